@@ -0,0 +1,250 @@
+/**
+ * Provides the TAssetHandler microbenchmarks.
+ *
+ * @file src/GQE/Bench/AssetBenchmarks.cpp
+ * @author Ryan Lindeman
+ * @date 20130803 - Initial Release
+ * @date 20130817 - Added AddReference+DropReference(slot) benchmark
+ * @date 20130818 - Added GetReference+DropReference(cached) benchmark
+ */
+
+#include <vector>
+#include <SFML/System.hpp>
+#include <TVBench/CoreBenchmarks.hpp>
+#include <TVSource/Interfaces/TAssetHandler.hpp>
+#include <TVSource/Utils/StringUtil.hpp>
+
+namespace GQE
+{
+  /// Provides an asset handler that never touches the disk
+  class BenchAssetHandler : public TAssetHandler<sf::Vector2f>
+  {
+    protected:
+      virtual bool LoadFromFile(const typeAssetID theAssetID, sf::Vector2f& theAsset)
+      {
+        return true;
+      }
+
+      virtual bool LoadFromMemory(const typeAssetID theAssetID, sf::Vector2f& theAsset)
+      {
+        return true;
+      }
+
+      virtual bool LoadFromNetwork(const typeAssetID theAssetID, sf::Vector2f& theAsset)
+      {
+        return true;
+      }
+  };
+
+  /**
+   * MakeAssetID will return a typical asset filename for theIndex provided.
+   * @param[in] theIndex of the asset
+   * @return the asset ID to use
+   */
+  static typeAssetID MakeAssetID(const Uint32 theIndex)
+  {
+    return "resources/Graphics/BenchSprite" + ConvertUint32(theIndex) + ".png";
+  }
+
+  /// Measures GetReference/DropReference of assets already held with N assets
+  class AssetHeldBenchmark : public IBenchmark
+  {
+    public:
+      AssetHeldBenchmark() :
+        IBenchmark("TAssetHandler::GetReference+DropReference(held)"),
+        mHandler(NULL),
+        mAssetIDs()
+      {
+      }
+
+      virtual void DoSetup(const Uint32 theSize)
+      {
+        mHandler = new(std::nothrow) BenchAssetHandler();
+
+        // Hold a reference to theSize assets so they are never released
+        mAssetIDs.reserve(theSize);
+        for(Uint32 iloop = 0; iloop < theSize; iloop++)
+        {
+          mAssetIDs.push_back(MakeAssetID(iloop));
+          mHandler->GetReference(mAssetIDs.back());
+        }
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        const size_t anSize = mAssetIDs.size();
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          const typeAssetID& anAssetID = mAssetIDs[iloop % anSize];
+          mHandler->GetReference(anAssetID);
+          mHandler->DropReference(anAssetID);
+        }
+        return theIterations;
+      }
+
+      virtual void DoTeardown(void)
+      {
+        // Our handler will release every asset still held
+        delete mHandler;
+        mHandler = NULL;
+        mAssetIDs.clear();
+      }
+
+    private:
+      /// The asset handler being measured
+      BenchAssetHandler*        mHandler;
+      /// The ID of each asset held
+      std::vector<typeAssetID>  mAssetIDs;
+  };
+
+  /// Measures AddReference/DropReference by slot of assets already held with N assets
+  class AssetSlotBenchmark : public IBenchmark
+  {
+    public:
+      AssetSlotBenchmark() :
+        IBenchmark("TAssetHandler::AddReference+DropReference(slot)"),
+        mHandler(NULL),
+        mSlots()
+      {
+      }
+
+      virtual void DoSetup(const Uint32 theSize)
+      {
+        mHandler = new(std::nothrow) BenchAssetHandler();
+
+        // Hold a reference to theSize assets so they are never released
+        mSlots.reserve(theSize);
+        for(Uint32 iloop = 0; iloop < theSize; iloop++)
+        {
+          mSlots.push_back(mHandler->GetSlot(MakeAssetID(iloop)));
+        }
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        const size_t anSize = mSlots.size();
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          BenchAssetHandler::typeAssetSlot* anSlot = mSlots[iloop % anSize];
+          mHandler->AddReference(anSlot);
+          mHandler->DropReference(anSlot);
+        }
+        return theIterations;
+      }
+
+      virtual void DoTeardown(void)
+      {
+        // Our handler will release every asset still held
+        delete mHandler;
+        mHandler = NULL;
+        mSlots.clear();
+      }
+
+    private:
+      /// The asset handler being measured
+      BenchAssetHandler*                               mHandler;
+      /// The slot of each asset held
+      std::vector<BenchAssetHandler::typeAssetSlot*>   mSlots;
+  };
+
+  /// Measures GetReference/DropReference that acquire and release the asset
+  class AssetAcquireBenchmark : public IBenchmark
+  {
+    public:
+      AssetAcquireBenchmark() :
+        IBenchmark("TAssetHandler::GetReference+DropReference(acquire)"),
+        mHandler(),
+        mAssetID(MakeAssetID(0))
+      {
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          mHandler.GetReference(mAssetID);
+          mHandler.DropReference(mAssetID);
+        }
+        return theIterations;
+      }
+
+    private:
+      /// The asset handler being measured
+      BenchAssetHandler mHandler;
+      /// The ID of the asset acquired and released
+      const typeAssetID mAssetID;
+  };
+
+  /// Measures GetReference/DropReference that revive the asset from the cache
+  class AssetCachedBenchmark : public IBenchmark
+  {
+    public:
+      AssetCachedBenchmark() :
+        IBenchmark("TAssetHandler::GetReference+DropReference(cached)"),
+        mHandler(),
+        mAssetID(MakeAssetID(0))
+      {
+      }
+
+      virtual void DoSetup(const Uint32 theSize)
+      {
+        // Load the asset once so it is kept in the cache when dropped
+        mHandler.SetCacheBudget(1024 * 1024);
+        mHandler.GetReference(mAssetID, AssetLoadNow);
+        mHandler.DropReference(mAssetID);
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          mHandler.GetReference(mAssetID);
+          mHandler.DropReference(mAssetID);
+        }
+        return theIterations;
+      }
+
+      virtual void DoTeardown(void)
+      {
+        // Evict the cached asset so every run starts the same way
+        mHandler.SetCacheBudget(0);
+      }
+
+    private:
+      /// The asset handler being measured
+      BenchAssetHandler mHandler;
+      /// The ID of the asset revived from the cache
+      const typeAssetID mAssetID;
+  };
+
+  void RegisterAssetBenchmarks(BenchmarkRunner& theRunner)
+  {
+    theRunner.AddBenchmark(new(std::nothrow) AssetHeldBenchmark())
+      .AddSize(10).AddSize(100).AddSize(1000);
+    theRunner.AddBenchmark(new(std::nothrow) AssetSlotBenchmark())
+      .AddSize(10).AddSize(100).AddSize(1000);
+    theRunner.AddBenchmark(new(std::nothrow) AssetAcquireBenchmark());
+    theRunner.AddBenchmark(new(std::nothrow) AssetCachedBenchmark());
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,58 @@
+/**
+ * Provides the GQE Bench typedef's and forward class declarations.
+ *
+ * @file include/GQE/Bench/Bench_types.hpp
+ * @author Ryan Lindeman
+ * @date 20130804 - Initial Release
+ */
+#ifndef   BENCH_TYPES_HPP_INCLUDED
+#define   BENCH_TYPES_HPP_INCLUDED
+
+#include <string>
+#include <TVSource/Core/Core_types.hpp>
+
+namespace GQE
+{
+  /// Provides the measurement results of a single benchmark and size
+  struct typeBenchmarkResult
+  {
+    std::string name;        ///< Benchmark name including the size (e.g. ISystem::HasEntity/1000)
+    Uint64      iterations;  ///< Number of iterations used by each repetition
+    Uint64      operations;  ///< Number of operations performed by each repetition
+    Uint32      repetitions; ///< Number of repetitions measured
+    double      nsPerOp;     ///< Median nanoseconds spent per operation
+    double      nsP95;       ///< 95th percentile nanoseconds spent per operation
+    double      nsMin;       ///< Fastest nanoseconds spent per operation
+    double      cv;          ///< Coefficient of variation in percent of each repetition
+    double      allocsPerOp; ///< Heap allocations made per operation
+    double      bytesPerOp;  ///< Heap bytes allocated per operation
+  };
+
+  // Forward declare GQE bench classes provided
+  class BenchmarkBaseline;
+  class BenchmarkRunner;
+  class IBenchmark;
+} // namespace GQE
+
+#endif // BENCH_TYPES_HPP_INCLUDED
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,310 @@
+/**
+ * Provides the BenchmarkBaseline class which is responsible for saving the
+ * benchmark results of a machine profile and comparing new results against
+ * them to detect performance regressions.
+ *
+ * @file src/GQE/Bench/BenchmarkBaseline.cpp
+ * @author Ryan Lindeman
+ * @date 20130804 - Initial Release
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <TVBench/BenchmarkBaseline.hpp>
+#if defined(GQE_WINDOWS)
+#include <windows.h>
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace GQE
+{
+  /// Default directory where each machine profile baseline is stored
+  const char* BenchmarkBaseline::DEFAULT_DIRECTORY = "baselines";
+  /// Default median regression tolerance in percent
+  const float BenchmarkBaseline::DEFAULT_MEDIAN_TOLERANCE = 5.0f;
+  /// Default 95th percentile regression tolerance in percent
+  const float BenchmarkBaseline::DEFAULT_P95_TOLERANCE = 10.0f;
+
+  BenchmarkBaseline::BenchmarkBaseline() :
+    mResults()
+  {
+  }
+
+  BenchmarkBaseline::~BenchmarkBaseline()
+  {
+  }
+
+  bool BenchmarkBaseline::LoadFromFile(const std::string theFilename)
+  {
+    // Assume the baseline could not be loaded
+    bool anResult = false;
+
+    // Try to open the baseline file for reading
+    std::ifstream anFile(theFilename.c_str());
+    if(anFile.is_open())
+    {
+      // Remove any results previously loaded
+      mResults.clear();
+
+      // Each benchmark result is written on a line of its own
+      std::string anLine;
+      while(std::getline(anFile, anLine))
+      {
+        // Find the name of the benchmark on this line
+        const std::string anKey = "\"name\": \"";
+        size_t anStart = anLine.find(anKey);
+        if(anStart == std::string::npos)
+        {
+          continue;
+        }
+        anStart += anKey.length();
+        size_t anEnd = anLine.find('"', anStart);
+        if(anEnd == std::string::npos)
+        {
+          continue;
+        }
+
+        // Retrieve each value of this benchmark result
+        typeBenchmarkResult anBaseline;
+        anBaseline.name = anLine.substr(anStart, anEnd - anStart);
+        anBaseline.iterations = (Uint64)ParseNumber(anLine, "iterations", 0.0);
+        anBaseline.operations = (Uint64)ParseNumber(anLine, "operations", 0.0);
+        anBaseline.repetitions = (Uint32)ParseNumber(anLine, "repetitions", 1.0);
+        anBaseline.nsPerOp = ParseNumber(anLine, "ns_per_op", 0.0);
+        anBaseline.nsP95 = ParseNumber(anLine, "p95_ns_per_op", anBaseline.nsPerOp);
+        anBaseline.nsMin = ParseNumber(anLine, "min_ns_per_op", anBaseline.nsPerOp);
+        anBaseline.cv = ParseNumber(anLine, "cv_percent", 0.0);
+        anBaseline.allocsPerOp = ParseNumber(anLine, "allocs_per_op", 0.0);
+        anBaseline.bytesPerOp = ParseNumber(anLine, "bytes_per_op", 0.0);
+        mResults[anBaseline.name] = anBaseline;
+      }
+
+      // Baseline was loaded if it contained at least one result
+      anResult = !mResults.empty();
+
+      // Close the baseline file
+      anFile.close();
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  Uint32 BenchmarkBaseline::Compare(const std::vector<typeBenchmarkResult>& theResults,
+    const float theMedianTolerance, const float theP95Tolerance,
+    std::ostream& theStream) const
+  {
+    // Number of benchmarks that have regressed
+    Uint32 anResult = 0;
+
+    // Write our diff table header
+    theStream << std::left << std::setw(56) << "benchmark"
+      << std::right << std::setw(12) << "base ns"
+      << std::setw(12) << "new ns"
+      << std::setw(10) << "median"
+      << std::setw(12) << "base p95"
+      << std::setw(12) << "new p95"
+      << std::setw(10) << "p95"
+      << std::setw(8) << "cv%"
+      << "  status" << std::endl;
+
+    for(size_t iloop = 0; iloop < theResults.size(); iloop++)
+    {
+      const typeBenchmarkResult& anNew = theResults[iloop];
+
+      // Benchmarks that are not in our baseline can't regress
+      std::map<const std::string, typeBenchmarkResult>::const_iterator anIter;
+      anIter = mResults.find(anNew.name);
+      if(anIter == mResults.end())
+      {
+        theStream << std::left << std::setw(56) << anNew.name
+          << std::right << std::fixed << std::setprecision(1)
+          << std::setw(12) << "-"
+          << std::setw(12) << anNew.nsPerOp
+          << std::setw(10) << "-"
+          << std::setw(12) << "-"
+          << std::setw(12) << anNew.nsP95
+          << std::setw(10) << "-"
+          << std::setw(8) << anNew.cv
+          << "  new" << std::endl;
+        continue;
+      }
+      const typeBenchmarkResult& anBase = anIter->second;
+
+      // Compute the change in percent of the median and 95th percentile
+      double anMedianDelta = 0.0;
+      if(anBase.nsPerOp > 0.0)
+      {
+        anMedianDelta = (anNew.nsPerOp - anBase.nsPerOp) * 100.0 / anBase.nsPerOp;
+      }
+      double anP95Delta = 0.0;
+      if(anBase.nsP95 > 0.0)
+      {
+        anP95Delta = (anNew.nsP95 - anBase.nsP95) * 100.0 / anBase.nsP95;
+      }
+
+      // Determine if this benchmark has regressed or improved
+      const char* anStatus = "ok";
+      if(anMedianDelta > theMedianTolerance || anP95Delta > theP95Tolerance)
+      {
+        anStatus = "REGRESSED";
+        anResult++;
+      }
+      else if(anNew.allocsPerOp > anBase.allocsPerOp * 1.01 + 0.01)
+      {
+        anStatus = "REGRESSED(allocs)";
+        anResult++;
+      }
+      else if(anMedianDelta < -theMedianTolerance)
+      {
+        anStatus = "improved";
+      }
+
+      theStream << std::left << std::setw(56) << anNew.name
+        << std::right << std::fixed << std::setprecision(1)
+        << std::setw(12) << anBase.nsPerOp
+        << std::setw(12) << anNew.nsPerOp
+        << std::setw(9) << std::showpos << anMedianDelta << "%"
+        << std::setw(12) << std::noshowpos << anBase.nsP95
+        << std::setw(12) << anNew.nsP95
+        << std::setw(9) << std::showpos << anP95Delta << "%"
+        << std::setw(8) << std::noshowpos << anNew.cv
+        << "  " << anStatus << std::endl;
+    }
+
+    // Write a summary of the comparison
+    theStream << anResult << " of " << theResults.size()
+      << " benchmarks regressed (median tolerance " << theMedianTolerance
+      << "%, p95 tolerance " << theP95Tolerance << "%)" << std::endl;
+
+    // Return the number of regressions found above
+    return anResult;
+  }
+
+  bool BenchmarkBaseline::SaveToFile(const std::string theFilename,
+    const std::string theProfile,
+    const std::vector<typeBenchmarkResult>& theResults)
+  {
+    // Assume the results could not be written
+    bool anResult = false;
+
+    // Try to open the results file for writing
+    std::ofstream anFile(theFilename.c_str(), std::ios::out | std::ios::trunc);
+    if(anFile.is_open())
+    {
+      anFile << "{" << std::endl;
+      anFile << "  \"profile\": \"" << theProfile << "\"," << std::endl;
+      anFile << "  \"benchmarks\": [" << std::endl;
+
+      // Write the result of each benchmark and size run, one per line
+      for(size_t iloop = 0; iloop < theResults.size(); iloop++)
+      {
+        anFile << "    { \"name\": \"" << theResults[iloop].name << "\""
+          << ", \"iterations\": " << theResults[iloop].iterations
+          << ", \"operations\": " << theResults[iloop].operations
+          << ", \"repetitions\": " << theResults[iloop].repetitions
+          << ", \"ns_per_op\": " << theResults[iloop].nsPerOp
+          << ", \"p95_ns_per_op\": " << theResults[iloop].nsP95
+          << ", \"min_ns_per_op\": " << theResults[iloop].nsMin
+          << ", \"cv_percent\": " << theResults[iloop].cv
+          << ", \"allocs_per_op\": " << theResults[iloop].allocsPerOp
+          << ", \"bytes_per_op\": " << theResults[iloop].bytesPerOp
+          << " }" << (iloop + 1 < theResults.size() ? "," : "") << std::endl;
+      }
+
+      anFile << "  ]" << std::endl;
+      anFile << "}" << std::endl;
+
+      // Results were written if the stream is still good
+      anResult = anFile.good();
+
+      // Close the results file
+      anFile.close();
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  std::string BenchmarkBaseline::GetFilename(const std::string theDirectory,
+    const std::string theProfile)
+  {
+    // Make sure theDirectory exists (it is fine if it already does)
+#if defined(GQE_WINDOWS)
+    _mkdir(theDirectory.c_str());
+#else
+    mkdir(theDirectory.c_str(), 0755);
+#endif
+
+    // Return the baseline filename for theProfile provided
+    return theDirectory + "/" + theProfile + ".json";
+  }
+
+  std::string BenchmarkBaseline::GetDefaultProfile(void)
+  {
+    // Default to "default" if the host name can't be determined
+    std::string anResult = "default";
+
+#if defined(GQE_WINDOWS)
+    char anName[MAX_COMPUTERNAME_LENGTH + 1];
+    DWORD anLength = sizeof(anName);
+    if(GetComputerNameA(anName, &anLength))
+    {
+      anResult = std::string(anName, anLength);
+    }
+#else
+    char anName[256];
+    if(gethostname(anName, sizeof(anName)) == 0)
+    {
+      anName[sizeof(anName) - 1] = '\0';
+      anResult = anName;
+    }
+#endif
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  double BenchmarkBaseline::ParseNumber(const std::string& theLine, const char* theKey,
+    const double theDefault)
+  {
+    double anResult = theDefault;
+
+    // Look for "theKey": followed by the number
+    std::string anKey = std::string("\"") + theKey + "\":";
+    size_t anOffset = theLine.find(anKey);
+    if(anOffset != std::string::npos)
+    {
+      anResult = strtod(theLine.c_str() + anOffset + anKey.length(), NULL);
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
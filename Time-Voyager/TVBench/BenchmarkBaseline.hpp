@@ -0,0 +1,162 @@
+/**
+ * Provides the BenchmarkBaseline class which is responsible for saving the
+ * benchmark results of a machine profile and comparing new results against
+ * them to detect performance regressions.
+ *
+ * @file include/GQE/Bench/BenchmarkBaseline.hpp
+ * @author Ryan Lindeman
+ * @date 20130804 - Initial Release
+ */
+#ifndef   BENCH_BENCHMARK_BASELINE_HPP_INCLUDED
+#define   BENCH_BENCHMARK_BASELINE_HPP_INCLUDED
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <TVBench/Bench_types.hpp>
+
+namespace GQE
+{
+  /// Provides the baseline results of a machine profile
+  class BenchmarkBaseline
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Default directory where each machine profile baseline is stored
+      static const char* DEFAULT_DIRECTORY;
+      /// Default median regression tolerance in percent
+      static const float DEFAULT_MEDIAN_TOLERANCE;
+      /// Default 95th percentile regression tolerance in percent
+      static const float DEFAULT_P95_TOLERANCE;
+
+      /**
+       * BenchmarkBaseline constructor
+       */
+      BenchmarkBaseline();
+
+      /**
+       * BenchmarkBaseline deconstructor
+       */
+      virtual ~BenchmarkBaseline();
+
+      /**
+       * LoadFromFile will load the baseline results previously written by the
+       * SaveToFile method.
+       * @param[in] theFilename to load the baseline results from
+       * @return true if the baseline was loaded, false otherwise
+       */
+      bool LoadFromFile(const std::string theFilename);
+
+      /**
+       * Compare will compare theResults provided against the baseline
+       * results loaded and write a diff table to theStream provided. A
+       * benchmark has regressed if its median or 95th percentile time grew
+       * by more than the tolerance provided or if it makes more allocations.
+       * @param[in] theResults to compare against the baseline
+       * @param[in] theMedianTolerance in percent for the median time
+       * @param[in] theP95Tolerance in percent for the 95th percentile time
+       * @param[in] theStream to write the diff table to
+       * @return the number of benchmarks that have regressed
+       */
+      Uint32 Compare(const std::vector<typeBenchmarkResult>& theResults,
+        const float theMedianTolerance, const float theP95Tolerance,
+        std::ostream& theStream) const;
+
+      /**
+       * SaveToFile will write theResults provided for theProfile provided as
+       * JSON so they can be used as the baseline of future runs.
+       * @param[in] theFilename to write the results to
+       * @param[in] theProfile name of the machine the results were taken on
+       * @param[in] theResults to write
+       * @return true if the results were written, false otherwise
+       */
+      static bool SaveToFile(const std::string theFilename,
+        const std::string theProfile,
+        const std::vector<typeBenchmarkResult>& theResults);
+
+      /**
+       * GetFilename will return the baseline filename to use for theProfile
+       * provided in theDirectory provided and create theDirectory if needed.
+       * @param[in] theDirectory where baselines are stored
+       * @param[in] theProfile name of the machine
+       * @return the baseline filename for theProfile
+       */
+      static std::string GetFilename(const std::string theDirectory,
+        const std::string theProfile);
+
+      /**
+       * GetDefaultProfile will return the name of the machine we are running
+       * on which is used as the default machine profile name.
+       * @return the host name of this machine or "default" if unknown
+       */
+      static std::string GetDefaultProfile(void);
+
+    private:
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// The baseline results loaded indexed by benchmark name
+      std::map<const std::string, typeBenchmarkResult> mResults;
+
+      /**
+       * ParseNumber will return the number that follows theKey provided in
+       * theLine provided.
+       * @param[in] theLine to search
+       * @param[in] theKey to find (e.g. "ns_per_op")
+       * @param[in] theDefault to return if theKey was not found
+       * @return the number found or theDefault
+       */
+      static double ParseNumber(const std::string& theLine, const char* theKey,
+        const double theDefault);
+
+      /**
+       * BenchmarkBaseline copy constructor is private because we do not allow
+       * copies of our class
+       */
+      BenchmarkBaseline(const BenchmarkBaseline&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      BenchmarkBaseline& operator=(const BenchmarkBaseline&); // Intentionally undefined
+  }; // class BenchmarkBaseline
+} // namespace GQE
+
+#endif // BENCH_BENCHMARK_BASELINE_HPP_INCLUDED
+
+/**
+ * @class GQE::BenchmarkBaseline
+ * @ingroup Bench
+ * The BenchmarkBaseline class stores the results of a benchmark run as the
+ * baseline of a machine profile (baselines/<profile>.json by default, where
+ * the profile defaults to the host name). Later runs are compared against it:
+ *
+ *   Time-Voyager-Bench --save-baseline --profile=ci-win32
+ *   Time-Voyager-Bench --compare --profile=ci-win32 --tolerance-median=5
+ *
+ * The comparison prints a diff table with the median and 95th percentile
+ * change of each benchmark and the Time-Voyager-Bench program exits with a
+ * non-zero exit code if any benchmark regressed. Only the JSON written by
+ * SaveToFile (one benchmark per line) is understood by LoadFromFile.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,491 @@
+/**
+ * Provides the BenchmarkRunner class which is responsible for running each
+ * registered IBenchmark class and reporting the time and allocations spent
+ * per operation.
+ *
+ * @file src/GQE/Bench/BenchmarkRunner.cpp
+ * @author Ryan Lindeman
+ * @date 20130803 - Initial Release
+ * @date 20130804 - Add repetitions, CPU pinning and baseline comparison
+ * @date 20130808 - Count allocations with AllocTracker instead of AllocCounter
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <SFML/System.hpp>
+#include <TVBench/BenchmarkBaseline.hpp>
+#include <TVBench/BenchmarkRunner.hpp>
+#include <TVSource/Utils/AllocTracker.hpp>
+#include <TVSource/Utils/StringUtil.hpp>
+#if defined(GQE_WINDOWS)
+#include <windows.h>
+#elif defined(GQE_LINUX)
+#include <sched.h>
+#endif
+
+namespace GQE
+{
+  BenchmarkRunner::BenchmarkRunner() :
+    mBenchmarks(),
+    mResults(),
+    mFilter(),
+    mReport(),
+    mProfile(BenchmarkBaseline::GetDefaultProfile()),
+    mBaselineDir(BenchmarkBaseline::DEFAULT_DIRECTORY),
+    mMinTime(DEFAULT_MIN_TIME),
+    mWarmup(DEFAULT_WARMUP),
+    mRepetitions(DEFAULT_REPETITIONS),
+    mPinCPU(-1),
+    mMedianTolerance(BenchmarkBaseline::DEFAULT_MEDIAN_TOLERANCE),
+    mP95Tolerance(BenchmarkBaseline::DEFAULT_P95_TOLERANCE),
+    mList(false),
+    mSaveBaseline(false),
+    mCompare(false)
+  {
+  }
+
+  BenchmarkRunner::~BenchmarkRunner()
+  {
+    // Delete every benchmark registered
+    std::vector<IBenchmark*>::iterator anIter = mBenchmarks.begin();
+    while(anIter != mBenchmarks.end())
+    {
+      // Get the benchmark to delete
+      IBenchmark* anBenchmark = *anIter;
+
+      // Increment our iterator first
+      anIter++;
+
+      // Delete the benchmark
+      delete anBenchmark;
+
+      // Don't keep pointers to objects we have just deleted
+      anBenchmark = NULL;
+    }
+
+    // Last of all clear our list of benchmarks
+    mBenchmarks.clear();
+  }
+
+  bool BenchmarkRunner::ProcessArgument(const std::string theArgument)
+  {
+    // Assume theArgument provided is one of ours
+    bool anResult = true;
+
+    // Split theArgument into its --name and value portions
+    size_t anEquals = theArgument.find('=');
+    std::string anName = theArgument.substr(0, anEquals);
+    std::string anValue;
+    if(anEquals != std::string::npos)
+    {
+      anValue = theArgument.substr(anEquals + 1);
+    }
+
+    if(anName == "--filter")
+    {
+      mFilter = anValue;
+    }
+    else if(anName == "--min-time")
+    {
+      mMinTime = ParseUint32(anValue, DEFAULT_MIN_TIME);
+    }
+    else if(anName == "--json" && !anValue.empty())
+    {
+      mReport = anValue;
+    }
+    else if(anName == "--list")
+    {
+      mList = true;
+    }
+    else if(anName == "--warmup")
+    {
+      mWarmup = ParseUint32(anValue, DEFAULT_WARMUP);
+    }
+    else if(anName == "--repetitions")
+    {
+      mRepetitions = ParseUint32(anValue, DEFAULT_REPETITIONS);
+
+      // At least one repetition is always measured
+      if(mRepetitions == 0)
+      {
+        mRepetitions = 1;
+      }
+    }
+    else if(anName == "--pin")
+    {
+      // Default to the first CPU if no CPU was provided
+      mPinCPU = (Int32)ParseUint32(anValue, 0);
+    }
+    else if(anName == "--profile" && !anValue.empty())
+    {
+      mProfile = anValue;
+    }
+    else if(anName == "--baseline-dir" && !anValue.empty())
+    {
+      mBaselineDir = anValue;
+    }
+    else if(anName == "--save-baseline")
+    {
+      mSaveBaseline = true;
+    }
+    else if(anName == "--compare")
+    {
+      mCompare = true;
+    }
+    else if(anName == "--tolerance-median")
+    {
+      mMedianTolerance = ParseFloat(anValue, BenchmarkBaseline::DEFAULT_MEDIAN_TOLERANCE);
+    }
+    else if(anName == "--tolerance-p95")
+    {
+      mP95Tolerance = ParseFloat(anValue, BenchmarkBaseline::DEFAULT_P95_TOLERANCE);
+    }
+    else
+    {
+      // Not one of ours
+      anResult = false;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  IBenchmark& BenchmarkRunner::AddBenchmark(IBenchmark* theBenchmark)
+  {
+    mBenchmarks.push_back(theBenchmark);
+
+    // Return theBenchmark so sizes can be added
+    return *theBenchmark;
+  }
+
+  int BenchmarkRunner::Run(void)
+  {
+    // Assume all benchmarks will run successfully
+    int anResult = StatusAppOK;
+
+    // Write our table header unless we are only listing the names
+    if(!mList)
+    {
+      // Pin ourselves to a single CPU if requested
+      if(mPinCPU >= 0 && !PinThread())
+      {
+        std::cerr << "BenchmarkRunner::Run() unable to pin to CPU " << mPinCPU << std::endl;
+      }
+
+      std::cout << "profile=" << mProfile << ", min-time=" << mMinTime
+        << "ms, warmup=" << mWarmup << ", repetitions=" << mRepetitions
+        << ", pin=" << mPinCPU << std::endl;
+      std::cout << std::left << std::setw(56) << "benchmark"
+        << std::right << std::setw(14) << "ns/op"
+        << std::setw(12) << "p95 ns/op"
+        << std::setw(8) << "cv%"
+        << std::setw(12) << "allocs/op"
+        << std::setw(12) << "bytes/op"
+        << std::setw(14) << "iterations" << std::endl;
+    }
+
+    for(size_t iloop = 0; iloop < mBenchmarks.size(); iloop++)
+    {
+      IBenchmark* anBenchmark = mBenchmarks[iloop];
+
+      // Run this benchmark for each of its problem sizes
+      std::vector<Uint32> anSizes = anBenchmark->GetSizes();
+      for(size_t jloop = 0; jloop < anSizes.size(); jloop++)
+      {
+        // Append the problem size to the name if one was provided
+        std::string anName = anBenchmark->GetName();
+        if(anSizes[jloop] > 0)
+        {
+          anName += "/" + ConvertUint32(anSizes[jloop]);
+        }
+
+        // Skip this benchmark if it doesn't match our filter
+        if(!mFilter.empty() && anName.find(mFilter) == std::string::npos)
+        {
+          continue;
+        }
+
+        if(mList)
+        {
+          std::cout << anName << std::endl;
+        }
+        else
+        {
+          typeBenchmarkResult anMeasurement;
+          anMeasurement.name = anName;
+
+          // Measure this benchmark and report the results
+          Measure(*anBenchmark, anSizes[jloop], anMeasurement);
+          WriteRow(std::cout, anMeasurement);
+          mResults.push_back(anMeasurement);
+        }
+      }
+    }
+
+    // Nothing else to do if we are only listing the names
+    if(mList)
+    {
+      return anResult;
+    }
+
+    // Write the JSON report if one was requested
+    if(!mReport.empty() &&
+      !BenchmarkBaseline::SaveToFile(mReport, mProfile, mResults))
+    {
+      std::cerr << "BenchmarkRunner::Run() unable to write " << mReport << std::endl;
+      anResult = StatusError;
+    }
+
+    // Compare our results against the baseline of our profile if requested
+    const std::string anBaselineFile = BenchmarkBaseline::GetFilename(mBaselineDir, mProfile);
+    if(mCompare)
+    {
+      BenchmarkBaseline anBaseline;
+      if(anBaseline.LoadFromFile(anBaselineFile))
+      {
+        std::cout << std::endl << "baseline " << anBaselineFile << std::endl;
+        if(anBaseline.Compare(mResults, mMedianTolerance, mP95Tolerance, std::cout) > 0)
+        {
+          anResult = StatusError;
+        }
+      }
+      else
+      {
+        std::cerr << "BenchmarkRunner::Run() unable to load baseline "
+          << anBaselineFile << std::endl;
+        anResult = StatusError;
+      }
+    }
+
+    // Save our results as the new baseline of our profile if requested
+    if(mSaveBaseline)
+    {
+      if(BenchmarkBaseline::SaveToFile(anBaselineFile, mProfile, mResults))
+      {
+        std::cout << "saved baseline " << anBaselineFile << std::endl;
+      }
+      else
+      {
+        std::cerr << "BenchmarkRunner::Run() unable to write baseline "
+          << anBaselineFile << std::endl;
+        anResult = StatusError;
+      }
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  const std::vector<typeBenchmarkResult>& BenchmarkRunner::GetResults(void) const
+  {
+    return mResults;
+  }
+
+  void BenchmarkRunner::Measure(IBenchmark& theBenchmark, const Uint32 theSize,
+    typeBenchmarkResult& theResult) const
+  {
+    // Minimum time to measure for in microseconds
+    const Int64 anMinTime = (Int64)mMinTime * 1000;
+
+    // Prepare theBenchmark for theSize provided
+    theBenchmark.DoSetup(theSize);
+
+    // Calibrate the iterations needed to reach our minimum time
+    Uint64 anIterations = 1;
+    while(true)
+    {
+      // Time how long it takes to run the requested iterations
+      sf::Clock anClock;
+      theBenchmark.DoRun((Uint32)anIterations);
+      Int64 anElapsed = anClock.getElapsedTime().asMicroseconds();
+
+      // Stop once we have measured for long enough
+      if(anElapsed >= anMinTime || anIterations >= MAX_ITERATIONS)
+      {
+        break;
+      }
+
+      // Estimate the iterations needed to reach our minimum time (plus 20%)
+      Uint64 anNext = anIterations * 10;
+      if(anElapsed > 0)
+      {
+        anNext = anIterations * (Uint64)anMinTime * 6 / 5 / (Uint64)anElapsed;
+      }
+
+      // Grow by at least 2 and at most 10 times each pass
+      if(anNext < anIterations * 2)
+      {
+        anNext = anIterations * 2;
+      }
+      if(anNext > anIterations * 10)
+      {
+        anNext = anIterations * 10;
+      }
+      if(anNext > MAX_ITERATIONS)
+      {
+        anNext = MAX_ITERATIONS;
+      }
+      anIterations = anNext;
+    }
+
+    // Run each warmup requested without measuring it
+    for(Uint32 iloop = 0; iloop < mWarmup; iloop++)
+    {
+      theBenchmark.DoRun((Uint32)anIterations);
+    }
+
+    // Measure each repetition using the same number of iterations
+    std::vector<double> anSamples;
+    Uint64 anOperations = 0;
+    Uint64 anAllocs = 0;
+    Uint64 anBytes = 0;
+    for(Uint32 iloop = 0; iloop < mRepetitions; iloop++)
+    {
+      // Take note of the allocations made before running the benchmark
+      Uint64 anAllocStart = AllocTracker::GetAllocCount();
+      Uint64 anBytesStart = AllocTracker::GetAllocBytes();
+
+      // Time how long it takes to run the requested iterations
+      sf::Clock anClock;
+      anOperations = theBenchmark.DoRun((Uint32)anIterations);
+      Int64 anElapsed = anClock.getElapsedTime().asMicroseconds();
+
+      // Compute the allocations made while running the benchmark
+      anAllocs = AllocTracker::GetAllocCount() - anAllocStart;
+      anBytes = AllocTracker::GetAllocBytes() - anBytesStart;
+
+      // Never divide by zero below
+      if(anOperations == 0)
+      {
+        anOperations = 1;
+      }
+
+      // Record the nanoseconds per operation of this repetition
+      anSamples.push_back((double)anElapsed * 1000.0 / (double)anOperations);
+    }
+
+    // Release everything created for theSize provided
+    theBenchmark.DoTeardown();
+
+    // Compute the mean and standard deviation of each repetition
+    double anMean = 0.0;
+    for(size_t iloop = 0; iloop < anSamples.size(); iloop++)
+    {
+      anMean += anSamples[iloop];
+    }
+    anMean /= (double)anSamples.size();
+    double anVariance = 0.0;
+    for(size_t iloop = 0; iloop < anSamples.size(); iloop++)
+    {
+      anVariance += (anSamples[iloop] - anMean) * (anSamples[iloop] - anMean);
+    }
+    if(anSamples.size() > 1)
+    {
+      anVariance /= (double)(anSamples.size() - 1);
+    }
+
+    // Sort the samples so we can compute the percentiles
+    std::sort(anSamples.begin(), anSamples.end());
+
+    // Store our measurements as our result
+    theResult.iterations = anIterations;
+    theResult.operations = anOperations;
+    theResult.repetitions = mRepetitions;
+    theResult.nsPerOp = GetPercentile(anSamples, 50.0f);
+    theResult.nsP95 = GetPercentile(anSamples, 95.0f);
+    theResult.nsMin = anSamples.front();
+    theResult.cv = anMean > 0.0 ? sqrt(anVariance) * 100.0 / anMean : 0.0;
+    theResult.allocsPerOp = (double)anAllocs / (double)anOperations;
+    theResult.bytesPerOp = (double)anBytes / (double)anOperations;
+  }
+
+  void BenchmarkRunner::WriteRow(std::ostream& theStream, const typeBenchmarkResult& theResult)
+  {
+    theStream << std::left << std::setw(56) << theResult.name
+      << std::right << std::fixed
+      << std::setw(14) << std::setprecision(1) << theResult.nsPerOp
+      << std::setw(12) << std::setprecision(1) << theResult.nsP95
+      << std::setw(8) << std::setprecision(1) << theResult.cv
+      << std::setw(12) << std::setprecision(2) << theResult.allocsPerOp
+      << std::setw(12) << std::setprecision(1) << theResult.bytesPerOp
+      << std::setw(14) << theResult.iterations << std::endl;
+  }
+
+  bool BenchmarkRunner::PinThread(void) const
+  {
+    // Assume the thread could not be pinned
+    bool anResult = false;
+
+#if defined(GQE_WINDOWS)
+    // Pin ourselves to the CPU requested and raise our priority
+    if(SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << mPinCPU) != 0)
+    {
+      SetPriorityClass(GetCurrentProcess(), HIGH_PRIORITY_CLASS);
+      SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_HIGHEST);
+      anResult = true;
+    }
+#elif defined(GQE_LINUX)
+    // Pin ourselves to the CPU requested
+    cpu_set_t anSet;
+    CPU_ZERO(&anSet);
+    CPU_SET(mPinCPU, &anSet);
+    anResult = (sched_setaffinity(0, sizeof(anSet), &anSet) == 0);
+#endif
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  double BenchmarkRunner::GetPercentile(const std::vector<double>& theSamples,
+    const float thePercentile)
+  {
+    // Default to 0 if no samples are available
+    double anResult = 0.0;
+
+    if(!theSamples.empty())
+    {
+      // Use the nearest rank method to find the sample index
+      size_t anIndex = (size_t)ceil((thePercentile / 100.0f) * (float)theSamples.size());
+
+      // Nearest rank is 1 based, so step back one unless we are at the first
+      if(anIndex > 0)
+      {
+        anIndex--;
+      }
+
+      // Clamp to the last sample available
+      if(anIndex >= theSamples.size())
+      {
+        anIndex = theSamples.size() - 1;
+      }
+
+      anResult = theSamples[anIndex];
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,205 @@
+/**
+ * Provides the BenchmarkRunner class which is responsible for running each
+ * registered IBenchmark class and reporting the time and allocations spent
+ * per operation.
+ *
+ * @file include/GQE/Bench/BenchmarkRunner.hpp
+ * @author Ryan Lindeman
+ * @date 20130803 - Initial Release
+ * @date 20130804 - Add repetitions, CPU pinning and baseline comparison
+ */
+#ifndef   BENCH_BENCHMARK_RUNNER_HPP_INCLUDED
+#define   BENCH_BENCHMARK_RUNNER_HPP_INCLUDED
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include <TVSource/Core/Core_types.hpp>
+#include <TVBench/Bench_types.hpp>
+#include <TVBench/IBenchmark.hpp>
+
+namespace GQE
+{
+  /// Provides the runner for all registered microbenchmarks
+  class BenchmarkRunner
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Default minimum time in milliseconds to measure each benchmark for
+      static const Uint32 DEFAULT_MIN_TIME = 100;
+      /// Default number of untimed warmup runs after calibration
+      static const Uint32 DEFAULT_WARMUP = 1;
+      /// Default number of measured repetitions of each benchmark
+      static const Uint32 DEFAULT_REPETITIONS = 5;
+      /// Maximum number of iterations a benchmark will be run with
+      static const Uint32 MAX_ITERATIONS = 1000000000;
+
+      /**
+       * BenchmarkRunner constructor
+       */
+      BenchmarkRunner();
+
+      /**
+       * BenchmarkRunner deconstructor will delete every registered benchmark
+       */
+      virtual ~BenchmarkRunner();
+
+      /**
+       * ProcessArgument is responsible for parsing a single command line
+       * argument (e.g. --filter=ISystem, --min-time=500, --json=file.json,
+       * --list, --warmup=2, --repetitions=9, --pin=1, --profile=name,
+       * --baseline-dir=dir, --save-baseline, --compare, --tolerance-median=5
+       * or --tolerance-p95=10).
+       * @param[in] theArgument to parse
+       * @return true if theArgument was recognized, false otherwise
+       */
+      bool ProcessArgument(const std::string theArgument);
+
+      /**
+       * AddBenchmark will register theBenchmark provided to be run by this
+       * BenchmarkRunner which will delete it at destruction time.
+       * @param[in] theBenchmark to register
+       * @return a reference to theBenchmark so sizes can be added
+       */
+      IBenchmark& AddBenchmark(IBenchmark* theBenchmark);
+
+      /**
+       * Run is responsible for running every registered benchmark that
+       * matches the filter provided and printing the results to standard out
+       * and to the JSON report if requested.
+       * @return StatusAppOK if successful, StatusError if a benchmark has
+       * regressed or a report could not be written
+       */
+      int Run(void);
+
+      /**
+       * GetResults will return the results of every benchmark run so far.
+       * @return the vector of results collected by Run
+       */
+      const std::vector<typeBenchmarkResult>& GetResults(void) const;
+
+    private:
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// The benchmarks registered with this runner
+      std::vector<IBenchmark*>          mBenchmarks;
+      /// The results collected for each benchmark and size run
+      std::vector<typeBenchmarkResult>  mResults;
+      /// Only benchmarks whose name contains this filter will be run
+      std::string                       mFilter;
+      /// The filename to write the JSON report to (empty if none)
+      std::string                       mReport;
+      /// The machine profile name used for the baseline filename
+      std::string                       mProfile;
+      /// The directory where each machine profile baseline is stored
+      std::string                       mBaselineDir;
+      /// Minimum time in milliseconds to measure each repetition for
+      Uint32                            mMinTime;
+      /// Number of untimed warmup runs after calibration
+      Uint32                            mWarmup;
+      /// Number of measured repetitions of each benchmark
+      Uint32                            mRepetitions;
+      /// The CPU to pin the benchmark thread to (-1 for none)
+      Int32                             mPinCPU;
+      /// Median regression tolerance in percent
+      float                             mMedianTolerance;
+      /// 95th percentile regression tolerance in percent
+      float                             mP95Tolerance;
+      /// True if benchmark names should be listed instead of run
+      bool                              mList;
+      /// True if the results should be saved as the new baseline
+      bool                              mSaveBaseline;
+      /// True if the results should be compared against the baseline
+      bool                              mCompare;
+
+      /**
+       * Measure is responsible for calibrating the iterations needed for
+       * theBenchmark provided with theSize provided to reach the minimum time
+       * and then measuring each warmup and repetition requested.
+       * @param[in] theBenchmark to measure
+       * @param[in] theSize (N) to measure theBenchmark with
+       * @param[out] theResult of the measurement
+       */
+      void Measure(IBenchmark& theBenchmark, const Uint32 theSize,
+        typeBenchmarkResult& theResult) const;
+
+      /**
+       * WriteRow is responsible for writing theResult provided as a single
+       * row of the results table to theStream provided.
+       * @param[in] theStream to write the row to
+       * @param[in] theResult to write
+       */
+      static void WriteRow(std::ostream& theStream, const typeBenchmarkResult& theResult);
+
+      /**
+       * PinThread is responsible for pinning the benchmark thread to the CPU
+       * requested and raising its priority to reduce measurement noise.
+       * @return true if the thread was pinned, false otherwise
+       */
+      bool PinThread(void) const;
+
+      /**
+       * GetPercentile will return the sample found at thePercentile provided
+       * using the nearest rank method.
+       * @param[in] theSamples sorted in ascending order
+       * @param[in] thePercentile to find in the range of [0,100]
+       * @return the sample value at thePercentile provided
+       */
+      static double GetPercentile(const std::vector<double>& theSamples,
+        const float thePercentile);
+
+      /**
+       * BenchmarkRunner copy constructor is private because we do not allow
+       * copies of our class
+       */
+      BenchmarkRunner(const BenchmarkRunner&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      BenchmarkRunner& operator=(const BenchmarkRunner&); // Intentionally undefined
+  }; // class BenchmarkRunner
+} // namespace GQE
+
+#endif // BENCH_BENCHMARK_RUNNER_HPP_INCLUDED
+
+/**
+ * @class GQE::BenchmarkRunner
+ * @ingroup Bench
+ * The BenchmarkRunner class runs each registered IBenchmark class for each of
+ * its problem sizes. The number of iterations is increased until a single
+ * call to DoRun takes at least the minimum time (100 ms by default), those
+ * calibration runs and the warmup runs requested are not measured. DoRun is
+ * then called once for each repetition (5 by default) with the same number
+ * of iterations and the median, 95th percentile, fastest and coefficient of
+ * variation of the nanoseconds per operation are reported along with the
+ * heap allocations and heap bytes per operation. For example:
+ *
+ *   Time-Voyager-Bench --filter=ISystem --min-time=500 --json=bench.json
+ *
+ * The --pin option pins the benchmark thread to a single CPU (0 by default)
+ * and raises its priority. The --save-baseline and --compare options use the
+ * BenchmarkBaseline class to store and check the results of each machine
+ * profile and Run returns StatusError if any benchmark regressed.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
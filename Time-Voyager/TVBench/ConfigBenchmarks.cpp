@@ -0,0 +1,154 @@
+/**
+ * Provides the ConfigReader microbenchmarks.
+ *
+ * @file src/GQE/Bench/ConfigBenchmarks.cpp
+ * @author Ryan Lindeman
+ * @date 20130803 - Initial Release
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <TVBench/CoreBenchmarks.hpp>
+#include <TVSource/Managers/ConfigReader.hpp>
+
+namespace GQE
+{
+  /// Filename of the configuration file generated for the ConfigReader benchmarks
+  static const char* BENCH_CONFIG_FILE = "bench-config.cfg";
+
+  /// Number of name=value lines written to each section
+  static const Uint32 BENCH_CONFIG_NAMES = 8;
+
+  /**
+   * WriteConfigFile will write a configuration file with theSections
+   * provided each containing BENCH_CONFIG_NAMES name=value lines.
+   * @param[in] theSections to write
+   * @return the total number of lines written
+   */
+  static Uint32 WriteConfigFile(const Uint32 theSections)
+  {
+    Uint32 anResult = 0;
+    std::ofstream anFile(BENCH_CONFIG_FILE, std::ios::out | std::ios::trunc);
+    for(Uint32 iloop = 0; iloop < theSections; iloop++)
+    {
+      anFile << "[section" << iloop << "]" << std::endl;
+      anFile << "; comment lines are skipped" << std::endl;
+      anResult += 2;
+      for(Uint32 jloop = 0; jloop < BENCH_CONFIG_NAMES; jloop++)
+      {
+        anFile << "name" << jloop << "=" << (iloop * 100 + jloop) << std::endl;
+        anResult++;
+      }
+    }
+    anFile.close();
+
+    // Return the total number of lines written
+    return anResult;
+  }
+
+  /// Measures ConfigReader::LoadFromFile per line read with N sections
+  class ConfigLoadBenchmark : public IBenchmark
+  {
+    public:
+      ConfigLoadBenchmark() :
+        IBenchmark("ConfigReader::LoadFromFile(per line)"),
+        mLines(0)
+      {
+      }
+
+      virtual void DoSetup(const Uint32 theSize)
+      {
+        mLines = WriteConfigFile(theSize);
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          // Includes deleting each section when anReader goes out of scope
+          ConfigReader anReader;
+          anReader.LoadFromFile(BENCH_CONFIG_FILE);
+        }
+        return (Uint64)theIterations * mLines;
+      }
+
+      virtual void DoTeardown(void)
+      {
+        std::remove(BENCH_CONFIG_FILE);
+      }
+
+    private:
+      /// The number of lines in the generated configuration file
+      Uint32 mLines;
+  };
+
+  /// Measures ConfigReader::GetUint32 with N sections loaded
+  class ConfigGetBenchmark : public IBenchmark
+  {
+    public:
+      ConfigGetBenchmark() :
+        IBenchmark("ConfigReader::GetUint32"),
+        mReader(NULL),
+        mSum(0)
+      {
+      }
+
+      virtual void DoSetup(const Uint32 theSize)
+      {
+        WriteConfigFile(theSize);
+        mReader = new(std::nothrow) ConfigReader();
+        mReader->LoadFromFile(BENCH_CONFIG_FILE);
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          mSum += mReader->GetUint32("section0", "name7", 0);
+        }
+        return theIterations;
+      }
+
+      virtual void DoTeardown(void)
+      {
+        delete mReader;
+        mReader = NULL;
+        std::remove(BENCH_CONFIG_FILE);
+      }
+
+    private:
+      /// The ConfigReader being measured
+      ConfigReader*   mReader;
+      /// Accumulates each value retrieved so the calls are not optimized away
+      volatile Uint32 mSum;
+  };
+
+  void RegisterConfigBenchmarks(BenchmarkRunner& theRunner)
+  {
+    theRunner.AddBenchmark(new(std::nothrow) ConfigLoadBenchmark())
+      .AddSize(10).AddSize(100).AddSize(1000);
+    theRunner.AddBenchmark(new(std::nothrow) ConfigGetBenchmark())
+      .AddSize(10).AddSize(1000);
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
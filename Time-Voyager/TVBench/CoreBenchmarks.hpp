@@ -0,0 +1,92 @@
+/**
+ * Provides the functions used to register each group of core engine
+ * microbenchmarks with the BenchmarkRunner class.
+ *
+ * @file include/GQE/Bench/CoreBenchmarks.hpp
+ * @author Ryan Lindeman
+ * @date 20130803 - Initial Release
+ */
+#ifndef   BENCH_CORE_BENCHMARKS_HPP_INCLUDED
+#define   BENCH_CORE_BENCHMARKS_HPP_INCLUDED
+
+#include <TVBench/BenchmarkRunner.hpp>
+
+namespace GQE
+{
+  /**
+   * RegisterPropertyBenchmarks will register the PropertyManager Get, Set,
+   * Add and Clone benchmarks.
+   * @param[in] theRunner to register the benchmarks with
+   */
+  void RegisterPropertyBenchmarks(BenchmarkRunner& theRunner);
+
+  /**
+   * RegisterEntityBenchmarks will register the ISystem AddEntity,
+   * DropEntity and HasEntity benchmarks and the Prototype MakeInstance and
+   * Destroy benchmarks at growing numbers of entities.
+   * @param[in] theRunner to register the benchmarks with
+   */
+  void RegisterEntityBenchmarks(BenchmarkRunner& theRunner);
+
+  /**
+   * RegisterEventBenchmarks will register the EventManager DoEvents and
+   * Post benchmarks at growing numbers of events.
+   * @param[in] theRunner to register the benchmarks with
+   */
+  void RegisterEventBenchmarks(BenchmarkRunner& theRunner);
+
+  /**
+   * RegisterAssetBenchmarks will register the TAssetHandler GetReference and
+   * DropReference benchmarks.
+   * @param[in] theRunner to register the benchmarks with
+   */
+  void RegisterAssetBenchmarks(BenchmarkRunner& theRunner);
+
+  /**
+   * RegisterConfigBenchmarks will register the ConfigReader LoadFromFile
+   * and lookup benchmarks.
+   * @param[in] theRunner to register the benchmarks with
+   */
+  void RegisterConfigBenchmarks(BenchmarkRunner& theRunner);
+
+  /**
+   * RegisterStringBenchmarks will register the StringUtil Parse and Convert
+   * function benchmarks.
+   * @param[in] theRunner to register the benchmarks with
+   */
+  void RegisterStringBenchmarks(BenchmarkRunner& theRunner);
+
+  /**
+   * RegisterLoggerBenchmarks will register the logging throughput
+   * benchmarks for each ILogger derived class.
+   * @param[in] theRunner to register the benchmarks with
+   */
+  void RegisterLoggerBenchmarks(BenchmarkRunner& theRunner);
+} // namespace GQE
+
+#endif // BENCH_CORE_BENCHMARKS_HPP_INCLUDED
+
+/**
+ * Each group of benchmarks is implemented in its own source file (e.g.
+ * EntityBenchmarks.cpp) and registered by the main function of the
+ * Time-Voyager-Bench program.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
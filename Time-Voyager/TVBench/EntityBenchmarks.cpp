@@ -0,0 +1,203 @@
+/**
+ * Provides the ISystem and Prototype microbenchmarks.
+ *
+ * @file src/GQE/Bench/EntityBenchmarks.cpp
+ * @author Ryan Lindeman
+ * @date 20130803 - Initial Release
+ */
+
+#include <vector>
+#include <TVBench/CoreBenchmarks.hpp>
+#include <TVSource/Entity/classes/Prototype.hpp>
+#include <TVSource/Entity/interfaces/IEntity.hpp>
+#include <TVSource/Entity/systems/MovementSystem.hpp>
+#include <TVSource/Interfaces/IApp.hpp>
+#include <TVSource/Utils/StringUtil.hpp>
+
+namespace GQE
+{
+  /// Provides the simplest IEntity possible for the ISystem benchmarks
+  class BenchEntity : public IEntity
+  {
+    public:
+      virtual void Destroy(void)
+      {
+        // Do nothing
+      }
+  };
+
+  /// Base class for the ISystem benchmarks which holds N entities
+  class SystemBenchmark : public IBenchmark
+  {
+    public:
+      SystemBenchmark(const std::string theName) :
+        IBenchmark(theName),
+        mSystem(NULL),
+        mEntities()
+      {
+      }
+
+      virtual void DoSetup(const Uint32 theSize)
+      {
+        mSystem = new(std::nothrow) MovementSystem(*IApp::GetApp());
+
+        // Add theSize entities to our system
+        mEntities.reserve(theSize);
+        for(Uint32 iloop = 0; iloop < theSize; iloop++)
+        {
+          IEntity* anEntity = new(std::nothrow) BenchEntity();
+          mSystem->AddEntity(anEntity);
+          mEntities.push_back(anEntity);
+        }
+      }
+
+      virtual void DoTeardown(void)
+      {
+        // Drop every entity from our system before deleting them
+        mSystem->DropAllEntities();
+        for(size_t iloop = 0; iloop < mEntities.size(); iloop++)
+        {
+          delete mEntities[iloop];
+        }
+        mEntities.clear();
+
+        // Delete our system last
+        delete mSystem;
+        mSystem = NULL;
+      }
+
+    protected:
+      /// The system being measured
+      ISystem*              mSystem;
+      /// The entities added to our system during setup
+      std::vector<IEntity*> mEntities;
+  };
+
+  /// Measures ISystem::AddEntity followed by ISystem::DropEntity with N entities
+  class SystemAddDropBenchmark : public SystemBenchmark
+  {
+    public:
+      SystemAddDropBenchmark() :
+        SystemBenchmark("ISystem::AddEntity+DropEntity")
+      {
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        BenchEntity anEntity;
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          mSystem->AddEntity(&anEntity);
+          mSystem->DropEntity(anEntity.GetID());
+        }
+        return theIterations;
+      }
+  };
+
+  /// Measures ISystem::HasEntity of the last entity added with N entities
+  class SystemHasBenchmark : public SystemBenchmark
+  {
+    public:
+      SystemHasBenchmark() :
+        SystemBenchmark("ISystem::HasEntity"),
+        mFound(0)
+      {
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        // The last entity added is the worst case for a linear search
+        const typeEntityID anEntityID = mEntities.empty() ? 0 : mEntities.back()->GetID();
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          mFound += mSystem->HasEntity(anEntityID) ? 1 : 0;
+        }
+        return theIterations;
+      }
+
+    private:
+      /// Counts each entity found so the calls are not optimized away
+      volatile Uint32 mFound;
+  };
+
+  /// Measures Prototype::MakeInstance of N instances followed by Prototype::Destroy
+  class PrototypeBenchmark : public IBenchmark
+  {
+    public:
+      PrototypeBenchmark() :
+        IBenchmark("Prototype::MakeInstance+Destroy"),
+        mSystem(NULL),
+        mPrototype(NULL),
+        mSize(0)
+      {
+      }
+
+      virtual void DoSetup(const Uint32 theSize)
+      {
+        mSize = theSize;
+        mSystem = new(std::nothrow) MovementSystem(*IApp::GetApp());
+        mPrototype = new(std::nothrow) Prototype("bench-" + ConvertUint32(theSize));
+        mPrototype->AddSystem(mSystem);
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          for(Uint32 jloop = 0; jloop < mSize; jloop++)
+          {
+            mPrototype->MakeInstance();
+          }
+          mPrototype->Destroy();
+        }
+        return (Uint64)theIterations * mSize;
+      }
+
+      virtual void DoTeardown(void)
+      {
+        delete mPrototype;
+        mPrototype = NULL;
+        delete mSystem;
+        mSystem = NULL;
+      }
+
+    private:
+      /// The system each Instance is added to
+      ISystem*   mSystem;
+      /// The prototype used to make each Instance
+      Prototype* mPrototype;
+      /// The number of instances to make each iteration
+      Uint32     mSize;
+  };
+
+  void RegisterEntityBenchmarks(BenchmarkRunner& theRunner)
+  {
+    theRunner.AddBenchmark(new(std::nothrow) SystemAddDropBenchmark())
+      .AddSize(100).AddSize(1000).AddSize(10000);
+    theRunner.AddBenchmark(new(std::nothrow) SystemHasBenchmark())
+      .AddSize(100).AddSize(1000).AddSize(10000);
+    theRunner.AddBenchmark(new(std::nothrow) PrototypeBenchmark())
+      .AddSize(100).AddSize(1000).AddSize(10000);
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
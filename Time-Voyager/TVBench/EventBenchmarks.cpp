@@ -0,0 +1,175 @@
+/**
+ * Provides the EventManager microbenchmarks.
+ *
+ * @file src/GQE/Bench/EventBenchmarks.cpp
+ * @author Ryan Lindeman
+ * @date 20130803 - Initial Release
+ * @date 20130825 - Added the EventManager::Post benchmark
+ */
+
+#include <TVBench/CoreBenchmarks.hpp>
+#include <TVSource/Managers/EventManager.hpp>
+#include <TVSource/Utils/StringUtil.hpp>
+
+namespace GQE
+{
+  /// Measures EventManager::DoEvents with N events registered
+  class EventBenchmark : public IBenchmark
+  {
+    public:
+      EventBenchmark() :
+        IBenchmark("EventManager::DoEvents"),
+        mEvents(NULL),
+        mCalls(0),
+        mSize(0)
+      {
+      }
+
+      virtual void DoSetup(const Uint32 theSize)
+      {
+        mSize = theSize;
+        mEvents = new(std::nothrow) EventManager();
+
+        // Register theSize events which all call our HandleEvent method
+        for(Uint32 iloop = 0; iloop < theSize; iloop++)
+        {
+          mEvents->Add<EventBenchmark>("event-" + ConvertUint32(iloop),
+            *this, &EventBenchmark::HandleEvent);
+        }
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          mEvents->DoEvents(this);
+        }
+        return (Uint64)theIterations * mSize;
+      }
+
+      virtual void DoTeardown(void)
+      {
+        delete mEvents;
+        mEvents = NULL;
+      }
+
+      /**
+       * HandleEvent is called for each event registered by DoEvents.
+       * @param[in] theContext provided to DoEvents
+       */
+      void HandleEvent(void* theContext)
+      {
+        mCalls++;
+      }
+
+    private:
+      /// The EventManager being measured
+      EventManager*   mEvents;
+      /// Counts each event handled so the calls are not optimized away
+      volatile Uint32 mCalls;
+      /// The number of events registered
+      Uint32          mSize;
+  };
+
+  /// Provides the event posted by the EventQueueBenchmark
+  struct typeBenchEvent
+  {
+    Uint32 id;    ///< Identifies the sender of the event
+    float  value; ///< Value carried by the event
+  };
+
+  /// Measures EventManager::Post and DispatchEvents with N events each frame
+  class EventQueueBenchmark : public IBenchmark
+  {
+    public:
+      EventQueueBenchmark() :
+        IBenchmark("EventManager::Post"),
+        mEvents(NULL),
+        mCalls(0),
+        mSize(0)
+      {
+      }
+
+      virtual void DoSetup(const Uint32 theSize)
+      {
+        mSize = theSize;
+        mEvents = new(std::nothrow) EventManager();
+
+        // Subscribe our HandleEvents method to a queue holding theSize events
+        mEvents->AddQueue<typeBenchEvent>(theSize);
+        mEvents->Subscribe(*this, &EventQueueBenchmark::HandleEvents);
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        typeBenchEvent anEvent;
+        anEvent.value = 1.0f;
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          for(Uint32 jloop = 0; jloop < mSize; jloop++)
+          {
+            anEvent.id = jloop;
+            mEvents->Post(anEvent);
+          }
+          mEvents->DispatchEvents();
+        }
+        return (Uint64)theIterations * mSize;
+      }
+
+      virtual void DoTeardown(void)
+      {
+        delete mEvents;
+        mEvents = NULL;
+      }
+
+      /**
+       * HandleEvents is called with each batch of events dispatched.
+       * @param[in] theEvents dispatched
+       * @param[in] theCount of events dispatched
+       */
+      void HandleEvents(const typeBenchEvent* theEvents, const Uint32 theCount)
+      {
+        for(Uint32 iloop = 0; iloop < theCount; iloop++)
+        {
+          mCalls += theEvents[iloop].id;
+        }
+      }
+
+    private:
+      /// The EventManager being measured
+      EventManager*   mEvents;
+      /// Sums each event handled so the calls are not optimized away
+      volatile Uint32 mCalls;
+      /// The number of events posted each frame
+      Uint32          mSize;
+  };
+
+  void RegisterEventBenchmarks(BenchmarkRunner& theRunner)
+  {
+    theRunner.AddBenchmark(new(std::nothrow) EventBenchmark())
+      .AddSize(1).AddSize(10).AddSize(100);
+    theRunner.AddBenchmark(new(std::nothrow) EventQueueBenchmark())
+      .AddSize(1).AddSize(10).AddSize(100);
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
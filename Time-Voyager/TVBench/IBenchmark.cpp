@@ -0,0 +1,81 @@
+/**
+ * Provides the IBenchmark interface class used by every microbenchmark that
+ * is run by the BenchmarkRunner class.
+ *
+ * @file src/GQE/Bench/IBenchmark.cpp
+ * @author Ryan Lindeman
+ * @date 20130803 - Initial Release
+ */
+
+#include <TVBench/IBenchmark.hpp>
+
+namespace GQE
+{
+  IBenchmark::IBenchmark(const std::string theName) :
+    mName(theName),
+    mSizes()
+  {
+  }
+
+  IBenchmark::~IBenchmark()
+  {
+  }
+
+  const std::string IBenchmark::GetName(void) const
+  {
+    return mName;
+  }
+
+  const std::vector<Uint32> IBenchmark::GetSizes(void) const
+  {
+    std::vector<Uint32> anResult(mSizes);
+
+    // Always run at least once even if no sizes were added
+    if(anResult.empty())
+    {
+      anResult.push_back(0);
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  IBenchmark& IBenchmark::AddSize(const Uint32 theSize)
+  {
+    mSizes.push_back(theSize);
+
+    // Return ourselves so sizes can be chained
+    return *this;
+  }
+
+  void IBenchmark::DoSetup(const Uint32 theSize)
+  {
+    // Do nothing
+  }
+
+  void IBenchmark::DoTeardown(void)
+  {
+    // Do nothing
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
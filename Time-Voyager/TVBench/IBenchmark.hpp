@@ -0,0 +1,128 @@
+/**
+ * Provides the IBenchmark interface class used by every microbenchmark that
+ * is run by the BenchmarkRunner class.
+ *
+ * @file include/GQE/Bench/IBenchmark.hpp
+ * @author Ryan Lindeman
+ * @date 20130803 - Initial Release
+ */
+#ifndef   BENCH_IBENCHMARK_HPP_INCLUDED
+#define   BENCH_IBENCHMARK_HPP_INCLUDED
+
+#include <string>
+#include <vector>
+#include <TVSource/Core/Core_types.hpp>
+
+namespace GQE
+{
+  /// Provides the interface for all microbenchmarks
+  class IBenchmark
+  {
+    public:
+      /**
+       * IBenchmark constructor
+       * @param[in] theName to use for this benchmark (e.g. ISystem::HasEntity)
+       */
+      IBenchmark(const std::string theName);
+
+      /**
+       * IBenchmark deconstructor
+       */
+      virtual ~IBenchmark();
+
+      /**
+       * GetName will return the name of this benchmark.
+       * @return the name of this benchmark
+       */
+      const std::string GetName(void) const;
+
+      /**
+       * GetSizes will return each problem size (N) this benchmark should be
+       * run with. If no sizes were added a single size of 0 is returned.
+       * @return the problem sizes to run this benchmark with
+       */
+      const std::vector<Uint32> GetSizes(void) const;
+
+      /**
+       * AddSize will add theSize provided as a problem size (N) this
+       * benchmark should be run with.
+       * @param[in] theSize to run this benchmark with
+       * @return a reference to this benchmark so sizes can be chained
+       */
+      IBenchmark& AddSize(const Uint32 theSize);
+
+      /**
+       * DoSetup is responsible for creating everything needed to run this
+       * benchmark with theSize provided. This is not included in the timing.
+       * @param[in] theSize (N) to prepare this benchmark for
+       */
+      virtual void DoSetup(const Uint32 theSize);
+
+      /**
+       * DoRun is responsible for running the operation being measured
+       * theIterations times. This is the only method included in the timing.
+       * @param[in] theIterations to run the operation being measured
+       * @return the number of operations performed (usually theIterations)
+       */
+      virtual Uint64 DoRun(const Uint32 theIterations) = 0;
+
+      /**
+       * DoTeardown is responsible for releasing everything created by the
+       * DoSetup method. This is not included in the timing.
+       */
+      virtual void DoTeardown(void);
+
+    private:
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// The name of this benchmark
+      const std::string   mName;
+      /// The problem sizes this benchmark should be run with
+      std::vector<Uint32> mSizes;
+
+      /**
+       * IBenchmark copy constructor is private because we do not allow copies
+       * of our class
+       */
+      IBenchmark(const IBenchmark&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      IBenchmark& operator=(const IBenchmark&); // Intentionally undefined
+  }; // class IBenchmark
+} // namespace GQE
+
+#endif // BENCH_IBENCHMARK_HPP_INCLUDED
+
+/**
+ * @class GQE::IBenchmark
+ * @ingroup Bench
+ * The IBenchmark class is the interface for each microbenchmark run by the
+ * BenchmarkRunner class. The DoSetup method is called once for each problem
+ * size added, followed by several calls to DoRun with an increasing number of
+ * iterations until the minimum measurement time has been reached, followed by
+ * a single call to DoTeardown. The value returned by DoRun is used to compute
+ * the time and allocations per operation, which allows a single iteration to
+ * perform N operations (e.g. DoEvents with N events registered).
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,209 @@
+/**
+ * Provides the logging throughput microbenchmarks for each ILogger derived
+ * class.
+ *
+ * @file src/GQE/Bench/LoggerBenchmarks.cpp
+ * @author Ryan Lindeman
+ * @date 20130803 - Initial Release
+ * @date 20130809 - Added AsyncLogger benchmark
+ * @date 20130810 - Added runtime log level benchmark
+ * @date 20130810 - Added BinaryLogger and ILOGB benchmarks
+ */
+
+#include <cstdio>
+#include <TVBench/CoreBenchmarks.hpp>
+#include <TVSource/Loggers/AsyncLogger.hpp>
+#include <TVSource/Loggers/BinaryLogger.hpp>
+#include <TVSource/Loggers/FileLogger.hpp>
+#include <TVSource/Loggers/Log_macros.hpp>
+#include <TVSource/Loggers/ScopeLogger.hpp>
+#include <TVSource/Loggers/StringLogger.hpp>
+
+namespace GQE
+{
+  /// Filename of the log file written by the logger benchmarks
+  static const char* BENCH_LOG_FILE = "bench-output.txt";
+
+  /// The default logger to install for each logger benchmark
+  enum BenchLoggerType
+  {
+    BenchLoggerNone,     ///< No default logger is installed
+    BenchLoggerFile,     ///< A FileLogger is the default logger
+    BenchLoggerAsync,    ///< An AsyncLogger is the default logger
+    BenchLoggerBinary,   ///< A BinaryLogger is the default logger
+    BenchLoggerString,   ///< A StringLogger is the default logger
+    BenchLoggerInactive, ///< An inactive FileLogger is the default logger
+    BenchLoggerFiltered  ///< A FileLogger only logging warnings is the default logger
+  };
+
+  /// Base class for the logger benchmarks which installs the default logger
+  class LoggerBenchmark : public IBenchmark
+  {
+    public:
+      LoggerBenchmark(const std::string theName, const BenchLoggerType theType) :
+        IBenchmark(theName),
+        mType(theType),
+        mLogger(NULL)
+      {
+      }
+
+      virtual void DoSetup(const Uint32 theSize)
+      {
+        // Create the default logger requested (if any)
+        if(BenchLoggerString == mType)
+        {
+          mLogger = new(std::nothrow) StringLogger(true);
+        }
+        else if(BenchLoggerAsync == mType)
+        {
+          mLogger = new(std::nothrow) AsyncLogger(BENCH_LOG_FILE, true);
+        }
+        else if(BenchLoggerBinary == mType)
+        {
+          mLogger = new(std::nothrow) BinaryLogger(BENCH_LOG_FILE, true);
+        }
+        else if(BenchLoggerNone != mType)
+        {
+          mLogger = new(std::nothrow) FileLogger(BENCH_LOG_FILE, true);
+        }
+
+        // Disable the inactive logger so every message goes to the null stream
+        if(BenchLoggerInactive == mType && NULL != mLogger)
+        {
+          mLogger->SetActive(false);
+        }
+
+        // Raise the runtime log level so every info message is skipped
+        if(BenchLoggerFiltered == mType)
+        {
+          ILogger::SetLevel(SeverityWarning);
+        }
+      }
+
+      virtual void DoTeardown(void)
+      {
+        // Restore the default runtime log level
+        ILogger::SetLevel(SeverityInfo);
+
+        // Deleting our logger removes it as the default logger
+        delete mLogger;
+        mLogger = NULL;
+        std::remove(BENCH_LOG_FILE);
+      }
+
+    private:
+      /// The type of default logger to install
+      const BenchLoggerType mType;
+      /// The default logger installed
+      ILogger*              mLogger;
+  };
+
+  /// Measures writing a formatted message using the ILOG macro
+  class LoggerMacroBenchmark : public LoggerBenchmark
+  {
+    public:
+      LoggerMacroBenchmark(const std::string theName, const BenchLoggerType theType) :
+        LoggerBenchmark(theName, theType)
+      {
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          ILOG() << "LoggerBenchmark::DoRun(" << iloop << ") position="
+            << 320.5f << "," << 240.25f << std::endl;
+        }
+        return theIterations;
+      }
+  };
+
+  /// Measures recording the same message using the ILOGB binary log macro
+  class LoggerBinaryMacroBenchmark : public LoggerBenchmark
+  {
+    public:
+      LoggerBinaryMacroBenchmark(const std::string theName, const BenchLoggerType theType) :
+        LoggerBenchmark(theName, theType)
+      {
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          ILOGB("LoggerBenchmark::DoRun({}) position={},{}") << iloop
+            << 320.5f << 240.25f;
+        }
+        return theIterations;
+      }
+  };
+
+  /// Measures logging the Entry and Exit of a scope using the ScopeLogger class
+  class ScopeLoggerBenchmark : public LoggerBenchmark
+  {
+    public:
+      ScopeLoggerBenchmark(const std::string theName, const BenchLoggerType theType) :
+        LoggerBenchmark(theName, theType)
+      {
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          ScopeLogger anScope(SeverityInfo, __FILE__, __LINE__, "ScopeLoggerBenchmark");
+        }
+        return theIterations;
+      }
+  };
+
+  void RegisterLoggerBenchmarks(BenchmarkRunner& theRunner)
+  {
+    theRunner.AddBenchmark(new(std::nothrow) LoggerMacroBenchmark(
+      "FileLogger::ILOG", BenchLoggerFile));
+    theRunner.AddBenchmark(new(std::nothrow) LoggerMacroBenchmark(
+      "AsyncLogger::ILOG", BenchLoggerAsync));
+    theRunner.AddBenchmark(new(std::nothrow) LoggerMacroBenchmark(
+      "BinaryLogger::ILOG", BenchLoggerBinary));
+    theRunner.AddBenchmark(new(std::nothrow) LoggerBinaryMacroBenchmark(
+      "BinaryLogger::ILOGB", BenchLoggerBinary));
+    theRunner.AddBenchmark(new(std::nothrow) LoggerBinaryMacroBenchmark(
+      "FileLogger::ILOGB", BenchLoggerFile));
+    theRunner.AddBenchmark(new(std::nothrow) LoggerMacroBenchmark(
+      "StringLogger::ILOG", BenchLoggerString));
+    theRunner.AddBenchmark(new(std::nothrow) LoggerMacroBenchmark(
+      "FileLogger::ILOG(inactive)", BenchLoggerInactive));
+    theRunner.AddBenchmark(new(std::nothrow) LoggerMacroBenchmark(
+      "FileLogger::ILOG(level warning)", BenchLoggerFiltered));
+    theRunner.AddBenchmark(new(std::nothrow) LoggerMacroBenchmark(
+      "ILOG(no logger)", BenchLoggerNone));
+    theRunner.AddBenchmark(new(std::nothrow) ScopeLoggerBenchmark(
+      "ScopeLogger(FileLogger)", BenchLoggerFile));
+    theRunner.AddBenchmark(new(std::nothrow) ScopeLoggerBenchmark(
+      "ScopeLogger(AsyncLogger)", BenchLoggerAsync));
+  }
+} // namespace GQE
+
+/**
+ * The FatalLogger class is not measured since it shuts down the application
+ * after each message is logged.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,170 @@
+/**
+ * Provides the PropertyManager microbenchmarks.
+ *
+ * @file src/GQE/Bench/PropertyBenchmarks.cpp
+ * @author Ryan Lindeman
+ * @date 20130803 - Initial Release
+ */
+
+#include <SFML/Graphics.hpp>
+#include <TVBench/CoreBenchmarks.hpp>
+#include <TVSource/Managers/PropertyManager.hpp>
+
+namespace GQE
+{
+  /**
+   * AddEntityProperties will add the same properties the RenderSystem and
+   * MovementSystem classes add to each IEntity to thePropertyManager provided.
+   * @param[in] thePropertyManager to add the properties to
+   */
+  static void AddEntityProperties(PropertyManager& thePropertyManager)
+  {
+    // RenderSystem properties
+    thePropertyManager.Add<sf::Sprite>("Sprite", sf::Sprite());
+    thePropertyManager.Add<sf::IntRect>("rSpriteRect", sf::IntRect(0,0,32,32));
+    thePropertyManager.Add<sf::Vector2f>("vScale", sf::Vector2f(1,1));
+    thePropertyManager.Add<sf::Vector2f>("vOrigin", sf::Vector2f(0,0));
+    thePropertyManager.Add<sf::Vector2f>("vPosition", sf::Vector2f(0,0));
+    thePropertyManager.Add<float>("fRotation", 0.0f);
+    thePropertyManager.Add<bool>("bVisible", true);
+
+    // MovementSystem properties
+    thePropertyManager.Add<sf::Vector2f>("vVelocity", sf::Vector2f(0,0));
+    thePropertyManager.Add<sf::Vector2f>("vAcceleration", sf::Vector2f(0,0));
+    thePropertyManager.Add<float>("fRotationalVelocity", 0.0f);
+    thePropertyManager.Add<float>("fRotationalAcceleration", 0.0f);
+    thePropertyManager.Add<bool>("bFixedMovement", true);
+    thePropertyManager.Add<bool>("bScreenWrap", true);
+    thePropertyManager.Add<bool>("bMovable", true);
+  }
+
+  /// Number of properties added by the AddEntityProperties function
+  static const Uint32 ENTITY_PROPERTIES = 14;
+
+  /// Measures PropertyManager::Get of a float property
+  class PropertyGetBenchmark : public IBenchmark
+  {
+    public:
+      PropertyGetBenchmark() :
+        IBenchmark("PropertyManager::Get<float>"),
+        mSink(0.0f)
+      {
+        AddEntityProperties(mProperties);
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          mSink += mProperties.Get<float>("fRotation");
+        }
+        return theIterations;
+      }
+
+    private:
+      /// The properties of a typical entity
+      PropertyManager mProperties;
+      /// Accumulates each value retrieved so the calls are not optimized away
+      volatile float  mSink;
+  };
+
+  /// Measures PropertyManager::Set of a sf::Vector2f property
+  class PropertySetBenchmark : public IBenchmark
+  {
+    public:
+      PropertySetBenchmark() :
+        IBenchmark("PropertyManager::Set<sf::Vector2f>")
+      {
+        AddEntityProperties(mProperties);
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          mProperties.Set<sf::Vector2f>("vPosition", sf::Vector2f((float)iloop, 1.0f));
+        }
+        return theIterations;
+      }
+
+    private:
+      /// The properties of a typical entity
+      PropertyManager mProperties;
+  };
+
+  /// Measures PropertyManager::Add of each typical entity property
+  class PropertyAddBenchmark : public IBenchmark
+  {
+    public:
+      PropertyAddBenchmark() :
+        IBenchmark("PropertyManager::Add")
+      {
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          // Includes deleting each property when anProperties goes out of scope
+          PropertyManager anProperties;
+          AddEntityProperties(anProperties);
+        }
+        return (Uint64)theIterations * ENTITY_PROPERTIES;
+      }
+  };
+
+  /// Measures PropertyManager::Clone of a typical entity
+  class PropertyCloneBenchmark : public IBenchmark
+  {
+    public:
+      PropertyCloneBenchmark() :
+        IBenchmark("PropertyManager::Clone")
+      {
+        AddEntityProperties(mProperties);
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          // Includes deleting each property when anClone goes out of scope
+          PropertyManager anClone;
+          anClone.Clone(mProperties);
+        }
+        return theIterations;
+      }
+
+    private:
+      /// The properties of a typical entity
+      PropertyManager mProperties;
+  };
+
+  void RegisterPropertyBenchmarks(BenchmarkRunner& theRunner)
+  {
+    theRunner.AddBenchmark(new(std::nothrow) PropertyGetBenchmark());
+    theRunner.AddBenchmark(new(std::nothrow) PropertySetBenchmark());
+    theRunner.AddBenchmark(new(std::nothrow) PropertyAddBenchmark());
+    theRunner.AddBenchmark(new(std::nothrow) PropertyCloneBenchmark());
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
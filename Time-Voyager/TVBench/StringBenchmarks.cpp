@@ -0,0 +1,314 @@
+/**
+ * Provides the StringUtil Parse and Convert microbenchmarks.
+ *
+ * @file src/GQE/Bench/StringBenchmarks.cpp
+ * @author Ryan Lindeman
+ * @date 20130803 - Initial Release
+ * @date 20130814 - Added buffer overload and stringstream reference benchmarks
+ */
+
+#include <sstream>
+#include <TVBench/CoreBenchmarks.hpp>
+#include <TVSource/Utils/StringUtil.hpp>
+
+namespace GQE
+{
+  /**
+   * StreamParse will parse theValue using a stringstream the way the
+   * StringUtil Parse functions did before the buffer overloads were added.
+   * @param[in] theValue string to parse
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault
+   */
+  template<class TYPE>
+  static TYPE StreamParse(const std::string theValue, const TYPE theDefault)
+  {
+    TYPE anResult = theDefault;
+    std::istringstream iss(theValue);
+    iss >> anResult;
+    return anResult;
+  }
+
+  /**
+   * StreamParseVector2f will parse theValue using substr and stringstreams
+   * the way ParseVector2f did before the buffer overloads were added.
+   * @param[in] theValue string to parse
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault
+   */
+  static sf::Vector2f StreamParseVector2f(const std::string theValue,
+    const sf::Vector2f theDefault)
+  {
+    sf::Vector2f anResult = theDefault;
+    size_t anCommaOffset = theValue.find_first_of(',');
+    if(anCommaOffset != std::string::npos)
+    {
+      anResult.x = StreamParse<float>(theValue.substr(0,anCommaOffset), theDefault.x);
+      anResult.y = StreamParse<float>(theValue.substr(anCommaOffset+1), theDefault.y);
+    }
+    return anResult;
+  }
+
+  /**
+   * StreamConvert will convert theValue using a stringstream the way the
+   * StringUtil Convert functions did before the buffer overloads were added.
+   * @param[in] theValue to convert
+   * @return the resulting string
+   */
+  template<class TYPE>
+  static std::string StreamConvert(const TYPE theValue)
+  {
+    std::stringstream anResult;
+    anResult << theValue;
+    return anResult.str();
+  }
+
+  /**
+   * StreamConvertVector2f will convert theVector using a stringstream the
+   * way ConvertVector2f did before the buffer overloads were added.
+   * @param[in] theVector to convert
+   * @return the resulting string
+   */
+  static std::string StreamConvertVector2f(const sf::Vector2f theVector)
+  {
+    std::stringstream anResult;
+    anResult << theVector.x << ", ";
+    anResult << theVector.y;
+    return anResult.str();
+  }
+
+  /// Measures one of the StringUtil Parse functions
+  template<class TYPE>
+  class TParseBenchmark : public IBenchmark
+  {
+    public:
+      /// Declare the Parse function signature used by this benchmark
+      typedef TYPE (*typeParseFunc)(const std::string, const TYPE);
+
+      TParseBenchmark(const std::string theName, typeParseFunc theParseFunc,
+        const std::string theValue, const TYPE theDefault) :
+        IBenchmark(theName),
+        mParseFunc(theParseFunc),
+        mValue(theValue),
+        mDefault(theDefault),
+        mResult(theDefault)
+      {
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          mResult = mParseFunc(mValue, mDefault);
+        }
+        return theIterations;
+      }
+
+    private:
+      /// The Parse function being measured
+      typeParseFunc     mParseFunc;
+      /// The string value to parse
+      const std::string mValue;
+      /// The default value to provide
+      const TYPE        mDefault;
+      /// The last value parsed
+      TYPE              mResult;
+  };
+
+  /// Measures one of the StringUtil Convert functions
+  template<class TYPE>
+  class TConvertBenchmark : public IBenchmark
+  {
+    public:
+      /// Declare the Convert function signature used by this benchmark
+      typedef std::string (*typeConvertFunc)(const TYPE);
+
+      TConvertBenchmark(const std::string theName, typeConvertFunc theConvertFunc,
+        const TYPE theValue) :
+        IBenchmark(theName),
+        mConvertFunc(theConvertFunc),
+        mValue(theValue),
+        mLength(0)
+      {
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          mLength += (Uint32)mConvertFunc(mValue).length();
+        }
+        return theIterations;
+      }
+
+    private:
+      /// The Convert function being measured
+      typeConvertFunc mConvertFunc;
+      /// The value to convert
+      const TYPE      mValue;
+      /// Accumulates each string length so the calls are not optimized away
+      volatile Uint32 mLength;
+  };
+
+  /// Measures one of the StringUtil buffer Parse overloads
+  template<class TYPE>
+  class TParseBufferBenchmark : public IBenchmark
+  {
+    public:
+      /// Declare the buffer Parse function signature used by this benchmark
+      typedef TYPE (*typeParseFunc)(const char*, const size_t, const TYPE);
+
+      TParseBufferBenchmark(const std::string theName, typeParseFunc theParseFunc,
+        const std::string theValue, const TYPE theDefault) :
+        IBenchmark(theName),
+        mParseFunc(theParseFunc),
+        mValue(theValue),
+        mDefault(theDefault),
+        mResult(theDefault)
+      {
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          mResult = mParseFunc(mValue.data(), mValue.length(), mDefault);
+        }
+        return theIterations;
+      }
+
+    private:
+      /// The Parse function being measured
+      typeParseFunc     mParseFunc;
+      /// The string value to parse
+      const std::string mValue;
+      /// The default value to provide
+      const TYPE        mDefault;
+      /// The last value parsed
+      TYPE              mResult;
+  };
+
+  /// Measures one of the StringUtil buffer Convert overloads
+  template<class TYPE>
+  class TConvertBufferBenchmark : public IBenchmark
+  {
+    public:
+      /// Declare the buffer Convert function signature used by this benchmark
+      typedef size_t (*typeConvertFunc)(const TYPE, char*, const size_t);
+
+      TConvertBufferBenchmark(const std::string theName, typeConvertFunc theConvertFunc,
+        const TYPE theValue) :
+        IBenchmark(theName),
+        mConvertFunc(theConvertFunc),
+        mValue(theValue),
+        mLength(0)
+      {
+      }
+
+      virtual Uint64 DoRun(const Uint32 theIterations)
+      {
+        for(Uint32 iloop = 0; iloop < theIterations; iloop++)
+        {
+          mLength += (Uint32)mConvertFunc(mValue, mBuffer, sizeof(mBuffer));
+        }
+        return theIterations;
+      }
+
+    private:
+      /// The Convert function being measured
+      typeConvertFunc mConvertFunc;
+      /// The value to convert
+      const TYPE      mValue;
+      /// The buffer each value is converted into
+      char            mBuffer[CONVERT_BUFFER_SIZE];
+      /// Accumulates each string length so the calls are not optimized away
+      volatile Uint32 mLength;
+  };
+
+  void RegisterStringBenchmarks(BenchmarkRunner& theRunner)
+  {
+    theRunner.AddBenchmark(new(std::nothrow) TParseBenchmark<bool>(
+      "StringUtil::ParseBool", ParseBool, "true", false));
+    theRunner.AddBenchmark(new(std::nothrow) TParseBenchmark<Int32>(
+      "StringUtil::ParseInt32", ParseInt32, "-123456", 0));
+    theRunner.AddBenchmark(new(std::nothrow) TParseBenchmark<Uint32>(
+      "StringUtil::ParseUint32", ParseUint32, "123456", 0));
+    theRunner.AddBenchmark(new(std::nothrow) TParseBenchmark<float>(
+      "StringUtil::ParseFloat", ParseFloat, "3.14159", 0.0f));
+    theRunner.AddBenchmark(new(std::nothrow) TParseBenchmark<sf::Vector2f>(
+      "StringUtil::ParseVector2f", ParseVector2f, "320.5, 240.25", sf::Vector2f(0,0)));
+    theRunner.AddBenchmark(new(std::nothrow) TParseBenchmark<sf::IntRect>(
+      "StringUtil::ParseIntRect", ParseIntRect, "0, 32, 128, 32", sf::IntRect(0,0,0,0)));
+    theRunner.AddBenchmark(new(std::nothrow) TParseBenchmark<sf::Color>(
+      "StringUtil::ParseColor", ParseColor, "255, 128, 64, 255", sf::Color::White));
+    theRunner.AddBenchmark(new(std::nothrow) TConvertBenchmark<bool>(
+      "StringUtil::ConvertBool", ConvertBool, true));
+    theRunner.AddBenchmark(new(std::nothrow) TConvertBenchmark<Int32>(
+      "StringUtil::ConvertInt32", ConvertInt32, -123456));
+    theRunner.AddBenchmark(new(std::nothrow) TConvertBenchmark<Uint32>(
+      "StringUtil::ConvertUint32", ConvertUint32, 123456));
+    theRunner.AddBenchmark(new(std::nothrow) TConvertBenchmark<float>(
+      "StringUtil::ConvertFloat", ConvertFloat, 3.14159f));
+    theRunner.AddBenchmark(new(std::nothrow) TConvertBenchmark<sf::Vector2f>(
+      "StringUtil::ConvertVector2f", ConvertVector2f, sf::Vector2f(320.5f, 240.25f)));
+    theRunner.AddBenchmark(new(std::nothrow) TConvertBenchmark<sf::IntRect>(
+      "StringUtil::ConvertIntRect", ConvertIntRect, sf::IntRect(0, 32, 128, 32)));
+
+    // Compare the buffer overloads with the previous stringstream versions
+    theRunner.AddBenchmark(new(std::nothrow) TParseBenchmark<Int32>(
+      "StringUtil::ParseInt32(stream)", StreamParse<Int32>, "-123456", 0));
+    theRunner.AddBenchmark(new(std::nothrow) TParseBufferBenchmark<Int32>(
+      "StringUtil::ParseInt32(buffer)", ParseInt32, "-123456", 0));
+    theRunner.AddBenchmark(new(std::nothrow) TParseBenchmark<Uint32>(
+      "StringUtil::ParseUint32(stream)", StreamParse<Uint32>, "123456", 0));
+    theRunner.AddBenchmark(new(std::nothrow) TParseBufferBenchmark<Uint32>(
+      "StringUtil::ParseUint32(buffer)", ParseUint32, "123456", 0));
+    theRunner.AddBenchmark(new(std::nothrow) TParseBenchmark<float>(
+      "StringUtil::ParseFloat(stream)", StreamParse<float>, "3.14159", 0.0f));
+    theRunner.AddBenchmark(new(std::nothrow) TParseBufferBenchmark<float>(
+      "StringUtil::ParseFloat(buffer)", ParseFloat, "3.14159", 0.0f));
+    theRunner.AddBenchmark(new(std::nothrow) TParseBenchmark<sf::Vector2f>(
+      "StringUtil::ParseVector2f(stream)", StreamParseVector2f, "320.5, 240.25", sf::Vector2f(0,0)));
+    theRunner.AddBenchmark(new(std::nothrow) TParseBufferBenchmark<sf::Vector2f>(
+      "StringUtil::ParseVector2f(buffer)", ParseVector2f, "320.5, 240.25", sf::Vector2f(0,0)));
+    theRunner.AddBenchmark(new(std::nothrow) TParseBufferBenchmark<sf::IntRect>(
+      "StringUtil::ParseIntRect(buffer)", ParseIntRect, "0, 32, 128, 32", sf::IntRect(0,0,0,0)));
+    theRunner.AddBenchmark(new(std::nothrow) TParseBufferBenchmark<sf::Color>(
+      "StringUtil::ParseColor(buffer)", ParseColor, "255, 128, 64, 255", sf::Color::White));
+    theRunner.AddBenchmark(new(std::nothrow) TConvertBenchmark<Int32>(
+      "StringUtil::ConvertInt32(stream)", StreamConvert<Int32>, -123456));
+    theRunner.AddBenchmark(new(std::nothrow) TConvertBufferBenchmark<Int32>(
+      "StringUtil::ConvertInt32(buffer)", ConvertInt32, -123456));
+    theRunner.AddBenchmark(new(std::nothrow) TConvertBenchmark<float>(
+      "StringUtil::ConvertFloat(stream)", StreamConvert<float>, 3.14159f));
+    theRunner.AddBenchmark(new(std::nothrow) TConvertBufferBenchmark<float>(
+      "StringUtil::ConvertFloat(buffer)", ConvertFloat, 3.14159f));
+    theRunner.AddBenchmark(new(std::nothrow) TConvertBenchmark<sf::Vector2f>(
+      "StringUtil::ConvertVector2f(stream)", StreamConvertVector2f, sf::Vector2f(320.5f, 240.25f)));
+    theRunner.AddBenchmark(new(std::nothrow) TConvertBufferBenchmark<sf::Vector2f>(
+      "StringUtil::ConvertVector2f(buffer)", ConvertVector2f, sf::Vector2f(320.5f, 240.25f)));
+    theRunner.AddBenchmark(new(std::nothrow) TConvertBufferBenchmark<sf::IntRect>(
+      "StringUtil::ConvertIntRect(buffer)", ConvertIntRect, sf::IntRect(0, 32, 128, 32)));
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,71 @@
+// Time-Voyager-Bench.cpp : Defines the entry point for the benchmark console application.
+//
+
+#include <iostream>
+#include <TVBench/BenchmarkRunner.hpp>
+#include <TVBench/CoreBenchmarks.hpp>
+#include <TVSource/Interfaces/IApp.hpp>
+
+/// Provides the IApp needed by the Prototype and ISystem benchmarks, never Run
+class BenchApp : public GQE::IApp
+{
+  public:
+    BenchApp() :
+      GQE::IApp("Time-Voyager-Bench")
+    {
+    }
+
+  protected:
+    virtual void InitAssetHandlers(void)
+    {
+    }
+
+    virtual void InitScreenFactory(void)
+    {
+    }
+
+    virtual void HandleCleanup(void)
+    {
+    }
+};
+
+int main(int argc, char* argv[])
+{
+  // Default anExitCode to a specific value
+  int anExitCode = GQE::StatusNoError;
+
+  // Create our benchmark application before any benchmark is registered
+  BenchApp anApp;
+
+  // Create our benchmark runner
+  GQE::BenchmarkRunner anRunner;
+
+  // Process command line arguments
+  for(int iloop = 1; iloop < argc; iloop++)
+  {
+    if(!anRunner.ProcessArgument(argv[iloop]))
+    {
+      std::cerr << "main() unknown argument " << argv[iloop] << std::endl;
+      std::cerr << "usage: Time-Voyager-Bench [--filter=name] [--min-time=ms]"
+        << " [--json=file] [--list] [--warmup=n] [--repetitions=n] [--pin[=cpu]]"
+        << " [--profile=name] [--baseline-dir=dir] [--save-baseline] [--compare]"
+        << " [--tolerance-median=pct] [--tolerance-p95=pct]" << std::endl;
+      return GQE::StatusError;
+    }
+  }
+
+  // Register every group of core engine benchmarks
+  GQE::RegisterPropertyBenchmarks(anRunner);
+  GQE::RegisterEntityBenchmarks(anRunner);
+  GQE::RegisterEventBenchmarks(anRunner);
+  GQE::RegisterAssetBenchmarks(anRunner);
+  GQE::RegisterConfigBenchmarks(anRunner);
+  GQE::RegisterStringBenchmarks(anRunner);
+  GQE::RegisterLoggerBenchmarks(anRunner);
+
+  // Run each benchmark that matches the filter provided
+  anExitCode = anRunner.Run();
+
+  // return our exit code
+  return anExitCode;
+}
@@ -9,6 +9,7 @@
  * @date 20120421 - Use arial.ttf font since SFML 2 crashes on exit when using default font
  * @date 20120512 - Use new RAII Asset style
  * @date 20120630 - Fix mouse image of X or O and SFML 2 and Window mode.
+ * @date 20130815 - Load assets in the background
  */
 #include "GameState.hpp"
 #include <TVSource/Apps/MenuState.hpp>
@@ -24,14 +25,22 @@ GameState::GameState(GQE::IApp& theApp) :
   mAnimationSystem(theApp),
   mRenderSystem(theApp),
   mPlayer("player", 255),
-  mWinFont("resources/Fonts/arial.ttf", GQE::AssetLoadNow),
-  mBackground("resources/Graphics/Board.png", GQE::AssetLoadNow),
-  mPlayer1("resources/Graphics/Player1.png", GQE::AssetLoadNow),
-  mPlayer2("resources/Graphics/Player2.png", GQE::AssetLoadNow),
-  mEmpty("resources/Graphics/Empty.png", GQE::AssetLoadNow),
+  mWinFont("resources/Fonts/arial.ttf"),
+  mBackground("resources/Graphics/Board.png"),
+  mPlayer1("resources/Graphics/Player1.png"),
+  mPlayer2("resources/Graphics/Player2.png"),
+  mEmpty("resources/Graphics/Empty.png"),
+  mAssetsReady(false),
   mCurrentPlayer(0),
   mWinnerText(NULL)
 {
+  // Load our assets in the background instead of blocking this frame
+  mLoads.push_back(mWinFont.LoadAsync());
+  mLoads.push_back(mBackground.LoadAsync());
+  mLoads.push_back(mPlayer1.LoadAsync());
+  mLoads.push_back(mPlayer2.LoadAsync());
+  mLoads.push_back(mEmpty.LoadAsync());
+
 	mCharacterImage.loadFromFile("resources/Graphics/character1.png");
 }
 
@@ -85,9 +94,7 @@ void GameState::DoInit(void)
   }
 
 
-  // Load our Background image which will show the TicTacToe game board
-  mBackgroundSprite.setTexture(mBackground.GetAsset());
-
+  // Our Background image and font are set by ApplyAssets once they are loaded
 
   // Setup winner text color as White
   mWinnerText = new sf::Text("", mWinFont.GetAsset(), 30);
@@ -140,7 +147,8 @@ void GameState::HandleEvents(sf::Event theEvent)
     }
 
 
-    if(theEvent.type == sf::Event::MouseButtonReleased)
+    // Ignore clicks until our assets have been loaded in the background
+    if(theEvent.type == sf::Event::MouseButtonReleased && mAssetsReady)
     {
       // Determine which square they clicked on
       GQE::Uint8 col = (theEvent.mouseButton.x / 270);
@@ -273,6 +281,20 @@ void GameState::UpdateFixed(void)
 
 void GameState::UpdateVariable(float theElapsedTime)
 {
+  // Apply our assets once every background load is done
+  if(false == mAssetsReady)
+  {
+    mAssetsReady = true;
+    for(size_t iloop = 0; iloop < mLoads.size(); iloop++)
+    {
+      mAssetsReady = mAssetsReady && mLoads[iloop].IsDone();
+    }
+    if(mAssetsReady)
+    {
+      ApplyAssets();
+    }
+  }
+
   // Draw the current player image at the mouse position
   mCursor.setPosition(sf::Mouse::getPosition(mApp.mWindow).x-32.0f,
     sf::Mouse::getPosition(mApp.mWindow).y-25.25f);
@@ -306,6 +328,18 @@ void GameState::HandleCleanup(void)
 {
 }
 
+void GameState::ApplyAssets(void)
+{
+  // Load our Background image which will show the TicTacToe game board
+  mBackgroundSprite.setTexture(mBackground.GetAsset(), true);
+
+  // Use our font for the winner text
+  mWinnerText->setFont(mWinFont.GetAsset());
+
+  // Call ReInit to reset the board using the loaded images
+  ReInit();
+}
+
 /**
  * Copyright (c) 2010-2011 Ryan Lindeman
  * Permission is hereby granted, free of charge, to any person obtaining a copy
@@ -6,11 +6,13 @@
  * @date 20110704 - Initial Release
  * @date 20120421 - Use arial.ttf font since SFML 2 crashes on exit when using default font
  * @date 20120512 - Use new RAII Asset style
+ * @date 20130815 - Load assets in the background
  */
 
 #ifndef   GAME_STATE_HPP_INCLUDED
 #define   GAME_STATE_HPP_INCLUDED
 
+#include <vector>
 #include <SFML/Graphics.hpp>
 #include <TVSource/Assets/FontAsset.hpp>
 #include <TVSource/Assets/ImageAsset.hpp>
@@ -82,6 +84,12 @@ class GameState : public GQE::IState
     virtual void HandleCleanup(void);
 
   private:
+    /**
+     * ApplyAssets is responsible for setting the textures and fonts of our
+     * sprites and text once every asset has been loaded in the background.
+     */
+    void ApplyAssets(void);
+
     // Variables
     /////////////////////////////////////////////////////////////////////////
 
@@ -103,6 +111,10 @@ class GameState : public GQE::IState
     GQE::ImageAsset mPlayer1;
     GQE::ImageAsset mPlayer2;
     GQE::ImageAsset mEmpty;
+    /// Handles to each asset being loaded in the background
+    std::vector<GQE::AssetLoadHandle> mLoads;
+    /// True once every asset has been loaded and applied
+    bool            mAssetsReady;
     sf::Sprite      mBackgroundSprite;
     sf::Sprite      mCursor;
     sf::Sprite      mBoardSprite[3][3];
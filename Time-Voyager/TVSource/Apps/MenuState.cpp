@@ -9,20 +9,29 @@
  * @date 20120421 - Use arial.ttf font since SFML 2 crashes on exit when using default font
  * @date 20120512 - Use new RAII Asset style
  * @date 20120630 - Fix mouse image of X or O and SFML 2 and Window mode.
+ * @date 20130815 - Load assets in the background
+ * @date 20130819 - Use Menu as the state ID so its asset manifest is its own
  */
 #include "MenuState.hpp"
 #include <TVSource/Apps/GameState.hpp>
 #include <TVSource/Interfaces/IApp.hpp>
 
 MenuState::MenuState(GQE::IApp& theApp) :
-  GQE::IState("Game",theApp),
-  mWinFont("resources/Fonts/arial.ttf", GQE::AssetLoadNow),
-  mBackground("resources/Graphics/BlackBG.png", GQE::AssetLoadNow),
-  mStart("resources/Graphics/start.png", GQE::AssetLoadNow),
-  mSettings("resources/Graphics/settings.png", GQE::AssetLoadNow),
-  mExit("resources/Graphics/exit.png", GQE::AssetLoadNow),
+  GQE::IState("Menu",theApp),
+  mWinFont("resources/Fonts/arial.ttf"),
+  mBackground("resources/Graphics/BlackBG.png"),
+  mStart("resources/Graphics/start.png"),
+  mSettings("resources/Graphics/settings.png"),
+  mExit("resources/Graphics/exit.png"),
+  mAssetsReady(false),
   mWinnerText(NULL)
 {
+  // Load our assets in the background instead of blocking this frame
+  mLoads.push_back(mWinFont.LoadAsync());
+  mLoads.push_back(mBackground.LoadAsync());
+  mLoads.push_back(mStart.LoadAsync());
+  mLoads.push_back(mSettings.LoadAsync());
+  mLoads.push_back(mExit.LoadAsync());
 }
 
 MenuState::~MenuState(void)
@@ -36,12 +45,9 @@ void MenuState::DoInit(void)
   // First call our base class implementation
   IState::DoInit();
 
-  mBackgroundSprite.setTexture(mBackground.GetAsset());
-  mStartSprite.setTexture(mStart.GetAsset());
+  // Our textures are set by ApplyAssets once they have been loaded
   mStartSprite.setPosition((200.0f), (200.0f));
-  mSettingsSprite.setTexture(mSettings.GetAsset());
   mSettingsSprite.setPosition((200.0f), (300.0f));
-  mExitSprite.setTexture(mExit.GetAsset());
   mExitSprite.setPosition((200.0f), (400.0f));
   // Make sure our update loop is only called 30 times per second
   mApp.SetUpdateRate(30.0f);
@@ -91,7 +97,19 @@ void MenuState::UpdateFixed(void)
 
 void MenuState::UpdateVariable(float theElapsedTime)
 {
-  
+  // Apply our assets once every background load is done
+  if(false == mAssetsReady)
+  {
+    mAssetsReady = true;
+    for(size_t iloop = 0; iloop < mLoads.size(); iloop++)
+    {
+      mAssetsReady = mAssetsReady && mLoads[iloop].IsDone();
+    }
+    if(mAssetsReady)
+    {
+      ApplyAssets();
+    }
+  }
 }
 
 void MenuState::Draw(void)
@@ -109,6 +127,14 @@ void MenuState::HandleCleanup(void)
 {
 }
 
+void MenuState::ApplyAssets(void)
+{
+  mBackgroundSprite.setTexture(mBackground.GetAsset(), true);
+  mStartSprite.setTexture(mStart.GetAsset(), true);
+  mSettingsSprite.setTexture(mSettings.GetAsset(), true);
+  mExitSprite.setTexture(mExit.GetAsset(), true);
+}
+
 /**
  * Copyright (c) 2010-2011 Ryan Lindeman
  * Permission is hereby granted, free of charge, to any person obtaining a copy
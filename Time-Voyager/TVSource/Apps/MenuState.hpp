@@ -6,11 +6,13 @@
  * @date 20110704 - Initial Release
  * @date 20120421 - Use arial.ttf font since SFML 2 crashes on exit when using default font
  * @date 20120512 - Use new RAII Asset style
+ * @date 20130815 - Load assets in the background
  */
 
 #ifndef   MENU_STATE_HPP_INCLUDED
 #define   MENU_STATE_HPP_INCLUDED
 
+#include <vector>
 #include <SFML/Graphics.hpp>
 #include <TVSource/Assets/FontAsset.hpp>
 #include <TVSource/Assets/ImageAsset.hpp>
@@ -78,6 +80,12 @@ class MenuState : public GQE::IState
     virtual void HandleCleanup(void);
 
   private:
+    /**
+     * ApplyAssets is responsible for setting the textures and fonts of our
+     * sprites and text once every asset has been loaded in the background.
+     */
+    void ApplyAssets(void);
+
     // Variables
     /////////////////////////////////////////////////////////////////////////
     GQE::FontAsset  mWinFont;
@@ -85,6 +93,10 @@ class MenuState : public GQE::IState
     GQE::ImageAsset mStart;
     GQE::ImageAsset mSettings;
     GQE::ImageAsset mExit;
+    /// Handles to each asset being loaded in the background
+    std::vector<GQE::AssetLoadHandle> mLoads;
+    /// True once every asset has been loaded and applied
+    bool            mAssetsReady;
 	sf::Sprite      mBackgroundSprite;
 	sf::Sprite      mStartSprite;
 	sf::Sprite      mSettingsSprite;
@@ -13,8 +13,8 @@ int main(int argc, char* argv[])
   // Default anExitCode to a specific value
   int anExitCode = GQE::StatusNoError;
 
-  // Create a FileLogger and make it the default logger before creating our App
-  GQE::FileLogger anLogger("output.txt", true);
+  // Create an AsyncLogger and make it the default logger before creating our App
+  GQE::AsyncLogger anLogger("output.txt", true);
 
   // Create our action application.
   GQE::IApp* anApp = new(std::nothrow) TimeVoyagerApp();
@@ -12,6 +12,8 @@
  * @date 20120512 - Use new RAII Asset and Asset Handler management style
  * @date 20120514 - Add default constructor for missing Asset ID at construction
  * @date 20120615 - Adjust comments for default constructor
+ * @date 20130816 - Default to loading from asset packs in release builds
+ * @date 20130818 - Default to keeping dropped assets in the handler cache
  */
 #ifndef   CORE_CONFIG_ASSET_HPP_INCLUDED
 #define   CORE_CONFIG_ASSET_HPP_INCLUDED
@@ -38,12 +40,12 @@ namespace GQE
        * @param[in] theAssetID to uniquely identify this asset
        * @param[in] theLoadTime (Now, Later) of when to load this asset
        * @param[in] theLoadStyle (File, Mem, Network) to use when loading this asset
-       * @param[in] theDropTime at (Zero, Exit) for when to unload this asset
+       * @param[in] theDropTime at (Zero, Exit, Cached) for when to unload this asset
        */
       ConfigAsset(const typeAssetID theAssetID,
         AssetLoadTime theLoadTime = AssetLoadLater,
-        AssetLoadStyle theLoadStyle = AssetLoadFromFile,
-        AssetDropTime theDropTime = AssetDropAtZero);
+        AssetLoadStyle theLoadStyle = AssetLoadFromDefault,
+        AssetDropTime theDropTime = AssetDropCached);
 
       /**
        * ConfigAsset deconstructor
@@ -6,10 +6,15 @@
  * @author Ryan Lindeman
  * @date 20120428 - Initial Release
  * @date 20120514 - Don't throw exception on new
+ * @date 20130813 - Load the compiled configuration file when it is newer
+ * @date 20130816 - Load configuration files from the asset packs mapped by the AssetManager
+ * @date 20130824 - Load configuration files fetched from a content server by the NetworkSource
  */
  
 #include <TVSource/assets/ConfigHandler.hpp>
+#include <TVSource/interfaces/IApp.hpp>
 #include <TVSource/loggers/Log_macros.hpp>
+#include <TVSource/Utils/MappedFile.hpp>
  
 namespace GQE
 {
@@ -35,8 +40,18 @@ namespace GQE
     // Was a valid filename found? then attempt to load the asset from anFilename
     if(anFilename.length() > 0)
     {
+      // Load the compiled file instead if it is newer than anFilename
+      std::string anCompiled = ConfigReader::GetCompiledFilename(anFilename);
+      if(MappedFile::IsNewer(anCompiled, anFilename))
+      {
+        anResult = theAsset.LoadFromCompiled(anCompiled);
+      }
+
       // Load the asset from a file
-      anResult = theAsset.LoadFromFile(anFilename);
+      if(!anResult)
+      {
+        anResult = theAsset.LoadFromFile(anFilename);
+      }
     }
     else
     {
@@ -53,7 +68,24 @@ namespace GQE
     // Start with a return result of false
     bool anResult = false;
 
-    // TODO: Add LoadFromMemory support to ConfigReader
+    // Retrieve the filename for this asset
+    std::string anFilename = GetFilename(theAssetID);
+
+    // The location and size in bytes of the configuration within an asset pack
+    const char* anData = NULL;
+    size_t anDataSize = 0;
+
+    // Try to obtain the configuration from the asset packs mapped by the AssetManager
+    if(IApp::GetApp()->mAssetManager.FindPackData(anFilename, anData, anDataSize))
+    {
+      // Parse the configuration in place from the memory location found
+      anResult = theAsset.LoadFromMemory(anData, anDataSize);
+    }
+    else
+    {
+      // Not found in any asset pack? then load the loose file instead
+      anResult = LoadFromFile(theAssetID, theAsset);
+    }
 
     // Return anResult of true if successful, false otherwise
     return anResult;
@@ -64,7 +96,23 @@ namespace GQE
     // Start with a return result of false
     bool anResult = false;
 
-    // TODO: Add load from network for this asset
+    // Retrieve the filename for this asset
+    std::string anFilename = GetFilename(theAssetID);
+
+    // The copy of the configuration fetched into the network cache
+    std::string anCached;
+
+    // Fetch the configuration from the content server used by the AssetManager
+    if(IApp::GetApp()->mAssetManager.GetNetworkSource().Fetch(anFilename, anCached))
+    {
+      // Parse the configuration from the cached copy
+      anResult = theAsset.LoadFromFile(anCached);
+    }
+    else
+    {
+      ELOG() << "ConfigHandler::LoadFromNetwork(" << theAssetID
+        << ") Unable to fetch asset!" << std::endl;
+    }
 
     // Return anResult of true if successful, false otherwise
     return anResult;
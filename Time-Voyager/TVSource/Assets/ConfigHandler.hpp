@@ -5,6 +5,7 @@
  * @file include/GQE/Core/assets/ConfigHandler.hpp
  * @author Ryan Lindeman
  * @date 20120428 - Initial Release
+ * @date 20130813 - Load the compiled configuration file when it is newer
  */
 #ifndef   CORE_CONFIG_HANDLER_HPP_INCLUDED
 #define   CORE_CONFIG_HANDLER_HPP_INCLUDED
@@ -70,7 +71,10 @@ namespace GQE
  * @class GQE::ConfigHandler
  * @ingroup Core
  * The ConfigHandler class is used to reference count and manage all
- * ConfigReader classes used in a GQE application.
+ * ConfigReader classes used in a GQE application. If a compiled
+ * configuration file (see ConfigReader::SaveToCompiled) that is newer than
+ * the configuration file exists next to it, the compiled file is loaded
+ * instead.
  *
  * Copyright (c) 2010-2012 Ryan Lindeman
  * Permission is hereby granted, free of charge, to any person obtaining a copy
@@ -5,9 +5,12 @@
  * @file src/GQE/Core/assets/FontHandler.cpp
  * @author Ryan Lindeman
  * @date 20120428 - Initial Release
+ * @date 20130816 - Load fonts from the asset packs mapped by the AssetManager
+ * @date 20130824 - Load fonts fetched from a content server by the NetworkSource
  */
  
 #include <TVSource/assets/FontHandler.hpp>
+#include <TVSource/interfaces/IApp.hpp>
 #include <TVSource/loggers/Log_macros.hpp>
  
 namespace GQE
@@ -56,17 +59,21 @@ namespace GQE
     // Start with a return result of false
     bool anResult = false;
 
-    // TODO: Retrieve the const char* pointer to load data from
+    // Retrieve the filename for this asset
+    std::string anFilename = GetFilename(theAssetID);
+
+    // The location and size in bytes of the font within an asset pack
     const char* anData = NULL;
-    // TODO: Retrieve the size in bytes of the font to load from memory
     size_t anDataSize = 0;
+#if (SFML_VERSION_MAJOR < 2)
     // TODO: Retrieve the character size for this font
     unsigned int anCharSize = 30;
+#endif
 
-    // Try to obtain the font from the memory location specified
-    if(NULL != anData && anDataSize > 0)
+    // Try to obtain the font from the asset packs mapped by the AssetManager
+    if(IApp::GetApp()->mAssetManager.FindPackData(anFilename, anData, anDataSize))
     {
-      // Load the font from the memory location specified
+      // Load the font from the memory location found
 #if (SFML_VERSION_MAJOR < 2)
       anResult = theAsset.LoadFromMemory(anData, anDataSize, anCharSize);
 #else
@@ -75,8 +82,8 @@ namespace GQE
     }
     else
     {
-      ELOG() << "FontHandler::LoadFromMemory(" << theAssetID
-        << ") Bad memory location or size!" << std::endl;
+      // Not found in any asset pack? then load the loose file instead
+      anResult = LoadFromFile(theAssetID, theAsset);
     }
 
     // Return anResult of true if successful, false otherwise
@@ -88,7 +95,27 @@ namespace GQE
     // Start with a return result of false
     bool anResult = false;
 
-    // TODO: Add load from network for this asset
+    // Retrieve the filename for this asset
+    std::string anFilename = GetFilename(theAssetID);
+
+    // The copy of the font fetched into the network cache
+    std::string anCached;
+
+    // Fetch the font from the content server used by the AssetManager
+    if(IApp::GetApp()->mAssetManager.GetNetworkSource().Fetch(anFilename, anCached))
+    {
+      // Load the font from the cached copy
+#if (SFML_VERSION_MAJOR < 2)
+      anResult = theAsset.LoadFromFile(anCached);
+#else
+      anResult = theAsset.loadFromFile(anCached);
+#endif
+    }
+    else
+    {
+      ELOG() << "FontHandler::LoadFromNetwork(" << theAssetID
+        << ") Unable to fetch asset!" << std::endl;
+    }
 
     // Return anResult of true if successful, false otherwise
     return anResult;
@@ -5,10 +5,18 @@
  * @file src/GQE/Core/assets/ImageHandler.cpp
  * @author Ryan Lindeman
  * @date 20120428 - Initial Release
+ * @date 20130815 - Decode images in the background and upload on the main thread
+ * @date 20130816 - Load images from the asset packs mapped by the AssetManager
+ * @date 20130818 - Estimate the size of each cached image from its pixels
+ * @date 20130820 - Upload images decoded by a previous run from the TextureCache
+ * @date 20130824 - Load images fetched from a content server by the NetworkSource
  */
  
+#include <new>
 #include <TVSource/assets/ImageHandler.hpp>
+#include <TVSource/interfaces/IApp.hpp>
 #include <TVSource/loggers/Log_macros.hpp>
+#include <TVSource/utils/MappedFile.hpp>
  
 namespace GQE
 {
@@ -25,6 +33,16 @@ namespace GQE
   ImageHandler::~ImageHandler()
   {
     ILOG() << "ImageHandler::dtor()" << std::endl;
+
+#if (SFML_VERSION_MAJOR >= 2)
+    // Delete any image decoded but never uploaded
+    std::map<const typeAssetID, sf::Image*>::iterator iter;
+    for(iter = mDecoded.begin(); iter != mDecoded.end(); iter++)
+    {
+      delete iter->second;
+    }
+    mDecoded.clear();
+#endif
   }
 
 #if (SFML_VERSION_MAJOR < 2)
@@ -49,7 +67,16 @@ namespace GQE
       // Don't forget to set smoothing to false to better support tile base games
       theAsset.SetSmooth(false);
 #else
-      anResult = theAsset.loadFromFile(anFilename);
+      // Map the image file so its cached pixels (if any) can be used
+      MappedFile anSource;
+      if(anSource.Open(anFilename))
+      {
+        anResult = LoadTexture(anFilename, anSource.GetData(), anSource.GetSize(), theAsset);
+      }
+      else
+      {
+        anResult = theAsset.loadFromFile(anFilename);
+      }
 #endif
     }
     else
@@ -71,28 +98,30 @@ namespace GQE
     // Start with a return result of false
     bool anResult = false;
 
-    // TODO: Retrieve the const char* pointer to load data from
+    // Retrieve the filename for this asset
+    std::string anFilename = GetFilename(theAssetID);
+
+    // The location and size in bytes of the image within an asset pack
     const char* anData = NULL;
-    // TODO: Retrieve the size in bytes of the font to load from memory
     size_t anDataSize = 0;
 
-    // Try to obtain the font from the memory location specified
-    if(NULL != anData && anDataSize > 0)
+    // Try to obtain the image from the asset packs mapped by the AssetManager
+    if(IApp::GetApp()->mAssetManager.FindPackData(anFilename, anData, anDataSize))
     {
-      // Load the image from the memory location specified
+      // Load the image from the memory location found
 #if (SFML_VERSION_MAJOR < 2)
       anResult = theAsset.LoadFromMemory(anData, anDataSize);
 
       // Don't forget to set smoothing to false to better support tile base games
       theAsset.SetSmooth(false);
 #else
-      anResult = theAsset.loadFromMemory(anData, anDataSize);
+      anResult = LoadTexture(anFilename, anData, anDataSize, theAsset);
 #endif
     }
     else
     {
-      ELOG() << "ImageHandler::LoadFromMemory(" << theAssetID
-        << ") Bad memory location or size!" << std::endl;
+      // Not found in any asset pack? then load the loose file instead
+      anResult = LoadFromFile(theAssetID, theAsset);
     }
 
     // Return anResult of true if successful, false otherwise
@@ -108,11 +137,241 @@ namespace GQE
     // Start with a return result of false
     bool anResult = false;
 
-    // TODO: Add load from network for this asset
+    // Retrieve the filename for this asset
+    std::string anFilename = GetFilename(theAssetID);
+
+    // The copy of the image fetched into the network cache
+    std::string anCached;
+
+    // Fetch the image from the content server used by the AssetManager
+    if(IApp::GetApp()->mAssetManager.GetNetworkSource().Fetch(anFilename, anCached))
+    {
+      // Load the image from the cached copy
+#if (SFML_VERSION_MAJOR < 2)
+      anResult = theAsset.LoadFromFile(anCached);
+
+      // Don't forget to set smoothing to false to better support tile base games
+      theAsset.SetSmooth(false);
+#else
+      // Map the cached copy so the pixels cached for anFilename can be used
+      MappedFile anSource;
+      if(anSource.Open(anCached))
+      {
+        anResult = LoadTexture(anFilename, anSource.GetData(), anSource.GetSize(), theAsset);
+      }
+#endif
+    }
+    else
+    {
+      ELOG() << "ImageHandler::LoadFromNetwork(" << theAssetID
+        << ") Unable to fetch asset!" << std::endl;
+    }
+
+    // Return anResult of true if successful, false otherwise
+    return anResult;
+  }
+
+#if (SFML_VERSION_MAJOR >= 2)
+  bool ImageHandler::LoadInBackground(const typeAssetID theAssetID,
+    sf::Texture& theAsset, AssetLoadStyle theLoadStyle)
+  {
+    // Start with a return result of false
+    bool anResult = false;
+
+    if(AssetLoadFromFile == theLoadStyle || AssetLoadFromMemory == theLoadStyle ||
+      AssetLoadFromNetwork == theLoadStyle)
+    {
+      // Retrieve the filename for this asset
+      std::string anFilename = GetFilename(theAssetID);
+
+      // The file to decode, which is the copy fetched from the content server
+      // when loading from the network
+      std::string anLocal = anFilename;
+
+      // The location and size in bytes of the image file contents
+      const char* anData = NULL;
+      size_t anDataSize = 0;
+
+      // Was a valid filename found? then attempt to decode the image
+      if(anFilename.length() > 0)
+      {
+        sf::Image* anImage = new(std::nothrow) sf::Image();
+        if(NULL != anImage)
+        {
+          // Fetch the image on this worker thread so the main thread never
+          // waits on the content server
+          if(AssetLoadFromNetwork == theLoadStyle &&
+            !IApp::GetApp()->mAssetManager.GetNetworkSource().Fetch(anFilename, anLocal))
+          {
+            ELOG() << "ImageHandler::LoadInBackground(" << theAssetID
+              << ") Unable to fetch asset!" << std::endl;
+            anLocal.clear();
+          }
+
+          // Use the asset packs or fall back to mapping the loose file
+          MappedFile anSource;
+          if(AssetLoadFromMemory != theLoadStyle ||
+            !IApp::GetApp()->mAssetManager.FindPackData(anFilename, anData, anDataSize))
+          {
+            if(anSource.Open(anLocal))
+            {
+              anData = anSource.GetData();
+              anDataSize = anSource.GetSize();
+            }
+          }
+
+          // The pixels cached by a previous run and their dimensions
+          MappedFile anCached;
+          const Uint8* anPixels = NULL;
+          Uint32 anWidth = 0;
+          Uint32 anHeight = 0;
+
+          if(NULL == anData)
+          {
+            anResult = !anLocal.empty() && anImage->loadFromFile(anLocal);
+          }
+          else if(IApp::GetApp()->mAssetManager.GetTextureCache().Find(anFilename,
+            anData, anDataSize, anCached, anPixels, anWidth, anHeight))
+          {
+            // Copy the cached pixels instead of decoding the image again
+            anImage->create(anWidth, anHeight, anPixels);
+            anResult = true;
+          }
+          else
+          {
+            anResult = DecodeImage(anFilename, anData, anDataSize, *anImage);
+          }
+        }
+
+        if(anResult)
+        {
+          // Keep the decoded image until FinishInForeground uploads it
+          sf::Lock anLock(mDecodedMutex);
+          delete mDecoded[theAssetID];
+          mDecoded[theAssetID] = anImage;
+        }
+        else
+        {
+          delete anImage;
+        }
+      }
+      else
+      {
+        ELOG() << "ImageHandler::LoadInBackground(" << theAssetID
+          << ") No filename provided!" << std::endl;
+      }
+    }
+    else
+    {
+      // Other styles are loaded by FinishInForeground on the main thread
+      anResult = true;
+    }
+
+    // Return anResult of true if successful, false otherwise
+    return anResult;
+  }
+
+  bool ImageHandler::FinishInForeground(const typeAssetID theAssetID,
+    sf::Texture& theAsset)
+  {
+    // Start with a return result of false
+    bool anResult = false;
+
+    // Retrieve the image decoded by LoadInBackground (if any)
+    sf::Image* anImage = NULL;
+    {
+      sf::Lock anLock(mDecodedMutex);
+      std::map<const typeAssetID, sf::Image*>::iterator iter;
+      iter = mDecoded.find(theAssetID);
+      if(iter != mDecoded.end())
+      {
+        anImage = iter->second;
+        mDecoded.erase(iter);
+      }
+    }
+
+    if(NULL != anImage)
+    {
+      // Upload the decoded image into the texture
+      anResult = theAsset.loadFromImage(*anImage);
+      delete anImage;
+    }
+    else
+    {
+      ELOG() << "ImageHandler::FinishInForeground(" << theAssetID
+        << ") No decoded image found!" << std::endl;
+    }
+
+    // Return anResult of true if successful, false otherwise
+    return anResult;
+  }
+#endif
+
+#if (SFML_VERSION_MAJOR >= 2)
+  bool ImageHandler::LoadTexture(const std::string& theFilename,
+    const char* theSource, size_t theSourceSize, sf::Texture& theAsset)
+  {
+    // Start with a return result of false
+    bool anResult = false;
+
+    // The pixels cached by a previous run and their dimensions
+    MappedFile anCached;
+    const Uint8* anPixels = NULL;
+    Uint32 anWidth = 0;
+    Uint32 anHeight = 0;
+
+    if(IApp::GetApp()->mAssetManager.GetTextureCache().Find(theFilename,
+      theSource, theSourceSize, anCached, anPixels, anWidth, anHeight))
+    {
+      // Upload the cached pixels straight from the mapping
+      anResult = theAsset.create(anWidth, anHeight);
+      if(anResult)
+      {
+        theAsset.update(anPixels);
+      }
+    }
+    else
+    {
+      // Decode the image and upload it
+      sf::Image anImage;
+      anResult = DecodeImage(theFilename, theSource, theSourceSize, anImage) &&
+        theAsset.loadFromImage(anImage);
+    }
 
     // Return anResult of true if successful, false otherwise
     return anResult;
   }
+
+  bool ImageHandler::DecodeImage(const std::string& theFilename,
+    const char* theSource, size_t theSourceSize, sf::Image& theImage)
+  {
+    // Decode the image file contents provided
+    bool anResult = theImage.loadFromMemory(theSource, theSourceSize);
+
+    // Cache the pixels decoded so the next run can skip decoding them
+    if(anResult)
+    {
+      IApp::GetApp()->mAssetManager.GetTextureCache().Store(theFilename,
+        theSource, theSourceSize, theImage.getSize().x, theImage.getSize().y,
+        theImage.getPixelsPtr());
+    }
+
+    // Return anResult of true if successful, false otherwise
+    return anResult;
+  }
+#endif
+
+#if (SFML_VERSION_MAJOR < 2)
+  Uint64 ImageHandler::GetAssetBytes(const sf::Image& theAsset) const
+  {
+    return (Uint64)theAsset.GetWidth() * theAsset.GetHeight() * 4;
+  }
+#else
+  Uint64 ImageHandler::GetAssetBytes(const sf::Texture& theAsset) const
+  {
+    return (Uint64)theAsset.getSize().x * theAsset.getSize().y * 4;
+  }
+#endif
 } // namespace GQE
 
 /**
@@ -5,11 +5,15 @@
  * @file include/GQE/Core/assets/ImageHandler.hpp
  * @author Ryan Lindeman
  * @date 20120428 - Initial Release
+ * @date 20130815 - Decode images in the background and upload on the main thread
+ * @date 20130818 - Estimate the size of each cached image from its pixels
+ * @date 20130820 - Upload images decoded by a previous run from the TextureCache
  */
 #pragma once//added to make MSVC 2010 stop complaining.
 #ifndef   CORE_IMAGE_HANDLER_HPP_INCLUDED
 #define   CORE_IMAGE_HANDLER_HPP_INCLUDED
  
+#include <map>
 #include <SFML/Graphics.hpp>
 #include <TVSource/Core/Core_types.hpp>
 #include <TVSource/Interfaces/TAssetHandler.hpp>
@@ -78,7 +82,76 @@ namespace GQE
     virtual bool LoadFromNetwork(const typeAssetID theAssetID, sf::Texture& theAsset);
 #endif
 
+#if (SFML_VERSION_MAJOR >= 2)
+    /**
+     * LoadInBackground is called from an AssetLoader worker thread and will
+     * decode the image file (or its contents in an asset pack) into an
+     * sf::Image waiting to be uploaded by FinishInForeground, since textures
+     * can only be created on the main thread.
+     * @param[in] theAssetID of the asset to be loaded
+     * @param[in] theAsset to load
+     * @param[in] theLoadStyle (File, Mem, Network) to use when loading this asset
+     * @return true if the image was successfully decoded, false otherwise
+     */
+    virtual bool LoadInBackground(const typeAssetID theAssetID, sf::Texture& theAsset,
+      AssetLoadStyle theLoadStyle);
+
+    /**
+     * FinishInForeground is called on the main thread and will upload the
+     * image decoded by LoadInBackground into theAsset texture provided.
+     * @param[in] theAssetID of the asset to be finished
+     * @param[in] theAsset to finish
+     * @return true if the texture was successfully created, false otherwise
+     */
+    virtual bool FinishInForeground(const typeAssetID theAssetID, sf::Texture& theAsset);
+#endif
+
+    /**
+     * GetAssetBytes will estimate the memory used by theAsset as 4 bytes
+     * (RGBA) for each pixel.
+     * @param[in] theAsset to estimate the size of
+     * @return the estimated size of theAsset in bytes
+     */
+#if (SFML_VERSION_MAJOR < 2)
+    virtual Uint64 GetAssetBytes(const sf::Image& theAsset) const;
+#else
+    virtual Uint64 GetAssetBytes(const sf::Texture& theAsset) const;
+#endif
+
   private:
+#if (SFML_VERSION_MAJOR >= 2)
+    /**
+     * LoadTexture will upload the pixels cached for theSource provided
+     * straight into theAsset texture or, if none are cached yet, decode
+     * theSource and cache its pixels for the next run.
+     * @param[in] theFilename of the image file
+     * @param[in] theSource contents of the image file
+     * @param[in] theSourceSize of the image file in bytes
+     * @param[in] theAsset texture to load
+     * @return true if the texture was successfully created, false otherwise
+     */
+    bool LoadTexture(const std::string& theFilename, const char* theSource,
+      size_t theSourceSize, sf::Texture& theAsset);
+
+    /**
+     * DecodeImage will decode theSource provided into theImage provided and
+     * store its pixels in the TextureCache for the next run.
+     * @param[in] theFilename of the image file
+     * @param[in] theSource contents of the image file
+     * @param[in] theSourceSize of the image file in bytes
+     * @param[in] theImage to decode into
+     * @return true if theSource was successfully decoded, false otherwise
+     */
+    bool DecodeImage(const std::string& theFilename, const char* theSource,
+      size_t theSourceSize, sf::Image& theImage);
+
+    // Variables
+    ///////////////////////////////////////////////////////////////////////////
+    /// Images decoded in the background waiting to be uploaded
+    std::map<const typeAssetID, sf::Image*> mDecoded;
+    /// Mutex that protects mDecoded from the AssetLoader worker threads
+    sf::Mutex mDecodedMutex;
+#endif
   }; // class ImageHandler
 } // namespace GQE
 
@@ -88,7 +161,10 @@ namespace GQE
  * @class GQE::ImageHandler
  * @ingroup Core
  * The ImageHandler class is used to reference count and manage all sf::Image
- * classes used in a GQE application.
+ * classes used in a GQE application. When loaded by the AssetLoader each
+ * image is decoded on a worker thread and only the texture upload is done on
+ * the main thread. The pixels of each image decoded are kept in the
+ * TextureCache of the AssetManager so later runs can skip decoding it.
  *
  * Copyright (c) 2010-2012 Ryan Lindeman
  * Permission is hereby granted, free of charge, to any person obtaining a copy
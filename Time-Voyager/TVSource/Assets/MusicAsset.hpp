@@ -13,6 +13,7 @@
  * @date 20120512 - Use new RAII Asset and Asset Handler management style
  * @date 20120514 - Add default constructor for missing Asset ID at construction
  * @date 20120615 - Adjust comments for default constructor
+ * @date 20130816 - Default to loading from asset packs in release builds
  */
 #ifndef   CORE_MUSIC_ASSET_HPP_INCLUDED
 #define   CORE_MUSIC_ASSET_HPP_INCLUDED
@@ -43,7 +44,7 @@ namespace GQE
        */
       MusicAsset(const typeAssetID theAssetID,
         AssetLoadTime theLoadTime = AssetLoadLater,
-        AssetLoadStyle theLoadStyle = AssetLoadFromFile,
+        AssetLoadStyle theLoadStyle = AssetLoadFromDefault,
         AssetDropTime theDropTime = AssetDropAtZero);
 
       /**
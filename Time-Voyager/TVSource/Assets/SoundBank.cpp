@@ -0,0 +1,200 @@
+/**
+ * Provides the SoundBank class in the GQE namespace which is responsible for
+ * loading a group of sound effects together on the AssetLoader worker
+ * threads and reporting the memory they use.
+ *
+ * @file src/GQE/Core/assets/SoundBank.cpp
+ * @author Ryan Lindeman
+ * @date 20130821 - Initial Release
+ */
+
+#include <new>
+#include <TVSource/assets/SoundBank.hpp>
+#include <TVSource/loggers/Log_macros.hpp>
+
+namespace GQE
+{
+  SoundBank::SoundBank(const std::string theBankID) :
+    mBankID(theBankID)
+  {
+    ILOG() << "SoundBank::ctor(" << mBankID << ")" << std::endl;
+  }
+
+  SoundBank::~SoundBank()
+  {
+    ILOG() << "SoundBank::dtor(" << mBankID << ")" << std::endl;
+
+    // Wait for the background loads still in progress
+    Wait();
+
+    // Report the memory used by the bank one last time
+    LogStats();
+
+    // Drop the reference to each sound
+    std::map<const typeAssetID, SoundAsset*>::iterator iter;
+    for(iter = mSounds.begin(); iter != mSounds.end(); ++iter)
+    {
+      delete iter->second;
+    }
+    mSounds.clear();
+  }
+
+  const std::string& SoundBank::GetID(void) const
+  {
+    return mBankID;
+  }
+
+  void SoundBank::AddSound(const typeAssetID theAssetID, AssetLoadStyle theLoadStyle)
+  {
+    // Only add each sound once
+    if(mSounds.find(theAssetID) == mSounds.end())
+    {
+      SoundAsset* anSound = new(std::nothrow) SoundAsset(theAssetID,
+        AssetLoadLater, theLoadStyle);
+      if(NULL != anSound)
+      {
+        mSounds[theAssetID] = anSound;
+      }
+      else
+      {
+        ELOG() << "SoundBank(" << mBankID << ")::AddSound(" << theAssetID
+          << ") unable to allocate sound" << std::endl;
+      }
+    }
+  }
+
+  SoundAsset* SoundBank::GetSound(const typeAssetID theAssetID)
+  {
+    // Default to NULL if theAssetID was never added
+    SoundAsset* anResult = NULL;
+
+    std::map<const typeAssetID, SoundAsset*>::iterator iter;
+    iter = mSounds.find(theAssetID);
+    if(iter != mSounds.end())
+    {
+      anResult = iter->second;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  void SoundBank::LoadAsync(void)
+  {
+    // Start timing the background loads if none are in progress
+    if(mLoads.empty())
+    {
+      mLoadClock.restart();
+    }
+
+    // Queue each sound that isn't loaded or being loaded already
+    std::map<const typeAssetID, SoundAsset*>::iterator iter;
+    for(iter = mSounds.begin(); iter != mSounds.end(); ++iter)
+    {
+      AssetLoadState anState = iter->second->GetLoadState();
+      if(AssetLoadIdle == anState || AssetLoadFailed == anState)
+      {
+        mLoads.push_back(iter->second->LoadAsync());
+      }
+    }
+  }
+
+  bool SoundBank::IsDone(void)
+  {
+    // Forget each background load that is done
+    for(size_t iloop = mLoads.size(); iloop > 0; iloop--)
+    {
+      if(mLoads[iloop - 1].IsDone())
+      {
+        mLoads.erase(mLoads.begin() + (iloop - 1));
+
+        // Report the memory used once the last load is done
+        if(mLoads.empty())
+        {
+          ILOG() << "SoundBank(" << mBankID << ")::IsDone() loaded in "
+            << mLoadClock.getElapsedTime().asMilliseconds() << "ms" << std::endl;
+          LogStats();
+        }
+      }
+    }
+
+    // Return true if every background load is done
+    return mLoads.empty();
+  }
+
+  bool SoundBank::Wait(void)
+  {
+    // Wait for each background load in the order they were queued
+    for(size_t iloop = 0; iloop < mLoads.size(); iloop++)
+    {
+      mLoads[iloop].Wait();
+    }
+    IsDone();
+
+    // Return true if every sound was loaded
+    return GetStats().loaded == (Uint32)mSounds.size();
+  }
+
+  typeSoundBankStats SoundBank::GetStats(void) const
+  {
+    // Start with empty statistics
+    typeSoundBankStats anResult = typeSoundBankStats();
+    anResult.count = (Uint32)mSounds.size();
+
+    // Add the samples of each sound loaded together
+    std::map<const typeAssetID, SoundAsset*>::const_iterator iter;
+    for(iter = mSounds.begin(); iter != mSounds.end(); ++iter)
+    {
+      if(iter->second->IsLoaded())
+      {
+        const sf::SoundBuffer& anBuffer = iter->second->GetAsset();
+        anResult.loaded++;
+#if (SFML_VERSION_MAJOR < 2)
+        anResult.samples += anBuffer.GetSamplesCount();
+        anResult.seconds += anBuffer.GetDuration();
+#else
+        anResult.samples += anBuffer.getSampleCount();
+        anResult.seconds += anBuffer.getDuration().asSeconds();
+#endif
+      }
+      else if(AssetLoadFailed == iter->second->GetLoadState())
+      {
+        anResult.failed++;
+      }
+    }
+    anResult.bytes = anResult.samples * sizeof(sf::Int16);
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  void SoundBank::LogStats(void) const
+  {
+    typeSoundBankStats anStats = GetStats();
+    ILOG() << "SoundBank(" << mBankID << ") sounds=" << anStats.loaded
+      << "/" << anStats.count << " failed=" << anStats.failed
+      << " samples=" << anStats.samples << " bytes=" << anStats.bytes
+      << " seconds=" << anStats.seconds << std::endl;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
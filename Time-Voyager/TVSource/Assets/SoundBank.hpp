@@ -0,0 +1,151 @@
+/**
+ * Provides the SoundBank class in the GQE namespace which is responsible for
+ * loading a group of sound effects together on the AssetLoader worker
+ * threads and reporting the memory they use.
+ *
+ * @file include/GQE/Core/assets/SoundBank.hpp
+ * @author Ryan Lindeman
+ * @date 20130821 - Initial Release
+ */
+#ifndef   CORE_SOUND_BANK_HPP_INCLUDED
+#define   CORE_SOUND_BANK_HPP_INCLUDED
+
+#include <map>
+#include <string>
+#include <vector>
+#include <TVSource/Assets/SoundAsset.hpp>
+#include <TVSource/Managers/AssetLoadHandle.hpp>
+#include <TVSource/Core/Core_types.hpp>
+
+namespace GQE
+{
+  /// Provides a group of sound effects loaded together
+  class GQE_API SoundBank
+  {
+    public:
+      /**
+       * SoundBank constructor
+       * @param[in] theBankID to identify this bank in the log
+       */
+      SoundBank(const std::string theBankID);
+
+      /**
+       * SoundBank deconstructor will log the memory statistics of the bank
+       * and drop the reference to each sound in the bank
+       */
+      virtual ~SoundBank();
+
+      /**
+       * GetID will return the ID of this bank.
+       * @return the ID of this bank
+       */
+      const std::string& GetID(void) const;
+
+      /**
+       * AddSound will add theAssetID sound provided to this bank. The sound
+       * is loaded the next time LoadAsync is called.
+       * @param[in] theAssetID of the sound to add
+       * @param[in] theLoadStyle (File, Mem, Network) to use when loading the sound
+       */
+      void AddSound(const typeAssetID theAssetID,
+        AssetLoadStyle theLoadStyle = AssetLoadFromDefault);
+
+      /**
+       * GetSound will return the sound of theAssetID provided or NULL if
+       * theAssetID was never added to this bank.
+       * @param[in] theAssetID of the sound to find
+       * @return pointer to the sound found or NULL if not found
+       */
+      SoundAsset* GetSound(const typeAssetID theAssetID);
+
+      /**
+       * LoadAsync will queue every sound of this bank that isn't loaded yet
+       * to be decoded by the AssetLoader worker threads, so the sounds of a
+       * large bank are decoded in parallel instead of one after another.
+       */
+      void LoadAsync(void);
+
+      /**
+       * IsDone will return true once no sound of this bank is being loaded
+       * anymore, whether or not each load was successful. The memory
+       * statistics are logged the first time every load is done.
+       * @return true if every sound queued by LoadAsync is done loading
+       */
+      bool IsDone(void);
+
+      /**
+       * Wait will block the calling (main) thread until every sound queued
+       * by LoadAsync is done loading.
+       * @return true if every sound was loaded, false otherwise
+       */
+      bool Wait(void);
+
+      /**
+       * GetStats will return the memory statistics of the sounds in this bank.
+       * @return the memory statistics of this bank
+       */
+      typeSoundBankStats GetStats(void) const;
+
+      /**
+       * LogStats will write the memory statistics of this bank to the log.
+       */
+      void LogStats(void) const;
+
+    private:
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// The ID of this bank
+      const std::string mBankID;
+      /// Each sound of this bank by Asset ID
+      std::map<const typeAssetID, SoundAsset*> mSounds;
+      /// The background loads queued by LoadAsync that aren't done yet
+      std::vector<AssetLoadHandle> mLoads;
+      /// Clock started by LoadAsync to time the background loads
+      sf::Clock mLoadClock;
+
+      /**
+       * SoundBank copy constructor is private because we do not allow copies
+       * of our class
+       */
+      SoundBank(const SoundBank&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      SoundBank& operator=(const SoundBank&); // Intentionally undefined
+  }; // class SoundBank
+} // namespace GQE
+
+#endif // CORE_SOUND_BANK_HPP_INCLUDED
+
+/**
+ * @class GQE::SoundBank
+ * @ingroup Core
+ * The SoundBank class keeps a reference to each sound effect of a group
+ * (e.g. the effects used by a state) and loads them together using
+ * LoadAsync, so each sound is decoded by one of the AssetLoader worker
+ * threads instead of all of them being decoded one after another while
+ * the state is initialized. The number of samples and bytes used by the
+ * sounds of each bank are written to the log once the bank is loaded and
+ * again when it is destroyed.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
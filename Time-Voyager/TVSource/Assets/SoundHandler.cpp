@@ -5,10 +5,16 @@
  * @file src/GQE/Core/assets/SoundHandler.cpp
  * @author Ryan Lindeman
  * @date 20120428 - Initial Release
+ * @date 20130816 - Load sounds from the asset packs mapped by the AssetManager
+ * @date 20130818 - Estimate the size of each cached sound from its samples
+ * @date 20130821 - Load sounds decoded by a previous run from the SoundCache
+ * @date 20130824 - Load sounds fetched from a content server by the NetworkSource
  */
  
 #include <TVSource/assets/SoundHandler.hpp>
+#include <TVSource/interfaces/IApp.hpp>
 #include <TVSource/loggers/Log_macros.hpp>
+#include <TVSource/utils/MappedFile.hpp>
  
 namespace GQE
 {
@@ -38,7 +44,16 @@ namespace GQE
 #if (SFML_VERSION_MAJOR < 2)
       anResult = theAsset.LoadFromFile(anFilename);
 #else
-      anResult = theAsset.loadFromFile(anFilename);
+      // Map the sound file so its cached samples (if any) can be used
+      MappedFile anSource;
+      if(anSource.Open(anFilename))
+      {
+        anResult = LoadSamples(anFilename, anSource.GetData(), anSource.GetSize(), theAsset);
+      }
+      else
+      {
+        anResult = theAsset.loadFromFile(anFilename);
+      }
 #endif
     }
     else
@@ -56,25 +71,27 @@ namespace GQE
     // Start with a return result of false
     bool anResult = false;
 
-    // TODO: Retrieve the const char* pointer to load data from
+    // Retrieve the filename for this asset
+    std::string anFilename = GetFilename(theAssetID);
+
+    // The location and size in bytes of the sound within an asset pack
     const char* anData = NULL;
-    // TODO: Retrieve the size in bytes of the font to load from memory
     size_t anDataSize = 0;
 
-    // Try to obtain the font from the memory location specified
-    if(NULL != anData && anDataSize > 0)
+    // Try to obtain the sound from the asset packs mapped by the AssetManager
+    if(IApp::GetApp()->mAssetManager.FindPackData(anFilename, anData, anDataSize))
     {
-      // Load the image from the memory location specified
+      // Load the sound from the memory location found
 #if (SFML_VERSION_MAJOR < 2)
       anResult = theAsset.LoadFromMemory(anData, anDataSize);
 #else
-      anResult = theAsset.loadFromMemory(anData, anDataSize);
+      anResult = LoadSamples(anFilename, anData, anDataSize, theAsset);
 #endif
     }
     else
     {
-      ELOG() << "SoundHandler::LoadFromMemory(" << theAssetID
-        << ") Bad memory location or size!" << std::endl;
+      // Not found in any asset pack? then load the loose file instead
+      anResult = LoadFromFile(theAssetID, theAsset);
     }
 
     // Return anResult of true if successful, false otherwise
@@ -86,11 +103,84 @@ namespace GQE
     // Start with a return result of false
     bool anResult = false;
 
-    // TODO: Add load from network for this asset
+    // Retrieve the filename for this asset
+    std::string anFilename = GetFilename(theAssetID);
+
+    // The copy of the sound fetched into the network cache
+    std::string anCached;
+
+    // Fetch the sound from the content server used by the AssetManager
+    if(IApp::GetApp()->mAssetManager.GetNetworkSource().Fetch(anFilename, anCached))
+    {
+      // Load the sound from the cached copy
+#if (SFML_VERSION_MAJOR < 2)
+      anResult = theAsset.LoadFromFile(anCached);
+#else
+      // Map the cached copy so the samples cached for anFilename can be used
+      MappedFile anSource;
+      if(anSource.Open(anCached))
+      {
+        anResult = LoadSamples(anFilename, anSource.GetData(), anSource.GetSize(), theAsset);
+      }
+#endif
+    }
+    else
+    {
+      ELOG() << "SoundHandler::LoadFromNetwork(" << theAssetID
+        << ") Unable to fetch asset!" << std::endl;
+    }
 
     // Return anResult of true if successful, false otherwise
     return anResult;
   }
+
+#if (SFML_VERSION_MAJOR >= 2)
+  bool SoundHandler::LoadSamples(const std::string& theFilename,
+    const char* theSource, size_t theSourceSize, sf::SoundBuffer& theAsset)
+  {
+    // Start with a return result of false
+    bool anResult = false;
+
+    // The samples cached by a previous run and their format
+    SoundCache& anCache = IApp::GetApp()->mAssetManager.GetSoundCache();
+    MappedFile anCached;
+    const Int16* anSamples = NULL;
+    Uint64 anSampleCount = 0;
+    Uint32 anChannelCount = 0;
+    Uint32 anSampleRate = 0;
+
+    if(anCache.Find(theFilename, theSource, theSourceSize, anCached,
+      anSamples, anSampleCount, anChannelCount, anSampleRate))
+    {
+      // Load the cached samples straight from the mapping
+      anResult = theAsset.loadFromSamples((const sf::Int16*)anSamples,
+        (std::size_t)anSampleCount, anChannelCount, anSampleRate);
+    }
+    else
+    {
+      // Decode the sound and cache its samples for the next run
+      anResult = theAsset.loadFromMemory(theSource, theSourceSize);
+      if(anResult)
+      {
+        anCache.Store(theFilename, theSource, theSourceSize,
+          (const Int16*)theAsset.getSamples(), theAsset.getSampleCount(),
+          theAsset.getChannelCount(), theAsset.getSampleRate());
+      }
+    }
+
+    // Return anResult of true if successful, false otherwise
+    return anResult;
+  }
+#endif
+
+  Uint64 SoundHandler::GetAssetBytes(const sf::SoundBuffer& theAsset) const
+  {
+#if (SFML_VERSION_MAJOR < 2)
+    return (Uint64)theAsset.GetSamplesCount() * sizeof(sf::Int16);
+#else
+    return (Uint64)theAsset.getSampleCount() * sizeof(sf::Int16);
+#endif
+  }
 } // namespace GQE
  
 /**
@@ -5,6 +5,8 @@
  * @file include/GQE/Core/assets/MusicHandler.hpp
  * @author Ryan Lindeman
  * @date 20120428 - Initial Release
+ * @date 20130818 - Estimate the size of each cached sound from its samples
+ * @date 20130821 - Load sounds decoded by a previous run from the SoundCache
  */
 #ifndef   CORE_SOUND_HANDLER_HPP_INCLUDED
 #define   CORE_SOUND_HANDLER_HPP_INCLUDED
@@ -60,7 +62,29 @@ namespace GQE
      */
     virtual bool LoadFromNetwork(const typeAssetID theAssetID, sf::SoundBuffer& theAsset);
 
+    /**
+     * GetAssetBytes will estimate the memory used by theAsset from the
+     * number of 16 bit samples it holds.
+     * @param[in] theAsset to estimate the size of
+     * @return the estimated size of theAsset in bytes
+     */
+    virtual Uint64 GetAssetBytes(const sf::SoundBuffer& theAsset) const;
+
   private:
+#if (SFML_VERSION_MAJOR >= 2)
+    /**
+     * LoadSamples will load the samples cached for theSource provided
+     * straight into theAsset sound buffer or, if none are cached yet, decode
+     * theSource and cache its samples for the next run.
+     * @param[in] theFilename of the sound file
+     * @param[in] theSource contents of the sound file
+     * @param[in] theSourceSize of the sound file in bytes
+     * @param[in] theAsset sound buffer to load
+     * @return true if the sound buffer was successfully loaded, false otherwise
+     */
+    bool LoadSamples(const std::string& theFilename, const char* theSource,
+      size_t theSourceSize, sf::SoundBuffer& theAsset);
+#endif
   }; // class SoundHandler
 } // namespace GQE
 
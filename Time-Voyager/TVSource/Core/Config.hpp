@@ -16,6 +16,7 @@
  * @date 20120211 - Next minor release of GQE
  * @date 20120211 - Next minor release of GQE
  * @date 20120330 - Next minor release of GQE
+ * @date 20130806 - Added portable thread local storage macro
  */
 #ifndef GQE_CONFIG_HPP
 #define GQE_CONFIG_HPP
@@ -95,6 +96,22 @@
 #endif
 
 
+////////////////////////////////////////////////////////////
+// Define a portable thread local storage macro
+////////////////////////////////////////////////////////////
+#if defined(_MSC_VER)
+
+/// Define the GQE thread local storage specifier for Visual C++ compilers
+#define GQE_THREAD_LOCAL __declspec(thread)
+
+#else
+
+/// Define the GQE thread local storage specifier for GCC compatible compilers
+#define GQE_THREAD_LOCAL __thread
+
+#endif
+
+
 ////////////////////////////////////////////////////////////
 // Define portable import / export macros
 ////////////////////////////////////////////////////////////
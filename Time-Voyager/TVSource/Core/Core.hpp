@@ -12,6 +12,20 @@
  * @date 20120512 - Add new Asset Handler classes
  * @date 20120702 - Add new EventManager and IEvent classes
  * @date 20120720 - Moved PropertyManager to Core library from Entity library beep
+ * @date 20130802 - Add new BenchmarkManager class
+ * @date 20130805 - Add new AtomicUtil and StatHistogram includes
+ * @date 20130806 - Add new ProfileManager class and Profile macros
+ * @date 20130807 - Add new PerfCounters include
+ * @date 20130808 - Add new AllocTracker include
+ * @date 20130809 - Add new AsyncLogger class
+ * @date 20130810 - Add new BinaryLogger and LogRecord classes
+ * @date 20130811 - Add new FlightRecorder class
+ * @date 20130812 - Add new MappedFile class
+ * @date 20130815 - Add new AssetLoader and AssetLoadHandle classes
+ * @date 20130821 - Add new SoundBank, DecodeCache, SoundCache, TextureCache and AssetPack
+ * @date 20130823 - Add new MusicManager class
+ * @date 20130824 - Add new NetworkSource class
+ * @date 20130825 - Add new IEventQueue and TEventQueue classes
  */
 #ifndef   GQE_CORE_HPP_INCLUDED
 #define   GQE_CORE_HPP_INCLUDED
@@ -32,31 +46,54 @@
 #include <TVSource/Assets/MusicAsset.hpp>
 #include <TVSource/Assets/MusicHandler.hpp>
 #include <TVSource/Assets/SoundAsset.hpp>
+#include <TVSource/Assets/SoundBank.hpp>
 #include <TVSource/Assets/SoundHandler.hpp>
+#include <TVSource/Managers/AssetLoader.hpp>
+#include <TVSource/Managers/AssetLoadHandle.hpp>
 #include <TVSource/Managers/AssetManager.hpp>
+#include <TVSource/Managers/BenchmarkManager.hpp>
 #include <TVSource/Managers/ConfigReader.hpp>
 #include <TVSource/Managers/EventManager.hpp>
+#include <TVSource/Managers/FlightRecorder.hpp>
+#include <TVSource/Managers/MusicManager.hpp>
+#include <TVSource/Managers/ProfileManager.hpp>
+#include <TVSource/Managers/Profile_macros.hpp>
 #include <TVSource/Managers/PropertyManager.hpp>
 #include <TVSource/Managers/StateManager.hpp>
 #include <TVSource/Managers/StatManager.hpp>
 #include <TVSource/Interfaces/IApp.hpp>
 #include <TVSource/Interfaces/IAssetHandler.hpp>
 #include <TVSource/Interfaces/IEvent.hpp>
+#include <TVSource/Interfaces/IEventQueue.hpp>
 #include <TVSource/Interfaces/ILogger.hpp>
 #include <TVSource/Interfaces/IProperty.hpp>
 #include <TVSource/Interfaces/IState.hpp>
 #include <TVSource/Interfaces/TAsset.hpp>
 #include <TVSource/Interfaces/TAssetHandler.hpp>
 #include <TVSource/Interfaces/TEvent.hpp>
+#include <TVSource/Interfaces/TEventQueue.hpp>
 #include <TVSource/Interfaces/TProperty.hpp>
 #include <TVSource/Loggers/Log_macros.hpp>
+#include <TVSource/Loggers/AsyncLogger.hpp>
+#include <TVSource/Loggers/BinaryLogger.hpp>
 #include <TVSource/Loggers/FatalLogger.hpp>
 #include <TVSource/Loggers/FileLogger.hpp>
+#include <TVSource/Loggers/LogRecord.hpp>
 #include <TVSource/Loggers/ScopeLogger.hpp>
 #include <TVSource/Loggers/StringLogger.hpp>
 //#include <GQE/Core/loggers/onullstream>
 //#include <GQE/Core/states/SplashState.hpp>
+#include <TVSource/Utils/AllocTracker.hpp>
+#include <TVSource/Utils/AssetPack.hpp>
+#include <TVSource/Utils/AtomicUtil.hpp>
+#include <TVSource/Utils/DecodeCache.hpp>
+#include <TVSource/Utils/MappedFile.hpp>
+#include <TVSource/Utils/NetworkSource.hpp>
+#include <TVSource/Utils/PerfCounters.hpp>
+#include <TVSource/Utils/SoundCache.hpp>
+#include <TVSource/Utils/StatHistogram.hpp>
 #include <TVSource/Utils/StringUtil.hpp>
+#include <TVSource/Utils/TextureCache.hpp>
 
 #endif // GQE_CORE_HPP_INCLUDED
 
@@ -8,11 +8,34 @@
  * @date 20120512 - Remove gApp variable (moved to IApp::gApp)
  * @date 20120512 - Force compiler to create TAsset<xyz> base classes
  * @date 20120523 - Remove unnecessary force of TAsset<xyz> base classes
+ * @date 20130802 - Added GameLoopPhase names
+ * @date 20130807 - Added PerfCounter names
  */
 #include "Core_types.hpp"
 
 namespace GQE
 {
+  /// Names of each GameLoopPhase value for use in reports and log messages
+  const char* gPhaseNames[PhaseCount] =
+  {
+    "input",
+    "fixed",
+    "variable",
+    "draw",
+    "display",
+    "cleanup",
+    "frame"
+  };
+
+  /// Names of each PerfCounter value for use in reports and log messages
+  const char* gPerfNames[PerfCount] =
+  {
+    "cycles",
+    "instructions",
+    "l1_misses",
+    "llc_misses",
+    "branch_misses"
+  };
 } // namespace GQE
 
 /**
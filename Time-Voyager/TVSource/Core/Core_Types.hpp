@@ -16,12 +16,32 @@
  * @date 20120630 - Added new GraphicRange enumeration
  * @date 20120702 - Add new EventManager and Event ID typedef
  * @date 20120720 - Moved PropertyManager to Core library from Entity library
+ * @date 20130802 - Added new GameLoopPhase enumeration and BenchmarkManager
+ * @date 20130805 - Added new StatHistogram class and typeStatSummary struct
+ * @date 20130806 - Added new ProfileManager class and profile zone types
+ * @date 20130807 - Added new PerfCounters class and hardware counter types
+ * @date 20130808 - Added new AllocTracker class and typeAllocTotals struct
+ * @date 20130809 - Added new AsyncLogger class
+ * @date 20130810 - Added new BinaryLogger and LogRecord classes and log site types
+ * @date 20130811 - Added new FlightRecorder class
+ * @date 20130812 - Added new MappedFile class
+ * @date 20130815 - Added new AssetLoader and AssetLoadHandle classes and AssetLoadState
+ * @date 20130816 - Added new AssetPack class and AssetLoadFromDefault
+ * @date 20130818 - Added AssetDropCached and typeAssetCacheStats struct
+ * @date 20130819 - Added typeAssetManifest for state asset prefetching
+ * @date 20130821 - Added DecodeCache, SoundCache, SoundBank and typeSoundBankStats
+ * @date 20130822 - Added typeVoiceStats for the SoundSystem
+ * @date 20130823 - Added new MusicManager class
+ * @date 20130824 - Added new NetworkSource class and typeNetworkStats struct
+ * @date 20130825 - Added new IEventQueue interface
  */
 #ifndef   GQE_CORE_TYPES_HPP_INCLUDED
 #define   GQE_CORE_TYPES_HPP_INCLUDED
 
 #include <map>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 #include <TVSource/Core/Config.hpp>
 
@@ -53,7 +73,19 @@ namespace GQE
   {
     AssetDropUnspecified = 0, ///< Drop/unload time unspecified, use default AtZero
     AssetDropAtZero      = 1, ///< Drop/unload when count reaches 0
-    AssetDropAtExit      = 2  ///< Drop/unload when program exits (deconstructor)
+    AssetDropAtExit      = 2, ///< Drop/unload when program exits (deconstructor)
+    AssetDropCached      = 3  ///< Cache when count reaches 0, drop/unload when evicted
+  };
+
+  /// Enumeration of AssetLoadState for assets loaded in the background
+  enum AssetLoadState
+  {
+    AssetLoadIdle     = 0, ///< No background load is in progress
+    AssetLoadQueued   = 1, ///< Waiting for an AssetLoader worker thread
+    AssetLoadDecoding = 2, ///< Being decoded by an AssetLoader worker thread
+    AssetLoadDecoded  = 3, ///< Decoded and waiting to be finished on the main thread
+    AssetLoadReady    = 4, ///< Loaded and ready to use
+    AssetLoadFailed   = 5  ///< The background load failed
   };
 
   /// Enumeration of all Asset loading techniques
@@ -62,7 +94,12 @@ namespace GQE
     AssetLoadFromUnknown = 0, ///< Error condition returned by GetLoadStyle
     AssetLoadFromFile    = 1, ///< Load the asset from a file
     AssetLoadFromMemory  = 2, ///< Load the asset from memory
-    AssetLoadFromNetwork = 3  ///< Load the asset from the network
+    AssetLoadFromNetwork = 3, ///< Load the asset from the network
+#if defined(GQE_DEBUG)
+    AssetLoadFromDefault = AssetLoadFromFile   ///< Debug builds load loose files
+#else
+    AssetLoadFromDefault = AssetLoadFromMemory ///< Release builds load from asset packs
+#endif
   };
 
   /// Enumeration of all Logging severity types
@@ -75,6 +112,43 @@ namespace GQE
     SeverityFatal         = FATAL_LEVEL   ///< Fatal severity type
   };
 
+  /// Enumeration of each timed portion of the IApp game loop
+  enum GameLoopPhase
+  {
+    PhaseInput    = 0, ///< ProcessInput portion of the game loop
+    PhaseFixed    = 1, ///< UpdateFixed portion of the game loop
+    PhaseVariable = 2, ///< UpdateVariable portion of the game loop
+    PhaseDraw     = 3, ///< Draw portion of the game loop
+    PhaseDisplay  = 4, ///< Render window display portion of the game loop
+    PhaseCleanup  = 5, ///< StateManager cleanup portion of the game loop
+    PhaseFrame    = 6, ///< Entire game loop iteration (all phases above)
+    PhaseCount    = 7  ///< Number of GameLoopPhase values (not a phase)
+  };
+
+  /// Enumeration of each hardware counter sampled by PerfCounters
+  enum PerfCounter
+  {
+    PerfCycles       = 0, ///< CPU cycles
+    PerfInstructions = 1, ///< Instructions retired
+    PerfL1Misses     = 2, ///< L1 data cache read misses
+    PerfLLCMisses    = 3, ///< Last level cache misses
+    PerfBranchMisses = 4, ///< Branch mispredictions
+    PerfCount        = 5  ///< Number of PerfCounter values (not a counter)
+  };
+
+  /// Enumeration of each argument type stored by a binary log record
+  enum LogArgumentType
+  {
+    LogArgumentInt32   = 1, ///< Signed 32 bit integer
+    LogArgumentUint32  = 2, ///< Unsigned 32 bit integer
+    LogArgumentInt64   = 3, ///< Signed 64 bit integer
+    LogArgumentUint64  = 4, ///< Unsigned 64 bit integer
+    LogArgumentDouble  = 5, ///< Double precision floating point number
+    LogArgumentBool    = 6, ///< Boolean value stored as a single byte
+    LogArgumentChar    = 7, ///< Single character
+    LogArgumentString  = 8  ///< String stored as a 16 bit length and characters
+  };
+
   /// Status Enumeration for Status Return values
   enum StatusType
   {
@@ -96,16 +170,36 @@ namespace GQE
   class IApp;
   class IAssetHandler;
   class IEvent;
+  class IEventQueue;
   class ILogger;
   class IProperty;
   class IState;
 
   // Forward declare GQE core classes provided
+  class AllocScope;
+  class AllocTracker;
+  class AssetLoadHandle;
+  class AssetLoader;
+  class AssetPack;
   class AssetManager;
+  class BenchmarkManager;
   class ConfigReader;
+  class CounterZone;
   class EventManager;
+  class FlightRecorder;
+  class DecodeCache;
+  class MappedFile;
+  class MusicManager;
+  class NetworkSource;
+  class PerfCounters;
+  class ProfileManager;
+  class ProfileZone;
   class PropertyManager;
+  class SoundCache;
   class StateManager;
+  class StatHistogram;
+  class StatManager;
+  class TextureCache;
 
   // Forward declare GQE core assets provided
   class ConfigAsset;
@@ -118,18 +212,135 @@ namespace GQE
   class MusicAsset;
   class MusicHandler;
   class SoundAsset;
+  class SoundBank;
   class SoundHandler;
 
   // Forward declare GQE core loggers provided
+  class AsyncLogger;
+  class BinaryLogger;
   class FatalLogger;
   class FileLogger;
+  class LogRecord;
   class ScopeLogger;
   class StringLogger;
 
   // Forward declare GQE core states provided
+  class BenchmarkState;
   class MenuState;
   class SplashState;
 
+  /// Names of each GameLoopPhase value for use in reports and log messages
+  extern GQE_API const char* gPhaseNames[PhaseCount];
+
+  /// Names of each PerfCounter value for use in reports and log messages
+  extern GQE_API const char* gPerfNames[PerfCount];
+
+  /// Provides the StatManager statistics of a game loop phase over its window
+  struct typeStatSummary
+  {
+    Uint32 count; ///< Number of samples recorded in the window
+    Uint32 p50;   ///< Median time in microseconds
+    Uint32 p95;   ///< 95th percentile time in microseconds
+    Uint32 p99;   ///< 99th percentile time in microseconds
+    Uint32 max;   ///< Largest time in microseconds
+  };
+
+  /// Provides a single zone recorded by the ProfileManager
+  struct typeProfileZone
+  {
+    const char* name;  ///< Zone name which must be a string literal
+    Uint64      begin; ///< Timestamp in ticks when the zone was entered
+    Uint64      end;   ///< Timestamp in ticks when the zone was exited
+  };
+
+  /// Provides the ring of zones recorded by a single thread
+  struct typeProfileRing
+  {
+    std::string      name;  ///< Thread name shown in the trace
+    Uint32           id;    ///< Thread ID shown in the trace
+    volatile Uint32  next;  ///< Total zones recorded (next index to write)
+    typeProfileZone* zones; ///< Ring of zones recorded by this thread
+  };
+
+  /// Provides a single reading of every hardware counter
+  struct typePerfSample
+  {
+    Uint64 counters[PerfCount]; ///< Counter values indexed by PerfCounter
+  };
+
+  /// Provides the hardware counter totals of a system or game loop phase
+  struct typePerfTotals
+  {
+    const char* name;                ///< Zone name which must be a string literal
+    Uint64      counters[PerfCount]; ///< Counter totals indexed by PerfCounter
+    Uint64      calls;               ///< Number of times the zone was sampled
+    Uint64      entities;            ///< Entities processed over every call
+  };
+
+  /// Provides the allocations made while an AllocTracker tag was active
+  struct typeAllocTotals
+  {
+    const char* name;   ///< Tag name (e.g. system name or game loop phase)
+    Uint64      allocs; ///< Number of allocations made
+    Uint64      bytes;  ///< Number of bytes allocated
+    Uint64      live;   ///< Number of bytes allocated and not yet freed
+  };
+
+  /// Provides the cache statistics of an asset handler (see AssetDropCached)
+  struct typeAssetCacheStats
+  {
+    Uint64 hits;      ///< Number of references revived from the cache
+    Uint64 misses;    ///< Number of references that acquired a new asset
+    Uint64 evictions; ///< Number of assets dropped to stay within the budget
+    Uint32 count;     ///< Number of assets currently in the cache
+    Uint64 bytes;     ///< Estimated bytes used by the assets in the cache
+    Uint64 budget;    ///< Most bytes the cache may use before evicting assets
+  };
+
+  /// Provides the memory statistics of a SoundBank
+  struct typeSoundBankStats
+  {
+    Uint32 count;   ///< Number of sounds in the bank
+    Uint32 loaded;  ///< Number of sounds loaded so far
+    Uint32 failed;  ///< Number of sounds that failed to load
+    Uint64 samples; ///< Number of 16 bit samples held by the sounds loaded
+    Uint64 bytes;   ///< Bytes used by the samples of the sounds loaded
+    float  seconds; ///< Total duration of the sounds loaded in seconds
+  };
+
+  /// Provides the voice statistics of a SoundSystem
+  struct typeVoiceStats
+  {
+    Uint32 active;    ///< Number of voices playing a sound now
+    Uint32 total;     ///< Number of voices in the voice pool
+    Uint64 played;    ///< Number of sounds started on a voice
+    Uint64 coalesced; ///< Number of sounds merged into the same sound of the same update
+    Uint64 limited;   ///< Number of sounds skipped because of their instance limit
+    Uint64 stolen;    ///< Number of voices stopped early for a more important sound
+    Uint64 dropped;   ///< Number of sounds skipped because every voice was more important
+  };
+
+  /// Provides the statistics of a NetworkSource
+  struct typeNetworkStats
+  {
+    Uint32 connects;  ///< Number of connections opened to the content server
+    Uint32 requests;  ///< Number of requests sent to the content server
+    Uint32 fetched;   ///< Number of files downloaded into the cache
+    Uint32 validated; ///< Number of cached files the server said are unchanged
+    Uint32 offline;   ///< Number of cached files used without the server
+    Uint32 failed;    ///< Number of files that couldn't be fetched
+    Uint64 bytes;     ///< Bytes downloaded into the cache
+  };
+
+  /// Provides the static information of a binary log call site
+  struct typeLogSite
+  {
+    SeverityType severity; ///< Severity of every message logged from the site
+    const char*  file;     ///< Source file of the site (must outlive the logger)
+    Int32        line;     ///< Source line of the site
+    const char*  format;   ///< Format of the message with {} for each argument
+  };
+
   /// Declare Asset ID typedef which is used for identifying Asset objects
   typedef std::string typeAssetID;
 
@@ -145,6 +356,9 @@ namespace GQE
   /// Declare State ID typedef which is used for identifying State objects
   typedef std::string typeStateID;
 
+  /// Declare AssetManifest typedef which lists the (Asset Handler ID, Asset ID) used by a State
+  typedef std::set<std::pair<typeAssetHandlerID, typeAssetID> > typeAssetManifest;
+
   /// Declare NameValue typedef which is used for config section maps
   typedef std::map<const std::string, const std::string> typeNameValue;
 
@@ -9,6 +9,7 @@
  * @date 20120618 - Added missing Entity classes
  * @date 20120623 - Added AnimationSystem class
  * @date 20120720 - Moved PropertyManager to Core library
+ * @date 20130822 - Added SoundSystem class
  */
 #ifndef ENTITY_HPP_INCLUDED
 #define ENTITY_HPP_INCLUDED
@@ -27,6 +28,7 @@
 #include <TVSource/Entity/systems/AnimationSystem.hpp>
 #include <TVSource/Entity/systems/MovementSystem.hpp>
 #include <TVSource/Entity/systems/RenderSystem.hpp>
+#include <TVSource/Entity/systems/SoundSystem.hpp>
 
 #endif // ENTITY_HPP_INCLUDED
 
@@ -9,6 +9,7 @@
  * @date 20120623 - Add forward declaration of ISystem derived classes
  * @date 20120627 - Add forward declaration of ActionSystem classes
  * @date 20120720 - Moved PropertyManager to Core library
+ * @date 20130822 - Add forward declaration of SoundSystem class
  */
 #ifndef ENTITY_TYPES_HPP_INCLUDED
 #define ENTITY_TYPES_HPP_INCLUDED
@@ -35,6 +36,7 @@ namespace GQE
   class AnimationSystem;
   class MovementSystem;
   class RenderSystem;
+  class SoundSystem;
 
   /// Declare Action ID typedef which is used for identifying IAction objects
   typedef std::string typeActionID;
@@ -9,6 +9,7 @@
  * @date 20120620 - Drop ourselves from registered IEntity classes
  * @date 20120622 - Fix issues with dropping IEntity classes
  * @date 20120707 - Fix pure-virtual crash which calls HandleCleanup in dtor
+ * @date 20130807 - Added GetEntityCount for hardware counters per entity
  */
 #include <TVSource/Entity/interfaces/ISystem.hpp>
 #include <TVSource/Entity/interfaces/IEntity.hpp>
@@ -118,6 +119,25 @@ namespace GQE
     return anResult;
   }
 
+  Uint32 ISystem::GetEntityCount(void) const
+  {
+    Uint32 anResult = 0;
+
+    // Add the number of IEntity classes in each z-order
+    std::map<const Uint32, std::deque<IEntity*> >::const_iterator anIter;
+    anIter = mEntities.begin();
+    while(anIter != mEntities.end())
+    {
+      anResult += (Uint32)anIter->second.size();
+
+      // Increment map iterator
+      anIter++;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
   void ISystem::DropEntity(const typeEntityID theEntityID)
   {
     // This will be set to true if theEntityID was found and dropped
@@ -13,6 +13,7 @@
  *                  EraseEntity.
  * @date 20120623 - Adjusted scope of some ISystem variables
  * @date 20120707 - Fix pure-virtual crash which calls HandleCleanup in dtor
+ * @date 20130807 - Added GetEntityCount for hardware counters per entity
  */
 #ifndef ISYSTEM_HPP_INCLUDED
 #define ISYSTEM_HPP_INCLUDED
@@ -67,6 +68,13 @@ namespace GQE
        */
       bool HasEntity(const typeEntityID theEntityID) const;
 
+      /**
+       * GetEntityCount is responsible for counting the IEntity classes
+       * currently registered with this ISystem.
+       * @return the number of IEntity classes registered
+       */
+      Uint32 GetEntityCount(void) const;
+
       /**
        * DropEntity is responsible for removing the IEntity class that matches
        * the ID provided from this ISystem derived class.
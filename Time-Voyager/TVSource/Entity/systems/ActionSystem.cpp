@@ -4,9 +4,14 @@
  * @file src/GQE/Entity/systems/ActionSystem.cpp
  * @author Jacob Dix
  * @date 20120620 - Initial Release
+ * @date 20130806 - Add profile zones for each update
+ * @date 20130807 - Add hardware counter zones for each update
+ * @date 20130808 - Add allocation scope tags for each update
  */
 #include <SFML/Graphics.hpp>
 #include <TVSource/Entity/systems/ActionSystem.hpp>
+#include <TVSource/Managers/Profile_macros.hpp>
+#include <TVSource/Utils/Alloc_macros.hpp>
 #include <TVSource/Entity/interfaces/IAction.hpp>
 #include <TVSource/Entity/interfaces/IEntity.hpp>
 #include <TVSource/Entity/classes/ActionGroup.hpp>
@@ -87,6 +92,10 @@ namespace GQE
 
   void ActionSystem::UpdateFixed()
   {
+    PROFILE_ZONE("ActionSystem::UpdateFixed");
+    CounterZone anCounters(mApp.mStatManager, "ActionSystem::UpdateFixed", GetEntityCount());
+    ALLOC_SCOPE("ActionSystem::UpdateFixed");
+
     // Search through each z-order map to find theEntityID provided
     std::map<const Uint32, std::deque<IEntity*> >::iterator anIter;
     anIter = mEntities.begin();
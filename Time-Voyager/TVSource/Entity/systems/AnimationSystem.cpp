@@ -6,10 +6,15 @@
  * @date 20120623 - Initial Release
  * @date 20120904 - Fix SFML v1.6 issues with Vector2u
  * @date 20120910 - Fix SFML v1.6 issue with frame edge check
+ * @date 20130806 - Add profile zones for each update
+ * @date 20130807 - Add hardware counter zones for each update
+ * @date 20130808 - Add allocation scope tags for each update
  */
 
 #include <SFML/System.hpp>
 #include <TVSource/Entity/systems/AnimationSystem.hpp>
+#include <TVSource/Managers/Profile_macros.hpp>
+#include <TVSource/Utils/Alloc_macros.hpp>
 #include <TVSource/Entity/interfaces/IEntity.hpp>
 
 
@@ -48,6 +53,10 @@ namespace GQE
 
   void AnimationSystem::UpdateFixed()
   {
+    PROFILE_ZONE("AnimationSystem::UpdateFixed");
+    CounterZone anCounters(mApp.mStatManager, "AnimationSystem::UpdateFixed", GetEntityCount());
+    ALLOC_SCOPE("AnimationSystem::UpdateFixed");
+
     // Search through each z-order map to find theEntityID provided
     std::map<const Uint32, std::deque<IEntity*> >::iterator anIter;
     anIter = mEntities.begin();
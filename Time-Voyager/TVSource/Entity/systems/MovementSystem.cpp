@@ -9,9 +9,14 @@
  * @date 20120622 - Small adjustments to implementation and Handle methods
  * @date 20120623 - Improved documentation and adjusted some properties
  * @date 20120630 - Improve ScreenWrap functionality using SpriteRect values
+ * @date 20130806 - Add profile zones for each update
+ * @date 20130807 - Add hardware counter zones for each update
+ * @date 20130808 - Add allocation scope tags for each update
  */
 #include <SFML/Graphics.hpp>
 #include <TVSource/Entity/systems/MovementSystem.hpp>
+#include <TVSource/Managers/Profile_macros.hpp>
+#include <TVSource/Utils/Alloc_macros.hpp>
 #include <TVSource/Entity/interfaces/IEntity.hpp>
 
 namespace GQE
@@ -46,6 +51,10 @@ namespace GQE
 
   void MovementSystem::UpdateFixed()
   {
+    PROFILE_ZONE("MovementSystem::UpdateFixed");
+    CounterZone anCounters(mApp.mStatManager, "MovementSystem::UpdateFixed", GetEntityCount());
+    ALLOC_SCOPE("MovementSystem::UpdateFixed");
+
     // Search through each z-order map to find theEntityID provided
     std::map<const Uint32, std::deque<IEntity*> >::iterator anIter;
     anIter = mEntities.begin();
@@ -103,6 +112,10 @@ namespace GQE
 
   void MovementSystem::UpdateVariable(float theElapsedTime)
   {
+    PROFILE_ZONE("MovementSystem::UpdateVariable");
+    CounterZone anCounters(mApp.mStatManager, "MovementSystem::UpdateVariable", GetEntityCount());
+    ALLOC_SCOPE("MovementSystem::UpdateVariable");
+
     // Search through each z-order map to find theEntityID provided
     std::map<const Uint32, std::deque<IEntity*> >::iterator anIter;
     anIter = mEntities.begin();
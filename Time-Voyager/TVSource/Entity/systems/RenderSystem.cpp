@@ -7,9 +7,14 @@
  * @date 20120616 - Adjustments for new PropertyManager class
  * @date 20120622 - Small adjustments to implementation and Handle methods
  * @date 20120623 - Improved documentation and adjusted some properties
+ * @date 20130806 - Add profile zones for each update
+ * @date 20130807 - Add hardware counter zones for each update
+ * @date 20130808 - Add allocation scope tags for each update
  */
 #include <SFML/Graphics.hpp>
 #include <TVSource/Entity/systems/RenderSystem.hpp>
+#include <TVSource/Managers/Profile_macros.hpp>
+#include <TVSource/Utils/Alloc_macros.hpp>
 #include <TVSource/Entity/interfaces/IEntity.hpp>
 
 namespace GQE
@@ -53,6 +58,10 @@ namespace GQE
 
   void RenderSystem::Draw()
   {
+    PROFILE_ZONE("RenderSystem::Draw");
+    CounterZone anCounters(mApp.mStatManager, "RenderSystem::Draw", GetEntityCount());
+    ALLOC_SCOPE("RenderSystem::Draw");
+
     // Search through each z-order map to find theEntityID provided
     std::map<const Uint32, std::deque<IEntity*> >::iterator anIter;
     anIter = mEntities.begin();
@@ -0,0 +1,408 @@
+/**
+ * Provides the SoundSystem class for playing the sounds of every entity in a
+ * game using a fixed pool of voices.
+ *
+ * @file src/GQE/Entity/systems/SoundSystem.cpp
+ * @author Jacob Dix
+ * @date 20130822 - Initial Release
+ */
+#include <algorithm>
+#include <cmath>
+#include <new>
+#include <TVSource/Entity/systems/SoundSystem.hpp>
+#include <TVSource/Managers/Profile_macros.hpp>
+#include <TVSource/Utils/Alloc_macros.hpp>
+#include <TVSource/Entity/interfaces/IEntity.hpp>
+#include <TVSource/Interfaces/IApp.hpp>
+#include <TVSource/loggers/Log_macros.hpp>
+
+namespace GQE
+{
+  SoundSystem::SoundSystem(IApp& theApp, const Uint32 theVoiceCount):
+    ISystem("SoundSystem",theApp),
+    mVoices(theVoiceCount),
+    mListener(0.0f, 0.0f),
+    mMinDistance(400.0f)
+  {
+    // Reset the voice statistics
+    mStats.active = 0;
+    mStats.total = theVoiceCount;
+    mStats.played = 0;
+    mStats.coalesced = 0;
+    mStats.limited = 0;
+    mStats.stolen = 0;
+    mStats.dropped = 0;
+
+    // Mark each voice as never used
+    for(Uint32 iloop = 0; iloop < theVoiceCount; iloop++)
+    {
+      mVoices[iloop].info = NULL;
+    }
+  }
+
+  SoundSystem::~SoundSystem()
+  {
+    // Stop each voice before the sound buffers it plays are released
+    std::vector<typeVoice>::iterator iter = mVoices.begin();
+    while(iter != mVoices.end())
+    {
+#if (SFML_VERSION_MAJOR < 2)
+      iter->sound.Stop();
+#else
+      iter->sound.stop();
+      iter->sound.resetBuffer();
+#endif
+      iter++;
+    }
+    mVoices.clear();
+
+    // Delete each sound asset registered
+    std::map<const typeAssetID, typeSoundInfo>::iterator anSound = mSounds.begin();
+    while(anSound != mSounds.end())
+    {
+      delete anSound->second.asset;
+      anSound->second.asset = NULL;
+      anSound++;
+    }
+    mSounds.clear();
+  }
+
+  void SoundSystem::RegisterSound(const typeAssetID theSoundID,
+    const Uint32 thePriority, const Uint32 theMaxInstances)
+  {
+    typeSoundInfo* anInfo = GetSoundInfo(theSoundID);
+
+    // Only update the sound if it could be registered
+    if(NULL != anInfo)
+    {
+      anInfo->priority = thePriority;
+      anInfo->maxInstances = theMaxInstances;
+    }
+  }
+
+  void SoundSystem::Play(const typeAssetID theSoundID, const sf::Vector2f thePosition)
+  {
+    float anDistance = GetDistance(thePosition);
+
+    // Look for the same sound triggered earlier during this update
+    std::vector<typeSoundTrigger>::iterator iter = mTriggers.begin();
+    while(iter != mTriggers.end() && iter->soundID != theSoundID)
+    {
+      iter++;
+    }
+
+    // Coalesce with the earlier trigger keeping whichever is closest
+    if(iter != mTriggers.end())
+    {
+      if(anDistance < iter->distance)
+      {
+        iter->position = thePosition;
+        iter->distance = anDistance;
+      }
+      mStats.coalesced++;
+    }
+    else
+    {
+      typeSoundInfo* anInfo = GetSoundInfo(theSoundID);
+
+      // Only trigger sounds that could be registered
+      if(NULL != anInfo)
+      {
+        typeSoundTrigger anTrigger;
+        anTrigger.soundID = theSoundID;
+        anTrigger.info = anInfo;
+        anTrigger.position = thePosition;
+        anTrigger.distance = anDistance;
+        mTriggers.push_back(anTrigger);
+      }
+      else
+      {
+        mStats.dropped++;
+      }
+    }
+  }
+
+  void SoundSystem::SetListener(const sf::Vector2f thePosition)
+  {
+    mListener = thePosition;
+#if (SFML_VERSION_MAJOR < 2)
+    sf::Listener::SetPosition(thePosition.x, thePosition.y, 0.0f);
+#else
+    sf::Listener::setPosition(thePosition.x, thePosition.y, 0.0f);
+#endif
+  }
+
+  void SoundSystem::SetMinDistance(const float theDistance)
+  {
+    mMinDistance = theDistance;
+  }
+
+  const typeVoiceStats& SoundSystem::GetVoiceStats(void) const
+  {
+    return mStats;
+  }
+
+  void SoundSystem::AddProperties(IEntity* theEntity)
+  {
+    theEntity->mProperties.Add<std::string>("sSoundID","");
+    theEntity->mProperties.Add<bool>("bPlaySound",false);
+  }
+
+  void SoundSystem::HandleInit(IEntity* theEntity)
+  {
+    // Do nothing
+  }
+
+  void SoundSystem::HandleEvents(sf::Event theEvent)
+  {
+  }
+
+  void SoundSystem::UpdateFixed()
+  {
+    PROFILE_ZONE("SoundSystem::UpdateFixed");
+    CounterZone anCounters(mApp.mStatManager, "SoundSystem::UpdateFixed", GetEntityCount());
+    ALLOC_SCOPE("SoundSystem::UpdateFixed");
+
+    // Search through each z-order map for each IEntity playing a sound
+    std::map<const Uint32, std::deque<IEntity*> >::iterator anIter;
+    anIter = mEntities.begin();
+    while(anIter != mEntities.end())
+    {
+      std::deque<IEntity*>::iterator anQueue = anIter->second.begin();
+      while(anQueue != anIter->second.end())
+      {
+        // Get the IEntity address first
+        GQE::IEntity* anEntity = *anQueue;
+
+        // Increment the IEntity iterator second
+        anQueue++;
+
+        // Does this IEntity want to play its sound?
+        if(anEntity->mProperties.Get<bool>("bPlaySound"))
+        {
+          // Trigger the sound at the RenderSystem position of this IEntity
+          Play(anEntity->mProperties.Get<std::string>("sSoundID"),
+            anEntity->mProperties.Get<sf::Vector2f>("vPosition"));
+
+          // Only play the sound once per request
+          anEntity->mProperties.Set<bool>("bPlaySound",false);
+        }
+      } // while(anQueue != anIter->second.end())
+
+      // Increment map iterator
+      anIter++;
+    } //while(anIter != mEntities.end())
+
+    // Give the most important sounds a voice first
+    std::sort(mTriggers.begin(), mTriggers.end(), SortTriggers);
+    for(std::size_t iloop = 0; iloop < mTriggers.size(); iloop++)
+    {
+      StartTrigger(mTriggers[iloop]);
+    }
+    mTriggers.clear();
+
+    // Count the voices still playing and publish the voice statistics
+    mStats.active = 0;
+    for(std::size_t jloop = 0; jloop < mVoices.size(); jloop++)
+    {
+      if(IsPlaying(mVoices[jloop]))
+      {
+        mStats.active++;
+      }
+    }
+    mApp.mStatManager.SetVoiceStats(mStats);
+  }
+
+  void SoundSystem::UpdateVariable(float theElapsedTime)
+  {
+  }
+
+  void SoundSystem::Draw()
+  {
+  }
+
+  void SoundSystem::HandleCleanup(IEntity* theEntity)
+  {
+    // Do nothing
+  }
+
+  SoundSystem::typeSoundInfo* SoundSystem::GetSoundInfo(const typeAssetID theSoundID)
+  {
+    typeSoundInfo* anResult = NULL;
+
+    // Has this sound been registered already?
+    std::map<const typeAssetID, typeSoundInfo>::iterator iter = mSounds.find(theSoundID);
+    if(iter != mSounds.end())
+    {
+      anResult = &iter->second;
+    }
+    else
+    {
+      SoundAsset* anAsset = new(std::nothrow) SoundAsset(theSoundID);
+      if(NULL != anAsset)
+      {
+        // Start decoding the sound in the background right away
+        anAsset->LoadAsync();
+
+        typeSoundInfo anInfo;
+        anInfo.asset = anAsset;
+        anInfo.priority = DEFAULT_PRIORITY;
+        anInfo.maxInstances = DEFAULT_MAX_INSTANCES;
+        anResult = &mSounds.insert(
+          std::pair<const typeAssetID, typeSoundInfo>(theSoundID, anInfo)).first->second;
+      }
+      else
+      {
+        ELOG() << "SoundSystem::GetSoundInfo(" << theSoundID
+          << ") unable to allocate sound asset" << std::endl;
+      }
+    }
+
+    // Return anResult of the sound found or registered above
+    return anResult;
+  }
+
+  float SoundSystem::GetDistance(const sf::Vector2f thePosition) const
+  {
+    float anX = thePosition.x - mListener.x;
+    float anY = thePosition.y - mListener.y;
+
+    return std::sqrt(anX * anX + anY * anY);
+  }
+
+  bool SoundSystem::IsPlaying(const typeVoice& theVoice)
+  {
+#if (SFML_VERSION_MAJOR < 2)
+    return NULL != theVoice.info && theVoice.sound.GetStatus() != sf::Sound::Stopped;
+#else
+    return NULL != theVoice.info && theVoice.sound.getStatus() != sf::Sound::Stopped;
+#endif
+  }
+
+  bool SoundSystem::IsMoreImportant(const Uint32 thePriority, const float theDistance,
+    const Uint32 theOtherPriority, const float theOtherDistance)
+  {
+    return thePriority > theOtherPriority ||
+      (thePriority == theOtherPriority && theDistance < theOtherDistance);
+  }
+
+  bool SoundSystem::SortTriggers(const typeSoundTrigger& theLeft,
+    const typeSoundTrigger& theRight)
+  {
+    return IsMoreImportant(theLeft.info->priority, theLeft.distance,
+      theRight.info->priority, theRight.distance);
+  }
+
+  void SoundSystem::StartTrigger(const typeSoundTrigger& theTrigger)
+  {
+    typeVoice* anFree = NULL;
+    typeVoice* anWorst = NULL;
+    typeVoice* anWorstInstance = NULL;
+    float anWorstDistance = 0.0f;
+    float anWorstInstanceDistance = 0.0f;
+    Uint32 anInstances = 0;
+
+    // Find a free voice, the least important voice and the least important
+    // voice already playing this sound in a single pass over the voice pool
+    for(std::size_t iloop = 0; iloop < mVoices.size(); iloop++)
+    {
+      typeVoice* anVoice = &mVoices[iloop];
+      if(IsPlaying(*anVoice))
+      {
+        float anDistance = GetDistance(anVoice->position);
+        if(NULL == anWorst || IsMoreImportant(anWorst->info->priority,
+          anWorstDistance, anVoice->info->priority, anDistance))
+        {
+          anWorst = anVoice;
+          anWorstDistance = anDistance;
+        }
+        if(anVoice->info == theTrigger.info)
+        {
+          anInstances++;
+          if(NULL == anWorstInstance || anDistance > anWorstInstanceDistance)
+          {
+            anWorstInstance = anVoice;
+            anWorstInstanceDistance = anDistance;
+          }
+        }
+      }
+      else if(NULL == anFree)
+      {
+        anFree = anVoice;
+      }
+    }
+
+    // Decide which voice (if any) this sound will play on
+    typeVoice* anTarget = NULL;
+    if(anInstances >= theTrigger.info->maxInstances)
+    {
+      // Replace the furthest instance of this sound if this one is closer
+      if(NULL != anWorstInstance && theTrigger.distance < anWorstInstanceDistance)
+      {
+        anTarget = anWorstInstance;
+        mStats.stolen++;
+      }
+      else
+      {
+        mStats.limited++;
+      }
+    }
+    else if(NULL != anFree)
+    {
+      anTarget = anFree;
+    }
+    else if(NULL != anWorst && IsMoreImportant(theTrigger.info->priority,
+      theTrigger.distance, anWorst->info->priority, anWorstDistance))
+    {
+      anTarget = anWorst;
+      mStats.stolen++;
+    }
+    else
+    {
+      mStats.dropped++;
+    }
+
+    // Start the sound on the voice chosen above
+    if(NULL != anTarget)
+    {
+      anTarget->info = theTrigger.info;
+      anTarget->position = theTrigger.position;
+#if (SFML_VERSION_MAJOR < 2)
+      anTarget->sound.Stop();
+      anTarget->sound.SetBuffer(theTrigger.info->asset->GetAsset());
+      anTarget->sound.SetPosition(theTrigger.position.x, theTrigger.position.y, 0.0f);
+      anTarget->sound.SetMinDistance(mMinDistance);
+      anTarget->sound.Play();
+#else
+      anTarget->sound.stop();
+      anTarget->sound.setBuffer(theTrigger.info->asset->GetAsset());
+      anTarget->sound.setPosition(theTrigger.position.x, theTrigger.position.y, 0.0f);
+      anTarget->sound.setMinDistance(mMinDistance);
+      anTarget->sound.play();
+#endif
+      mStats.played++;
+    }
+  }
+
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Jacob Dix
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,274 @@
+/**
+ * Provides the SoundSystem class for playing the sounds of every entity in a
+ * game using a fixed pool of voices.
+ *
+ * @file include/GQE/Entity/systems/SoundSystem.hpp
+ * @author Jacob Dix
+ * @date 20130822 - Initial Release
+ */
+#ifndef SOUND_SYSTEM_HPP_INCLUDED
+#define SOUND_SYSTEM_HPP_INCLUDED
+
+#include <map>
+#include <vector>
+#include <SFML/Audio.hpp>
+#include <SFML/System.hpp>
+#include <TVSource/Assets/SoundAsset.hpp>
+#include <TVSource/Entity/interfaces/ISystem.hpp>
+#include <TVSource/Entity/Entity_types.hpp>
+
+namespace GQE
+{
+  /// The SoundSystem for playing every IEntity sound in a game
+  class GQE_API SoundSystem : public ISystem
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Default number of voices in the voice pool
+      static const Uint32 DEFAULT_VOICES = 32;
+      /// Default priority of each sound (higher priorities are more important)
+      static const Uint32 DEFAULT_PRIORITY = 128;
+      /// Default number of voices each sound may play on at once
+      static const Uint32 DEFAULT_MAX_INSTANCES = 4;
+
+      /**
+       * SoundSystem Constructor.
+       * @param[in] theApp is the current GQE app.
+       * @param[in] theVoiceCount is the number of voices in the voice pool.
+       */
+      SoundSystem(IApp& theApp, const Uint32 theVoiceCount = DEFAULT_VOICES);
+
+      /**
+       * SoundSystem Destructor.
+       */
+      virtual ~SoundSystem();
+
+      /**
+       * RegisterSound is responsible for setting the priority and instance
+       * limit of theSoundID provided and starting to load it in the
+       * background. Sounds played without being registered use the defaults.
+       * @param[in] theSoundID is the asset ID of the sound to register.
+       * @param[in] thePriority of the sound (higher priorities are more important).
+       * @param[in] theMaxInstances is the number of voices the sound may play on at once.
+       */
+      void RegisterSound(const typeAssetID theSoundID,
+        const Uint32 thePriority = DEFAULT_PRIORITY,
+        const Uint32 theMaxInstances = DEFAULT_MAX_INSTANCES);
+
+      /**
+       * Play is responsible for triggering theSoundID provided at thePosition
+       * provided. The sound is started by the next UpdateFixed call and
+       * identical sounds triggered before then are coalesced into the one
+       * closest to the listener.
+       * @param[in] theSoundID is the asset ID of the sound to play.
+       * @param[in] thePosition of the sound in the game world.
+       */
+      void Play(const typeAssetID theSoundID, const sf::Vector2f thePosition);
+
+      /**
+       * SetListener is responsible for moving the listener used to attenuate
+       * each sound and decide which voices are furthest away.
+       * @param[in] thePosition of the listener in the game world.
+       */
+      void SetListener(const sf::Vector2f thePosition);
+
+      /**
+       * SetMinDistance is responsible for setting the distance from the
+       * listener within which sounds play at full volume. Sounds further
+       * away are attenuated.
+       * @param[in] theDistance in game world units (pixels).
+       */
+      void SetMinDistance(const float theDistance);
+
+      /**
+       * GetVoiceStats will return the statistics of the voice pool.
+       * @return the statistics of the voice pool
+       */
+      const typeVoiceStats& GetVoiceStats(void) const;
+
+      /**
+       * AddProperties is responsible for adding the properties used by this
+       * ISystem derived class to the IEntity derived class provided.
+       * @param[in] theEntity to add the properties to.
+       */
+      virtual void AddProperties(IEntity* theEntity);
+
+      /**
+       * HandleEvents is responsible for letting each Instance class have a
+       * chance to handle theEvent specified.
+       * @param[in] theEvent to handle
+       */
+      virtual void HandleEvents(sf::Event theEvent);
+
+      /**
+       * UpdateFixed is called a specific number of times every game loop and
+       * this method will play the sound of each IEntity whose bPlaySound
+       * property is set and start every sound triggered since the last call
+       * on the voices of the voice pool.
+       */
+      virtual void UpdateFixed(void);
+
+      /**
+       * UpdateVariable is called every time the game loop draws a frame and
+       * includes the elapsed time between the last UpdateVariable call for
+       * use with equations that use time as a variable. (e.g. physics velocity
+       * and acceleration equations).
+       */
+      virtual void UpdateVariable(float theElapsedTime);
+
+      /**
+       * Draw is called during the game loop after events and the fixed update
+       * loop calls are completed and depends largely on the speed of the
+       * computer to determine how frequently it will be called. This gives the
+       * EntityManager a chance to call the Draw method for each Instance
+       * class.
+       */
+      virtual void Draw(void);
+    protected:
+      /**
+       * HandleInit is called to allow each derived ISystem to perform any
+       * initialization steps when a new IEntity is added.
+       */
+      virtual void HandleInit(IEntity* theEntity);
+
+      /**
+       * HandleCleanup is called when the IEntity that was added is finally
+       * dropped from this ISystem and gives the derived ISystem class a chance
+       * to perform any custom work before the IEntity is deleted.
+       */
+      virtual void HandleCleanup(IEntity* theEntity);
+    private:
+      /// Provides the priority and instance limit of each sound
+      struct typeSoundInfo
+      {
+        SoundAsset* asset;        ///< The sound buffer played
+        Uint32      priority;     ///< Priority of the sound
+        Uint32      maxInstances; ///< Most voices the sound may play on at once
+      };
+
+      /// Provides a sound triggered since the last UpdateFixed call
+      struct typeSoundTrigger
+      {
+        typeAssetID    soundID;  ///< The asset ID of the sound triggered
+        typeSoundInfo* info;     ///< The priority and instance limit of the sound
+        sf::Vector2f   position; ///< Position of the sound closest to the listener
+        float          distance; ///< Distance between position and the listener
+      };
+
+      /// Provides a voice of the voice pool
+      struct typeVoice
+      {
+        sf::Sound      sound;    ///< The sound source playing on this voice
+        typeSoundInfo* info;     ///< The sound playing (NULL if never used)
+        sf::Vector2f   position; ///< Position of the sound playing
+      };
+
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// The priority and instance limit of each sound played so far
+      std::map<const typeAssetID, typeSoundInfo> mSounds;
+      /// The sounds triggered since the last UpdateFixed call
+      std::vector<typeSoundTrigger> mTriggers;
+      /// The fixed pool of voices
+      std::vector<typeVoice> mVoices;
+      /// Position of the listener in the game world
+      sf::Vector2f mListener;
+      /// Distance within which sounds play at full volume
+      float mMinDistance;
+      /// The statistics of the voice pool
+      typeVoiceStats mStats;
+
+      /**
+       * GetSoundInfo will return the priority and instance limit of
+       * theSoundID provided, registering the sound with the defaults if it
+       * hasn't been registered yet.
+       * @param[in] theSoundID is the asset ID of the sound.
+       * @return pointer to the information of the sound
+       */
+      typeSoundInfo* GetSoundInfo(const typeAssetID theSoundID);
+
+      /**
+       * GetDistance will return the distance between thePosition provided
+       * and the listener.
+       * @param[in] thePosition in the game world.
+       * @return the distance to the listener
+       */
+      float GetDistance(const sf::Vector2f thePosition) const;
+
+      /**
+       * IsPlaying will return true if theVoice provided is playing a sound.
+       * @param[in] theVoice to check.
+       * @return true if theVoice is playing, false otherwise
+       */
+      static bool IsPlaying(const typeVoice& theVoice);
+
+      /**
+       * IsMoreImportant will return true if a sound of thePriority and
+       * theDistance provided is more important than a sound of theOtherPriority
+       * and theOtherDistance provided. Higher priorities win and sounds of the
+       * same priority closer to the listener win.
+       * @return true if the first sound is more important
+       */
+      static bool IsMoreImportant(const Uint32 thePriority, const float theDistance,
+        const Uint32 theOtherPriority, const float theOtherDistance);
+
+      /**
+       * SortTriggers is used to sort the sounds triggered so the most
+       * important sounds are given a voice first.
+       * @return true if theLeft trigger is more important than theRight trigger
+       */
+      static bool SortTriggers(const typeSoundTrigger& theLeft,
+        const typeSoundTrigger& theRight);
+
+      /**
+       * StartTrigger is responsible for finding a voice for theTrigger
+       * provided, stealing the least important voice if needed, and starting
+       * the sound on it.
+       * @param[in] theTrigger to start.
+       */
+      void StartTrigger(const typeSoundTrigger& theTrigger);
+  }; // class SoundSystem
+} // namespace GQE
+
+#endif // SOUND_SYSTEM_HPP_INCLUDED
+
+/**
+ * @class GQE::SoundSystem
+ * @ingroup Entity
+ * The SoundSystem class plays every IEntity sound on a fixed pool of voices
+ * so overlapping sounds never exceed the sound sources available or the
+ * mixing time budget. It provides the following properties:
+ * - sSoundID: The asset ID of the sound this IEntity plays
+ * - bPlaySound: A boolean that plays sSoundID during the next UpdateFixed
+ * The SoundSystem class makes use of the following properties provided by the
+ * RenderSystem class:
+ * - vPosition: The sf::Vector2f representing the current IEntity position
+ * Sounds can also be triggered directly using Play. Every sound triggered
+ * is started during the next UpdateFixed call, where identical sounds
+ * triggered during the same update are coalesced into a single voice. Each
+ * sound may only play on as many voices at once as its instance limit (see
+ * RegisterSound) and once every voice is busy the least important voice
+ * (lowest priority, then furthest from the listener) is stolen if the new
+ * sound is more important, otherwise the new sound is dropped. The voice
+ * statistics are published to the StatManager each update.
+ *
+ * Copyright (c) 2010-2013 Jacob Dix
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
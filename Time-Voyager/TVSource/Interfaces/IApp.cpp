@@ -28,6 +28,22 @@
  * @date 20120622 - Remove setting of show value of StatManager to false
  * @date 20120630 - Add new SetGraphicRange and CalculateGraphicRange methods
  * @date 20120702 - Call new IState::Cleanup method during game loop
+ * @date 20130802 - Add command line benchmark scenarios and game loop phase timing
+ * @date 20130805 - Record game loop phase times and [stats] settings with StatManager
+ * @date 20130806 - Add profile zones for each game loop phase and the F9 trace hotkey
+ * @date 20130807 - Add hardware counter zones for each game loop phase
+ * @date 20130808 - Add allocation scope tags for each game loop phase
+ * @date 20130810 - Set the runtime log level from the [log] and [logmodules] settings
+ * @date 20130811 - Add FlightRecorder frames, F10 hotkey and [flightrecorder] settings
+ * @date 20130815 - Finish background asset loads each frame and [assets] settings
+ * @date 20130816 - Map the application wide asset pack at startup
+ * @date 20130818 - Read the asset cache budget from the [assets] settings
+ * @date 20130819 - Load and save the state asset manifests used for prefetching
+ * @date 20130820 - Read the texture cache directory from the [assets] settings
+ * @date 20130821 - Read the sound cache directory from the [assets] settings
+ * @date 20130823 - Crossfade music tracks each frame and [music] settings
+ * @date 20130824 - Configure the NetworkSource from the [network] settings
+ * @date 20130825 - Dispatch the typed events posted each frame
  */
 
 #include <assert.h>
@@ -41,11 +57,20 @@
 #include <TVSource/Interfaces/IApp.hpp>
 #include <TVSource/Interfaces/IState.hpp>
 #include <TVSource/Loggers/Log_macros.hpp>
+#include <TVSource/Managers/Profile_macros.hpp>
+#include <TVSource/Utils/Alloc_macros.hpp>
+#include <TVSource/Utils/StringUtil.hpp>
+#include <TVSource/States/BenchmarkState.hpp>
 
 namespace GQE
 {
   /// Default application wide settings file string
   const char* IApp::APP_SETTINGS = "TVSource/resources/Settings/settings.cfg";
+  const char* IApp::APP_PACK = "resources.pak";
+  const char* IApp::APP_MANIFESTS = "manifests.cfg";
+  const char* IApp::APP_TEXTURE_CACHE = "texturecache";
+  const char* IApp::APP_SOUND_CACHE = "soundcache";
+  const char* IApp::APP_NETWORK_CACHE = "netcache";
 
   /// Single instance of the most recently created App class
   IApp* IApp::gApp = NULL;
@@ -61,6 +86,11 @@ namespace GQE
     mGraphicRange(LowRange),
 
     mAssetManager(),
+    mBenchmarkManager(),
+    mEventManager(),
+    mFlightRecorder(),
+    mMusicManager(),
+    mProfileManager(),
     mStatManager(),
     mStateManager(),
     mExitCode(0),
@@ -94,7 +124,6 @@ namespace GQE
   void IApp::ProcessArguments(int argc, char* argv[])
   {
     // Handle command line arguments
-    // TODO: Add handling of command line arguments
     if(argc == 1)
     {
       ILOG() << "IApp::ProcessArguments(" << argv[0] << ") command line: (none)" << std::endl;
@@ -105,6 +134,17 @@ namespace GQE
       for(int iloop = 1; iloop<argc; iloop++)
       {
         ILOG() << "Argument" << iloop << "=(" << argv[iloop] << ")" << std::endl;
+
+        // Give the BenchmarkManager, FlightRecorder, ProfileManager and
+        // StatManager a chance to handle this argument
+        if(!mBenchmarkManager.ProcessArgument(argv[iloop]) &&
+           !mFlightRecorder.ProcessArgument(argv[iloop]) &&
+           !mProfileManager.ProcessArgument(argv[iloop]) &&
+           !mStatManager.ProcessArgument(argv[iloop]))
+        {
+          WLOG() << "IApp::ProcessArguments() unknown argument("
+            << argv[iloop] << ")" << std::endl;
+        }
       }
     }
   }
@@ -129,6 +169,9 @@ namespace GQE
     mAssetManager.RegisterHandler(new(std::nothrow) MusicHandler());
     mAssetManager.RegisterHandler(new(std::nothrow) SoundHandler());
 
+    // Map the application wide asset pack (if any) before any asset is loaded
+    mAssetManager.AddPack(IApp::APP_PACK);
+
     // Give derived class a time to register custom IAssetHandler classes
     InitAssetHandlers();
 
@@ -139,14 +182,35 @@ namespace GQE
     // Try to open the Renderer window to display graphics
     InitRenderer();
 
-    // Give the derived application a chance to register a IScreenFactory class
-    // to provide IScreen derived classes (previously known as IState derived
-    // classes) as requested.
-    InitScreenFactory();
+    // Load the state asset manifests recorded by previous runs (if any)
+    mStateManager.LoadManifests(IApp::APP_MANIFESTS);
+
+    // Are we running a benchmark scenario? then skip the game screens
+    if(mBenchmarkManager.IsEnabled())
+    {
+      // Make the BenchmarkState our active state
+      mStateManager.AddActiveState(new(std::nothrow) BenchmarkState(*this));
+
+      // Give the BenchmarkManager a chance to initialize
+      mBenchmarkManager.DoInit();
+    }
+    else
+    {
+      // Give the derived application a chance to register a IScreenFactory class
+      // to provide IScreen derived classes (previously known as IState derived
+      // classes) as requested.
+      InitScreenFactory();
+    }
 
     // Give the StatManager a chance to initialize
     mStatManager.DoInit();
 
+    // Give the ProfileManager a chance to initialize
+    mProfileManager.DoInit();
+
+    // Give the FlightRecorder a chance to initialize (after the ProfileManager)
+    mFlightRecorder.DoInit();
+
     // GameLoop if Running flag is still true
     GameLoop();
 
@@ -244,8 +308,8 @@ namespace GQE
     SLOG(App_InitSettingsConfig, SeverityInfo) << std::endl;
     ConfigAsset anSettingsConfig(IApp::APP_SETTINGS);
 
-    // Convert specific settings into properties
-    mProperties.Add<bool>("bWindowConsole", 
+    // Convert specific settings into properties (headless benchmarks are console only)
+    mProperties.Add<bool>("bWindowConsole", mBenchmarkManager.IsHeadless() ||
       anSettingsConfig.GetAsset().GetBool("window","console",false));
     mProperties.Add<bool>("bWindowFullscreen", 
       anSettingsConfig.GetAsset().GetBool("window","fullscreen",false));
@@ -255,6 +319,95 @@ namespace GQE
       anSettingsConfig.GetAsset().GetUint32("window","height",DEFAULT_VIDEO_HEIGHT));
     mProperties.Add<Uint32>("uWindowDepth", 
       anSettingsConfig.GetAsset().GetUint32("window","depth",DEFAULT_VIDEO_BPP));
+
+    // Configure the StatManager overlay, hitch threshold and rolling window
+    mStatManager.SetShow(
+      anSettingsConfig.GetAsset().GetBool("stats","show",false));
+    mStatManager.SetHitchThreshold((Uint32)(1000.0f *
+      anSettingsConfig.GetAsset().GetFloat("stats","hitch",
+        StatManager::DEFAULT_HITCH_THRESHOLD / 1000.0f)));
+    mStatManager.SetWindowSize(
+      anSettingsConfig.GetAsset().GetUint32("stats","window",
+        StatManager::DEFAULT_WINDOW_SIZE));
+
+    // Sample the hardware counters if requested (--counters also enables them)
+    if(anSettingsConfig.GetAsset().GetBool("stats","counters",false))
+    {
+      mStatManager.SetCounting(true);
+    }
+
+    // Set the minimum severity logged and any per module overrides
+    ILogger::SetLevel(ParseSeverity(
+      anSettingsConfig.GetAsset().GetString("log","level"), ILogger::GetLevel()));
+    std::vector<std::string> anModules =
+      anSettingsConfig.GetAsset().GetNames("logmodules");
+    for(size_t iloop = 0; iloop < anModules.size(); iloop++)
+    {
+      ILogger::SetModuleLevel(anModules[iloop].c_str(), ParseSeverity(
+        anSettingsConfig.GetAsset().GetString("logmodules",anModules[iloop]),
+        ILogger::GetLevel()));
+    }
+
+    // Configure the FlightRecorder (--no-flight-recorder also disables it)
+    if(!anSettingsConfig.GetAsset().GetBool("flightrecorder","enabled",true))
+    {
+      mFlightRecorder.SetEnabled(false);
+    }
+    mFlightRecorder.SetDumpFile(
+      anSettingsConfig.GetAsset().GetString("flightrecorder","file"));
+    mFlightRecorder.SetZones(
+      anSettingsConfig.GetAsset().GetBool("flightrecorder","zones",true));
+
+    // Configure the background asset loader worker threads and upload budget
+    mAssetManager.GetLoader().SetWorkerCount(
+      anSettingsConfig.GetAsset().GetUint32("assets","workers",
+        AssetLoader::DEFAULT_WORKERS));
+    mAssetManager.GetLoader().SetUploadBudget((Uint32)(1000.0f *
+      anSettingsConfig.GetAsset().GetFloat("assets","budget",
+        AssetLoader::DEFAULT_UPLOAD_BUDGET / 1000.0f)));
+
+    // Configure how many megabytes of unreferenced assets each handler keeps
+    mAssetManager.SetCacheBudget((Uint64)1024 * 1024 *
+      anSettingsConfig.GetAsset().GetUint32("assets","cache",
+        AssetManager::DEFAULT_CACHE_BUDGET));
+
+    // Prefetch the assets of the states likely to become active next
+    mStateManager.SetPrefetching(
+      anSettingsConfig.GetAsset().GetBool("assets","prefetch",true));
+
+    // Keep the pixels of each image decoded for the next run
+    mAssetManager.GetTextureCache().SetDirectory(
+      anSettingsConfig.GetAsset().GetString("assets","texturecache",
+        IApp::APP_TEXTURE_CACHE));
+
+    // Keep the samples of each sound decoded for the next run
+    mAssetManager.GetSoundCache().SetDirectory(
+      anSettingsConfig.GetAsset().GetString("assets","soundcache",
+        IApp::APP_SOUND_CACHE));
+
+    // Configure the music volume and the time spent crossfading tracks
+    mMusicManager.SetVolume(
+      anSettingsConfig.GetAsset().GetFloat("music","volume",
+        (float)MusicManager::DEFAULT_VOLUME));
+    mMusicManager.SetFadeTime((Uint32)(1000.0f *
+      anSettingsConfig.GetAsset().GetFloat("music","fade",
+        MusicManager::DEFAULT_FADE_TIME / 1000.0f)));
+
+    // Configure the content server assets loaded from the network come from
+    NetworkSource& anNetworkSource = mAssetManager.GetNetworkSource();
+    anNetworkSource.SetConnectionCount(
+      anSettingsConfig.GetAsset().GetUint32("network","connections",
+        NetworkSource::DEFAULT_CONNECTIONS));
+    anNetworkSource.SetTimeout((Uint32)(1000.0f *
+      anSettingsConfig.GetAsset().GetFloat("network","timeout",
+        NetworkSource::DEFAULT_TIMEOUT / 1000.0f)));
+    anNetworkSource.SetDirectory(
+      anSettingsConfig.GetAsset().GetString("network","cache",
+        IApp::APP_NETWORK_CACHE));
+    anNetworkSource.SetServer(
+      anSettingsConfig.GetAsset().GetString("network","server",""),
+      (unsigned short)anSettingsConfig.GetAsset().GetUint32("network","port",
+        NetworkSource::DEFAULT_PORT));
   }
 
   void IApp::InitRenderer(void)
@@ -290,8 +443,8 @@ namespace GQE
       // Create a RenderWindow object using VideoMode object above
       mWindow.create(mVideoMode, mTitle, mWindowStyle, mContextSettings);
 
-      // Use Vertical Sync
-      mWindow.setVerticalSyncEnabled(true);
+      // Use Vertical Sync unless we are running a benchmark scenario
+      mWindow.setVerticalSyncEnabled(!mBenchmarkManager.IsEnabled());
 
     }
     else
@@ -307,6 +460,15 @@ namespace GQE
     // Is this a Console Only game loop?
     bool anConsoleOnly = mProperties.Get<bool>("bWindowConsole");
 
+    // Are we running a benchmark scenario?
+    bool anBenchmark = mBenchmarkManager.IsEnabled();
+
+    // Clock used in timing each phase of the game loop
+    sf::Clock anPhaseClock;
+
+    // The time in microseconds spent in each phase of the game loop
+    Int64 anPhaseTimes[PhaseCount];
+
     // Clock used in restricting Update loop to a fixed rate
     sf::Clock anUpdateClock;
 
@@ -331,22 +493,50 @@ namespace GQE
     while(IsRunning() && !mStateManager.IsEmpty() &&
          (mWindow.isOpen() || anConsoleOnly))
     {
+      // Record the entire frame as a single profile zone
+      PROFILE_ZONE("IApp::GameLoop");
+      CounterZone anFrameCounters(mStatManager, gPhaseNames[PhaseFrame]);
+
       // Get the currently active state
       IState& anState = mStateManager.GetActiveState();
 
       // Count the number of sequential UpdateFixed loop calls
       Uint32 anUpdates = 0;
 
+      // Restart our phase clock at the start of each frame
+      anPhaseClock.restart();
+
       // Process any available input
       ProcessInput(anState);
 
+      // Deliver the events posted since the previous frame before updating
+      {
+        PROFILE_ZONE("EventManager::DispatchEvents");
+        mEventManager.DispatchEvents();
+      }
+      anPhaseTimes[PhaseInput] = anPhaseClock.restart().asMicroseconds();
+
       // Make note of the current update time
 
       sf::Int32 anUpdateTime = anUpdateClock.getElapsedTime().asMilliseconds();
 
+      // Maximum sequential UpdateFixed calls allowed for this frame
+      Uint32 anMaxUpdates = mMaxUpdates;
+
+      // Benchmarks perform exactly one UpdateFixed call every frame
+      if(anBenchmark)
+      {
+        anUpdateNext = anUpdateTime - mUpdateRate;
+        anMaxUpdates = 1;
+      }
+
       // Process our UpdateFixed portion of the game loop
-      while((anUpdateTime - anUpdateNext) >= mUpdateRate && anUpdates++ < mMaxUpdates)
+      while((anUpdateTime - anUpdateNext) >= mUpdateRate && anUpdates++ < anMaxUpdates)
       {
+        PROFILE_ZONE("IState::UpdateFixed");
+        CounterZone anCounters(mStatManager, gPhaseNames[PhaseFixed]);
+        ALLOC_SCOPE(gPhaseNames[PhaseFixed]);
+
         // Let the current active state perform fixed updates next
         anState.UpdateFixed();
 
@@ -361,28 +551,96 @@ namespace GQE
         // Compute the next appropriate UpdateFixed time
         anUpdateNext += mUpdateRate;
       } // while((anUpdateTime - anUpdateNext) >= mUpdateRate && anUpdates <= mMaxUpdates)
+      anPhaseTimes[PhaseFixed] = anPhaseClock.restart().asMicroseconds();
 
       // Let the current active state perform its variable update
 
       // Convert to floating point value of seconds for SFML 2.0
-      anState.UpdateVariable(anFrameClock.restart().asSeconds());
+      float anElapsedTime = anFrameClock.restart().asSeconds();
 
-      // Let the current active state draw stuff
-      anState.Draw();
+      // Benchmarks use the fixed update rate so each run does the same work
+      if(anBenchmark)
+      {
+        anElapsedTime = (float)mUpdateRate / 1000.0f;
+      }
+      {
+        PROFILE_ZONE("IState::UpdateVariable");
+        CounterZone anCounters(mStatManager, gPhaseNames[PhaseVariable]);
+        ALLOC_SCOPE(gPhaseNames[PhaseVariable]);
+        anState.UpdateVariable(anElapsedTime);
+      }
+      anPhaseTimes[PhaseVariable] = anPhaseClock.restart().asMicroseconds();
+
+      {
+        PROFILE_ZONE("IState::Draw");
+        CounterZone anCounters(mStatManager, gPhaseNames[PhaseDraw]);
+        ALLOC_SCOPE(gPhaseNames[PhaseDraw]);
+
+        // Let the current active state draw stuff
+        anState.Draw();
+
+        // Let the StatManager perform its drawing
+        mStatManager.Draw();
+      }
+      anPhaseTimes[PhaseDraw] = anPhaseClock.restart().asMicroseconds();
+
+      {
+        PROFILE_ZONE("IApp::Display");
+        CounterZone anCounters(mStatManager, gPhaseNames[PhaseDisplay]);
+        ALLOC_SCOPE(gPhaseNames[PhaseDisplay]);
+
+        // Display Render window to the screen
+        mWindow.display();
+      }
+      anPhaseTimes[PhaseDisplay] = anPhaseClock.restart().asMicroseconds();
+
+      {
+        PROFILE_ZONE("StateManager::Cleanup");
+        CounterZone anCounters(mStatManager, gPhaseNames[PhaseCleanup]);
+        ALLOC_SCOPE(gPhaseNames[PhaseCleanup]);
+
+        // Give the state manager a chance to delete any pending states
+        mStateManager.Cleanup(); 
 
-      // Let the StatManager perform its drawing
-      mStatManager.Draw();
+        // Finish assets loaded in the background within the upload budget
+        PROFILE_ZONE("AssetManager::UpdateLoads");
+        mAssetManager.UpdateLoads();
 
-      // Display Render window to the screen
-      mWindow.display();
+        // Crossfade to any music track prebuffered in the background
+        mMusicManager.Update(anElapsedTime);
+      }
+      anPhaseTimes[PhaseCleanup] = anPhaseClock.restart().asMicroseconds();
+
+      // The entire frame is the sum of each phase above
+      anPhaseTimes[PhaseFrame] = anPhaseTimes[PhaseInput] +
+        anPhaseTimes[PhaseFixed] + anPhaseTimes[PhaseVariable] +
+        anPhaseTimes[PhaseDraw] + anPhaseTimes[PhaseDisplay] +
+        anPhaseTimes[PhaseCleanup];
+
+      // Let the StatManager record the time spent in each phase
+      mStatManager.AddFrame(anPhaseTimes);
+
+      // Let the ProfileManager write its trace after enough frames
+      mProfileManager.AddFrame();
 
-      // Give the state manager a chance to delete any pending states
-      mStateManager.Cleanup(); 
+      // Keep this frame with the FlightRecorder
+      mFlightRecorder.AddFrame(anPhaseTimes, mStatManager);
+
+      // Record this frame with the BenchmarkManager, have we run enough frames?
+      if(anBenchmark && mBenchmarkManager.AddFrame(anPhaseTimes))
+      {
+        // Write our benchmark report and exit
+        Quit(mBenchmarkManager.WriteReport(mStatManager) ? StatusAppOK : StatusError);
+      }
     } // while(IsRunning() && !mStates.empty() && (mWindow.isOpen() || anConsoleOnly))
   }
 
   void IApp::ProcessInput(IState& theState)
   {
+    PROFILE_ZONE("IApp::ProcessInput");
+    CounterZone anCounters(mStatManager, gPhaseNames[PhaseInput]);
+    ALLOC_SCOPE(gPhaseNames[PhaseInput]);
+
     // Variable for storing the current input event to be processed
     sf::Event anEvent;
 
@@ -403,6 +661,19 @@ namespace GQE
           break;
         case sf::Event::Resized:      // Window resized
           break;
+        case sf::Event::KeyPressed:   // F9 records and writes profile zones
+          if(sf::Keyboard::F9 == anEvent.key.code)
+          {
+            mProfileManager.HandleHotkey();
+            break;
+          }
+          if(sf::Keyboard::F10 == anEvent.key.code)  // F10 writes flight recorder dump
+          {
+            mFlightRecorder.HandleHotkey();
+            break;
+          }
+          theState.HandleEvents(anEvent);
+          break;
         default:                      // Current active state will handle
           theState.HandleEvents(anEvent);
       } // switch(anEvent.Type)
@@ -413,9 +684,24 @@ namespace GQE
   {
     SLOG(App_Cleanup, SeverityInfo) << std::endl;
 
+    // Give the FlightRecorder a chance to de-initialize
+    mFlightRecorder.DeInit();
+
+    // Give the ProfileManager a chance to de-initialize
+    mProfileManager.DeInit();
+
     // Give the StatManager a chance to de-initialize
     mStatManager.DeInit();
 
+    // Stop the music and close every track before the asset packs are unmapped
+    mMusicManager.DeInit();
+
+    // Save the state asset manifests so the next run can prefetch them
+    if(!mBenchmarkManager.IsEnabled())
+    {
+      mStateManager.SaveManifests(IApp::APP_MANIFESTS);
+    }
+
     // Close the Render window if it is still open
     if(mWindow.isOpen())
     {
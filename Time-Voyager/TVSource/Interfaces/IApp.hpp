@@ -19,6 +19,16 @@
  *                  improved gameloop.
  * @date 20120630 - Add new SetGraphicRange and CalculateGraphicRange methods
  * @date 20120720 - Add new PropertyManager to IApp class for storing app wide properties
+ * @date 20130802 - Add new BenchmarkManager for command line benchmark scenarios
+ * @date 20130806 - Add new ProfileManager for recording profile zones
+ * @date 20130811 - Add new FlightRecorder dumped on fatal errors
+ * @date 20130816 - Map the application wide asset pack at startup
+ * @date 20130819 - Add the application wide state asset manifests file
+ * @date 20130820 - Add the application wide texture cache directory
+ * @date 20130821 - Add the application wide sound cache directory
+ * @date 20130823 - Add new MusicManager for crossfading music tracks
+ * @date 20130824 - Add the application wide network cache directory
+ * @date 20130825 - Add new EventManager for typed events posted from any thread
  */
 #ifndef   CORE_APP_HPP_INCLUDED
 #define   CORE_APP_HPP_INCLUDED
@@ -30,6 +40,11 @@
 #include <SFML/Window.hpp>
 #include <SFML/Graphics.hpp>
 #include <TVSource/Managers/AssetManager.hpp>
+#include <TVSource/Managers/BenchmarkManager.hpp>
+#include <TVSource/Managers/EventManager.hpp>
+#include <TVSource/Managers/FlightRecorder.hpp>
+#include <TVSource/Managers/MusicManager.hpp>
+#include <TVSource/Managers/ProfileManager.hpp>
 #include <TVSource/Managers/PropertyManager.hpp>
 #include <TVSource/Managers/StatManager.hpp>
 #include <TVSource/Managers/StateManager.hpp>
@@ -51,6 +66,16 @@ namespace GQE
       static const unsigned int DEFAULT_VIDEO_BPP = 32;
       /// Default application wide settings file string
       static const char* APP_SETTINGS;
+      /// Default application wide asset pack file string
+      static const char* APP_PACK;
+      /// Default application wide state asset manifests file string
+      static const char* APP_MANIFESTS;
+      /// Default application wide directory of decoded images
+      static const char* APP_TEXTURE_CACHE;
+      /// Default application wide directory of decoded sounds
+      static const char* APP_SOUND_CACHE;
+      /// Default application wide directory of files fetched from the network
+      static const char* APP_NETWORK_CACHE;
 
       // Variables
       /////////////////////////////////////////////////////////////////////////
@@ -76,6 +101,16 @@ namespace GQE
 #endif
       /// AssetManager for managing assets
       AssetManager              mAssetManager;
+      /// BenchmarkManager for running command line benchmark scenarios
+      BenchmarkManager          mBenchmarkManager;
+      /// EventManager for typed events posted from any thread (see Post)
+      EventManager              mEventManager;
+      /// FlightRecorder for keeping recent log records and frames for a dump
+      FlightRecorder            mFlightRecorder;
+      /// MusicManager for switching music tracks without stalling the game loop
+      MusicManager              mMusicManager;
+      /// ProfileManager for recording profile zones and writing Chrome traces
+      ProfileManager            mProfileManager;
       /// PropertyManager for managing IApp properties
       PropertyManager           mProperties;
       /// StatManager for managing game statistics
@@ -97,7 +132,9 @@ namespace GQE
 
       /**
        * ProcessArguments is responsible for processing command line arguments
-       * provided to the application.
+       * provided to the application. Benchmark arguments (--bench, --entities,
+       * --frames, --headless, --seed and --report) are passed on to the
+       * BenchmarkManager.
        * @param[in] argc is the number of arguments
        * @param[in] argv are the actual arguments
        */
@@ -5,6 +5,9 @@
  * @file include/GQE/Core/interfaces/IAssetHandler.hpp
  * @author Ryan Lindeman
  * @date 20120428 - Initial Release
+ * @date 20130815 - Add background loading methods used by the AssetLoader
+ * @date 20130818 - Add cache budget and statistics methods
+ * @date 20130819 - Add AddReference by Asset ID for prefetching
  */
 #ifndef   CORE_IASSET_HANDLER_HPP_INCLUDED
 #define   CORE_IASSET_HANDLER_HPP_INCLUDED
@@ -47,6 +50,16 @@ namespace GQE
       virtual void DropReference(const typeAssetID theAssetID,
         AssetDropTime theDropTime = AssetDropUnspecified) = 0;
 
+      /**
+       * AddReference will increment the reference counter for theAssetID
+       * specified, acquiring the asset first if it hasn't been created yet,
+       * so callers that don't know the asset type (e.g. StateManager
+       * prefetching) can hold an asset until they call DropReference.
+       * @param[in] theAssetID to add the reference for
+       * @return true if a reference was added, false otherwise
+       */
+      virtual bool AddReference(const typeAssetID theAssetID) = 0;
+
       /**
        * IsLoaded will return true if the Resource specified by theResourceID
        * has been loaded.
@@ -119,6 +132,63 @@ namespace GQE
        */
       virtual bool LoadAllAssets(void) = 0;
 
+      /**
+       * GetLoadState will return the background loading state of theAssetID
+       * provided (AssetLoadReady if the asset is already loaded).
+       * @param[in] theAssetID of the asset to find the loading state for
+       * @return the loading state for the asset or AssetLoadFailed otherwise
+       */
+      virtual AssetLoadState GetLoadState(const typeAssetID theAssetID) const = 0;
+
+      /**
+       * QueueAsset is called on the main thread before theAssetID provided is
+       * handed to the AssetLoader and will hold an extra reference to the
+       * asset until CompleteAsset or CancelAsset is called.
+       * @param[in] theAssetID of the asset to load in the background
+       * @return true if the asset should be queued, false if it is already
+       *         loaded, already queued or unknown
+       */
+      virtual bool QueueAsset(const typeAssetID theAssetID) = 0;
+
+      /**
+       * DecodeAsset is called by an AssetLoader worker thread and will load
+       * (decode) theAssetID provided without touching the main thread only
+       * resources (e.g. OpenGL textures).
+       * @param[in] theAssetID of the asset to decode
+       */
+      virtual void DecodeAsset(const typeAssetID theAssetID) = 0;
+
+      /**
+       * CompleteAsset is called on the main thread after DecodeAsset has
+       * finished and will finish loading theAssetID provided (e.g. upload
+       * the texture) before dropping the reference held by QueueAsset.
+       * @param[in] theAssetID of the asset to complete
+       */
+      virtual void CompleteAsset(const typeAssetID theAssetID) = 0;
+
+      /**
+       * CancelAsset is called on the main thread for each asset still waiting
+       * when the AssetLoader is stopped and will drop the reference held by
+       * QueueAsset without finishing the load.
+       * @param[in] theAssetID of the asset to cancel
+       */
+      virtual void CancelAsset(const typeAssetID theAssetID) = 0;
+
+      /**
+       * SetCacheBudget sets the most bytes the assets kept in the cache (see
+       * AssetDropCached) may use before the least recently used assets are
+       * evicted. A budget of 0 disables the cache.
+       * @param[in] theBudget in bytes to use for the cache
+       */
+      virtual void SetCacheBudget(const Uint64 theBudget) = 0;
+
+      /**
+       * GetCacheStats will return the hit, miss and eviction counters of the
+       * cache along with its current size and budget.
+       * @return the cache statistics for this IAssetHandler
+       */
+      virtual typeAssetCacheStats GetCacheStats(void) const = 0;
+
     protected:
 
     private:
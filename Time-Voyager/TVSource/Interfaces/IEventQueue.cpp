@@ -0,0 +1,144 @@
+/**
+ * Provides the IEventQueue interface class used by the EventManager to store
+ * and dispatch each TEventQueue of typed events.
+ *
+ * @file src/GQE/Core/interfaces/IEventQueue.cpp
+ * @author Ryan Lindeman
+ * @date 20130825 - Initial Release
+ * @date 20130826 - Yield while waiting for a slot and limit drop warnings
+ */
+
+#include <new>
+#include <SFML/System.hpp>
+#include <TVSource/Interfaces/IEventQueue.hpp>
+#include <TVSource/Loggers/Log_macros.hpp>
+#include <TVSource/Utils/AtomicUtil.hpp>
+
+namespace GQE
+{
+  IEventQueue::IEventQueue(std::string theType, const Uint32 theCapacity) :
+    mType(theType),
+    mState(0),
+    mCapacity(theCapacity),
+    mDropped(0)
+  {
+    // Allocate the ready flags of both buffers once, cleared to 0
+    for(Uint32 iloop = 0; iloop < 2; iloop++)
+    {
+      mReady[iloop] = new(std::nothrow) Uint32[theCapacity]();
+    }
+    if(NULL == mReady[0] || NULL == mReady[1])
+    {
+      ELOG() << "IEventQueue::ctor(" << mType << ") Unable to allocate "
+        << theCapacity << " events!" << std::endl;
+      Disable();
+    }
+  }
+
+  IEventQueue::~IEventQueue()
+  {
+    for(Uint32 iloop = 0; iloop < 2; iloop++)
+    {
+      delete[] const_cast<Uint32*>(mReady[iloop]);
+      mReady[iloop] = NULL;
+    }
+  }
+
+  const std::string& IEventQueue::GetType(void) const
+  {
+    return mType;
+  }
+
+  Uint32 IEventQueue::GetCapacity(void) const
+  {
+    return mCapacity;
+  }
+
+  Uint32 IEventQueue::GetDropped(void) const
+  {
+    return mDropped;
+  }
+
+  bool IEventQueue::BeginPost(Uint32& theBuffer, Uint32& theSlot)
+  {
+    // Reserve the next slot of the buffer currently posted to, both of which
+    // are found in the single value returned
+    Uint32 anState = AtomicIncrement(mState) - 1;
+    theBuffer = (0 != (anState & BUFFER_BIT)) ? 1 : 0;
+    theSlot = anState & COUNT_MASK;
+
+    // Return true if the slot reserved is within our capacity
+    return theSlot < mCapacity;
+  }
+
+  void IEventQueue::EndPost(const Uint32 theBuffer, const Uint32 theSlot)
+  {
+    // The atomic increment makes the event copied visible before the flag
+    AtomicIncrement(mReady[theBuffer][theSlot]);
+  }
+
+  Uint32 IEventQueue::BeginDispatch(Uint32& theBuffer)
+  {
+    // Only the main thread changes the buffer posted to, so switch posting
+    // to the other buffer and take the number of events posted at once
+    const Uint32 anCurrent = mState & BUFFER_BIT;
+    Uint32 anResult = AtomicExchange(mState, anCurrent ^ BUFFER_BIT) & COUNT_MASK;
+    theBuffer = (0 != anCurrent) ? 1 : 0;
+
+    // Events posted beyond our capacity were dropped, warn about the first
+    // frame and then every so often since this can happen every frame
+    if(anResult > mCapacity)
+    {
+      mDropped += anResult - mCapacity;
+      WLOG_EVERY_N(DROP_WARNING_INTERVAL) << "IEventQueue::BeginDispatch("
+        << mType << ") dropped " << (anResult - mCapacity) << " events ("
+        << mDropped << " total), capacity is " << mCapacity << std::endl;
+      anResult = mCapacity;
+    }
+
+    // Wait for each event still being copied by another thread and clear
+    // its flag so the slot can be posted to again
+    for(Uint32 iloop = 0; iloop < anResult; iloop++)
+    {
+      Uint32 anSpins = 0;
+      while(1 != AtomicCompareExchange(mReady[theBuffer][iloop], 0, 1))
+      {
+        // Another thread reserved this slot but hasn't finished copying, give
+        // it our time slice if it was preempted in the middle of the copy
+        if(++anSpins >= SPIN_COUNT)
+        {
+          sf::sleep(sf::Time::Zero);
+        }
+      }
+    }
+
+    // Return anResult of the number of events to dispatch
+    return anResult;
+  }
+
+  void IEventQueue::Disable(void)
+  {
+    mCapacity = 0;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
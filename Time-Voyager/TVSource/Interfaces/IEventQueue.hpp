@@ -0,0 +1,166 @@
+/**
+ * Provides the IEventQueue interface class used by the EventManager to store
+ * and dispatch each TEventQueue of typed events.
+ *
+ * @file include/GQE/Core/interfaces/IEventQueue.hpp
+ * @author Ryan Lindeman
+ * @date 20130825 - Initial Release
+ * @date 20130826 - Yield while waiting for a slot and limit drop warnings
+ */
+#ifndef   CORE_IEVENT_QUEUE_HPP_INCLUDED
+#define   CORE_IEVENT_QUEUE_HPP_INCLUDED
+
+#include <string>
+#include <TVSource/Core/Core_types.hpp>
+
+namespace GQE
+{
+  /// Provides the interface for each queue of typed events
+  class GQE_API IEventQueue
+  {
+    public:
+      /**
+       * IEventQueue default constructor
+       * @param[in] theType of event stored in this IEventQueue
+       * @param[in] theCapacity of events that can be posted each frame
+       */
+      IEventQueue(std::string theType, const Uint32 theCapacity);
+
+      /**
+       * IEventQueue deconstructor
+       */
+      virtual ~IEventQueue();
+
+      /**
+       * GetType will return the type of event stored in this IEventQueue.
+       * @return the type of event stored
+       */
+      const std::string& GetType(void) const;
+
+      /**
+       * GetCapacity will return the number of events that can be posted
+       * between each call to DispatchEvents.
+       * @return the number of events that can be posted each frame
+       */
+      Uint32 GetCapacity(void) const;
+
+      /**
+       * GetDropped will return the number of events dropped so far because
+       * more than GetCapacity events were posted in the same frame.
+       * @return the number of events dropped
+       */
+      Uint32 GetDropped(void) const;
+
+      /**
+       * DispatchEvents will deliver every event posted since the previous
+       * call in a single batch to each subscriber. Events posted while the
+       * subscribers run are delivered by the next call. Must only be called
+       * from the main thread.
+       * @return the number of events delivered
+       */
+      virtual Uint32 DispatchEvents(void) = 0;
+
+    protected:
+      /**
+       * BeginPost is responsible for reserving the slot that the next event
+       * posted will be copied into. Can be called from any thread.
+       * @param[out] theBuffer of the slot reserved
+       * @param[out] theSlot reserved within theBuffer
+       * @return true if a slot was reserved, false if the queue is full
+       */
+      bool BeginPost(Uint32& theBuffer, Uint32& theSlot);
+
+      /**
+       * EndPost is responsible for marking the slot reserved by BeginPost as
+       * ready to be dispatched once the event has been copied into it.
+       * @param[in] theBuffer of the slot reserved
+       * @param[in] theSlot reserved within theBuffer
+       */
+      void EndPost(const Uint32 theBuffer, const Uint32 theSlot);
+
+      /**
+       * BeginDispatch is responsible for switching posting to the other
+       * buffer and waiting for every event posted to the previous buffer to
+       * finish being copied.
+       * @param[out] theBuffer of the events to dispatch
+       * @return the number of events to dispatch from theBuffer
+       */
+      Uint32 BeginDispatch(Uint32& theBuffer);
+
+      /**
+       * Disable is called by the derived class when its event storage could
+       * not be allocated so every event posted is dropped.
+       */
+      void Disable(void);
+
+    private:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Bit of mState holding the buffer events are posted to
+      static const Uint32 BUFFER_BIT = 0x80000000;
+      /// Bits of mState holding the number of events posted to the buffer
+      static const Uint32 COUNT_MASK = 0x7FFFFFFF;
+      /// Number of times to check a slot being copied before yielding
+      static const Uint32 SPIN_COUNT = 64;
+      /// Number of frames with dropped events per warning logged
+      static const Uint32 DROP_WARNING_INTERVAL = 300;
+
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// The type of event stored in this IEventQueue
+      const std::string mType;
+      /// The buffer posted to (BUFFER_BIT) and number of events posted to it
+      volatile Uint32 mState;
+      /// The number of events that can be posted each frame
+      Uint32 mCapacity;
+      /// The number of events dropped so far
+      Uint32 mDropped;
+      /// Flags set by EndPost for each slot of both buffers
+      volatile Uint32* mReady[2];
+
+      /**
+       * IEventQueue copy constructor is private because we do not allow copies
+       * of our class
+       */
+      IEventQueue(const IEventQueue&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      IEventQueue& operator=(const IEventQueue&); // Intentionally undefined
+  }; // class IEventQueue
+} // namespace GQE
+
+#endif // CORE_IEVENT_QUEUE_HPP_INCLUDED
+
+/**
+ * @class GQE::IEventQueue
+ * @ingroup Core
+ * The IEventQueue class provides the lock-free posting and double buffered
+ * storage shared by every TEventQueue. Events are posted into one of two
+ * buffers allocated once at construction while the other buffer is being
+ * dispatched, so posting never allocates memory or takes a lock. A single
+ * atomic value holds both the buffer posted to and the number of events
+ * posted to it, which lets DispatchEvents switch buffers with one exchange
+ * without losing an event posted by a worker thread at the same moment.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -8,12 +8,22 @@
  * @date 20120426 - Change to ILogger::GetLogger call instead of gLogger
  * @date 20120504 - Fix segfault caused by SLOG taking over gInstance
  * @date 20120512 - Renamed App to IApp since it really is just an interface
+ * @date 20130809 - Added Flush and cache the timestamp text per second
+ * @date 20130810 - Added runtime log level and per module level overrides
+ * @date 20130810 - Added binary log call sites and LogArguments
+ * @date 20130811 - Write the FlightRecorder dump in FatalShutdown
+ * @date 20130826 - Added IsRecordingText
  */
+#include <cstring>
 #include <ctime>
 #include <ostream>
+#include <sstream>
 
 #include <TVSource/Interfaces/ILogger.hpp>
 #include <TVSource/Interfaces/IApp.hpp>
+#include <TVSource/Loggers/Log_macros.hpp>
+#include <TVSource/Managers/FlightRecorder.hpp>
+#include <TVSource/Utils/AtomicUtil.hpp>
 
 /*#ifdef BUILDING_MYDLL
 #define iLogger_DECLSPEC __declspec(dllexport)
@@ -23,15 +33,168 @@
 
 namespace GQE
 {
+  /**
+   * WriteDigits will write theValue provided as theCount decimal digits
+   * (padded with leading zeros) into theText provided.
+   * @param[out] theText to write the digits into
+   * @param[in] theValue to write
+   * @param[in] theCount of digits to write
+   */
+  static void WriteDigits(char* theText, int theValue, int theCount)
+  {
+    for(int iloop = theCount - 1; iloop >= 0; iloop--)
+    {
+      theText[iloop] = (char)('0' + theValue % 10);
+      theValue /= 10;
+    }
+  }
+
+  /// Provides the level override of a single module
+  struct typeLogModule
+  {
+    char            name[ILogger::MAX_MODULE_NAME]; ///< Name of the module
+    volatile Uint32 level; ///< Minimum severity logged from the module
+  };
+
+  /// The level override of each module
+  static typeLogModule gModules[ILogger::MAX_MODULES];
+
+  /// The static information of each binary log call site registered
+  static typeLogSite gSites[ILogger::MAX_SITES];
+
+  /// Lock used while registering a new call site
+  static volatile Uint32 gSiteLock = 0;
+
+  /**
+   * WriteArgument will write the next argument found in theArguments to
+   * theOstream provided and move theArguments past it.
+   * @param[in,out] theOstream to write the argument to
+   * @param[in,out] theArguments to read the next argument from
+   * @param[in] theEnd of the arguments recorded
+   * @return true if an argument was written, false if none was left
+   */
+  static bool WriteArgument(std::ostream& theOstream, const char*& theArguments,
+      const char* theEnd)
+  {
+    // Assume no argument is left
+    bool anResult = false;
+
+    if(theArguments < theEnd)
+    {
+      // Each argument starts with its type followed by its raw bytes
+      Uint8 anType = (Uint8)*theArguments++;
+      Uint32 anLeft = (Uint32)(theEnd - theArguments);
+      switch(anType)
+      {
+        case LogArgumentInt32:
+          if(anLeft >= sizeof(Int32))
+          {
+            Int32 anValue;
+            memcpy(&anValue, theArguments, sizeof(anValue));
+            theArguments += sizeof(anValue);
+            theOstream << anValue;
+            anResult = true;
+          }
+          break;
+        case LogArgumentUint32:
+          if(anLeft >= sizeof(Uint32))
+          {
+            Uint32 anValue;
+            memcpy(&anValue, theArguments, sizeof(anValue));
+            theArguments += sizeof(anValue);
+            theOstream << anValue;
+            anResult = true;
+          }
+          break;
+        case LogArgumentInt64:
+          if(anLeft >= sizeof(Int64))
+          {
+            Int64 anValue;
+            memcpy(&anValue, theArguments, sizeof(anValue));
+            theArguments += sizeof(anValue);
+            theOstream << anValue;
+            anResult = true;
+          }
+          break;
+        case LogArgumentUint64:
+          if(anLeft >= sizeof(Uint64))
+          {
+            Uint64 anValue;
+            memcpy(&anValue, theArguments, sizeof(anValue));
+            theArguments += sizeof(anValue);
+            theOstream << anValue;
+            anResult = true;
+          }
+          break;
+        case LogArgumentDouble:
+          if(anLeft >= sizeof(double))
+          {
+            double anValue;
+            memcpy(&anValue, theArguments, sizeof(anValue));
+            theArguments += sizeof(anValue);
+            theOstream << anValue;
+            anResult = true;
+          }
+          break;
+        case LogArgumentBool:
+          if(anLeft >= 1)
+          {
+            theOstream << (0 != *theArguments++ ? "true" : "false");
+            anResult = true;
+          }
+          break;
+        case LogArgumentChar:
+          if(anLeft >= 1)
+          {
+            theOstream << *theArguments++;
+            anResult = true;
+          }
+          break;
+        case LogArgumentString:
+          if(anLeft >= sizeof(Uint16))
+          {
+            Uint16 anLength;
+            memcpy(&anLength, theArguments, sizeof(anLength));
+            theArguments += sizeof(anLength);
+            if(anLength <= anLeft - sizeof(anLength))
+            {
+              theOstream.write(theArguments, anLength);
+              theArguments += anLength;
+              anResult = true;
+            }
+          }
+          break;
+        default:
+          break;
+      }
+
+      // Stop at the first argument that can't be read
+      if(!anResult)
+      {
+        theArguments = theEnd;
+      }
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
 
   /// Single instance of the most recently created ILogger class
   ILogger* ILogger::gInstance = NULL;
   std::onullstream ILogger::gNullStream;
+  volatile Uint32 ILogger::gLevel = INFO_LEVEL;
+  volatile Uint32 ILogger::gMinimumLevel = INFO_LEVEL;
+  volatile Uint32 ILogger::gModuleCount = 0;
+  volatile Uint32 ILogger::gSiteCount = 0;
 
   ILogger::ILogger(bool theDefault, int theExitCode) :
     mActive(false),
-    mExitCode(StatusError)
+    mExitCode(StatusError),
+    mTimestampTime(0)
   {
+    // No timestamp text has been cached yet
+    mTimestamp[0] = '\0';
+
     // Make this the default logger?
     if(theDefault)
     {
@@ -67,6 +230,116 @@ namespace GQE
     return gInstance;
   }
 
+  SeverityType ILogger::GetLevel(void)
+  {
+    return (SeverityType)gLevel;
+  }
+
+  void ILogger::SetLevel(SeverityType theSeverity)
+  {
+    gLevel = (Uint32)theSeverity;
+    UpdateMinimumLevel();
+  }
+
+  void ILogger::SetModuleLevel(const char* theModule, SeverityType theSeverity)
+  {
+    if(NULL != theModule)
+    {
+      // Change the existing override of theModule if one exists
+      Uint32 anCount = gModuleCount;
+      Uint32 anIndex = 0;
+      while(anIndex < anCount &&
+        strncmp(gModules[anIndex].name, theModule, MAX_MODULE_NAME - 1) != 0)
+      {
+        anIndex++;
+      }
+
+      if(anIndex < anCount)
+      {
+        gModules[anIndex].level = (Uint32)theSeverity;
+      }
+      else if(anCount < MAX_MODULES)
+      {
+        typeLogModule& anModule = gModules[anCount];
+        strncpy(anModule.name, theModule, MAX_MODULE_NAME - 1);
+        anModule.name[MAX_MODULE_NAME - 1] = '\0';
+        anModule.level = (Uint32)theSeverity;
+
+        // Only count the new override once it can be found by other threads
+        AtomicIncrement(gModuleCount);
+      }
+      else
+      {
+        WLOG() << "ILogger::SetModuleLevel(" << theModule
+          << ") too many module level overrides" << std::endl;
+      }
+
+      UpdateMinimumLevel();
+    }
+  }
+
+  void ILogger::ClearModuleLevels(void)
+  {
+    gModuleCount = 0;
+    UpdateMinimumLevel();
+  }
+
+  bool ILogger::IsModuleEnabled(SeverityType theSeverity,
+      const char* theSourceFile)
+  {
+    // Default to the level of modules without an override
+    Uint32 anLevel = gLevel;
+
+    if(NULL != theSourceFile)
+    {
+      // The module name is the source file name without path or extension
+      const char* anName = theSourceFile;
+      for(const char* anCharacter = theSourceFile; '\0' != *anCharacter; anCharacter++)
+      {
+        if('/' == *anCharacter || '\\' == *anCharacter)
+        {
+          anName = anCharacter + 1;
+        }
+      }
+      size_t anLength = 0;
+      while('\0' != anName[anLength] && '.' != anName[anLength] &&
+        anLength < MAX_MODULE_NAME - 1)
+      {
+        anLength++;
+      }
+
+      // Look for the override of this module
+      Uint32 anCount = gModuleCount;
+      for(Uint32 iloop = 0; iloop < anCount; iloop++)
+      {
+        if(strncmp(gModules[iloop].name, anName, anLength) == 0 &&
+          '\0' == gModules[iloop].name[anLength])
+        {
+          anLevel = gModules[iloop].level;
+          break;
+        }
+      }
+    }
+
+    // Return true if theSeverity is at or above the level found above
+    return (Uint32)theSeverity >= anLevel;
+  }
+
+  void ILogger::UpdateMinimumLevel(void)
+  {
+    // Find the lowest level of the default level and each override
+    Uint32 anMinimum = gLevel;
+    Uint32 anCount = gModuleCount;
+    for(Uint32 iloop = 0; iloop < anCount; iloop++)
+    {
+      if(gModules[iloop].level < anMinimum)
+      {
+        anMinimum = gModules[iloop].level;
+      }
+    }
+    gMinimumLevel = anMinimum;
+  }
+
   bool ILogger::IsActive(void)
   {
     return mActive;
@@ -78,60 +351,169 @@ namespace GQE
   }
 
 
+  void ILogger::Flush(void)
+  {
+    // Nothing to flush by default
+  }
+
+  void ILogger::LogArguments(Uint32 theSite, const char* theArguments,
+      Uint32 theLength)
+  {
+    const typeLogSite* anSite = GetSite(theSite);
+    if(NULL != anSite && IsActive())
+    {
+      // Format the arguments into text and log them as any other message
+      std::ostringstream anMessage;
+      WriteArguments(anMessage, anSite->format, theArguments, theLength);
+      LogMessage(anSite->severity, anSite->file, anSite->line,
+        anMessage.str().c_str());
+    }
+  }
+
+  bool ILogger::IsRecordingText(void)
+  {
+    // Text messages are not kept by default
+    return false;
+  }
+
+  Uint32 ILogger::RegisterSite(SeverityType theSeverity,
+      const char* theSourceFile, int theSourceLine, const char* theFormat)
+  {
+    // Default to 0 if no more sites can be registered
+    Uint32 anResult = 0;
+
+    // Spin until we own the lock, each site is only registered once
+    while(AtomicCompareExchange(gSiteLock, 1, 0) != 0)
+    {
+    }
+
+    if(gSiteCount < MAX_SITES)
+    {
+      typeLogSite& anSite = gSites[gSiteCount];
+      anSite.severity = theSeverity;
+      anSite.file = theSourceFile;
+      anSite.line = theSourceLine;
+      anSite.format = (NULL != theFormat) ? theFormat : "";
+
+      // Only count the new site once it can be found by other threads
+      anResult = AtomicIncrement(gSiteCount);
+    }
+
+    // Release the lock
+    AtomicCompareExchange(gSiteLock, 0, 1);
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  const typeLogSite* ILogger::GetSite(Uint32 theSite)
+  {
+    // Site IDs start at 1 so 0 can mean not registered
+    return (theSite > 0 && theSite <= gSiteCount) ? &gSites[theSite - 1] : NULL;
+  }
+
+  void ILogger::WriteArguments(std::ostream& theOstream, const char* theFormat,
+      const char* theArguments, Uint32 theLength)
+  {
+    const char* anEnd = theArguments + theLength;
+
+    // Replace each {} in theFormat with the next argument
+    for(const char* anCharacter = theFormat; '\0' != *anCharacter; anCharacter++)
+    {
+      if('{' == anCharacter[0] && '}' == anCharacter[1] &&
+        WriteArgument(theOstream, theArguments, anEnd))
+      {
+        anCharacter++;
+      }
+      else
+      {
+        theOstream << *anCharacter;
+      }
+    }
+
+    // Write any arguments left over at the end
+    while(theArguments < anEnd)
+    {
+      theOstream << " ";
+      WriteArgument(theOstream, theArguments, anEnd);
+    }
+  }
+
   void ILogger::WriteTag(std::ostream& theOstream, SeverityType theSeverity,
       const char* theSourceFile, int theSourceLine)
   {
-    const struct std::tm* anTm; // Pointer to Time structure
-    std::time_t anNow;
+    // Output time in timestamp format followed by the log level as a single
+    // character and the File:Line tag
+    theOstream << GetTimestamp(std::time(NULL)) << GetSeverityCharacter(theSeverity)
+      << " " << theSourceFile << ":" << theSourceLine << " ";
+  }
+
+  const char* ILogger::GetTimestamp(std::time_t theTime)
+  {
+    // Only convert theTime into local time (with help from OS) once per second
+    if(theTime != mTimestampTime || '\0' == mTimestamp[0])
+    {
+      FormatTimestamp(theTime, mTimestamp);
+      mTimestampTime = theTime;
+    }
 
-    // Get current time in seconds since Jan 1, 1970
-    anNow = std::time(NULL);
+    // Return the timestamp text cached above
+    return mTimestamp;
+  }
 
-    // Convert current time value into local time (with help from OS)
-    anTm = std::localtime(&anNow);
+  void ILogger::FormatTimestamp(std::time_t theTime, char* theText)
+  {
+    // Convert theTime into local time (with help from OS)
+    const struct std::tm* anTm = std::localtime(&theTime);
 
     // Output time in timestamp format
-    theOstream << anTm->tm_year + 1900 << "-";
-    theOstream.fill('0');
-    theOstream.width(2);
-    theOstream << anTm->tm_mon + 1 << "-";
-    theOstream.fill('0');
-    theOstream.width(2);
-    theOstream << anTm->tm_mday << " ";
-    theOstream.fill('0');
-    theOstream.width(2);
-    theOstream << anTm->tm_hour + 1 << ":";
-    theOstream.fill('0');
-    theOstream.width(2);
-    theOstream << anTm->tm_min << ":";
-    theOstream.fill('0');
-    theOstream.width(2);
-    theOstream << anTm->tm_sec << " ";
-
-    // Now print the log level as a single character
+    WriteDigits(&theText[0], anTm->tm_year + 1900, 4);
+    theText[4] = '-';
+    WriteDigits(&theText[5], anTm->tm_mon + 1, 2);
+    theText[7] = '-';
+    WriteDigits(&theText[8], anTm->tm_mday, 2);
+    theText[10] = ' ';
+    WriteDigits(&theText[11], anTm->tm_hour + 1, 2);
+    theText[13] = ':';
+    WriteDigits(&theText[14], anTm->tm_min, 2);
+    theText[16] = ':';
+    WriteDigits(&theText[17], anTm->tm_sec, 2);
+    theText[19] = ' ';
+    theText[TIMESTAMP_LENGTH] = '\0';
+  }
+
+  char ILogger::GetSeverityCharacter(SeverityType theSeverity)
+  {
+    // Default to U for unknown severity levels
+    char anResult = 'U';
+
     switch(theSeverity)
     {
       case SeverityInfo:
-        theOstream << "I";
+        anResult = 'I';
         break;
       case SeverityWarning:
-        theOstream << "W";
+        anResult = 'W';
         break;
       case SeverityError:
-        theOstream << "E";
+        anResult = 'E';
         break;
       case SeverityFatal:
-        theOstream << "F";
+        anResult = 'F';
         break;
       default:
-        theOstream << "U";
         break;
     }
-    theOstream << " " << theSourceFile << ":" << theSourceLine << " ";
+
+    // Return anResult determined above
+    return anResult;
   }
 
   void ILogger::FatalShutdown(void)
   {
+    // Write the last few seconds of context kept by the FlightRecorder
+    FlightRecorder::Dump("FatalShutdown");
+
     // Does the gApp pointer exist? then call the Quit method
     if(NULL != IApp::GetApp())
     {
@@ -9,10 +9,15 @@
  * @date 20110801 - Moved code to .cpp file due to circular dependencies
  * @date 20120426 - Change to ILogger::GetLogger call instead of gLogger
  * @date 20120504 - Fix segfault caused by SLOG taking over gInstance
+ * @date 20130809 - Added Flush and cache the timestamp text per second
+ * @date 20130810 - Added runtime log level and per module level overrides
+ * @date 20130810 - Added binary log call sites and LogArguments
+ * @date 20130826 - Added IsRecordingText for the FlightRecorder
  */
 #ifndef   CORE_ILOGGER_HPP_INCLUDED
 #define   CORE_ILOGGER_HPP_INCLUDED
 
+#include <ctime>
 #include <TVSource/Core/Core_types.hpp>
 #include <TVSource/loggers/onullstream>
 
@@ -22,6 +27,17 @@ namespace GQE
   class GQE_API ILogger
   {
     public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Maximum number of module level overrides (see SetModuleLevel)
+      static const Uint32 MAX_MODULES = 32;
+      /// Maximum length of a module name (longer names are truncated)
+      static const Uint32 MAX_MODULE_NAME = 32;
+      /// Maximum number of binary log call sites (see RegisterSite)
+      static const Uint32 MAX_SITES = 4096;
+      /// Length of the timestamp text written by FormatTimestamp
+      static const Uint32 TIMESTAMP_LENGTH = 20;
+
       /// Null stream for Logger macros if not active or severity level is disabled
       static std::onullstream gNullStream;
 
@@ -37,6 +53,50 @@ namespace GQE
        */
       static ILogger* GetLogger(void);
 
+      /**
+       * IsEnabled will return true if a message of theSeverity logged from
+       * theSourceFile would be logged by the default logger. The Log macros
+       * call this before evaluating any << arguments so disabled messages
+       * cost a single comparison.
+       * @param[in] theSeverity of the message to be logged
+       * @param[in] theSourceFile where the Log macro was called from
+       * @return true if the message would be logged, false otherwise
+       */
+      static bool IsEnabled(SeverityType theSeverity, const char* theSourceFile)
+      {
+        return (Uint32)theSeverity >= gMinimumLevel && NULL != gInstance &&
+          gInstance->mActive &&
+          (0 == gModuleCount || IsModuleEnabled(theSeverity, theSourceFile));
+      }
+
+      /**
+       * GetLevel will return the minimum severity logged by modules without
+       * a level override.
+       * @return the minimum severity logged
+       */
+      static SeverityType GetLevel(void);
+
+      /**
+       * SetLevel will set the minimum severity logged by modules without a
+       * level override (see SetModuleLevel).
+       * @param[in] theSeverity to use as the minimum severity logged
+       */
+      static void SetLevel(SeverityType theSeverity);
+
+      /**
+       * SetModuleLevel will set the minimum severity logged from theModule
+       * provided, which is the source file name without its path and
+       * extension (e.g. "PropertyManager").
+       * @param[in] theModule to override the minimum severity for
+       * @param[in] theSeverity to use as the minimum severity of theModule
+       */
+      static void SetModuleLevel(const char* theModule, SeverityType theSeverity);
+
+      /**
+       * ClearModuleLevels will remove every module level override.
+       */
+      static void ClearModuleLevels(void);
+
       /**
        * IsActive will return true if this logger is currently active
        * @return true if logger is active, false otherwise
@@ -89,6 +149,79 @@ namespace GQE
           const char* theSourceFile, int theSourceLine,
           const char* theMessage) = 0;
 
+      /**
+       * Flush is responsible for making sure every message logged so far has
+       * been written before returning (e.g. before a fatal shutdown).
+       */
+      virtual void Flush(void);
+
+      /**
+       * LogArguments is responsible for logging a message from theSite
+       * provided using theArguments recorded by the LogRecord class. By
+       * default the arguments are formatted into text and logged using the
+       * LogMessage method.
+       * @param[in] theSite the message was logged from (see RegisterSite)
+       * @param[in] theArguments recorded for the message
+       * @param[in] theLength of theArguments in bytes
+       */
+      virtual void LogArguments(Uint32 theSite, const char* theArguments,
+          Uint32 theLength);
+
+      /**
+       * IsRecordingText will return true if this logger keeps each text
+       * message logged with the FlightRecorder itself (see AsyncLogger).
+       * @return true if text messages are kept, false otherwise
+       */
+      virtual bool IsRecordingText(void);
+
+      /**
+       * RegisterSite will register the static information of a binary log
+       * call site and return its ID. This is called once per call site by
+       * the binary Log macros (see ILOGB).
+       * @param[in] theSeverity of every message logged from the site
+       * @param[in] theSourceFile of the site (must outlive every logger)
+       * @param[in] theSourceLine of the site
+       * @param[in] theFormat of the message (must outlive every logger)
+       * @return the ID of the site or 0 if MAX_SITES were registered
+       */
+      static Uint32 RegisterSite(SeverityType theSeverity,
+          const char* theSourceFile, int theSourceLine, const char* theFormat);
+
+      /**
+       * GetSite will return the static information of theSite provided.
+       * @param[in] theSite ID returned by RegisterSite
+       * @return pointer to the site information or NULL if not registered
+       */
+      static const typeLogSite* GetSite(Uint32 theSite);
+
+      /**
+       * WriteArguments will write theFormat provided to theOstream replacing
+       * each {} with the next argument found in theArguments. Any arguments
+       * left over are written at the end separated by a space.
+       * @param[in,out] theOstream to write the message to
+       * @param[in] theFormat of the message
+       * @param[in] theArguments recorded for the message
+       * @param[in] theLength of theArguments in bytes
+       */
+      static void WriteArguments(std::ostream& theOstream, const char* theFormat,
+          const char* theArguments, Uint32 theLength);
+
+      /**
+       * FormatTimestamp will write the timestamp text for theTime provided
+       * (e.g. "2013-08-09 12:00:00 ") into theText provided.
+       * @param[in] theTime in seconds since Jan 1, 1970 to convert
+       * @param[out] theText to write TIMESTAMP_LENGTH characters and a '\0' into
+       */
+      static void FormatTimestamp(std::time_t theTime, char* theText);
+
+      /**
+       * GetSeverityCharacter will return the single character used to show
+       * theSeverity provided in each log message tag.
+       * @param[in] theSeverity to convert
+       * @return the character for theSeverity (e.g. 'I' for SeverityInfo)
+       */
+      static char GetSeverityCharacter(SeverityType theSeverity);
+
     protected:
       /**
        * ILogger constructor is protected because we do not allow copies of our
@@ -110,6 +243,15 @@ namespace GQE
       void WriteTag(std::ostream& theOstream, SeverityType theSeverity,
           const char* theSourceFile, int theSourceLine);
 
+      /**
+       * GetTimestamp will return the timestamp text (e.g. "2013-08-09 12:00:00 ")
+       * for theTime provided. The text is cached so the local time conversion
+       * is only made once per second.
+       * @param[in] theTime in seconds since Jan 1, 1970 to convert
+       * @return the timestamp text of TIMESTAMP_LENGTH characters
+       */
+      const char* GetTimestamp(std::time_t theTime);
+
       /**
        * FatalShutdown is called when logging a Fatal severity after the message
        * has been logged and will handle gracefully exiting the application by
@@ -118,13 +260,42 @@ namespace GQE
       void FatalShutdown(void);
 
     private:
+      /**
+       * IsModuleEnabled will return true if a message of theSeverity logged
+       * from theSourceFile would be logged using the level override of its
+       * module or the default level if its module has no override.
+       * @param[in] theSeverity of the message to be logged
+       * @param[in] theSourceFile where the Log macro was called from
+       * @return true if the message would be logged, false otherwise
+       */
+      static bool IsModuleEnabled(SeverityType theSeverity,
+          const char* theSourceFile);
+
+      /**
+       * UpdateMinimumLevel will recompute gMinimumLevel after the default
+       * level or a module level override has changed.
+       */
+      static void UpdateMinimumLevel(void);
+
       /// Instance variable assigned at construction time
       static ILogger* gInstance;
+      /// Minimum severity logged by modules without a level override
+      static volatile Uint32 gLevel;
+      /// Lowest minimum severity of gLevel and every module level override
+      static volatile Uint32 gMinimumLevel;
+      /// Number of module level overrides
+      static volatile Uint32 gModuleCount;
+      /// Number of binary log call sites registered
+      static volatile Uint32 gSiteCount;
 
       /// Logger is currently active
       bool  mActive;
       /// The Exit value to use when FatalShutdown method is called
       int mExitCode;
+      /// The time of the timestamp text cached in mTimestamp
+      std::time_t mTimestampTime;
+      /// The timestamp text cached for mTimestampTime
+      char  mTimestamp[TIMESTAMP_LENGTH + 1];
 
       /**
        * Our copy constructor is private because we do not allow copies of
@@ -148,7 +319,10 @@ namespace GQE
  * @ingroup Core
  * The ILogger class is at the heart of all logging classes in GQ Engines.
  * Its' purpose is to provide logging support during and after development of
- * any game based on the GQ Engines framework.
+ * any game based on the GQ Engines framework. Besides the severity levels
+ * stripped at compile time (see GQE_STRIP_LOG) the minimum severity logged
+ * can be changed at runtime for every module or for a single module (e.g.
+ * from the [log] and [logmodules] sections of settings.cfg).
  *
  * Copyright (c) 2010-2011 Ryan Lindeman
  * Permission is hereby granted, free of charge, to any person obtaining a copy
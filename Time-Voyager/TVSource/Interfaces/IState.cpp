@@ -9,6 +9,7 @@
  * @date 20120322 - Support new SFML2 snapshot changes
  * @date 20120512 - Renamed App to IApp since it really is just an interface
  * @date 20120702 - Switched names of Cleanup and HandleCleanup and added cleanup events
+ * @date 20130819 - Record the assets created by the derived state constructor
  */
 
 #include <assert.h>
@@ -28,6 +29,10 @@ namespace GQE
     mPausedTime(0.0f)
   {
     ILOG() << "IState::ctor(" << mStateID << ")" << std::endl;
+
+    // Record the assets created by the derived class constructor into our
+    // asset manifest until we are added to the StateManager
+    mApp.mStateManager.RecordManifest(mStateID);
   }
 
   IState::~IState()
@@ -18,6 +18,11 @@
  * @date 20120514 - Fix comment whitespace and added GetID method call
  * @date 20120523 - Remove GQE_API from template classes to fix linker issues
  * @date 20120616 - Add default constructor and fixed assignment operator issues
+ * @date 20130815 - Add LoadAsync and return the dummy asset while loading
+ * @date 20130816 - Default to loading from asset packs in release builds
+ * @date 20130817 - Reference the asset slot directly instead of its Asset ID
+ * @date 20130818 - Default to keeping dropped assets in the handler cache
+ * @date 20130819 - Record each asset referenced into the state asset manifest
  */
 #ifndef   CORE_TASSET_HPP_INCLUDED
 #define   CORE_TASSET_HPP_INCLUDED
@@ -40,16 +45,18 @@ namespace GQE
        * @param[in] theAssetID to use for this asset
        * @param[in] theLoadTime (Now, Later) of when to load this asset
        * @param[in] theLoadStyle (File, Mem, Network) to use when loading this asset
-       * @param[in] theDropTime at (Zero, Exit) for when to unload this asset
+       * @param[in] theDropTime at (Zero, Exit, Cached) for when to unload this asset
        */
       TAsset(const typeAssetID theAssetID,
         AssetLoadTime theLoadTime = AssetLoadLater,
-        AssetLoadStyle theLoadStyle = AssetLoadFromFile,
-        AssetDropTime theDropTime = AssetDropAtZero) :
+        AssetLoadStyle theLoadStyle = AssetLoadFromDefault,
+        AssetDropTime theDropTime = AssetDropCached) :
         mAssetHandler(IApp::GetApp()->mAssetManager.GetHandler<TYPE>()),
-        mAsset(mAssetHandler.GetReference(theAssetID, theLoadTime, theLoadStyle, theDropTime)),
+        mSlot(mAssetHandler.GetSlot(theAssetID, theLoadTime, theLoadStyle, theDropTime)),
         mAssetID(theAssetID)
       {
+        // Add this asset to the state asset manifest being recorded (if any)
+        IApp::GetApp()->mAssetManager.RecordAsset(mAssetHandler.GetID(), theAssetID);
       }
 
       /**
@@ -60,7 +67,7 @@ namespace GQE
        */
       TAsset() :
         mAssetHandler(IApp::GetApp()->mAssetManager.GetHandler<TYPE>()),
-        mAsset(mAssetHandler.GetReference())
+        mSlot(NULL)
       {
       }
 
@@ -71,10 +78,11 @@ namespace GQE
         */
       TAsset(const TAsset<TYPE>& theCopy) :
         mAssetHandler(theCopy.mAssetHandler),
+        mSlot(theCopy.mSlot),
         mAssetID(theCopy.mAssetID)
       {
         // Increment reference count to this asset
-        mAsset = mAssetHandler.GetReference(mAssetID);
+        mAssetHandler.AddReference(mSlot);
       }
       
 
@@ -84,7 +92,7 @@ namespace GQE
       virtual ~TAsset()
       {
         // Drop reference to this asset
-        mAssetHandler.DropReference(mAssetID);
+        mAssetHandler.DropReference(mSlot);
       }
 
       /**
@@ -93,7 +101,7 @@ namespace GQE
        */
       bool IsLoaded(void) const
       {
-        return mAssetHandler.IsLoaded(mAssetID);
+        return NULL != mSlot && mSlot->loaded;
       }
 
       /**
@@ -107,46 +115,90 @@ namespace GQE
 
       /**
        * SetID will set the ID for this asset and get a reference to the
-       * asset.
+       * asset after dropping the reference to the previous asset (if any).
        * @param[in] theAssetID to use for this asset
        * @param[in] theLoadTime (Now, Later) of when to load this asset
        * @param[in] theLoadStyle (File, Mem, Network) to use when loading this asset
-       * @param[in] theDropTime at (Zero, Exit) for when to unload this asset
+       * @param[in] theDropTime at (Zero, Exit, Cached) for when to unload this asset
        */
       void SetID(const typeAssetID theAssetID,
         AssetLoadTime theLoadTime = AssetLoadLater,
-        AssetLoadStyle theLoadStyle = AssetLoadFromFile,
-        AssetDropTime theDropTime = AssetDropAtZero)
+        AssetLoadStyle theLoadStyle = AssetLoadFromDefault,
+        AssetDropTime theDropTime = AssetDropCached)
       {
+        // Try to obtain a reference to the new Asset from Handler
+        typename TAssetHandler<TYPE>::typeAssetSlot* anSlot =
+          mAssetHandler.GetSlot(theAssetID, theLoadTime, theLoadStyle, theDropTime);
+
+        // Drop the reference to the previous Asset (if any)
+        mAssetHandler.DropReference(mSlot);
+
         // Make note of the new Asset ID
+        mSlot = anSlot;
         mAssetID = theAssetID;
 
-        // Try to obtain a reference to the new Asset from Handler
-        mAsset = mAssetHandler.GetReference(mAssetID, theLoadTime, theLoadStyle, theDropTime);
+        // Add this asset to the state asset manifest being recorded (if any)
+        IApp::GetApp()->mAssetManager.RecordAsset(mAssetHandler.GetID(), theAssetID);
       }
 
       /**
-       * GetAsset will return the Asset if it is available.
-       * @return pointer to the Asset or NULL if not available yet.
+       * GetLoadState will return the background loading state of this asset.
+       * @return the loading state (Queued, Decoding, Ready, Failed, etc)
        */
-      TYPE& GetAsset(void)
+      AssetLoadState GetLoadState(void) const
       {
-        // Is asset not yet loaded, then try to load it immediately
-        if(false == mAssetHandler.IsLoaded(mAssetID))
+        // Default to failed if no asset was obtained
+        AssetLoadState anResult = AssetLoadFailed;
+
+        if(NULL != mSlot)
         {
-          // Load the asset immediately
-          bool anLoaded = mAssetHandler.LoadAsset(mAssetID);
+          anResult = mSlot->loaded ? AssetLoadReady : mSlot->state;
+        }
+
+        // Return anResult determined above
+        return anResult;
+      }
 
-          // If the asset was loaded, get a reference to it now
-          if(anLoaded)
+      /**
+       * LoadAsync will queue this asset to be loaded in the background by the
+       * AssetLoader worker threads. GetAsset will return the dummy asset
+       * until the load is ready.
+       * @return a handle that can be used to follow or wait for the load
+       */
+      AssetLoadHandle LoadAsync(void)
+      {
+        return IApp::GetApp()->mAssetManager.LoadAssetAsync(mAssetHandler, mAssetID);
+      }
+
+      /**
+       * GetAsset will return the Asset if it is available. If the asset is
+       * being loaded in the background the dummy asset is returned until the
+       * load is ready, otherwise the asset is loaded immediately. Once the
+       * asset is loaded this only checks the loaded flag of its slot.
+       * @return reference to the Asset or the dummy asset if not available yet.
+       */
+      TYPE& GetAsset(void)
+      {
+        // Default to the dummy asset until the asset is loaded
+        TYPE* anResult = mAssetHandler.GetReference();
+
+        if(NULL != mSlot)
+        {
+          // Asset already loaded? then use it (the usual case)
+          if(mSlot->loaded)
           {
-            // Get reference to the asset immediately
-            mAsset = mAssetHandler.GetReference(mAssetID);
+            anResult = mSlot->asset;
+          }
+          // Not loading in the background? then try to load it immediately
+          else if(false == TAssetHandler<TYPE>::IsPending(mSlot->state) &&
+            mAssetHandler.LoadAsset(mSlot))
+          {
+            anResult = mSlot->asset;
           }
         }
 
         // Return reference to dummy asset or loaded asset
-        return *mAsset;
+        return *anResult;
       }
 
       /**
@@ -226,7 +278,7 @@ namespace GQE
       /**
        * SetDropTime will set the drop time for this asset to theDropTime
        * specified.
-       * @param[in] theDropTime at (Zero, Exit) for when to unload this asset
+       * @param[in] theDropTime at (Zero, Exit, Cached) for when to unload this asset
        */
       void SetDropTime(AssetDropTime theDropTime)
       {
@@ -240,12 +292,11 @@ namespace GQE
        */
       TAsset<TYPE>& operator=(TAsset<TYPE> theRight)
       {
-        // Now swap my local copy with theRight copy made during the call to this method
+        // Now swap my local copy with theRight copy made during the call to
+        // this method, which already holds a reference to the asset and will
+        // drop the reference to our previous asset when it goes away
         swap(*this, theRight);
 
-        // Increment the reference count to this Asset
-        mAssetHandler.GetReference(mAssetID);
-
         // Return my pointer
         return *this;
       }
@@ -261,8 +312,8 @@ namespace GQE
         // enable ADL
         using std::swap;
 
-        // Swap our asset pointer and ID
-        swap(first.mAsset, second.mAsset);
+        // Swap our asset slot and ID
+        swap(first.mSlot, second.mSlot);
         swap(first.mAssetID, second.mAssetID);
         // The mAssetHandler is already handled at construction time
       }
@@ -271,8 +322,8 @@ namespace GQE
       ///////////////////////////////////////////////////////////////////////////
       /// Asset Handler class that will manage this asset
       TAssetHandler<TYPE>& mAssetHandler;
-      /// Pointer to the loaded asset
-      TYPE*                mAsset;
+      /// Slot of the asset which holds its pointer, load state and references
+      typename TAssetHandler<TYPE>::typeAssetSlot* mSlot;
       /// Asset ID specified for this asset
       typeAssetID          mAssetID;
   }; // class TAsset
@@ -285,7 +336,9 @@ namespace GQE
  * @ingroup Core
  * The TAsset template class is the template used to create a new asset type
  * reference.  It provides indirect reference counting and dummy asset
- * references if no Asset ID is provided (see IAssetHandler).
+ * references if no Asset ID is provided (see IAssetHandler). Each TAsset
+ * keeps the slot of its asset (see TAssetHandler::GetSlot) so using the asset
+ * never needs to look up its Asset ID.
  *
  * Copyright (c) 2010-2012 Ryan Lindeman
  * Permission is hereby granted, free of charge, to any person obtaining a copy
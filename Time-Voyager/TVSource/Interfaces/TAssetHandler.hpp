@@ -6,15 +6,27 @@
  * @author Ryan Lindeman
  * @date 20120428 - Initial Release
  * @date 20120523 - Remove GQE_API from template classes to fix linker issues
+ * @date 20130806 - Add profile zone for each asset load
+ * @date 20130808 - Add allocation scope tag for each asset load
+ * @date 20130815 - Add background loading by AssetLoader worker threads
+ * @date 20130816 - Default to loading from asset packs in release builds
+ * @date 20130817 - Keep each asset in a slot so TAsset can reference it directly
+ * @date 20130818 - Keep unreferenced assets in a budgeted LRU cache (AssetDropCached)
+ * @date 20130819 - Add AddReference by Asset ID for prefetching
+ * @date 20130826 - Use the settings of the first TAsset on prefetched slots
  */
 #ifndef   CORE_TASSET_HANDLER_HPP_INCLUDED
 #define   CORE_TASSET_HANDLER_HPP_INCLUDED
 
 #include <map>
 #include <typeinfo>
+#include <vector>
+#include <SFML/System.hpp>
 #include <TVSource/Interfaces/IAssetHandler.hpp>
 #include <TVSource/Core/Core_types.hpp>
 #include <TVSource/Loggers/Log_macros.hpp>
+#include <TVSource/Managers/Profile_macros.hpp>
+#include <TVSource/Utils/Alloc_macros.hpp>
 
 namespace GQE
 {
@@ -23,11 +35,39 @@ namespace GQE
   class TAssetHandler : public IAssetHandler
   {
     public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Number of slots allocated at a time so slot addresses never change
+      static const Uint32 SLOT_PAGE_SIZE = 64;
+
+      // Structures
+      ///////////////////////////////////////////////////////////////////////////
+      /// Structure holding information about each asset (see GetSlot)
+      struct typeAssetSlot {
+        TYPE*          asset;     ///< The asset being shared
+        Uint32         count;     ///< Number of people referencing this Asset
+        bool           loaded;    ///< Is the Asset currently loaded?
+        AssetLoadState state;     ///< Background load state (Idle, Queued, etc)
+        AssetLoadStyle loadStyle; ///< Load type (File, Memory, Network, etc)
+        AssetLoadTime  loadTime;  ///< Load time (Now, later)
+        AssetDropTime  dropTime;  ///< Drop time at (Zero, Exit, Cached)
+        typeAssetID    id;        ///< Asset ID this slot is registered under
+        std::string    filename;  ///< Filename to use when loading this asset
+        bool           cached;    ///< Is the Asset unreferenced and in the cache?
+        Uint64         bytes;     ///< Estimated bytes used while in the cache
+        typeAssetSlot* newer;     ///< Next more recently used slot in the cache
+        typeAssetSlot* older;     ///< Next less recently used slot in the cache
+        bool           prefetched; ///< Was the slot only referenced by AddReference?
+      };
+
       /**
        * TAssetHandler default constructor.
        */
       TAssetHandler() :
-        IAssetHandler(typeid(TYPE).name())
+        IAssetHandler(typeid(TYPE).name()),
+        mCacheNewest(NULL),
+        mCacheOldest(NULL),
+        mCacheStats()
       {
         ILOG() << "TAssetHandler::ctor(" << GetID() << ")" << std::endl;
       }
@@ -40,25 +80,28 @@ namespace GQE
         ILOG() << "TAssetHandler::dtor(" << GetID() << ")" << std::endl;
 
         // Iterator to use while deleting all assets
-        typename std::map<const typeAssetID, typeAssetData>::iterator iter;
+        typename std::map<const typeAssetID, typeAssetSlot*>::iterator iter;
 
         // Loop through each asset and try to remove each one
         iter = mAssets.begin();
         while(iter != mAssets.end())
         {
-          // Decrement the reference count for this asset
-          iter->second.count--;
+          // Decrement the reference count for this asset (cached assets have none)
+          if(iter->second->count > 0)
+          {
+            iter->second->count--;
+          }
 
           // See if the asset should be released and deleted
-          if(iter->second.count != 0)
+          if(iter->second->count != 0)
           {
             // Log an error for trying to drop a reference to an unknown ID
             ELOG() << "TAssetHandler(" << GetID() << "):dtor("
               << iter->first << ") Non zero asset reference count("
-              << iter->second.count << ")!" << std::endl;
+              << iter->second->count << ")!" << std::endl;
           }
           const typeAssetID anAssetID = iter->first;
-          TYPE* anAsset = iter->second.asset;
+          TYPE* anAsset = iter->second->asset;
 
           // Remove this Asset Data structure from our map
           mAssets.erase(iter++);
@@ -69,6 +112,14 @@ namespace GQE
           // Don't keep pointers to something that has been released
           anAsset = NULL;
         }
+
+        // Delete every page of slots now that every asset has been released
+        for(size_t iloop = 0; iloop < mSlotPages.size(); iloop++)
+        {
+          delete[] mSlotPages[iloop];
+        }
+        mSlotPages.clear();
+        mFreeSlots.clear();
       }
 
       /**
@@ -82,8 +133,11 @@ namespace GQE
       virtual void DropReference(const typeAssetID theAssetID,
         AssetDropTime theDropTime = AssetDropUnspecified)
       {
+        // Obtain a lock so the reference count is changed by one thread at a time
+        sf::Lock anLock(mMutex);
+
         // Iterator to the asset if found
-        typename std::map<const typeAssetID, typeAssetData>::iterator iter;
+        typename std::map<const typeAssetID, typeAssetSlot*>::iterator iter;
 
         // Try to find the asset using theAssetID as the key
         iter = mAssets.find(theAssetID);
@@ -91,54 +145,126 @@ namespace GQE
         // Found asset? decrement the count value
         if(iter != mAssets.end())
         {
-          // Default to dropTime previously registered
-          AssetDropTime anDropTime = iter->second.dropTime;
+          DropReference(iter->second, theDropTime);
+        }
+        else
+        {
+          // Log an error for trying to drop a reference to an unknown ID
+          ELOG() << "TAssetHandler(" << GetID() << "):DropReference("
+            << theAssetID << ") Asset ID not found!"
+            << std::endl;
+        }
+      }
 
-          // Decrement the reference count for this asset
-          iter->second.count--;
+      /**
+       * DropReference will decrement the reference counter for theSlot
+       * provided (see GetSlot) without looking up its Asset ID.
+       * @param[in] theSlot of the asset to drop the reference for
+       * @param[in] theDropTime indicates if asset is dropped when count = 0 or later
+       */
+      void DropReference(typeAssetSlot* theSlot,
+        AssetDropTime theDropTime = AssetDropUnspecified)
+      {
+        if(NULL != theSlot)
+        {
+          // Obtain a lock so the reference count is changed by one thread at a time
+          sf::Lock anLock(mMutex);
 
-          // Caller specified another dropTime value? use it instead
-          if(AssetDropUnspecified != theDropTime &&
-            theDropTime > AssetDropUnspecified &&
-            theDropTime <= AssetDropAtExit)
-          {
-            anDropTime = theDropTime;
-          }
+          // Default to dropTime previously registered
+          AssetDropTime anDropTime = theSlot->dropTime;
 
-          // Use anDropTime specified above
-          switch(anDropTime)
+          // Make sure we never drop more references than were added
+          if(theSlot->count == 0)
           {
-          default:
             ELOG() << "TAssetHandler(" << GetID() << ")::DropReference("
-              << theAssetID << ") Unknown drop time specified!" << std::endl;
-          case AssetDropUnspecified:
-          case AssetDropAtZero:
-            // See if the asset should be released and deleted
-            if(iter->second.count == 0)
-            {
-              TYPE* anAsset = iter->second.asset;
-
-              // Remove this Asset Data structure from our map
-              mAssets.erase(iter++);
+              << theSlot->id << ") Asset has no references to drop!" << std::endl;
+          }
+          else
+          {
+            // Decrement the reference count for this asset
+            theSlot->count--;
 
-              // Release the asset
-              ReleaseAsset(theAssetID, anAsset);
+            // Caller specified another dropTime value? use it instead
+            if(AssetDropUnspecified != theDropTime &&
+              theDropTime > AssetDropUnspecified &&
+              theDropTime <= AssetDropCached)
+            {
+              anDropTime = theDropTime;
+            }
 
-              // Don't keep pointers to something that has been released
-              anAsset = NULL;
+            // Use anDropTime specified above
+            switch(anDropTime)
+            {
+            default:
+              ELOG() << "TAssetHandler(" << GetID() << ")::DropReference("
+                << theSlot->id << ") Unknown drop time specified!" << std::endl;
+            case AssetDropUnspecified:
+            case AssetDropAtZero:
+              // See if the asset should be released and deleted
+              if(theSlot->count == 0)
+              {
+                ReleaseSlot(theSlot);
+              }
+              break;
+            case AssetDropAtExit:
+              /* Do nothing, destructor will release each asset */
+              break;
+            case AssetDropCached:
+              // Keep loaded assets in the cache while the budget allows it
+              if(theSlot->count == 0)
+              {
+                if(theSlot->loaded && mCacheStats.budget > 0)
+                {
+                  CacheSlot(theSlot);
+                  TrimCache(mCacheStats.budget);
+                }
+                else
+                {
+                  ReleaseSlot(theSlot);
+                }
+              }
+              break;
             }
-            break;
-          case AssetDropAtExit:
-            /* Do nothing, destructor will release each asset */
-            break;
           }
         }
-        else
+      }
+
+      /**
+       * AddReference will increment the reference counter for theAssetID
+       * specified, acquiring the asset first if it hasn't been created yet,
+       * so callers that don't know TYPE can hold the asset until they call
+       * DropReference. A slot created this way uses the default settings
+       * until the first TAsset for theAssetID provides its own (see GetSlot).
+       * @param[in] theAssetID to add the reference for
+       * @return true if a reference was added, false otherwise
+       */
+      virtual bool AddReference(const typeAssetID theAssetID)
+      {
+        return NULL != GetSlot(theAssetID, AssetLoadLater, AssetLoadFromDefault,
+          AssetDropCached, true);
+      }
+
+      /**
+       * AddReference will increment the reference counter for theSlot
+       * provided (see GetSlot) without looking up its Asset ID.
+       * @param[in] theSlot of the asset to add a reference for
+       */
+      void AddReference(typeAssetSlot* theSlot)
+      {
+        if(NULL != theSlot)
         {
-          // Log an error for trying to drop a reference to an unknown ID
-          ELOG() << "TAssetHandler(" << GetID() << "):DropReference("
-            << theAssetID << ") Asset ID not found!"
-            << std::endl;
+          // Obtain a lock so the reference count is changed by one thread at a time
+          sf::Lock anLock(mMutex);
+
+          // Revive the asset if it was waiting in the cache
+          if(theSlot->cached)
+          {
+            UncacheSlot(theSlot);
+            mCacheStats.hits++;
+          }
+
+          // Increment the reference count for this asset
+          theSlot->count++;
         }
       }
 
@@ -161,18 +287,52 @@ namespace GQE
        * @param[in] theAssetID to lookup for the reference
        * @param[in] theLoadTime (Now, Later) of when to load this asset
        * @param[in] theLoadStyle (File, Mem, Network) to use when loading this asset
+       * @param[in] theDropTime (Zero, Exit, Cached) of when to drop this asset
        * @return the asset found or a newly acquired asset if not found
        */
       TYPE* GetReference(const typeAssetID theAssetID,
         AssetLoadTime theLoadTime = AssetLoadLater,
-        AssetLoadStyle theLoadStyle = AssetLoadFromFile,
-        AssetDropTime theDropTime = AssetDropAtZero)
+        AssetLoadStyle theLoadStyle = AssetLoadFromDefault,
+        AssetDropTime theDropTime = AssetDropCached)
       {
-        // IAsset pointer that will be returned
-        TYPE* anResult = NULL;
+        // Obtain the slot of the asset which holds the new reference
+        typeAssetSlot* anSlot = GetSlot(theAssetID, theLoadTime, theLoadStyle, theDropTime);
+
+        // If no slot was found by this point then return the Dummy Asset instead
+        return (NULL != anSlot) ? anSlot->asset : &mDummyAsset;
+      }
+
+      /**
+       * GetSlot will retrieve the slot of the asset registered under
+       * theAssetID and increment the reference counter for this asset or call
+       * the AcquireAsset pure virtual function to obtain it if it hasn't yet
+       * been created. The slot address stays the same until the last
+       * reference is dropped so it can be used instead of theAssetID to
+       * access the asset (see TAsset). Assets found in the cache are revived
+       * without being loaded again. A slot that was only referenced by
+       * AddReference (e.g. prefetched by the StateManager) takes the load
+       * style and drop time provided by the first caller that isn't a prefetch.
+       * @param[in] theAssetID to lookup for the reference
+       * @param[in] theLoadTime (Now, Later) of when to load this asset
+       * @param[in] theLoadStyle (File, Mem, Network) to use when loading this asset
+       * @param[in] theDropTime (Zero, Exit, Cached) of when to drop this asset
+       * @param[in] thePrefetch is true if the settings provided are only defaults
+       * @return the slot found or a newly acquired slot, NULL otherwise
+       */
+      typeAssetSlot* GetSlot(const typeAssetID theAssetID,
+        AssetLoadTime theLoadTime = AssetLoadLater,
+        AssetLoadStyle theLoadStyle = AssetLoadFromDefault,
+        AssetDropTime theDropTime = AssetDropCached,
+        bool thePrefetch = false)
+      {
+        // Slot that will be returned
+        typeAssetSlot* anResult = NULL;
+
+        // Obtain a lock so the reference count is changed by one thread at a time
+        sf::Lock anLock(mMutex);
 
         // Iterator to the asset if found
-        typename std::map<const typeAssetID, typeAssetData>::iterator iter;
+        typename std::map<const typeAssetID, typeAssetSlot*>::iterator iter;
 
         // Try to find the asset using theAssetID as the key
         iter = mAssets.find(theAssetID);
@@ -180,66 +340,74 @@ namespace GQE
         // Found asset? increment the count and return the reference
         if(iter != mAssets.end())
         {
+          // Revive the asset if it was waiting in the cache
+          if(iter->second->cached)
+          {
+            UncacheSlot(iter->second);
+            mCacheStats.hits++;
+          }
+
+          // Use the settings of the first asset that isn't a prefetch
+          if(iter->second->prefetched && !thePrefetch)
+          {
+            SetSlotSettings(iter->second, theLoadTime, theLoadStyle, theDropTime);
+            iter->second->prefetched = false;
+          }
+
           // Increment the reference count for this asset
-          iter->second.count++;
+          iter->second->count++;
 
-          // Return the IAsset address found
-          anResult = iter->second.asset;
+          // Return the slot found
+          anResult = iter->second;
         }
         else
         {
+          // The asset isn't in memory so it must be acquired and loaded
+          mCacheStats.misses++;
+
           // First attempt to acquire the asset first
-          anResult = AcquireAsset(theAssetID);
+          TYPE* anAsset = AcquireAsset(theAssetID);
 
           // Map the newly acquired asset to theAssetID provided
-          if(NULL != anResult)
+          if(NULL != anAsset)
           {
-            // Create a new AssetData to hold our asset information
-            typeAssetData anAssetData;
+            anResult = AllocateSlot();
+          }
 
+          if(NULL != anResult)
+          {
             // Acquire the asset for the first time
-            anAssetData.asset = anResult;
-            anAssetData.count = 1;
-            anAssetData.loaded = false;
-            anAssetData.loadStyle = theLoadStyle;
-            anAssetData.loadTime = theLoadTime;
-            anAssetData.dropTime = AssetDropAtZero;
-            anAssetData.filename = theAssetID;
-
-            // Check the Load Style range provided and force to LoadFromUnknown if out of range
-            if(theLoadStyle < AssetLoadFromUnknown || theLoadStyle > AssetLoadFromNetwork)
-            {
-              // Force style to AssetLoadFromFile if out of enum range
-              anAssetData.loadStyle = AssetLoadFromFile;
-            }
-
-            // Check the Load Time range provided and force LoadNow if out of range
-            if(theLoadTime < AssetLoadNow || theLoadTime > AssetLoadLater)
-            {
-              // Force load time to AssetLoadLater if out of enum range
-              anAssetData.loadTime = AssetLoadLater;
-            }
-
-            // Store the newly acquired asset pointer in our map for future reference
-            mAssets.insert(std::pair<const typeAssetID, typeAssetData>(theAssetID, anAssetData));
+            anResult->asset = anAsset;
+            anResult->count = 1;
+            anResult->loaded = false;
+            anResult->state = AssetLoadIdle;
+            anResult->id = theAssetID;
+            anResult->filename = theAssetID;
+            anResult->cached = false;
+            anResult->bytes = 0;
+            anResult->newer = NULL;
+            anResult->older = NULL;
+            anResult->prefetched = thePrefetch;
+            SetSlotSettings(anResult, theLoadTime, theLoadStyle, theDropTime);
+
+            // Store the newly acquired slot in our map for future reference
+            mAssets.insert(std::pair<const typeAssetID, typeAssetSlot*>(theAssetID, anResult));
 
             // Were we asked to load the asset now?
-            if(AssetLoadNow == anAssetData.loadTime)
+            if(AssetLoadNow == anResult->loadTime)
             {
               // Load the Asset now
-              LoadAsset(theAssetID);
+              LoadAsset(anResult);
             }
           }
+          else if(NULL != anAsset)
+          {
+            // No slot was available for the asset acquired
+            ReleaseAsset(theAssetID, anAsset);
+          }
         }
 
-        // If result is NULL by this point then return the Dummy Asset instead
-        if(NULL == anResult)
-        {
-          // Get the DummyAsset pointer now
-          anResult = &mDummyAsset;
-        }
-
-        // Return the asset pointer provided to the caller
+        // Return the slot found or NULL if something went wrong
         return anResult;
       }
 
@@ -255,7 +423,10 @@ namespace GQE
         bool anResult = false;
 
         // Iterator to the asset if found
-        typename std::map<const typeAssetID, typeAssetData>::const_iterator iter;
+        typename std::map<const typeAssetID, typeAssetSlot*>::const_iterator iter;
+
+        // Obtain a lock so no other thread changes the assets while we look
+        sf::Lock anLock(mMutex);
 
         // Try to find the asset using theAssetID as the key
         iter = mAssets.find(theAssetID);
@@ -264,7 +435,7 @@ namespace GQE
         if(iter != mAssets.end())
         {
           // Return the loaded value found
-          anResult = iter->second.loaded;
+          anResult = iter->second->loaded;
         }
         else
         {
@@ -290,7 +461,10 @@ namespace GQE
         std::string anResult;
 
         // Iterator to the asset if found
-        typename std::map<const typeAssetID, typeAssetData>::const_iterator iter;
+        typename std::map<const typeAssetID, typeAssetSlot*>::const_iterator iter;
+
+        // Obtain a lock so no other thread changes the assets while we look
+        sf::Lock anLock(mMutex);
 
         // Try to find the asset using theAssetID as the key
         iter = mAssets.find(theAssetID);
@@ -299,7 +473,7 @@ namespace GQE
         if(iter != mAssets.end())
         {
           // Retrieve the filename for this asset
-          anResult = iter->second.filename;
+          anResult = iter->second->filename;
         }
         else
         {
@@ -322,7 +496,10 @@ namespace GQE
       virtual void SetFilename(const typeAssetID theAssetID, std::string theFilename)
       {
         // Iterator to the asset if found
-        typename std::map<const typeAssetID, typeAssetData>::iterator iter;
+        typename std::map<const typeAssetID, typeAssetSlot*>::iterator iter;
+
+        // Obtain a lock so no other thread changes the assets while we look
+        sf::Lock anLock(mMutex);
 
         // Try to find the asset using theAssetID as the key
         iter = mAssets.find(theAssetID);
@@ -331,14 +508,14 @@ namespace GQE
         if(iter != mAssets.end())
         {
           // Print warning if asset has already been loaded
-          if(false == iter->second.loaded)
+          if(false == iter->second->loaded)
           {
             WLOG() << "TAssetHandler(" << GetID() << ")::SetFilename("
               << theAssetID << ") Asset is already loaded" << std::endl;
           }
 
           // Set the filename for this asset
-          iter->second.filename = theFilename;
+          iter->second->filename = theFilename;
         }
         else
         {
@@ -360,7 +537,10 @@ namespace GQE
         AssetLoadStyle anResult = AssetLoadFromUnknown;
 
         // Iterator to the asset if found
-        typename std::map<const typeAssetID, typeAssetData>::const_iterator iter;
+        typename std::map<const typeAssetID, typeAssetSlot*>::const_iterator iter;
+
+        // Obtain a lock so no other thread changes the assets while we look
+        sf::Lock anLock(mMutex);
 
         // Try to find the asset using theAssetID as the key
         iter = mAssets.find(theAssetID);
@@ -368,7 +548,7 @@ namespace GQE
         if(iter != mAssets.end())
         {
           // Retrieve our loading style from the asset found
-          anResult = iter->second.loadStyle;
+          anResult = iter->second->loadStyle;
         }
         else
         {
@@ -392,7 +572,10 @@ namespace GQE
       void SetLoadStyle(const typeAssetID theAssetID, AssetLoadStyle theLoadStyle)
       {
         // Iterator to the asset if found
-        typename std::map<const typeAssetID, typeAssetData>::iterator iter;
+        typename std::map<const typeAssetID, typeAssetSlot*>::iterator iter;
+
+        // Obtain a lock so no other thread changes the assets while we look
+        sf::Lock anLock(mMutex);
 
         // Try to find the asset using theAssetID as the key
         iter = mAssets.find(theAssetID);
@@ -404,16 +587,16 @@ namespace GQE
           if(theLoadStyle < AssetLoadFromUnknown || theLoadStyle > AssetLoadFromNetwork)
           {
             // Force style to AssetLoadFromFile if out of enum range
-            iter->second.loadStyle = AssetLoadFromFile;
+            iter->second->loadStyle = AssetLoadFromFile;
           }
           else
           {
             // Set the asset Load Style now
-            iter->second.loadStyle = theLoadStyle;
+            iter->second->loadStyle = theLoadStyle;
           }
 
           // Are we changing the load style after it was loaded!?
-          if(true == iter->second.loaded)
+          if(true == iter->second->loaded)
           {
             switch(theLoadStyle)
             {
@@ -457,7 +640,10 @@ namespace GQE
         AssetLoadTime anResult = AssetLoadLater;
 
         // Iterator to the asset if found
-        typename std::map<const typeAssetID, typeAssetData>::const_iterator iter;
+        typename std::map<const typeAssetID, typeAssetSlot*>::const_iterator iter;
+
+        // Obtain a lock so no other thread changes the assets while we look
+        sf::Lock anLock(mMutex);
 
         // Try to find the asset using theAssetID as the key
         iter = mAssets.find(theAssetID);
@@ -465,7 +651,7 @@ namespace GQE
         if(iter != mAssets.end())
         {
           // Retrieve our loading time from the asset found
-          anResult = iter->second.loadTime;
+          anResult = iter->second->loadTime;
         }
         else
         {
@@ -489,7 +675,10 @@ namespace GQE
       virtual void SetLoadTime(const typeAssetID theAssetID, AssetLoadTime theLoadTime)
       {
         // Iterator to the asset if found
-        typename std::map<const typeAssetID, typeAssetData>::iterator iter;
+        typename std::map<const typeAssetID, typeAssetSlot*>::iterator iter;
+
+        // Obtain a lock so no other thread changes the assets while we look
+        sf::Lock anLock(mMutex);
 
         // Try to find the asset using theAssetID as the key
         iter = mAssets.find(theAssetID);
@@ -501,16 +690,16 @@ namespace GQE
           if(theLoadTime < AssetLoadNow || theLoadTime > AssetLoadLater)
           {
             // Force load time to AssetLoadLater if out of enum range
-            iter->second.loadTime = AssetLoadLater;
+            iter->second->loadTime = AssetLoadLater;
           }
           else
           {
             // Set the asset Load Time now
-            iter->second.loadTime = theLoadTime;
+            iter->second->loadTime = theLoadTime;
           }
 
           // Are we changing the load time after it was loaded!?
-          if(true == iter->second.loaded)
+          if(true == iter->second->loaded)
           {
             switch(theLoadTime)
             {
@@ -549,7 +738,10 @@ namespace GQE
         AssetDropTime anResult = AssetDropUnspecified;
 
         // Iterator to the asset if found
-        typename std::map<const typeAssetID, typeAssetData>::const_iterator iter;
+        typename std::map<const typeAssetID, typeAssetSlot*>::const_iterator iter;
+
+        // Obtain a lock so no other thread changes the assets while we look
+        sf::Lock anLock(mMutex);
 
         // Try to find the asset using theAssetID as the key
         iter = mAssets.find(theAssetID);
@@ -557,7 +749,7 @@ namespace GQE
         if(iter != mAssets.end())
         {
           // Retrieve our loading time from the asset found
-          anResult = iter->second.dropTime;
+          anResult = iter->second->dropTime;
         }
         else
         {
@@ -575,13 +767,16 @@ namespace GQE
        * SetDropTime allows someone to change the drop time of theAssetID
        * provided.
        * @param[in] theAssetID of the asset to change loading time
-       * @param[in] theDropTime (Zero, Exit) of when to drop this asset
+       * @param[in] theDropTime (Zero, Exit, Cached) of when to drop this asset
        */
       virtual void SetDropTime(const typeAssetID theAssetID,
         AssetDropTime theDropTime)
       {
         // Iterator to the asset if found
-        typename std::map<const typeAssetID, typeAssetData>::iterator iter;
+        typename std::map<const typeAssetID, typeAssetSlot*>::iterator iter;
+
+        // Obtain a lock so no other thread changes the assets while we look
+        sf::Lock anLock(mMutex);
 
         // Try to find the asset using theAssetID as the key
         iter = mAssets.find(theAssetID);
@@ -590,15 +785,15 @@ namespace GQE
         if(iter != mAssets.end())
         {
           // Check the range provided and force to Unknown if out of range
-          if(theDropTime < AssetDropAtZero || theDropTime > AssetDropAtExit)
+          if(theDropTime < AssetDropAtZero || theDropTime > AssetDropCached)
           {
             // Force drop time to AssetDropAtZero if out of enum range
-            iter->second.dropTime = AssetDropAtZero;
+            iter->second->dropTime = AssetDropAtZero;
           }
           else
           {
             // Set the asset drop time now
-            iter->second.dropTime = theDropTime;
+            iter->second->dropTime = theDropTime;
           }
         }
         else
@@ -622,7 +817,10 @@ namespace GQE
         bool anResult = false;
 
         // Iterator to the asset if found
-        typename std::map<const typeAssetID, typeAssetData>::iterator iter;
+        typename std::map<const typeAssetID, typeAssetSlot*>::iterator iter;
+
+        // Obtain a lock so no other thread changes the assets while we look
+        sf::Lock anLock(mMutex);
 
         // Try to find the asset using theAssetID as the key
         iter = mAssets.find(theAssetID);
@@ -630,37 +828,64 @@ namespace GQE
         // Found asset? return the loaded indicator found
         if(iter != mAssets.end())
         {
-          if(false == iter->second.loaded)
+          anResult = LoadAsset(iter->second);
+        }
+        else
+        {
+          // Log a warning for trying to determine loaded value of an unknown asset ID
+          WLOG() << "TAssetHandler(" << GetID() << "):LoadAsset("
+            << theAssetID << ") Asset ID provided not found!"
+            << std::endl;
+        }
+
+        // Return anResult which is true if asset was loaded, false otherwise
+        return anResult;
+      }
+
+      /**
+       * LoadAsset is responsible for loading the asset in theSlot provided
+       * (see GetSlot) according to the previously registered style.
+       * @param[in] theSlot of the asset to load
+       * @return true if the asset is loaded, false otherwise
+       */
+      bool LoadAsset(typeAssetSlot* theSlot)
+      {
+        // Result if no slot was provided
+        bool anResult = false;
+
+        if(NULL != theSlot)
+        {
+          // Obtain a lock so no other thread changes the assets while we load
+          sf::Lock anLock(mMutex);
+
+          // Leave assets being loaded by the AssetLoader alone
+          if(false == theSlot->loaded && false == IsPending(theSlot->state))
           {
+            PROFILE_ZONE("TAssetHandler::LoadAsset");
+            ALLOC_SCOPE(GetID().c_str());
+
             // Attempt to load the asset now using the correct style
-            switch(iter->second.loadStyle)
+            switch(theSlot->loadStyle)
             {
             case AssetLoadFromFile:
-              iter->second.loaded = LoadFromFile(theAssetID, *(iter->second.asset));
+              theSlot->loaded = LoadFromFile(theSlot->id, *(theSlot->asset));
               break;
             case AssetLoadFromMemory:
-              iter->second.loaded = LoadFromMemory(theAssetID, *(iter->second.asset));
+              theSlot->loaded = LoadFromMemory(theSlot->id, *(theSlot->asset));
               break;
             case AssetLoadFromNetwork:
-              iter->second.loaded = LoadFromNetwork(theAssetID, *(iter->second.asset));
+              theSlot->loaded = LoadFromNetwork(theSlot->id, *(theSlot->asset));
               break;
             case AssetLoadFromUnknown:
             default:
               ELOG() << "TAssetHandler(" << GetID() << ")::LoadAsset("
-                << theAssetID << ") unknown loading style specified!" << std::endl;
+                << theSlot->id << ") unknown loading style specified!" << std::endl;
               break;
             }
           }
 
           // Set our return result
-          anResult = iter->second.loaded;
-        }
-        else
-        {
-          // Log a warning for trying to determine loaded value of an unknown asset ID
-          WLOG() << "TAssetHandler(" << GetID() << "):LoadAsset("
-            << theAssetID << ") Asset ID provided not found!"
-            << std::endl;
+          anResult = theSlot->loaded;
         }
 
         // Return anResult which is true if asset was loaded, false otherwise
@@ -677,38 +902,18 @@ namespace GQE
         // Return true if all assets load successfully
         bool anResult = true;
     
-        // Iterator for each typeAssetData registered
-        typename std::map<const typeAssetID, typeAssetData>::iterator iter;
+        // Iterator for each typeAssetSlot registered
+        typename std::map<const typeAssetID, typeAssetSlot*>::iterator iter;
+
+        // Obtain a lock so no other thread changes the assets while we look
+        sf::Lock anLock(mMutex);
 
         // Loop through each asset handler and tell it to load its assets
         iter = mAssets.begin();
         while(iter != mAssets.end())
         {
-          // Is this an asset that hasn't been loaded yet? load it now
-          if(false == iter->second.loaded)
-          {
-            // Attempt to load the asset now using the correct style
-            switch(iter->second.loadStyle)
-            {
-            case AssetLoadFromFile:
-              iter->second.loaded = LoadFromFile(iter->first, *(iter->second.asset));
-              break;
-            case AssetLoadFromMemory:
-              iter->second.loaded = LoadFromMemory(iter->first, *(iter->second.asset));
-              break;
-            case AssetLoadFromNetwork:
-              iter->second.loaded = LoadFromNetwork(iter->first, *(iter->second.asset));
-              break;
-            case AssetLoadFromUnknown:
-            default:
-              ELOG() << "TAssetHandler(" << GetID() << ")::LoadAllAssets("
-                << iter->first << ") unknown loading style specified!" << std::endl;
-              break;
-            }
-          }
-
-          // Set our return result
-          anResult &= iter->second.loaded;
+          // Load this asset if it hasn't been loaded yet
+          anResult &= LoadAsset(iter->second);
 
           // Move to the next registered Assets value
           iter++;
@@ -719,6 +924,247 @@ namespace GQE
         return anResult;
       }
 
+      /**
+       * GetLoadState will return the background loading state of theAssetID
+       * provided (AssetLoadReady if the asset is already loaded).
+       * @param[in] theAssetID of the asset to find the loading state for
+       * @return the loading state for the asset or AssetLoadFailed otherwise
+       */
+      virtual AssetLoadState GetLoadState(const typeAssetID theAssetID) const
+      {
+        // Result if asset was not found
+        AssetLoadState anResult = AssetLoadFailed;
+
+        // Iterator to the asset if found
+        typename std::map<const typeAssetID, typeAssetSlot*>::const_iterator iter;
+
+        // Obtain a lock so no other thread changes the assets while we look
+        sf::Lock anLock(mMutex);
+
+        // Try to find the asset using theAssetID as the key
+        iter = mAssets.find(theAssetID);
+
+        // Found asset? return the loading state found
+        if(iter != mAssets.end())
+        {
+          anResult = iter->second->loaded ? AssetLoadReady : iter->second->state;
+        }
+
+        // Return anResult found or AssetLoadFailed if none was found
+        return anResult;
+      }
+
+      /**
+       * QueueAsset is called on the main thread before theAssetID provided is
+       * handed to the AssetLoader and will hold an extra reference to the
+       * asset until CompleteAsset or CancelAsset is called.
+       * @param[in] theAssetID of the asset to load in the background
+       * @return true if the asset should be queued, false if it is already
+       *         loaded, already queued or unknown
+       */
+      virtual bool QueueAsset(const typeAssetID theAssetID)
+      {
+        // Result if asset was not queued
+        bool anResult = false;
+
+        // Iterator to the asset if found
+        typename std::map<const typeAssetID, typeAssetSlot*>::iterator iter;
+
+        // Obtain a lock so the reference count is changed by one thread at a time
+        sf::Lock anLock(mMutex);
+
+        // Try to find the asset using theAssetID as the key
+        iter = mAssets.find(theAssetID);
+
+        // Found asset? queue it unless it is loaded or already queued
+        if(iter != mAssets.end())
+        {
+          if(false == iter->second->loaded && false == IsPending(iter->second->state))
+          {
+            // Hold a reference so the asset outlives the background load
+            iter->second->count++;
+            iter->second->state = AssetLoadQueued;
+            anResult = true;
+          }
+        }
+        else
+        {
+          // Log a warning for trying to queue an unknown asset ID
+          WLOG() << "TAssetHandler(" << GetID() << "):QueueAsset("
+            << theAssetID << ") Asset ID provided not found!"
+            << std::endl;
+        }
+
+        // Return anResult determined above
+        return anResult;
+      }
+
+      /**
+       * DecodeAsset is called by an AssetLoader worker thread and will load
+       * theAssetID provided by calling LoadInBackground without holding the
+       * lock so the main thread is never blocked by the decoding.
+       * @param[in] theAssetID of the asset to decode
+       */
+      virtual void DecodeAsset(const typeAssetID theAssetID)
+      {
+        // The asset to decode and the style to decode it with
+        TYPE* anAsset = NULL;
+        AssetLoadStyle anLoadStyle = AssetLoadFromUnknown;
+
+        // Iterator to the asset if found
+        typename std::map<const typeAssetID, typeAssetSlot*>::iterator iter;
+
+        {
+          // Obtain a lock only while we look up the asset
+          sf::Lock anLock(mMutex);
+
+          // Try to find the asset using theAssetID as the key
+          iter = mAssets.find(theAssetID);
+
+          // Only decode assets that are still waiting to be decoded
+          if(iter != mAssets.end() && AssetLoadQueued == iter->second->state)
+          {
+            iter->second->state = AssetLoadDecoding;
+            anAsset = iter->second->asset;
+            anLoadStyle = iter->second->loadStyle;
+          }
+        }
+
+        // Decode the asset now (the reference held by QueueAsset keeps it alive)
+        if(NULL != anAsset)
+        {
+          PROFILE_ZONE("TAssetHandler::DecodeAsset");
+          ALLOC_SCOPE(GetID().c_str());
+
+          bool anDecoded = LoadInBackground(theAssetID, *anAsset, anLoadStyle);
+
+          // Obtain a lock again to publish the result
+          sf::Lock anLock(mMutex);
+          iter = mAssets.find(theAssetID);
+          if(iter != mAssets.end())
+          {
+            iter->second->state = anDecoded ? AssetLoadDecoded : AssetLoadFailed;
+          }
+        }
+      }
+
+      /**
+       * CompleteAsset is called on the main thread after DecodeAsset has
+       * finished and will call FinishInForeground before dropping the
+       * reference held by QueueAsset.
+       * @param[in] theAssetID of the asset to complete
+       */
+      virtual void CompleteAsset(const typeAssetID theAssetID)
+      {
+        // Iterator to the asset if found
+        typename std::map<const typeAssetID, typeAssetSlot*>::iterator iter;
+
+        // Obtain a lock so no other thread changes the assets while we finish
+        sf::Lock anLock(mMutex);
+
+        // Try to find the asset using theAssetID as the key
+        iter = mAssets.find(theAssetID);
+
+        // Found asset? finish loading it on the main thread
+        if(iter != mAssets.end())
+        {
+          if(AssetLoadDecoded == iter->second->state)
+          {
+            PROFILE_ZONE("TAssetHandler::CompleteAsset");
+            ALLOC_SCOPE(GetID().c_str());
+
+            iter->second->loaded = FinishInForeground(theAssetID, *(iter->second->asset));
+            iter->second->state = iter->second->loaded ? AssetLoadIdle : AssetLoadFailed;
+          }
+
+          // Log an error if the background load failed
+          if(AssetLoadFailed == iter->second->state)
+          {
+            ELOG() << "TAssetHandler(" << GetID() << ")::CompleteAsset("
+              << theAssetID << ") Background load failed!" << std::endl;
+          }
+
+          // Drop the reference held by QueueAsset
+          DropReference(theAssetID);
+        }
+        else
+        {
+          // Log an error for trying to complete an unknown asset ID
+          ELOG() << "TAssetHandler(" << GetID() << "):CompleteAsset("
+            << theAssetID << ") Asset ID provided not found!"
+            << std::endl;
+        }
+      }
+
+      /**
+       * CancelAsset is called on the main thread for each asset still waiting
+       * when the AssetLoader is stopped and will drop the reference held by
+       * QueueAsset without finishing the load.
+       * @param[in] theAssetID of the asset to cancel
+       */
+      virtual void CancelAsset(const typeAssetID theAssetID)
+      {
+        // Iterator to the asset if found
+        typename std::map<const typeAssetID, typeAssetSlot*>::iterator iter;
+
+        // Obtain a lock so the reference count is changed by one thread at a time
+        sf::Lock anLock(mMutex);
+
+        // Try to find the asset using theAssetID as the key
+        iter = mAssets.find(theAssetID);
+
+        // Found asset? forget the background load and drop its reference
+        if(iter != mAssets.end())
+        {
+          iter->second->state = AssetLoadIdle;
+
+          // Drop the reference held by QueueAsset
+          DropReference(theAssetID);
+        }
+      }
+
+      /**
+       * IsPending will return true if theState provided means the asset is
+       * being loaded by the AssetLoader.
+       * @param[in] theState to check
+       * @return true if the asset is queued, decoding or decoded
+       */
+      static bool IsPending(const AssetLoadState theState)
+      {
+        return AssetLoadQueued == theState || AssetLoadDecoding == theState ||
+          AssetLoadDecoded == theState;
+      }
+
+      /**
+       * SetCacheBudget sets the most bytes the assets kept in the cache (see
+       * AssetDropCached) may use before the least recently used assets are
+       * evicted. A budget of 0 disables the cache.
+       * @param[in] theBudget in bytes to use for the cache
+       */
+      virtual void SetCacheBudget(const Uint64 theBudget)
+      {
+        // Obtain a lock so no other thread changes the cache while we trim it
+        sf::Lock anLock(mMutex);
+
+        // Evict assets right away if the new budget is smaller
+        mCacheStats.budget = theBudget;
+        TrimCache(theBudget);
+      }
+
+      /**
+       * GetCacheStats will return the hit, miss and eviction counters of the
+       * cache along with its current size and budget.
+       * @return the cache statistics for this TAssetHandler
+       */
+      virtual typeAssetCacheStats GetCacheStats(void) const
+      {
+        // Obtain a lock so no other thread changes the cache while we copy it
+        sf::Lock anLock(mMutex);
+
+        // Return a copy of the cache statistics
+        return mCacheStats;
+      }
+
     protected:
       /**
        * AcquireAsset is responsible for creating an IAsset derived asset and
@@ -748,6 +1194,71 @@ namespace GQE
         delete theAsset;
       }
 
+      /**
+       * LoadInBackground is called from an AssetLoader worker thread and is
+       * responsible for loading theAsset using theLoadStyle provided. Derived
+       * classes whose assets can't be fully loaded off the main thread (e.g.
+       * OpenGL textures) should decode into their own staging area here and
+       * override FinishInForeground to finish the load.
+       * @param[in] theAssetID of the asset to be loaded
+       * @param[in] theAsset to load
+       * @param[in] theLoadStyle (File, Mem, Network) to use when loading this asset
+       * @return true if the asset was successfully decoded, false otherwise
+       */
+      virtual bool LoadInBackground(const typeAssetID theAssetID, TYPE& theAsset,
+        AssetLoadStyle theLoadStyle)
+      {
+        // Result if the loading style is unknown
+        bool anResult = false;
+
+        // Attempt to load the asset now using the correct style
+        switch(theLoadStyle)
+        {
+        case AssetLoadFromFile:
+          anResult = LoadFromFile(theAssetID, theAsset);
+          break;
+        case AssetLoadFromMemory:
+          anResult = LoadFromMemory(theAssetID, theAsset);
+          break;
+        case AssetLoadFromNetwork:
+          anResult = LoadFromNetwork(theAssetID, theAsset);
+          break;
+        case AssetLoadFromUnknown:
+        default:
+          ELOG() << "TAssetHandler(" << GetID() << ")::LoadInBackground("
+            << theAssetID << ") unknown loading style specified!" << std::endl;
+          break;
+        }
+
+        // Return anResult of true if successful, false otherwise
+        return anResult;
+      }
+
+      /**
+       * FinishInForeground is called on the main thread after LoadInBackground
+       * was successful and is responsible for finishing the load of theAsset
+       * (the default has nothing left to do).
+       * @param[in] theAssetID of the asset to be finished
+       * @param[in] theAsset to finish
+       * @return true if the asset was successfully loaded, false otherwise
+       */
+      virtual bool FinishInForeground(const typeAssetID theAssetID, TYPE& theAsset)
+      {
+        return true;
+      }
+
+      /**
+       * GetAssetBytes is called when theAsset is moved to the cache and
+       * should estimate the memory used by theAsset (e.g. texture pixels or
+       * sound samples). The default only counts the size of TYPE.
+       * @param[in] theAsset to estimate the size of
+       * @return the estimated size of theAsset in bytes
+       */
+      virtual Uint64 GetAssetBytes(const TYPE& theAsset) const
+      {
+        return sizeof(TYPE);
+      }
+
       /**
        * LoadFromFile is responsible for loading theAsset from a file and must
        * be defined by the derived class since the interface for TYPE is
@@ -779,25 +1290,217 @@ namespace GQE
       virtual bool LoadFromNetwork(const typeAssetID theAssetID, TYPE& theAsset) = 0;
 
     private:
-      // Structures
-      ///////////////////////////////////////////////////////////////////////////
-      /// Structure holding information about each Resource
-      struct typeAssetData {
-        TYPE*          asset;     ///< The asset being shared
-        Uint32         count;     ///< Number of people referencing this Asset
-        bool           loaded;    ///< Is the Asset currently loaded?
-        AssetLoadStyle loadStyle; ///< Load type (File, Memory, Network, etc)
-        AssetLoadTime  loadTime;  ///< Load time (Now, later)
-        AssetDropTime  dropTime;  ///< Drop time at (Zero, Exit)
-        std::string    filename;  ///< Filename to use when loading this asset
-      };
-
       // Variables
       ///////////////////////////////////////////////////////////////////////////
-      /// Map that associates asset ID's with their appropriate TAssetData
-      std::map<const typeAssetID, typeAssetData> mAssets;
+      /// Map that associates asset ID's with the slot of each asset
+      std::map<const typeAssetID, typeAssetSlot*> mAssets;
+      /// Pages of SLOT_PAGE_SIZE slots allocated so far
+      std::vector<typeAssetSlot*> mSlotPages;
+      /// Slots not currently used by any asset
+      std::vector<typeAssetSlot*> mFreeSlots;
       /// Dummy asset that will be returned if an asset can't be Acquired
       TYPE mDummyAsset;
+      /// Mutex that protects mAssets from the AssetLoader worker threads
+      mutable sf::Mutex mMutex;
+      /// Most recently used slot in the cache
+      typeAssetSlot* mCacheNewest;
+      /// Least recently used slot in the cache which is evicted first
+      typeAssetSlot* mCacheOldest;
+      /// Cache counters, size and budget (see GetCacheStats)
+      typeAssetCacheStats mCacheStats;
+
+      /**
+       * SetSlotSettings will set the load time, load style and drop time of
+       * theSlot provided, forcing any value out of range to a safe default.
+       * @param[in] theSlot to change
+       * @param[in] theLoadTime (Now, Later) of when to load this asset
+       * @param[in] theLoadStyle (File, Mem, Network) to use when loading this asset
+       * @param[in] theDropTime (Zero, Exit, Cached) of when to drop this asset
+       */
+      void SetSlotSettings(typeAssetSlot* theSlot, AssetLoadTime theLoadTime,
+        AssetLoadStyle theLoadStyle, AssetDropTime theDropTime)
+      {
+        theSlot->loadStyle = theLoadStyle;
+        theSlot->loadTime = theLoadTime;
+        theSlot->dropTime = theDropTime;
+
+        // Check the Drop Time range provided and force DropAtZero if out of range
+        if(theDropTime < AssetDropAtZero || theDropTime > AssetDropCached)
+        {
+          // Force drop time to AssetDropAtZero if out of enum range
+          theSlot->dropTime = AssetDropAtZero;
+        }
+
+        // Check the Load Style range provided and force to LoadFromUnknown if out of range
+        if(theLoadStyle < AssetLoadFromUnknown || theLoadStyle > AssetLoadFromNetwork)
+        {
+          // Force style to AssetLoadFromFile if out of enum range
+          theSlot->loadStyle = AssetLoadFromFile;
+        }
+
+        // Check the Load Time range provided and force LoadNow if out of range
+        if(theLoadTime < AssetLoadNow || theLoadTime > AssetLoadLater)
+        {
+          // Force load time to AssetLoadLater if out of enum range
+          theSlot->loadTime = AssetLoadLater;
+        }
+      }
+
+      /**
+       * AllocateSlot will return an unused slot, allocating a new page of
+       * slots if every slot is in use.
+       * @return the slot to use or NULL if no memory is available
+       */
+      typeAssetSlot* AllocateSlot(void)
+      {
+        // Slot that will be returned
+        typeAssetSlot* anResult = NULL;
+
+        // Every slot used? then allocate another page of slots
+        if(mFreeSlots.empty())
+        {
+          typeAssetSlot* anPage = new(std::nothrow) typeAssetSlot[SLOT_PAGE_SIZE];
+          if(NULL != anPage)
+          {
+            mSlotPages.push_back(anPage);
+            for(Uint32 iloop = SLOT_PAGE_SIZE; iloop > 0; iloop--)
+            {
+              mFreeSlots.push_back(&anPage[iloop - 1]);
+            }
+          }
+        }
+
+        if(!mFreeSlots.empty())
+        {
+          anResult = mFreeSlots.back();
+          mFreeSlots.pop_back();
+        }
+
+        // Return anResult determined above
+        return anResult;
+      }
+
+      /**
+       * FreeSlot will forget the asset in theSlot provided so the slot can be
+       * used for another asset.
+       * @param[in] theSlot to free
+       */
+      void FreeSlot(typeAssetSlot* theSlot)
+      {
+        theSlot->asset = NULL;
+        theSlot->count = 0;
+        theSlot->loaded = false;
+        theSlot->state = AssetLoadIdle;
+        theSlot->id.clear();
+        theSlot->filename.clear();
+        theSlot->cached = false;
+        theSlot->bytes = 0;
+        theSlot->newer = NULL;
+        theSlot->older = NULL;
+        mFreeSlots.push_back(theSlot);
+      }
+
+      /**
+       * ReleaseSlot will remove the asset in theSlot provided from our map,
+       * free its slot and call ReleaseAsset to delete the asset.
+       * @param[in] theSlot of the asset to release
+       */
+      void ReleaseSlot(typeAssetSlot* theSlot)
+      {
+        const typeAssetID anAssetID = theSlot->id;
+        TYPE* anAsset = theSlot->asset;
+
+        // Remove this asset from our map and reuse its slot
+        mAssets.erase(anAssetID);
+        FreeSlot(theSlot);
+
+        // Release the asset
+        ReleaseAsset(anAssetID, anAsset);
+      }
+
+      /**
+       * CacheSlot will add the unreferenced asset in theSlot provided to the
+       * front of the cache as the most recently used asset.
+       * @param[in] theSlot of the asset to cache
+       */
+      void CacheSlot(typeAssetSlot* theSlot)
+      {
+        theSlot->cached = true;
+        theSlot->bytes = GetAssetBytes(*(theSlot->asset));
+        theSlot->newer = NULL;
+        theSlot->older = mCacheNewest;
+        if(NULL != mCacheNewest)
+        {
+          mCacheNewest->newer = theSlot;
+        }
+        else
+        {
+          mCacheOldest = theSlot;
+        }
+        mCacheNewest = theSlot;
+        mCacheStats.count++;
+        mCacheStats.bytes += theSlot->bytes;
+      }
+
+      /**
+       * UncacheSlot will remove theSlot provided from the cache because it
+       * is referenced again or is about to be evicted.
+       * @param[in] theSlot of the asset to remove from the cache
+       */
+      void UncacheSlot(typeAssetSlot* theSlot)
+      {
+        if(NULL != theSlot->newer)
+        {
+          theSlot->newer->older = theSlot->older;
+        }
+        else
+        {
+          mCacheNewest = theSlot->older;
+        }
+        if(NULL != theSlot->older)
+        {
+          theSlot->older->newer = theSlot->newer;
+        }
+        else
+        {
+          mCacheOldest = theSlot->newer;
+        }
+        mCacheStats.count--;
+        mCacheStats.bytes -= theSlot->bytes;
+        theSlot->cached = false;
+        theSlot->bytes = 0;
+        theSlot->newer = NULL;
+        theSlot->older = NULL;
+      }
+
+      /**
+       * TrimCache will evict the least recently used assets from the cache
+       * until the cache uses no more than theBudget bytes provided.
+       * @param[in] theBudget in bytes the cache must fit in
+       */
+      void TrimCache(const Uint64 theBudget)
+      {
+        while(NULL != mCacheOldest && (mCacheStats.bytes > theBudget ||
+          0 == theBudget))
+        {
+          typeAssetSlot* anSlot = mCacheOldest;
+          UncacheSlot(anSlot);
+          mCacheStats.evictions++;
+          ReleaseSlot(anSlot);
+        }
+      }
+
+      /**
+       * TAssetHandler copy constructor is private because we do not allow
+       * copies of our class
+       */
+      TAssetHandler(const TAssetHandler&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      TAssetHandler& operator=(const TAssetHandler&); // Intentionally undefined
   }; // class TAssetHandler
 } // namespace GQE
 
@@ -807,7 +1510,16 @@ namespace GQE
  * @class GQE::TAssetHandler
  * @ingroup Core
  * The TAssetHandler template class is used to quickly provide a IAssetHandler
- * derived class for handling the Asset type specified.
+ * derived class for handling the Asset type specified. Every method locks the
+ * handler so the AssetLoader worker threads can decode assets (see
+ * LoadInBackground) while the main thread keeps adding and dropping
+ * references. Each asset is kept in a slot allocated in pages so its address
+ * never changes, which lets TAsset reference the slot directly (see GetSlot)
+ * instead of looking up the Asset ID each time the asset is used. Assets
+ * dropped with AssetDropCached stay loaded after their last reference is
+ * dropped and are only evicted, least recently used first, once the
+ * estimated size of the cache (see GetAssetBytes) exceeds the budget set by
+ * SetCacheBudget.
  *
  * Copyright (c) 2010-2012 Ryan Lindeman
  * Permission is hereby granted, free of charge, to any person obtaining a copy
@@ -0,0 +1,246 @@
+/**
+ * Provides the TEventQueue class used by the EventManager to store each event
+ * of TYPE posted and deliver them in batches to each subscriber.
+ *
+ * @file include/GQE/Core/interfaces/TEventQueue.hpp
+ * @author Ryan Lindeman
+ * @date 20130825 - Initial Release
+ */
+#ifndef   CORE_TEVENT_QUEUE_HPP_INCLUDED
+#define   CORE_TEVENT_QUEUE_HPP_INCLUDED
+
+#include <new>
+#include <typeinfo>
+#include <vector>
+#include <TVSource/Interfaces/IEventQueue.hpp>
+#include <TVSource/Loggers/Log_macros.hpp>
+#include <TVSource/Core/Core_types.hpp>
+
+namespace GQE
+{
+  /// The Template version of the IEventQueue class for each type of event
+  template<class TYPE>
+  class TEventQueue : public IEventQueue
+  {
+    public:
+      /**
+       * TEventQueue default constructor will allocate the storage of every
+       * event that can be posted so Post never allocates memory.
+       * @param[in] theCapacity of events that can be posted each frame
+       */
+      explicit TEventQueue(const Uint32 theCapacity) :
+        IEventQueue(typeid(TYPE).name(), theCapacity)
+      {
+        // Allocate both buffers of events once, they are reused every frame
+        for(Uint32 iloop = 0; iloop < 2; iloop++)
+        {
+          mEvents[iloop] = new(std::nothrow) TYPE[theCapacity];
+        }
+        if(NULL == mEvents[0] || NULL == mEvents[1])
+        {
+          ELOG() << "TEventQueue::ctor(" << typeid(TYPE).name()
+            << ") Unable to allocate " << theCapacity << " events!" << std::endl;
+          Disable();
+        }
+      }
+
+      /**
+       * TEventQueue deconstructor
+       */
+      virtual ~TEventQueue()
+      {
+        for(size_t iloop = 0; iloop < mSubscribers.size(); iloop++)
+        {
+          delete mSubscribers[iloop];
+        }
+        mSubscribers.clear();
+
+        for(Uint32 iloop = 0; iloop < 2; iloop++)
+        {
+          delete[] mEvents[iloop];
+          mEvents[iloop] = NULL;
+        }
+      }
+
+      /**
+       * Post will copy theEvent provided into the buffer dispatched by the
+       * next call to DispatchEvents. Can be called from any thread and never
+       * allocates memory or takes a lock.
+       * @param[in] theEvent to post
+       * @return true if theEvent was posted, false if the queue was full
+       */
+      bool Post(const TYPE& theEvent)
+      {
+        Uint32 anBuffer = 0;
+        Uint32 anSlot = 0;
+
+        // Reserve a slot, copy theEvent into it and mark it ready
+        bool anResult = BeginPost(anBuffer, anSlot);
+        if(anResult)
+        {
+          mEvents[anBuffer][anSlot] = theEvent;
+          EndPost(anBuffer, anSlot);
+        }
+
+        // Return anResult of true if theEvent was posted
+        return anResult;
+      }
+
+      /**
+       * Subscribe will call theEventFunc of theEventClass provided with each
+       * batch of events dispatched. Must only be called from the main thread
+       * and never from a subscriber.
+       * @param[in] theEventClass to use when calling theEventFunc
+       * @param[in] theEventFunc to call with each batch of events
+       */
+      template<class TCLASS>
+      void Subscribe(TCLASS& theEventClass,
+        void (TCLASS::*theEventFunc)(const TYPE* theEvents, const Uint32 theCount))
+      {
+        ISubscriber* anSubscriber = new(std::nothrow)
+          TSubscriber<TCLASS>(theEventClass, theEventFunc);
+        if(NULL != anSubscriber)
+        {
+          mSubscribers.push_back(anSubscriber);
+        }
+        else
+        {
+          ELOG() << "TEventQueue::Subscribe(" << typeid(TYPE).name()
+            << ") Unable to allocate subscriber!" << std::endl;
+        }
+      }
+
+      /**
+       * Unsubscribe will stop delivering events to theEventClass provided.
+       * Must only be called from the main thread and never from a subscriber.
+       * @param[in] theEventClass to stop delivering events to
+       */
+      void Unsubscribe(const void* theEventClass)
+      {
+        for(size_t iloop = 0; iloop < mSubscribers.size(); iloop++)
+        {
+          if(mSubscribers[iloop]->GetClass() == theEventClass)
+          {
+            delete mSubscribers[iloop];
+            mSubscribers.erase(mSubscribers.begin() + iloop--);
+          }
+        }
+      }
+
+      /**
+       * DispatchEvents will deliver every event posted since the previous
+       * call in a single batch to each subscriber.
+       * @return the number of events delivered
+       */
+      virtual Uint32 DispatchEvents(void)
+      {
+        Uint32 anBuffer = 0;
+
+        // Take every event posted so far, posting continues in the other buffer
+        Uint32 anResult = BeginDispatch(anBuffer);
+        if(0 < anResult)
+        {
+          for(size_t iloop = 0; iloop < mSubscribers.size(); iloop++)
+          {
+            mSubscribers[iloop]->DoEvents(mEvents[anBuffer], anResult);
+          }
+        }
+
+        // Return anResult of the number of events delivered
+        return anResult;
+      }
+
+    private:
+      /// Provides the interface for each subscriber of this queue
+      class ISubscriber
+      {
+        public:
+          virtual ~ISubscriber() {}
+
+          /**
+           * DoEvents will deliver theCount events provided to the subscriber.
+           * @param[in] theEvents to deliver
+           * @param[in] theCount of events to deliver
+           */
+          virtual void DoEvents(const TYPE* theEvents, const Uint32 theCount) = 0;
+
+          /**
+           * GetClass will return the address of the subscriber class.
+           * @return the address of the subscriber class
+           */
+          virtual const void* GetClass(void) const = 0;
+      };
+
+      /// Calls theEventFunc of theEventClass with each batch of events
+      template<class TCLASS>
+      class TSubscriber : public ISubscriber
+      {
+        public:
+          /// Declare the event function typedef used by Subscribe
+          typedef void (TCLASS::*typeEventFunc)(const TYPE* theEvents, const Uint32 theCount);
+
+          TSubscriber(TCLASS& theEventClass, typeEventFunc theEventFunc) :
+            mEventClass(theEventClass),
+            mEventFunc(theEventFunc)
+          {
+          }
+
+          virtual void DoEvents(const TYPE* theEvents, const Uint32 theCount)
+          {
+            // Call the member method provided of the event class provided
+            (mEventClass.*mEventFunc)(theEvents, theCount);
+          }
+
+          virtual const void* GetClass(void) const
+          {
+            return &mEventClass;
+          }
+
+        private:
+          /// The address to the event class to use when calling the event function
+          TCLASS&       mEventClass;
+          /// The function to call in the event class
+          typeEventFunc mEventFunc;
+      };
+
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// Both buffers of events, one posted to while the other is dispatched
+      TYPE* mEvents[2];
+      /// Each subscriber that receives the events dispatched
+      std::vector<ISubscriber*> mSubscribers;
+  }; // class TEventQueue
+} // namespace GQE
+
+#endif // CORE_TEVENT_QUEUE_HPP_INCLUDED
+
+/**
+ * @class GQE::TEventQueue
+ * @ingroup Core
+ * The TEventQueue class stores each event of TYPE posted in contiguous
+ * buffers allocated once by the constructor and reused every frame, and
+ * delivers them to each subscriber as a single batch (a pointer to the first
+ * event and the number of events) instead of one call per event. TYPE must
+ * provide a default constructor and an assignment operator. Events are
+ * normally posted and dispatched through the EventManager (see
+ * EventManager::Post).
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,579 @@
+/**
+ * Provides the AsyncLogger class that provides asynchronous logging support to
+ * a file for all GQE classes in the GQE namespace in the GQE core library.
+ *
+ * @file src/GQE/Core/loggers/AsyncLogger.cpp
+ * @author Ryan Lindeman
+ * @date 20130809 - Initial Release
+ * @date 20130826 - Keep each text message with the FlightRecorder
+ * @date 20130826 - Reuse the ring of a thread that logs to several loggers
+ */
+
+#include <cstring>
+#include <new>
+#include <sstream>
+#include <streambuf>
+#include <TVSource/Loggers/AsyncLogger.hpp>
+#include <TVSource/Managers/FlightRecorder.hpp>
+#include <TVSource/Utils/AtomicUtil.hpp>
+
+namespace GQE
+{
+  /// Provides a single message waiting to be written
+  struct typeLogRecord
+  {
+    std::time_t  time;     ///< Time the message was logged
+    const char*  file;     ///< Source file the message was logged from
+    Int32        line;     ///< Source line the message was logged from
+    SeverityType severity; ///< Severity of the message
+    bool         tagged;   ///< True if the message is prefixed with a tag
+    Uint32       length;   ///< Number of characters used in message
+    char         message[AsyncLogger::MAX_MESSAGE]; ///< The message text
+  };
+
+  /// Next logger ID to assign (0 means no logger)
+  static volatile Uint32 gNextID = 0;
+
+  /// Maximum number of characters of the source file written for each line
+  static const Uint32 MAX_SOURCE_FILE = 256;
+
+  /// Maximum number of characters of the line number written for each line
+  static const Uint32 MAX_SOURCE_LINE = 12;
+
+  /// Provides the per thread ring of messages waiting to be written
+  class AsyncLogger::LogRing : public std::streambuf
+  {
+    public:
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// The records of this ring
+      typeLogRecord   mRecords[RING_SIZE];
+      /// Next record to be published by the thread that owns this ring
+      volatile Uint32 mHead;
+      /// Next record to be written by the writer
+      volatile Uint32 mTail;
+      /// The stream returned by GetStream which writes into the next record
+      std::ostream    mStream;
+      /// True if the next record was started but not yet published
+      bool            mPending;
+      /// True if the next record is kept with the FlightRecorder when published
+      bool            mRecord;
+      /// Identifies the thread that owns this ring (see GetRing)
+      const void*     mThread;
+
+      /**
+       * LogRing constructor
+       * @param[in] theDropCount to increment each time a message is dropped
+       * @param[in] theThread that owns this ring
+       */
+      LogRing(volatile Uint32& theDropCount, const void* theThread) :
+        mHead(0),
+        mTail(0),
+        mStream(NULL),
+        mPending(false),
+        mRecord(false),
+        mThread(theThread),
+        mDropCount(theDropCount)
+      {
+        // Our stream writes into the record we are building
+        mStream.rdbuf(this);
+      }
+
+      /**
+       * Begin will start a new record which mStream will write into.
+       * @param[in] theTime the message was logged
+       * @param[in] theTagged flag to prefix the message with a tag
+       * @param[in] theSeverity of the message
+       * @param[in] theSourceFile where the message was logged from
+       * @param[in] theSourceLine where the message was logged from
+       * @param[in] theRecord flag to keep the message with the FlightRecorder
+       * @return true if the record was started, false if the ring is full
+       */
+      bool Begin(std::time_t theTime, bool theTagged, SeverityType theSeverity,
+          const char* theSourceFile, int theSourceLine, bool theRecord = true)
+      {
+        // Assume the ring is full
+        bool anResult = false;
+
+        // Publish any message that wasn't ended with std::endl first
+        Commit();
+
+        if(mHead - mTail < RING_SIZE)
+        {
+          typeLogRecord& anRecord = mRecords[mHead & (RING_SIZE - 1)];
+          anRecord.time = theTime;
+          anRecord.file = theSourceFile;
+          anRecord.line = theSourceLine;
+          anRecord.severity = theSeverity;
+          anRecord.tagged = theTagged;
+          anRecord.length = 0;
+
+          // Write directly into the message of the record
+          setp(anRecord.message, anRecord.message + MAX_MESSAGE);
+          mPending = true;
+          mRecord = theRecord;
+          anResult = true;
+        }
+        else
+        {
+          // Drop the message rather than wait for the writer
+          AtomicIncrement(mDropCount);
+        }
+
+        // Return anResult determined above
+        return anResult;
+      }
+
+      /**
+       * Commit will publish the record started by Begin to the writer.
+       */
+      void Commit(void)
+      {
+        if(mPending)
+        {
+          typeLogRecord& anRecord = mRecords[mHead & (RING_SIZE - 1)];
+          anRecord.length = (Uint32)(pptr() - pbase());
+
+          // Keep the message with the FlightRecorder while it is recording
+          if(mRecord && FlightRecorder::gRecording)
+          {
+            FlightRecorder::AddText(anRecord.severity,
+              anRecord.tagged ? anRecord.file : NULL, anRecord.line,
+              anRecord.message, anRecord.length);
+          }
+
+          // Anything written after this goes nowhere until the next Begin
+          setp(NULL, NULL);
+          mPending = false;
+
+          // Publish the record (also acts as a memory barrier)
+          AtomicIncrement(mHead);
+        }
+      }
+
+    protected:
+      /**
+       * overflow is called when the message doesn't fit in the record and
+       * will silently truncate the message.
+       * @param[in] theCharacter that didn't fit
+       * @return anything but eof so the stream stays usable
+       */
+      virtual int_type overflow(int_type theCharacter)
+      {
+        return traits_type::not_eof(theCharacter);
+      }
+
+      /**
+       * sync is called by std::endl and std::flush and will publish the
+       * record being built.
+       * @return 0 always
+       */
+      virtual int sync(void)
+      {
+        Commit();
+        return 0;
+      }
+
+    private:
+      /// The number of messages dropped by the logger that owns this ring
+      volatile Uint32& mDropCount;
+  }; // class AsyncLogger::LogRing
+
+  AsyncLogger::AsyncLogger(const char* theFilename, bool theDefault) :
+    ILogger(theDefault),
+    mID(AtomicIncrement(gNextID)),
+    mRingCount(0),
+    mThread(&AsyncLogger::Run, this),
+    mRunning(false),
+    mDropCount(0),
+    mDropReported(0),
+    mBatch(NULL),
+    mBatchLength(0)
+  {
+    for(Uint32 iloop = 0; iloop < MAX_THREADS; iloop++)
+    {
+      mRings[iloop] = NULL;
+    }
+
+    // Allocate the batch buffer once, formatting never allocates afterwards
+    mBatch = new(std::nothrow) char[BATCH_SIZE];
+
+    mFileStream.open(theFilename);
+    if(mFileStream.is_open() && NULL != mBatch)
+    {
+      // Start the background thread that writes each message
+      mRunning = true;
+      mThread.launch();
+
+      LogMessage(SeverityInfo, __FILE__, __LINE__, "AsyncLogger::ctor()");
+    }
+  }
+
+  AsyncLogger::~AsyncLogger()
+  {
+    if(mRunning)
+    {
+      LogMessage(SeverityInfo, __FILE__, __LINE__, "AsyncLogger::dtor()");
+
+      // Stop the background thread before writing what is left ourselves
+      mRunning = false;
+      mThread.wait();
+      Flush();
+    }
+
+    // Close the log file
+    if(mFileStream.is_open())
+    {
+      mFileStream.close();
+    }
+
+    // Delete each ring registered
+    for(Uint32 iloop = 0; iloop < MAX_THREADS; iloop++)
+    {
+      delete mRings[iloop];
+      mRings[iloop] = NULL;
+    }
+
+    // Delete our batch buffer
+    delete[] mBatch;
+    mBatch = NULL;
+  }
+
+  std::ostream& AsyncLogger::GetStream(void)
+  {
+    std::ostream* anResult = &gNullStream;
+    if(mRunning && IsActive())
+    {
+      LogRing* anRing = GetRing(true);
+      if(NULL == anRing)
+      {
+        AtomicIncrement(mDropCount);
+      }
+      else if(anRing->mPending ||
+        anRing->Begin(std::time(NULL), false, SeverityInfo, NULL, 0))
+      {
+        // Continue the message being built or start one without a tag
+        anResult = &anRing->mStream;
+      }
+    }
+    return *anResult;
+  }
+
+  std::ostream& AsyncLogger::GetStream(SeverityType theSeverity,
+      const char* theSourceFile, int theSourceLine, int theExitCode)
+  {
+    std::ostream* anResult = &gNullStream;
+    if(mRunning && IsActive())
+    {
+      LogRing* anRing = GetRing(true);
+      if(NULL == anRing)
+      {
+        AtomicIncrement(mDropCount);
+      }
+      else if(anRing->Begin(std::time(NULL), true, theSeverity,
+        theSourceFile, theSourceLine))
+      {
+        anResult = &anRing->mStream;
+      }
+    }
+    return *anResult;
+  }
+
+  void AsyncLogger::LogMessage(const char* theMessage)
+  {
+    if(mRunning && IsActive())
+    {
+      LogRing* anRing = GetRing(true);
+      if(NULL == anRing)
+      {
+        AtomicIncrement(mDropCount);
+      }
+      else if(anRing->Begin(std::time(NULL), false, SeverityInfo, NULL, 0))
+      {
+        anRing->sputn(theMessage, (std::streamsize)strlen(theMessage));
+        anRing->Commit();
+      }
+    }
+  }
+
+  void AsyncLogger::LogMessage(SeverityType theSeverity,
+      const char* theSourceFile, int theSourceLine,
+      const char* theMessage)
+  {
+    if(mRunning && IsActive())
+    {
+      LogRing* anRing = GetRing(true);
+      if(NULL == anRing)
+      {
+        AtomicIncrement(mDropCount);
+      }
+      else if(anRing->Begin(std::time(NULL), true, theSeverity,
+        theSourceFile, theSourceLine))
+      {
+        anRing->sputn(theMessage, (std::streamsize)strlen(theMessage));
+        anRing->Commit();
+      }
+    }
+  }
+
+  void AsyncLogger::LogArguments(Uint32 theSite, const char* theArguments,
+      Uint32 theLength)
+  {
+    const typeLogSite* anSite = GetSite(theSite);
+    if(NULL != anSite && mRunning && IsActive())
+    {
+      LogRing* anRing = GetRing(true);
+      if(NULL == anRing)
+      {
+        AtomicIncrement(mDropCount);
+      }
+      else if(anRing->Begin(std::time(NULL), true, anSite->severity,
+        anSite->file, anSite->line, false))
+      {
+        // The FlightRecorder already kept theArguments (see LogRecord)
+        WriteArguments(anRing->mStream, anSite->format, theArguments, theLength);
+        anRing->Commit();
+      }
+    }
+  }
+
+  bool AsyncLogger::IsRecordingText(void)
+  {
+    return mRunning && IsActive();
+  }
+
+  void AsyncLogger::Flush(void)
+  {
+    // Publish any message the calling thread didn't end with std::endl
+    LogRing* anRing = GetRing(false);
+    if(NULL != anRing)
+    {
+      anRing->Commit();
+    }
+
+    // Write every message published so far from the calling thread
+    sf::Lock anLock(mWriteMutex);
+    WriteRings();
+  }
+
+  Uint32 AsyncLogger::GetDropCount(void) const
+  {
+    return mDropCount;
+  }
+
+  AsyncLogger::LogRing* AsyncLogger::GetRing(bool theRegister)
+  {
+    // The ring of the calling thread and the ID of the logger it belongs to
+    static GQE_THREAD_LOCAL LogRing* gRing = NULL;
+    static GQE_THREAD_LOCAL Uint32 gRingOwner = 0;
+    // The address of this is unique to each running thread
+    static GQE_THREAD_LOCAL char gThreadKey = 0;
+
+    if(gRingOwner != mID)
+    {
+      // Look for the ring the calling thread registered with us before it
+      // logged to another logger (only the calling thread adds its ring)
+      LogRing* anRing = NULL;
+      Uint32 anCount = mRingCount;
+      for(Uint32 iloop = 0; iloop < anCount && NULL == anRing; iloop++)
+      {
+        if(mRings[iloop]->mThread == &gThreadKey)
+        {
+          anRing = mRings[iloop];
+        }
+      }
+
+      if(NULL != anRing)
+      {
+        gRing = anRing;
+        gRingOwner = mID;
+      }
+      else if(theRegister)
+      {
+        // Register a ring the first time the calling thread logs a message
+        gRing = NULL;
+        gRingOwner = mID;
+
+        sf::Lock anLock(mRingMutex);
+        if(mRingCount < MAX_THREADS)
+        {
+          gRing = new(std::nothrow) LogRing(mDropCount, &gThreadKey);
+          if(NULL != gRing)
+          {
+            // Only count the new ring once it can be found by the writer
+            mRings[mRingCount] = gRing;
+            AtomicIncrement(mRingCount);
+          }
+        }
+      }
+    }
+
+    // Return the ring of the calling thread (if it belongs to us)
+    return (gRingOwner == mID) ? gRing : NULL;
+  }
+
+  void AsyncLogger::Run(void)
+  {
+    while(mRunning)
+    {
+      Uint32 anWritten = 0;
+
+      // Write each message published so far
+      {
+        sf::Lock anLock(mWriteMutex);
+        anWritten = WriteRings();
+      }
+
+      // Only sleep when there was nothing to write
+      if(0 == anWritten)
+      {
+        sf::sleep(sf::milliseconds(WRITE_INTERVAL));
+      }
+    }
+  }
+
+  Uint32 AsyncLogger::WriteRings(void)
+  {
+    // Number of messages written
+    Uint32 anResult = 0;
+
+    // Format every record published in each ring into our batch
+    Uint32 anCount = mRingCount;
+    for(Uint32 iloop = 0; iloop < anCount; iloop++)
+    {
+      LogRing* anRing = mRings[iloop];
+      Uint32 anHead = anRing->mHead;
+      Uint32 anTail = anRing->mTail;
+      while(anTail != anHead)
+      {
+        const typeLogRecord& anRecord = anRing->mRecords[anTail & (RING_SIZE - 1)];
+        AppendLine(anRecord.time, anRecord.tagged, anRecord.severity,
+          anRecord.file, anRecord.line, anRecord.message, anRecord.length);
+        anTail++;
+      }
+
+      // Give the records formatted back to the thread that owns the ring
+      if(anTail != anRing->mTail)
+      {
+        anResult += anTail - anRing->mTail;
+        AtomicAdd(anRing->mTail, anTail - anRing->mTail);
+      }
+    }
+
+    // Report any messages dropped since the last report
+    Uint32 anDropped = mDropCount;
+    if(anDropped != mDropReported)
+    {
+      std::ostringstream anMessage;
+      anMessage << "AsyncLogger dropped " << anDropped - mDropReported
+        << " messages";
+      AppendLine(std::time(NULL), true, SeverityWarning, __FILE__, __LINE__,
+        anMessage.str().c_str(), (Uint32)anMessage.str().length());
+      mDropReported = anDropped;
+      anResult++;
+    }
+
+    // Write whatever is left in our batch
+    WriteBatch();
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  void AsyncLogger::AppendLine(std::time_t theTime, bool theTagged,
+      SeverityType theSeverity, const char* theSourceFile,
+      int theSourceLine, const char* theMessage, Uint32 theLength)
+  {
+    // Limit the source file so each line always fits in an empty batch
+    Uint32 anFileLength = 0;
+    if(theTagged && NULL != theSourceFile)
+    {
+      anFileLength = (Uint32)strlen(theSourceFile);
+      if(anFileLength > MAX_SOURCE_FILE)
+      {
+        anFileLength = MAX_SOURCE_FILE;
+      }
+    }
+
+    // Write our batch first if this line might not fit
+    Uint32 anMaximum = TIMESTAMP_LENGTH + 2 + anFileLength + 1 +
+      MAX_SOURCE_LINE + 1 + theLength + 1;
+    if(mBatchLength + anMaximum > BATCH_SIZE)
+    {
+      WriteBatch();
+    }
+
+    char* anText = mBatch + mBatchLength;
+    if(theTagged)
+    {
+      // Output the cached timestamp, severity and File:Line tag
+      memcpy(anText, GetTimestamp(theTime), TIMESTAMP_LENGTH);
+      anText += TIMESTAMP_LENGTH;
+      *anText++ = GetSeverityCharacter(theSeverity);
+      *anText++ = ' ';
+      memcpy(anText, theSourceFile, anFileLength);
+      anText += anFileLength;
+      *anText++ = ':';
+
+      // Output the line number digits in reverse order first
+      char anDigits[MAX_SOURCE_LINE];
+      Uint32 anDigitCount = 0;
+      Uint32 anLine = theSourceLine < 0 ? 0 : (Uint32)theSourceLine;
+      do
+      {
+        anDigits[anDigitCount++] = (char)('0' + anLine % 10);
+        anLine /= 10;
+      } while(anLine > 0 && anDigitCount < MAX_SOURCE_LINE);
+      while(anDigitCount > 0)
+      {
+        *anText++ = anDigits[--anDigitCount];
+      }
+      *anText++ = ' ';
+    }
+
+    // Output the message and end the line if the message didn't
+    memcpy(anText, theMessage, theLength);
+    anText += theLength;
+    if(0 == theLength || '\n' != theMessage[theLength - 1])
+    {
+      *anText++ = '\n';
+    }
+
+    mBatchLength = (Uint32)(anText - mBatch);
+  }
+
+  void AsyncLogger::WriteBatch(void)
+  {
+    if(mBatchLength > 0)
+    {
+      // Write the whole batch with a single call
+      if(mFileStream.is_open())
+      {
+        mFileStream.write(mBatch, mBatchLength);
+        mFileStream.flush();
+      }
+      mBatchLength = 0;
+    }
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,247 @@
+/**
+ * Provides the AsyncLogger class that provides asynchronous logging support to
+ * a file for all GQE classes in the GQE namespace in the GQE core library.
+ *
+ * @file include/GQE/Core/loggers/AsyncLogger.hpp
+ * @author Ryan Lindeman
+ * @date 20130809 - Initial Release
+ * @date 20130826 - Keep each text message with the FlightRecorder
+ * @date 20130826 - Reuse the ring of a thread that logs to several loggers
+ */
+#ifndef   CORE_ASYNC_LOGGER_HPP_INCLUDED
+#define   CORE_ASYNC_LOGGER_HPP_INCLUDED
+
+#include <ctime>
+#include <fstream>
+#include <SFML/System.hpp>
+#include <TVSource/Core/Core_Types.hpp>
+#include <TVSource/Interfaces/ILogger.hpp>
+
+namespace GQE
+{
+  /// Provides file logging from a background thread
+  class GQE_API AsyncLogger : public ILogger
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Number of records in the ring of each thread (must be a power of 2)
+      static const Uint32 RING_SIZE = 1024;
+      /// Maximum number of characters of each message (longer are truncated)
+      static const Uint32 MAX_MESSAGE = 232;
+      /// Maximum number of threads that can log to this logger
+      static const Uint32 MAX_THREADS = 16;
+      /// Size in bytes of each batch written to the log file
+      static const Uint32 BATCH_SIZE = 64 * 1024;
+      /// Time in milliseconds the writer thread sleeps when every ring is empty
+      static const Int32 WRITE_INTERVAL = 5;
+
+      /**
+       * AsyncLogger constructor will open theFilename provided and start the
+       * background thread that writes each message logged.
+       * @param[in] theFilename to open as log file
+       * @param[in] theDefault flag meaning this should be the default logger
+       */
+      AsyncLogger(const char* theFilename, bool theDefault = false);
+
+      /**
+       * AsyncLogger deconstructor will stop the background thread after every
+       * message logged has been written.
+       */
+      virtual ~AsyncLogger();
+
+      /**
+       * GetStream is responsible for returning the ostream necessary to log the
+       * custom message that will follow without a prefix.
+       * @return the ostream to use for logging the message
+       */
+      virtual std::ostream& GetStream(void);
+
+      /**
+       * GetStream is responsible for returning the ostream necessary to log the
+       * custom message that will follow and prefix the custom message with an
+       * appropriate timestamp and File:Line tag.
+       * @param[in] theSeverity for this message to be logged
+       * @param[in] theSourceFile where the Log macro was called from
+       * @param[in] theSourceLine number where the Log macro was called from
+       * @param[in] theExitCode value to use when FatalShutdown is called
+       * @return the ostream to use for logging the message
+       */
+      virtual std::ostream& GetStream(SeverityType theSeverity,
+          const char* theSourceFile, int theSourceLine, int theExitCode = StatusError);
+
+      /**
+       * LogMessage is responsible for logging the message provided using an
+       * appropriate timestamp and File:Line tag in front.
+       * @param[in] theMessage to log
+       */
+      virtual void LogMessage(const char* theMessage);
+
+      /**
+       * LogMessage is responsible for logging the message provided using an
+       * appropriate timestamp and File:Line tag in front.
+       * @param[in] theSeverity for this message to be logged
+       * @param[in] theSourceFile where the Log macro was called from
+       * @param[in] theSourceLine number where the Log macro was called from
+       * @param[in] theMessage to log
+       */
+      virtual void LogMessage(SeverityType theSeverity,
+          const char* theSourceFile, int theSourceLine,
+          const char* theMessage);
+
+      /**
+       * Flush will write every message logged so far to the log file from
+       * the calling thread before returning.
+       */
+      virtual void Flush(void);
+
+      /**
+       * LogArguments is responsible for formatting theArguments of a binary
+       * log message directly into the ring of the calling thread.
+       * @param[in] theSite the message was logged from (see RegisterSite)
+       * @param[in] theArguments recorded for the message
+       * @param[in] theLength of theArguments in bytes
+       */
+      virtual void LogArguments(Uint32 theSite, const char* theArguments,
+          Uint32 theLength);
+
+      /**
+       * IsRecordingText will return true since each text message is kept with
+       * the FlightRecorder when it is published to the writer.
+       * @return true while the logger is running and active
+       */
+      virtual bool IsRecordingText(void);
+
+      /**
+       * GetDropCount will return the number of messages dropped because the
+       * ring of the logging thread was full.
+       * @return the number of messages dropped so far
+       */
+      Uint32 GetDropCount(void) const;
+
+    private:
+      /// Provides the per thread ring of messages waiting to be written
+      class LogRing;
+
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// Unique ID of this logger used to find the ring of each thread
+      const Uint32      mID;
+      /// Output Logger file
+      std::ofstream     mFileStream;
+      /// The ring registered by each thread
+      LogRing*          mRings[MAX_THREADS];
+      /// The number of rings registered in mRings
+      volatile Uint32   mRingCount;
+      /// Mutex used while registering a new ring
+      sf::Mutex         mRingMutex;
+      /// Mutex held by whoever is writing the rings to the log file
+      sf::Mutex         mWriteMutex;
+      /// The background thread that writes each message
+      sf::Thread        mThread;
+      /// True while the background thread should keep running
+      volatile bool     mRunning;
+      /// Number of messages dropped because a ring was full
+      volatile Uint32   mDropCount;
+      /// Number of dropped messages already reported in the log file
+      Uint32            mDropReported;
+      /// The batch of formatted messages waiting to be written
+      char*             mBatch;
+      /// Number of characters used in mBatch
+      Uint32            mBatchLength;
+
+      /**
+       * GetRing will return the ring of the calling thread, looking for the
+       * ring it registered before when it last logged to another logger.
+       * @param[in] theRegister flag to register a new ring if none exists yet
+       * @return the ring of the calling thread or NULL if none is available
+       */
+      LogRing* GetRing(bool theRegister);
+
+      /**
+       * Run is the background thread which writes the messages of each ring
+       * until the logger is destroyed.
+       */
+      void Run(void);
+
+      /**
+       * WriteRings will format the messages of each ring into batches and
+       * write them to the log file. The caller must hold mWriteMutex.
+       * @return the number of messages written
+       */
+      Uint32 WriteRings(void);
+
+      /**
+       * AppendLine will append one formatted line to mBatch and write the
+       * batch to the log file first if it doesn't have enough room left.
+       * @param[in] theTime the message was logged
+       * @param[in] theTagged flag to prefix the line with a tag
+       * @param[in] theSeverity of the message
+       * @param[in] theSourceFile where the message was logged from
+       * @param[in] theSourceLine where the message was logged from
+       * @param[in] theMessage to append
+       * @param[in] theLength of theMessage in characters
+       */
+      void AppendLine(std::time_t theTime, bool theTagged,
+          SeverityType theSeverity, const char* theSourceFile,
+          int theSourceLine, const char* theMessage, Uint32 theLength);
+
+      /**
+       * WriteBatch will write mBatch to the log file using a single call.
+       */
+      void WriteBatch(void);
+
+      /**
+       * Copy constructor is private because we do not allow copies of
+       * our Singleton class
+       */
+      AsyncLogger(const AsyncLogger&);             // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our Singleton class
+       */
+      AsyncLogger& operator=(const AsyncLogger&);  // Intentionally undefined
+  }; // class AsyncLogger
+} // namespace GQE
+
+#endif // CORE_ASYNC_LOGGER_HPP_INCLUDED
+
+/**
+ * @class GQE::AsyncLogger
+ * @ingroup Core
+ * The AsyncLogger class moves the cost of formatting and writing each log
+ * message off the thread that logged it. Each thread logs into its own ring
+ * of fixed size records (single producer, single consumer) so logging never
+ * takes a lock or allocates memory after the first message of a thread. The
+ * stream returned by GetStream writes directly into the next free record and
+ * the record is published when the message ends with std::endl (or when the
+ * next message is started). While the FlightRecorder is recording, each text
+ * message is also copied into its ring when the record is published. A
+ * background thread formats each record, reusing the timestamp text until the
+ * second changes, and writes the formatted lines in large batches. When a ring
+ * is full the message is dropped and counted instead of blocking the game
+ * loop; the number of dropped messages is reported in the log file. Flush writes every pending message from the
+ * calling thread and is used by the FatalLogger class before the application
+ * is shutdown. The source file of each message is kept as a pointer, so it
+ * must be a string that outlives the logger (e.g. __FILE__).
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
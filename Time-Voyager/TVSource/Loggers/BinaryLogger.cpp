@@ -0,0 +1,387 @@
+/**
+ * Provides the BinaryLogger class that provides compact binary logging support
+ * to a file for all GQE classes in the GQE namespace in the GQE core library.
+ *
+ * @file src/GQE/Core/loggers/BinaryLogger.cpp
+ * @author Ryan Lindeman
+ * @date 20130810 - Initial Release
+ * @date 20130826 - Reject site IDs above MAX_SITES when decoding
+ */
+
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <TVSource/Loggers/BinaryLogger.hpp>
+
+namespace GQE
+{
+  /// File used by the text call site of messages logged without a tag
+  static const char* const UNTAGGED_FILE = "";
+
+  /// Format used by every text call site (the text is a single argument)
+  static const char* const TEXT_FORMAT = "{}";
+
+  /// Provides a call site read back by the Decode method
+  struct typeDecodeSite
+  {
+    bool         valid;    ///< True if the site was read from the binary log
+    SeverityType severity; ///< Severity of every message logged from the site
+    std::string  file;     ///< Source file of the site
+    Int32        line;     ///< Source line of the site
+    std::string  format;   ///< Format of the message with {} for each argument
+  };
+
+  /**
+   * WriteValue will write the raw bytes of theValue provided to theOstream.
+   * @param[in] theOstream to write theValue to
+   * @param[in] theValue to write
+   */
+  template<class TYPE>
+  static void WriteValue(std::ostream& theOstream, const TYPE& theValue)
+  {
+    theOstream.write((const char*)&theValue, sizeof(TYPE));
+  }
+
+  /**
+   * ReadValue will read the raw bytes of theValue from theIstream provided.
+   * @param[in] theIstream to read theValue from
+   * @param[out] theValue to read
+   * @return true if theValue was read, false otherwise
+   */
+  template<class TYPE>
+  static bool ReadValue(std::istream& theIstream, TYPE& theValue)
+  {
+    return theIstream.read((char*)&theValue, sizeof(TYPE)).good();
+  }
+
+  /**
+   * WriteString will write theText provided as a 16 bit length followed by
+   * its characters (truncated to 65535 characters).
+   * @param[in] theOstream to write theText to
+   * @param[in] theText to write
+   */
+  static void WriteString(std::ostream& theOstream, const char* theText)
+  {
+    std::size_t anLength = strlen(theText);
+    Uint16 anCount = (Uint16)(anLength < 0xFFFF ? anLength : 0xFFFF);
+    WriteValue(theOstream, anCount);
+    theOstream.write(theText, anCount);
+  }
+
+  /**
+   * ReadString will read a 16 bit length followed by its characters from
+   * theIstream provided.
+   * @param[in] theIstream to read theText from
+   * @param[out] theText read
+   * @return true if theText was read, false otherwise
+   */
+  static bool ReadString(std::istream& theIstream, std::string& theText)
+  {
+    bool anResult = false;
+    Uint16 anCount = 0;
+    if(ReadValue(theIstream, anCount))
+    {
+      theText.resize(anCount);
+      anResult = (0 == anCount) || theIstream.read(&theText[0], anCount).good();
+    }
+    return anResult;
+  }
+
+  const char* const BinaryLogger::FILE_MAGIC = "GQEBLOG1";
+
+  BinaryLogger::TextBuffer::TextBuffer(BinaryLogger& theLogger) :
+    mLogger(theLogger)
+  {
+  }
+
+  int BinaryLogger::TextBuffer::sync(void)
+  {
+    // Called by std::endl at the end of each text message
+    mLogger.CommitText();
+    return 0;
+  }
+
+  BinaryLogger::BinaryLogger(const char* theFilename, bool theDefault) :
+    ILogger(theDefault),
+    mTextBuffer(*this),
+    mTextStream(&mTextBuffer),
+    mTextSite(0)
+  {
+    mFileStream.open(theFilename, std::ios::out | std::ios::binary);
+    if(mFileStream.is_open())
+    {
+      mFileStream.write(FILE_MAGIC, FILE_MAGIC_LENGTH);
+      LogMessage(SeverityInfo, __FILE__, __LINE__, "BinaryLogger::ctor()");
+    }
+  }
+
+  BinaryLogger::~BinaryLogger()
+  {
+    if(mFileStream.is_open())
+    {
+      CommitText();
+      LogMessage(SeverityInfo, __FILE__, __LINE__, "BinaryLogger::dtor()");
+      mFileStream.close();
+    }
+  }
+
+  std::ostream& BinaryLogger::GetStream(void)
+  {
+    std::ostream* anResult = &gNullStream;
+    if(mFileStream.is_open() && IsActive())
+    {
+      anResult = &mTextStream;
+    }
+    return *anResult;
+  }
+
+  std::ostream& BinaryLogger::GetStream(SeverityType theSeverity,
+      const char* theSourceFile, int theSourceLine, int theExitCode)
+  {
+    std::ostream* anResult = &gNullStream;
+    if(mFileStream.is_open() && IsActive())
+    {
+      // Commit any text message that didn't end with std::endl
+      CommitText();
+      mTextSite = GetTextSite(theSeverity, theSourceFile, theSourceLine);
+      anResult = &mTextStream;
+    }
+    return *anResult;
+  }
+
+  void BinaryLogger::LogMessage(const char* theMessage)
+  {
+    if(mFileStream.is_open() && IsActive())
+    {
+      Uint32 anSite = GetTextSite(SeverityInfo, UNTAGGED_FILE, 0);
+      sf::Lock anLock(mMutex);
+      WriteText(anSite, theMessage, strlen(theMessage));
+    }
+  }
+
+  void BinaryLogger::LogMessage(SeverityType theSeverity,
+      const char* theSourceFile, int theSourceLine,
+      const char* theMessage)
+  {
+    if(mFileStream.is_open() && IsActive())
+    {
+      Uint32 anSite = GetTextSite(theSeverity, theSourceFile, theSourceLine);
+      sf::Lock anLock(mMutex);
+      WriteText(anSite, theMessage, strlen(theMessage));
+    }
+  }
+
+  void BinaryLogger::LogArguments(Uint32 theSite, const char* theArguments,
+      Uint32 theLength)
+  {
+    if(mFileStream.is_open() && IsActive())
+    {
+      Uint16 anLength = (Uint16)(theLength < 0xFFFF ? theLength : 0xFFFF);
+      sf::Lock anLock(mMutex);
+      if(WriteRecord(theSite, anLength))
+      {
+        mFileStream.write(theArguments, anLength);
+      }
+    }
+  }
+
+  void BinaryLogger::Flush(void)
+  {
+    if(mFileStream.is_open())
+    {
+      CommitText();
+      sf::Lock anLock(mMutex);
+      mFileStream.flush();
+    }
+  }
+
+  bool BinaryLogger::Decode(std::istream& theInput, std::ostream& theOutput)
+  {
+    // Make sure theInput is a binary log before decoding anything
+    char anMagic[FILE_MAGIC_LENGTH];
+    bool anResult = theInput.read(anMagic, FILE_MAGIC_LENGTH).good() &&
+      memcmp(anMagic, FILE_MAGIC, FILE_MAGIC_LENGTH) == 0;
+
+    std::vector<typeDecodeSite> anSites;
+    std::vector<char> anArguments;
+    char anTimestamp[TIMESTAMP_LENGTH + 1];
+    char anChunk;
+
+    // Decode each chunk until the end of theInput or an error is found
+    while(anResult && theInput.get(anChunk).good())
+    {
+      Uint32 anSite = 0;
+      if(CHUNK_SITE == anChunk)
+      {
+        Uint8 anSeverity = 0;
+        Int32 anLine = 0;
+        std::string anFile;
+        std::string anFormat;
+        anResult = ReadValue(theInput, anSite) && anSite > 0 &&
+          anSite <= ILogger::MAX_SITES &&
+          ReadValue(theInput, anSeverity) && ReadValue(theInput, anLine) &&
+          ReadString(theInput, anFile) && ReadString(theInput, anFormat);
+        if(anResult)
+        {
+          if(anSite >= anSites.size())
+          {
+            typeDecodeSite anEmpty = {false, SeverityInfo, "", 0, ""};
+            anSites.resize(anSite + 1, anEmpty);
+          }
+          typeDecodeSite& anDecodeSite = anSites[anSite];
+          anDecodeSite.valid = true;
+          anDecodeSite.severity = (SeverityType)anSeverity;
+          anDecodeSite.file = anFile;
+          anDecodeSite.line = anLine;
+          anDecodeSite.format = anFormat;
+        }
+      }
+      else if(CHUNK_RECORD == anChunk)
+      {
+        Uint32 anTime = 0;
+        Uint16 anLength = 0;
+        anResult = ReadValue(theInput, anSite) && anSite < anSites.size() &&
+          anSites[anSite].valid && ReadValue(theInput, anTime) &&
+          ReadValue(theInput, anLength);
+        if(anResult && anLength > 0)
+        {
+          anArguments.resize(anLength);
+          anResult = theInput.read(&anArguments[0], anLength).good();
+        }
+        if(anResult)
+        {
+          const typeDecodeSite& anDecodeSite = anSites[anSite];
+
+          // Messages logged without a tag are written as is
+          if(!anDecodeSite.file.empty())
+          {
+            FormatTimestamp((std::time_t)anTime, anTimestamp);
+            theOutput << anTimestamp << GetSeverityCharacter(anDecodeSite.severity)
+              << " " << anDecodeSite.file << ":" << anDecodeSite.line << " ";
+          }
+          WriteArguments(theOutput, anDecodeSite.format.c_str(),
+            anLength > 0 ? &anArguments[0] : NULL, anLength);
+          theOutput << "\n";
+        }
+      }
+      else
+      {
+        // Unknown chunk type, the binary log must be corrupt
+        anResult = false;
+      }
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  Uint32 BinaryLogger::GetTextSite(SeverityType theSeverity,
+      const char* theSourceFile, int theSourceLine)
+  {
+    // The severity is kept in the lowest 2 bits of the line
+    typeTextKey anKey(theSourceFile, (theSourceLine << 2) | (theSeverity & 3));
+
+    sf::Lock anLock(mMutex);
+    std::map<typeTextKey, Uint32>::iterator anIter = mTextSites.find(anKey);
+    if(anIter == mTextSites.end())
+    {
+      anIter = mTextSites.insert(std::pair<const typeTextKey, Uint32>(anKey,
+        RegisterSite(theSeverity, theSourceFile, theSourceLine, TEXT_FORMAT))).first;
+    }
+
+    // Return the call site found or registered above
+    return anIter->second;
+  }
+
+  void BinaryLogger::CommitText(void)
+  {
+    const std::string anText = mTextBuffer.str();
+    if(!anText.empty())
+    {
+      // Messages continued without a tag use the untagged call site
+      if(0 == mTextSite)
+      {
+        mTextSite = GetTextSite(SeverityInfo, UNTAGGED_FILE, 0);
+      }
+
+      // Leave out the newline written by std::endl
+      std::size_t anLength = anText.length();
+      if('\n' == anText[anLength - 1])
+      {
+        anLength--;
+      }
+
+      sf::Lock anLock(mMutex);
+      WriteText(mTextSite, anText.data(), anLength);
+      mTextBuffer.str("");
+    }
+    mTextSite = 0;
+  }
+
+  void BinaryLogger::WriteText(Uint32 theSite, const char* theText,
+      std::size_t theLength)
+  {
+    // The text is a single string argument (type, 16 bit length, characters)
+    Uint16 anCount = (Uint16)(theLength < 0xFFF0 ? theLength : 0xFFF0);
+    Uint16 anLength = (Uint16)(1 + sizeof(anCount) + anCount);
+    if(WriteRecord(theSite, anLength))
+    {
+      mFileStream.put((char)LogArgumentString);
+      WriteValue(mFileStream, anCount);
+      mFileStream.write(theText, anCount);
+    }
+  }
+
+  bool BinaryLogger::WriteRecord(Uint32 theSite, Uint16 theLength)
+  {
+    const typeLogSite* anSite = GetSite(theSite);
+    if(NULL != anSite)
+    {
+      // Write the static information of theSite before its first record
+      if(theSite >= mSiteWritten.size())
+      {
+        mSiteWritten.resize(theSite + 1, false);
+      }
+      if(!mSiteWritten[theSite])
+      {
+        mFileStream.put(CHUNK_SITE);
+        WriteValue(mFileStream, theSite);
+        WriteValue(mFileStream, (Uint8)anSite->severity);
+        WriteValue(mFileStream, anSite->line);
+        WriteString(mFileStream, anSite->file);
+        WriteString(mFileStream, anSite->format);
+        mSiteWritten[theSite] = true;
+      }
+
+      // Write the record header, the caller writes the arguments that follow
+      mFileStream.put(CHUNK_RECORD);
+      WriteValue(mFileStream, theSite);
+      WriteValue(mFileStream, (Uint32)std::time(NULL));
+      WriteValue(mFileStream, theLength);
+    }
+
+    // Return true if the record header was written above
+    return NULL != anSite;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
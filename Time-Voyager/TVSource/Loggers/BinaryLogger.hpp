@@ -0,0 +1,249 @@
+/**
+ * Provides the BinaryLogger class that provides compact binary logging support
+ * to a file for all GQE classes in the GQE namespace in the GQE core library.
+ *
+ * @file include/GQE/Core/loggers/BinaryLogger.hpp
+ * @author Ryan Lindeman
+ * @date 20130810 - Initial Release
+ */
+#ifndef   CORE_BINARY_LOGGER_HPP_INCLUDED
+#define   CORE_BINARY_LOGGER_HPP_INCLUDED
+
+#include <fstream>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <utility>
+#include <vector>
+#include <SFML/System.hpp>
+#include <TVSource/Core/Core_Types.hpp>
+#include <TVSource/Interfaces/ILogger.hpp>
+
+namespace GQE
+{
+  /// Provides binary logging of call site IDs and raw arguments to a file
+  class GQE_API BinaryLogger : public ILogger
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Magic text written at the start of every binary log file
+      static const char* const FILE_MAGIC;
+      /// Length of FILE_MAGIC in characters
+      static const Uint32 FILE_MAGIC_LENGTH = 8;
+      /// Chunk type of the static information of a call site
+      static const char CHUNK_SITE = 'S';
+      /// Chunk type of a single message logged from a call site
+      static const char CHUNK_RECORD = 'R';
+
+      /**
+       * BinaryLogger constructor will open theFilename provided and write the
+       * FILE_MAGIC text at the start of it.
+       * @param[in] theFilename to open as binary log file
+       * @param[in] theDefault flag meaning this should be the default logger
+       */
+      BinaryLogger(const char* theFilename, bool theDefault = false);
+
+      /**
+       * BinaryLogger deconstructor will write any pending message and close
+       * the log file.
+       */
+      virtual ~BinaryLogger();
+
+      /**
+       * GetStream is responsible for returning the ostream necessary to log the
+       * custom message that will follow without a prefix.
+       * @return the ostream to use for logging the message
+       */
+      virtual std::ostream& GetStream(void);
+
+      /**
+       * GetStream is responsible for returning the ostream necessary to log the
+       * custom message that will follow and prefix the custom message with an
+       * appropriate timestamp and File:Line tag.
+       * @param[in] theSeverity for this message to be logged
+       * @param[in] theSourceFile where the Log macro was called from
+       * @param[in] theSourceLine number where the Log macro was called from
+       * @param[in] theExitCode value to use when FatalShutdown is called
+       * @return the ostream to use for logging the message
+       */
+      virtual std::ostream& GetStream(SeverityType theSeverity,
+          const char* theSourceFile, int theSourceLine, int theExitCode = StatusError);
+
+      /**
+       * LogMessage is responsible for logging the message provided using an
+       * appropriate timestamp and File:Line tag in front.
+       * @param[in] theMessage to log
+       */
+      virtual void LogMessage(const char* theMessage);
+
+      /**
+       * LogMessage is responsible for logging the message provided using an
+       * appropriate timestamp and File:Line tag in front.
+       * @param[in] theSeverity for this message to be logged
+       * @param[in] theSourceFile where the Log macro was called from
+       * @param[in] theSourceLine number where the Log macro was called from
+       * @param[in] theMessage to log
+       */
+      virtual void LogMessage(SeverityType theSeverity,
+          const char* theSourceFile, int theSourceLine,
+          const char* theMessage);
+
+      /**
+       * LogArguments is responsible for writing the record of a message from
+       * theSite provided without formatting theArguments into text.
+       * @param[in] theSite the message was logged from (see RegisterSite)
+       * @param[in] theArguments recorded for the message
+       * @param[in] theLength of theArguments in bytes
+       */
+      virtual void LogArguments(Uint32 theSite, const char* theArguments,
+          Uint32 theLength);
+
+      /**
+       * Flush will write every message logged so far to the log file.
+       */
+      virtual void Flush(void);
+
+      /**
+       * Decode will read the binary log from theInput provided and write each
+       * message to theOutput provided in the same text format used by the
+       * FileLogger class.
+       * @param[in] theInput to read the binary log from
+       * @param[out] theOutput to write the text log to
+       * @return true if the whole binary log was decoded, false otherwise
+       */
+      static bool Decode(std::istream& theInput, std::ostream& theOutput);
+
+    private:
+      /// Provides the stream buffer that commits the text message on std::endl
+      class TextBuffer : public std::stringbuf
+      {
+        public:
+          /**
+           * TextBuffer constructor
+           * @param[in] theLogger to commit each text message to
+           */
+          TextBuffer(BinaryLogger& theLogger);
+
+        protected:
+          /**
+           * sync is called by std::endl and std::flush and will commit the
+           * text message written so far.
+           * @return 0 always
+           */
+          virtual int sync(void);
+
+        private:
+          /// The logger to commit each text message to
+          BinaryLogger& mLogger;
+      };
+
+      /// Declare the key of each text call site (file and line with severity)
+      typedef std::pair<const char*, Int32> typeTextKey;
+
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// Output Logger file
+      std::ofstream     mFileStream;
+      /// Mutex held while writing to the log file
+      sf::Mutex         mMutex;
+      /// True for each call site ID already written to the log file
+      std::vector<bool> mSiteWritten;
+      /// The call site registered for each text File:Line tag
+      std::map<typeTextKey, Uint32> mTextSites;
+      /// Buffer of the text message written to mTextStream
+      TextBuffer        mTextBuffer;
+      /// Stream returned by GetStream for text messages
+      std::ostream      mTextStream;
+      /// Call site of the text message pending in mTextBuffer
+      Uint32            mTextSite;
+
+      /**
+       * GetTextSite will return the call site used for text messages logged
+       * from theSourceFile and theSourceLine provided.
+       * @param[in] theSeverity for this message to be logged
+       * @param[in] theSourceFile where the Log macro was called from
+       * @param[in] theSourceLine number where the Log macro was called from
+       * @return the ID of the call site or 0 if none could be registered
+       */
+      Uint32 GetTextSite(SeverityType theSeverity, const char* theSourceFile,
+          int theSourceLine);
+
+      /**
+       * CommitText will write the text message pending in mTextBuffer (if
+       * any) to the log file.
+       */
+      void CommitText(void);
+
+      /**
+       * WriteText will write theLength characters of theText provided as a
+       * record of theSite provided. The caller must hold mMutex.
+       * @param[in] theSite the message was logged from
+       * @param[in] theText of the message
+       * @param[in] theLength of theText in characters
+       */
+      void WriteText(Uint32 theSite, const char* theText, std::size_t theLength);
+
+      /**
+       * WriteRecord will write the record header of theSite provided (and the
+       * site itself if not yet written). The caller must hold mMutex and
+       * write theLength bytes of arguments right after.
+       * @param[in] theSite the message was logged from
+       * @param[in] theLength of the arguments that follow in bytes
+       * @return true if the arguments should be written, false otherwise
+       */
+      bool WriteRecord(Uint32 theSite, Uint16 theLength);
+
+      /**
+       * Copy constructor is private because we do not allow copies of
+       * our Singleton class
+       */
+      BinaryLogger(const BinaryLogger&);             // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our Singleton class
+       */
+      BinaryLogger& operator=(const BinaryLogger&);  // Intentionally undefined
+  }; // class BinaryLogger
+} // namespace GQE
+
+#endif // CORE_BINARY_LOGGER_HPP_INCLUDED
+
+/**
+ * @class GQE::BinaryLogger
+ * @ingroup Core
+ * The BinaryLogger class writes a compact binary log file instead of text.
+ * The static information of each call site (severity, file, line and format)
+ * is written once, before the first message logged from it, and each message
+ * afterwards is a record holding only the site ID, the time in seconds and
+ * the raw argument bytes recorded by the LogRecord class (see ILOGB, WLOGB,
+ * ELOGB). No timestamp, tag or argument is formatted into text while the game
+ * is running, which keeps info level logging cheap enough to leave on. The
+ * text logging macros (ILOG, WLOG, etc) still work: a call site is registered
+ * for each File:Line tag and the text is written as a single string argument.
+ * The binary log is turned back into the text format of the FileLogger class
+ * by the Decode method (see the decode-log command of Time-Voyager-Tools).
+ * Binary logs are written in the native byte order and must be decoded on a
+ * machine of the same byte order.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -8,9 +8,13 @@
  * @date 20110610 - Initial Release
  * @date 20120426 - Change to ILogger::GetLogger call instead of gLogger
  * @date 20120504 - Fix segfault caused by SLOG taking over gInstance
+ * @date 20130809 - Flush the global logger before calling FatalShutdown
+ * @date 20130811 - Keep the Fatal message with the FlightRecorder
+ * @date 20130826 - Don't keep the Fatal message twice with the AsyncLogger
  */
 
 #include <TVSource/Loggers/FatalLogger.hpp>
+#include <TVSource/Managers/FlightRecorder.hpp>
 
 namespace GQE
 {
@@ -24,11 +28,23 @@ namespace GQE
 
   FatalLogger::~FatalLogger()
   {
+    // Keep the Fatal message (which already includes its tag) for the dump
+    // unless our global logger keeps it when LogMessage is called below
+    if(FlightRecorder::gRecording && (NULL == GQE::ILogger::GetLogger() ||
+      !GQE::ILogger::GetLogger()->IsRecordingText()))
+    {
+      FlightRecorder::AddText(SeverityFatal, NULL, 0, GetString().c_str(),
+        (Uint32)GetString().length());
+    }
+
     // Make sure our global logger is defined before using it
     if(GQE::ILogger::GetLogger())
     {
       // Log the Fatal message string stream created
       GQE::ILogger::GetLogger()->LogMessage(GetString().c_str());
+
+      // Make sure every message is written before the application exits
+      GQE::ILogger::GetLogger()->Flush();
     }
 
     // Call the FatalShutdown method defined in ILogger
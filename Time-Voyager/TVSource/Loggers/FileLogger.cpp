@@ -6,6 +6,7 @@
  * @author Ryan Lindeman
  * @date 20110524 - Initial Release
  * @date 20120504 - Fix segfault caused by SLOG taking over gInstance
+ * @date 20130809 - Added Flush
  */
 
 #include <TVSource/loggers/FileLogger.hpp>
@@ -72,6 +73,13 @@ namespace GQE
     }
   }
 
+  void FileLogger::Flush(void)
+  {
+    if(mFileStream.is_open())
+    {
+      mFileStream.flush();
+    }
+  }
 } // namespace GQE
 
 /**
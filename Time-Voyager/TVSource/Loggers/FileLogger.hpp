@@ -6,6 +6,7 @@
  * @author Ryan Lindeman
  * @date 20110524 - Initial Release
  * @date 20120504 - Fix segment fault caused by SLOG taking over gInstance
+ * @date 20130809 - Added Flush
  */
 #ifndef   CORE_FILE_LOGGER_HPP_INCLUDED
 #define   CORE_FILE_LOGGER_HPP_INCLUDED
@@ -73,6 +74,12 @@ namespace GQE
           const char* theSourceFile, int theSourceLine,
           const char* theMessage);
 
+      /**
+       * Flush is responsible for making sure every message logged so far has
+       * been written to the log file before returning.
+       */
+      virtual void Flush(void);
+
     protected:      
 
     private:
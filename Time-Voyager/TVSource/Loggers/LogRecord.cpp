@@ -0,0 +1,179 @@
+/**
+ * Provides the LogRecord class that records the arguments of a binary log
+ * message (see ILOGB, WLOGB, ELOGB) used throughout the GQE namespace and the
+ * GQE core library.
+ *
+ * @file src/GQE/Core/loggers/LogRecord.cpp
+ * @author Ryan Lindeman
+ * @date 20130810 - Initial Release
+ * @date 20130811 - Keep every record with the FlightRecorder
+ */
+
+#include <cstring>
+#include <TVSource/Loggers/LogRecord.hpp>
+#include <TVSource/Interfaces/ILogger.hpp>
+#include <TVSource/Managers/FlightRecorder.hpp>
+
+namespace GQE
+{
+  LogRecord::LogRecord(volatile Uint32& theSite, SeverityType theSeverity,
+      const char* theSourceFile, int theSourceLine, const char* theFormat) :
+    mSite(theSite),
+    mSeverity(theSeverity),
+    mSourceFile(theSourceFile),
+    mLength(0)
+  {
+    // Register the call site the first time it is used
+    if(0 == mSite)
+    {
+      mSite = ILogger::RegisterSite(theSeverity, theSourceFile, theSourceLine,
+        theFormat);
+      theSite = mSite;
+    }
+  }
+
+  LogRecord::~LogRecord()
+  {
+    // Keep every record with the FlightRecorder regardless of the log level
+    const typeLogSite* anSite = ILogger::GetSite(mSite);
+    if(FlightRecorder::gRecording && NULL != anSite)
+    {
+      FlightRecorder::AddLog(*anSite, mArguments, mLength);
+    }
+
+    // The macros also create records below the log level for the FlightRecorder
+    if(NULL != anSite && ILogger::IsEnabled(mSeverity, mSourceFile))
+    {
+      ILogger::GetLogger()->LogArguments(mSite, mArguments, mLength);
+    }
+  }
+
+  LogRecord& LogRecord::operator<<(Int32 theValue)
+  {
+    Append(LogArgumentInt32, &theValue, sizeof(theValue));
+    return *this;
+  }
+
+  LogRecord& LogRecord::operator<<(Uint32 theValue)
+  {
+    Append(LogArgumentUint32, &theValue, sizeof(theValue));
+    return *this;
+  }
+
+  LogRecord& LogRecord::operator<<(Int64 theValue)
+  {
+    Append(LogArgumentInt64, &theValue, sizeof(theValue));
+    return *this;
+  }
+
+  LogRecord& LogRecord::operator<<(Uint64 theValue)
+  {
+    Append(LogArgumentUint64, &theValue, sizeof(theValue));
+    return *this;
+  }
+
+#if defined(_MSC_VER)
+  LogRecord& LogRecord::operator<<(long theValue)
+  {
+    return *this << (Int32)theValue;
+  }
+
+  LogRecord& LogRecord::operator<<(unsigned long theValue)
+  {
+    return *this << (Uint32)theValue;
+  }
+#endif
+
+  LogRecord& LogRecord::operator<<(float theValue)
+  {
+    return *this << (double)theValue;
+  }
+
+  LogRecord& LogRecord::operator<<(double theValue)
+  {
+    Append(LogArgumentDouble, &theValue, sizeof(theValue));
+    return *this;
+  }
+
+  LogRecord& LogRecord::operator<<(bool theValue)
+  {
+    Uint8 anValue = theValue ? 1 : 0;
+    Append(LogArgumentBool, &anValue, sizeof(anValue));
+    return *this;
+  }
+
+  LogRecord& LogRecord::operator<<(char theValue)
+  {
+    Append(LogArgumentChar, &theValue, sizeof(theValue));
+    return *this;
+  }
+
+  LogRecord& LogRecord::operator<<(const char* theValue)
+  {
+    if(NULL != theValue)
+    {
+      AppendString(theValue, strlen(theValue));
+    }
+    else
+    {
+      AppendString("(null)", 6);
+    }
+    return *this;
+  }
+
+  LogRecord& LogRecord::operator<<(const std::string& theValue)
+  {
+    AppendString(theValue.data(), theValue.length());
+    return *this;
+  }
+
+  void LogRecord::Append(LogArgumentType theType, const void* theValue,
+      Uint32 theSize)
+  {
+    // Drop the argument if there isn't room for the type and its value
+    if(mLength + 1 + theSize <= MAX_ARGUMENTS)
+    {
+      mArguments[mLength++] = (char)theType;
+      memcpy(&mArguments[mLength], theValue, theSize);
+      mLength += theSize;
+    }
+  }
+
+  void LogRecord::AppendString(const char* theValue, std::size_t theLength)
+  {
+    // Make sure there is room for the type, length and at least 1 character
+    if(mLength + 1 + sizeof(Uint16) < MAX_ARGUMENTS)
+    {
+      // Truncate theValue to the room left
+      Uint32 anRoom = MAX_ARGUMENTS - mLength - 1 - sizeof(Uint16);
+      Uint16 anLength = (Uint16)(theLength < anRoom ? theLength : anRoom);
+
+      mArguments[mLength++] = (char)LogArgumentString;
+      memcpy(&mArguments[mLength], &anLength, sizeof(anLength));
+      mLength += sizeof(anLength);
+      memcpy(&mArguments[mLength], theValue, anLength);
+      mLength += anLength;
+    }
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
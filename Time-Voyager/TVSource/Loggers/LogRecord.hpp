@@ -0,0 +1,150 @@
+/**
+ * Provides the LogRecord class that records the arguments of a binary log
+ * message (see ILOGB, WLOGB, ELOGB) used throughout the GQE namespace and the
+ * GQE core library.
+ *
+ * @file include/GQE/Core/loggers/LogRecord.hpp
+ * @author Ryan Lindeman
+ * @date 20130810 - Initial Release
+ * @date 20130811 - Keep every record with the FlightRecorder
+ */
+#ifndef   CORE_LOG_RECORD_HPP_INCLUDED
+#define   CORE_LOG_RECORD_HPP_INCLUDED
+
+#include <string>
+#include <TVSource/Core/Core_types.hpp>
+
+namespace GQE
+{
+  /// Provides the class used by the binary logging macros
+  class GQE_API LogRecord
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Maximum number of bytes of arguments recorded (more are dropped)
+      static const Uint32 MAX_ARGUMENTS = 256;
+
+      /**
+       * LogRecord constructor will register the call site the first time it
+       * is used and start recording the arguments that follow.
+       * @param[in,out] theSite ID of the call site (0 until registered)
+       * @param[in] theSeverity for this message to be logged
+       * @param[in] theSourceFile where the Log macro was called from
+       * @param[in] theSourceLine number where the Log macro was called from
+       * @param[in] theFormat of the message with {} for each argument
+       */
+      LogRecord(volatile Uint32& theSite, SeverityType theSeverity,
+          const char* theSourceFile, int theSourceLine, const char* theFormat);
+
+      /**
+       * LogRecord deconstructor will log the arguments recorded to the global
+       * logger (see ILogger::LogArguments) and keep them with the
+       * FlightRecorder if it is recording.
+       */
+      ~LogRecord();
+
+      /**
+       * The operator<< methods record theValue provided as the next argument
+       * of the message.
+       * @param[in] theValue to record
+       * @return this LogRecord so more arguments can follow
+       */
+      LogRecord& operator<<(Int32 theValue);
+      LogRecord& operator<<(Uint32 theValue);
+      LogRecord& operator<<(Int64 theValue);
+      LogRecord& operator<<(Uint64 theValue);
+#if defined(_MSC_VER)
+      LogRecord& operator<<(long theValue);
+      LogRecord& operator<<(unsigned long theValue);
+#endif
+      LogRecord& operator<<(float theValue);
+      LogRecord& operator<<(double theValue);
+      LogRecord& operator<<(bool theValue);
+      LogRecord& operator<<(char theValue);
+      LogRecord& operator<<(const char* theValue);
+      LogRecord& operator<<(const std::string& theValue);
+
+    private:
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// The ID of the call site this message was logged from
+      Uint32       mSite;
+      /// Severity of the message
+      SeverityType mSeverity;
+      /// Source file the message was logged from
+      const char*  mSourceFile;
+      /// The arguments recorded so far
+      char         mArguments[MAX_ARGUMENTS];
+      /// Number of bytes used in mArguments
+      Uint32       mLength;
+
+      /**
+       * Append will record theType and theSize bytes of theValue provided as
+       * the next argument if there is room left for them.
+       * @param[in] theType of the argument (see LogArgumentType)
+       * @param[in] theValue to record
+       * @param[in] theSize of theValue in bytes
+       */
+      void Append(LogArgumentType theType, const void* theValue, Uint32 theSize);
+
+      /**
+       * AppendString will record theLength characters of theValue provided as
+       * the next argument, truncating them if there isn't room for them all.
+       * @param[in] theValue to record
+       * @param[in] theLength of theValue in characters
+       */
+      void AppendString(const char* theValue, std::size_t theLength);
+
+      /**
+       * Copy constructor is private because we do not allow copies of
+       * our LogRecord class
+       */
+      LogRecord(const LogRecord&);             // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our LogRecord class
+       */
+      LogRecord& operator=(const LogRecord&);  // Intentionally undefined
+  }; // class LogRecord
+} // namespace GQE
+
+#endif // CORE_LOG_RECORD_HPP_INCLUDED
+
+/**
+ * @class GQE::LogRecord
+ * @ingroup Core
+ * The LogRecord class is created by the binary logging macros (see ILOGB,
+ * WLOGB, ELOGB) for each message logged. The static information of the call
+ * site (severity, file, line and format) is registered only once and each
+ * message afterwards records just the site ID and the raw bytes of each
+ * argument (a type byte followed by the value in native byte order). Strings
+ * are copied with a 16 bit length and are truncated if the arguments would
+ * exceed MAX_ARGUMENTS. The record is handed to the global logger when the
+ * LogRecord goes out of scope at the end of the statement. Loggers such as
+ * the BinaryLogger class write the record as is, all other loggers format
+ * the arguments into text using the {} placeholders of the format. While the
+ * FlightRecorder is recording the macros create a LogRecord at every severity
+ * and the record is kept by the FlightRecorder even if its severity is below
+ * the runtime log level.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -6,13 +6,20 @@
  * @author Ryan Lindeman
  * @date 20110610 - Initial Release
  * @date 20120426 - Change to ILogger::GetLogger call instead of gLogger
+ * @date 20130810 - Check the runtime log level before evaluating arguments
+ * @date 20130810 - Added WLOG_EVERY_N and WLOG_ONCE macros
+ * @date 20130810 - Added ILOGB, WLOGB and ELOGB binary log macros
+ * @date 20130811 - Record binary log messages for the FlightRecorder
  */
 #ifndef   GQE_LOG_MACROS_HPP_INCLUDED
 #define   GQE_LOG_MACROS_HPP_INCLUDED
 
 #include <TVSource/Core/Core_types.hpp>
 #include <TVSource/Loggers/FatalLogger.hpp>
+#include <TVSource/Loggers/LogRecord.hpp>
 #include <TVSource/Loggers/ScopeLogger.hpp>
+#include <TVSource/Managers/FlightRecorder.hpp>
+#include <TVSource/Utils/AtomicUtil.hpp>
 
 /**
  * Define GQE_STRIP_LOG to the minimum log level you wish to include when
@@ -26,6 +33,10 @@
 /////////////////////////////////////////////////////////////////////////////
 // Logger Macros
 /////////////////////////////////////////////////////////////////////////////
+/// Helper macros used to create a unique variable name per line
+#define GQE_LOG_CONCAT_(theLeft, theRight) theLeft##theRight
+#define GQE_LOG_CONCAT(theLeft, theRight) GQE_LOG_CONCAT_(theLeft, theRight)
+
 /**
  * LOG_ON macro will enable all logging facilities for the severity level
  * that is compiled into the code (see GQE_STRIP_LOG)
@@ -64,7 +75,7 @@
  */
 #define ILOGM(theMessage) \
   do { \
-    if(GQE::ILogger::GetLogger()) { \
+    if(GQE::ILogger::IsEnabled(GQE::SeverityInfo, __FILE__)) { \
       GQE::ILogger::GetLogger()->LogMessage(GQE::SeverityInfo, __FILE__, __LINE__, \
           theMessage); \
     } \
@@ -74,7 +85,7 @@
  * at the GQE::SeverityInfo level to the global Logger (see GQE::gLogger).
  */
 #define ILOG() \
-  if(!GQE::ILogger::GetLogger()) { \
+  if(!GQE::ILogger::IsEnabled(GQE::SeverityInfo, __FILE__)) { \
     /* Empty */ \
   } else \
     GQE::ILogger::GetLogger()->GetStream(GQE::SeverityInfo, __FILE__, __LINE__)
@@ -95,6 +106,25 @@
  */
 #define ILOG_IF(theCondition) \
   !(theCondition) ? (void) 0 : ILOG()
+/**
+ * ILOGB macro defines a simple macro that will record any << following the
+ * macro as the arguments of theFormat provided (with {} for each argument) at
+ * the GQE::SeverityInfo level to the global Logger (see GQE::gLogger). The
+ * call site is registered once and each message only records its arguments
+ * (see GQE::LogRecord). Messages below the log level are still recorded
+ * while the FlightRecorder is recording. This macro declares a call site
+ * variable so it can't be used as the only statement of an if/else without
+ * braces.
+ * @param[in] theFormat of the message as a string literal
+ */
+#define ILOGB(theFormat) \
+  static volatile GQE::Uint32 GQE_LOG_CONCAT(_gqlb_, __LINE__) = 0; \
+  if(!GQE::ILogger::IsEnabled(GQE::SeverityInfo, __FILE__) && \
+    !GQE::FlightRecorder::gRecording) { \
+    /* Empty */ \
+  } else \
+    GQE::LogRecord(GQE_LOG_CONCAT(_gqlb_, __LINE__), GQE::SeverityInfo, \
+      __FILE__, __LINE__, theFormat)
 #else
 #define ILOGM(theMessage) do {} while(false)
 #define ILOG() if(true) { /* Empty */ } else GQE::ILogger::gNullStream
@@ -102,6 +132,7 @@
   !(theCondition) ? (void) 0 : ILOGM(theMessage)
 #define ILOG_IF(condition) \
   !(theCondition) ? (void) 0 : ILOG()
+#define ILOGB(theFormat) if(true) { /* Empty */ } else GQE::ILogger::gNullStream
 #endif
 
 #if GQE_STRIP_LOG <= WARN_LEVEL
@@ -112,7 +143,7 @@
  */
 #define WLOGM(theMessage) \
   do { \
-    if(GQE::ILogger::GetLogger()) { \
+    if(GQE::ILogger::IsEnabled(GQE::SeverityWarning, __FILE__)) { \
       GQE::ILogger::GetLogger()->LogMessage(GQE::SeverityWarning, __FILE__, __LINE__, \
           theMessage); \
     } \
@@ -123,7 +154,7 @@
  * at the GQE::SeverityWarn level to the global Logger (see GQE::gLogger).
  */
 #define WLOG() \
-  if(!GQE::ILogger::GetLogger()) { \
+  if(!GQE::ILogger::IsEnabled(GQE::SeverityWarning, __FILE__)) { \
     /* Empty */ \
   } else \
     GQE::ILogger::GetLogger()->GetStream(GQE::SeverityWarning, __FILE__, __LINE__)
@@ -147,6 +178,56 @@
 #define WLOG_IF(theCondition) \
   !(theCondition) ? (void) 0 : WLOG()
 
+/**
+ * WLOG_EVERY_N macro defines a simple macro that will log any << following
+ * this macro only the first time and then once every theCount times it is
+ * reached at the GQE::SeverityWarn level to the global Logger (see
+ * GQE::gLogger). This macro declares a counter variable so it can't be used
+ * as the only statement of an if/else without braces.
+ * @param[in] theCount of times this macro is reached per message logged
+ */
+#define WLOG_EVERY_N(theCount) \
+  static volatile GQE::Uint32 GQE_LOG_CONCAT(_gqln_, __LINE__) = 0; \
+  if(!GQE::ILogger::IsEnabled(GQE::SeverityWarning, __FILE__) || \
+    (GQE::AtomicIncrement(GQE_LOG_CONCAT(_gqln_, __LINE__)) - 1) % (theCount) != 0) { \
+    /* Empty */ \
+  } else \
+    GQE::ILogger::GetLogger()->GetStream(GQE::SeverityWarning, __FILE__, __LINE__)
+
+/**
+ * WLOG_ONCE macro defines a simple macro that will log any << following this
+ * macro only the first time it is reached at the GQE::SeverityWarn level to
+ * the global Logger (see GQE::gLogger). This macro declares a flag variable
+ * so it can't be used as the only statement of an if/else without braces.
+ */
+#define WLOG_ONCE() \
+  static volatile GQE::Uint32 GQE_LOG_CONCAT(_gqlo_, __LINE__) = 0; \
+  if(!GQE::ILogger::IsEnabled(GQE::SeverityWarning, __FILE__) || \
+    GQE::AtomicCompareExchange(GQE_LOG_CONCAT(_gqlo_, __LINE__), 1, 0) != 0) { \
+    /* Empty */ \
+  } else \
+    GQE::ILogger::GetLogger()->GetStream(GQE::SeverityWarning, __FILE__, __LINE__)
+
+/**
+ * WLOGB macro defines a simple macro that will record any << following the
+ * macro as the arguments of theFormat provided (with {} for each argument) at
+ * the GQE::SeverityWarn level to the global Logger (see GQE::gLogger). The
+ * call site is registered once and each message only records its arguments
+ * (see GQE::LogRecord). Messages below the log level are still recorded
+ * while the FlightRecorder is recording. This macro declares a call site
+ * variable so it can't be used as the only statement of an if/else without
+ * braces.
+ * @param[in] theFormat of the message as a string literal
+ */
+#define WLOGB(theFormat) \
+  static volatile GQE::Uint32 GQE_LOG_CONCAT(_gqlb_, __LINE__) = 0; \
+  if(!GQE::ILogger::IsEnabled(GQE::SeverityWarning, __FILE__) && \
+    !GQE::FlightRecorder::gRecording) { \
+    /* Empty */ \
+  } else \
+    GQE::LogRecord(GQE_LOG_CONCAT(_gqlb_, __LINE__), GQE::SeverityWarning, \
+      __FILE__, __LINE__, theFormat)
+
 #else
 #define WLOGM(theMessage) do {} while(false)
 #define WLOG() if(true) { /* Empty */ } else GQE::ILogger::gNullStream
@@ -154,6 +235,9 @@
   !(theCondition) ? (void) 0 : WLOGM(theMessage)
 #define WLOG_IF(condition) \
   !(theCondition) ? (void) 0 : WLOG()
+#define WLOG_EVERY_N(theCount) if(true) { /* Empty */ } else GQE::ILogger::gNullStream
+#define WLOG_ONCE() if(true) { /* Empty */ } else GQE::ILogger::gNullStream
+#define WLOGB(theFormat) if(true) { /* Empty */ } else GQE::ILogger::gNullStream
 #endif
 
 #if GQE_STRIP_LOG <= ERROR_LEVEL
@@ -164,7 +248,7 @@
  */
 #define ELOGM(theMessage) \
   do { \
-    if(GQE::ILogger::GetLogger()) { \
+    if(GQE::ILogger::IsEnabled(GQE::SeverityError, __FILE__)) { \
       GQE::ILogger::GetLogger()->LogMessage(GQE::SeverityError, __FILE__, __LINE__, \
           theMessage); \
     } \
@@ -175,7 +259,7 @@
  * at the GQE::SeverityError level to the global Logger (see GQE::gLogger).
  */
 #define ELOG() \
-  if(!GQE::ILogger::GetLogger()) { \
+  if(!GQE::ILogger::IsEnabled(GQE::SeverityError, __FILE__)) { \
     /* Empty */ \
   } else \
     GQE::ILogger::GetLogger()->GetStream(GQE::SeverityError, __FILE__, __LINE__)
@@ -199,6 +283,26 @@
 #define ELOG_IF(theCondition) \
   !(theCondition) ? (void) 0 : ELOG()
 
+/**
+ * ELOGB macro defines a simple macro that will record any << following the
+ * macro as the arguments of theFormat provided (with {} for each argument) at
+ * the GQE::SeverityError level to the global Logger (see GQE::gLogger). The
+ * call site is registered once and each message only records its arguments
+ * (see GQE::LogRecord). Messages below the log level are still recorded
+ * while the FlightRecorder is recording. This macro declares a call site
+ * variable so it can't be used as the only statement of an if/else without
+ * braces.
+ * @param[in] theFormat of the message as a string literal
+ */
+#define ELOGB(theFormat) \
+  static volatile GQE::Uint32 GQE_LOG_CONCAT(_gqlb_, __LINE__) = 0; \
+  if(!GQE::ILogger::IsEnabled(GQE::SeverityError, __FILE__) && \
+    !GQE::FlightRecorder::gRecording) { \
+    /* Empty */ \
+  } else \
+    GQE::LogRecord(GQE_LOG_CONCAT(_gqlb_, __LINE__), GQE::SeverityError, \
+      __FILE__, __LINE__, theFormat)
+
 #else
 #define ELOGM(theMessage) do {} while(false)
 #define ELOG() if(true) { /* Empty */ } else GQE::ILogger::gNullStream
@@ -206,6 +310,7 @@
   !(theCondition) ? (void) 0 : ELOGM(theMessage)
 #define ELOG_IF(condition) \
   !(theCondition) ? (void) 0 : ELOG()
+#define ELOGB(theFormat) if(true) { /* Empty */ } else GQE::ILogger::gNullStream
 #endif
 
 #if GQE_STRIP_LOG <= FATAL_LEVEL
@@ -325,7 +430,7 @@
  * @param[in] theSeverity to use when logging Entry and Exit of scope
  */
 #define SLOGR(theScopeName, theSeverity) \
-  if(!GQE::ILogger::GetLogger()) { \
+  if(!GQE::ILogger::IsEnabled(theSeverity, __FILE__)) { \
     /* Empty */ \
   } else \
     _gql_##theScopeName.GetStream(theSeverity, __FILE__, __LINE__)
@@ -347,7 +452,7 @@
  * @param[in] theExitCode value to use when exiting the application
  */
 #define SLOGRE(theScopeName, theSeverity, theExitCode) \
-  if(!GQE::ILogger::GetLogger()) { \
+  if(!GQE::ILogger::IsEnabled(theSeverity, __FILE__)) { \
     /* Empty */ \
   } else \
     _gql_##theScopeName.GetStream(theSeverity, __FILE__, __LINE__, theExitCode)
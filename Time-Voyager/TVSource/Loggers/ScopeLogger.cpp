@@ -10,6 +10,7 @@
  * @date 20120426 - Change to ILogger::GetLogger call instead of gLogger
  * @date 20120504 - Fix segfault caused by SLOG taking over gInstance
  * @date 20120504 - Fix segfault caused by SLOG taking over gInstance
+ * @date 20130810 - Skip the Entry and Exit messages below the log level
  */
 
 #include <TVSource/Loggers/ScopeLogger.hpp>
@@ -25,8 +26,8 @@ namespace GQE
     mSourceLine(theSourceLine),
     mScopeName(theScopeName)
   {
-    // Make sure our global logger is defined before using it
-    if(GQE::ILogger::GetLogger())
+    // Make sure our global logger is defined and theSeverity is logged
+    if(GQE::ILogger::IsEnabled(theSeverity, theSourceFile))
     {
       // Log the scope Entry with theScopeName provided to the
       // global logger (see GQE::gLogger).
@@ -37,8 +38,8 @@ namespace GQE
 
   ScopeLogger::~ScopeLogger()
   {
-    // Make sure our global logger is defined before using it
-    if(GQE::ILogger::GetLogger())
+    // Make sure our global logger is defined and mSeverity is logged
+    if(GQE::ILogger::IsEnabled(mSeverity, mSourceFile))
     {
       // Log the scope Exit with mScopeName provided at construction time to
       // the global logger (see GQE::gLogger).
@@ -55,8 +56,8 @@ namespace GQE
 
   std::ostream& ScopeLogger::GetStream(void)
   {
-    // Make sure our global logger is defined before using it
-    if(GQE::ILogger::GetLogger())
+    // Make sure our global logger is defined and our Entry was logged
+    if(GQE::ILogger::IsEnabled(mSeverity, mSourceFile))
     {
       // Just return whatever the global logger returns for GetStream()
       return GQE::ILogger::GetLogger()->GetStream();
@@ -0,0 +1,75 @@
+/**
+ * Provides the AssetLoadHandle class in the GQE namespace which is returned
+ * by AssetManager::LoadAssetAsync to follow an asset being loaded in the
+ * background.
+ *
+ * @file src/GQE/Core/classes/AssetLoadHandle.cpp
+ * @author Ryan Lindeman
+ * @date 20130815 - Initial Release
+ */
+
+#include <TVSource/Interfaces/IAssetHandler.hpp>
+#include <TVSource/Managers/AssetLoader.hpp>
+#include <TVSource/Managers/AssetLoadHandle.hpp>
+
+namespace GQE
+{
+  AssetLoadHandle::AssetLoadHandle(AssetLoader& theAssetLoader,
+    IAssetHandler& theAssetHandler, const typeAssetID theAssetID) :
+    mAssetLoader(&theAssetLoader),
+    mAssetHandler(&theAssetHandler),
+    mAssetID(theAssetID)
+  {
+  }
+
+  const typeAssetID AssetLoadHandle::GetID(void) const
+  {
+    return mAssetID;
+  }
+
+  AssetLoadState AssetLoadHandle::GetState(void) const
+  {
+    return mAssetHandler->GetLoadState(mAssetID);
+  }
+
+  bool AssetLoadHandle::IsReady(void) const
+  {
+    return AssetLoadReady == GetState();
+  }
+
+  bool AssetLoadHandle::IsDone(void) const
+  {
+    // Retrieve the loading state once
+    AssetLoadState anState = GetState();
+
+    // Return true if the asset is no longer queued, decoding or decoded
+    return AssetLoadQueued != anState && AssetLoadDecoding != anState &&
+      AssetLoadDecoded != anState;
+  }
+
+  bool AssetLoadHandle::Wait(void)
+  {
+    return mAssetLoader->Wait(*mAssetHandler, mAssetID);
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
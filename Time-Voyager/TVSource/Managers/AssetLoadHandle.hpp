@@ -0,0 +1,102 @@
+/**
+ * Provides the AssetLoadHandle class in the GQE namespace which is returned
+ * by AssetManager::LoadAssetAsync to follow an asset being loaded in the
+ * background.
+ *
+ * @file include/GQE/Core/classes/AssetLoadHandle.hpp
+ * @author Ryan Lindeman
+ * @date 20130815 - Initial Release
+ */
+#ifndef   CORE_ASSET_LOAD_HANDLE_HPP_INCLUDED
+#define   CORE_ASSET_LOAD_HANDLE_HPP_INCLUDED
+
+#include <TVSource/Core/Core_types.hpp>
+
+namespace GQE
+{
+  /// Provides a handle to an asset being loaded by the AssetLoader
+  class GQE_API AssetLoadHandle
+  {
+    public:
+      /**
+       * AssetLoadHandle constructor
+       * @param[in] theAssetLoader that is loading the asset
+       * @param[in] theAssetHandler that manages the asset
+       * @param[in] theAssetID of the asset being loaded
+       */
+      AssetLoadHandle(AssetLoader& theAssetLoader,
+        IAssetHandler& theAssetHandler, const typeAssetID theAssetID);
+
+      /**
+       * GetID will return the ID of the asset being loaded.
+       * @return the Asset ID being loaded
+       */
+      const typeAssetID GetID(void) const;
+
+      /**
+       * GetState will return the current loading state of the asset.
+       * @return the loading state (Queued, Decoding, Ready, Failed, etc)
+       */
+      AssetLoadState GetState(void) const;
+
+      /**
+       * IsReady will return true once the asset has been loaded.
+       * @return true if loaded, false otherwise
+       */
+      bool IsReady(void) const;
+
+      /**
+       * IsDone will return true once the asset is no longer being loaded,
+       * whether or not the load was successful.
+       * @return true if the asset is no longer being loaded
+       */
+      bool IsDone(void) const;
+
+      /**
+       * Wait will block the calling (main) thread until the asset is no
+       * longer being loaded.
+       * @return true if the asset was loaded, false otherwise
+       */
+      bool Wait(void);
+
+    private:
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// The AssetLoader loading the asset
+      AssetLoader*   mAssetLoader;
+      /// The IAssetHandler that manages the asset
+      IAssetHandler* mAssetHandler;
+      /// The ID of the asset being loaded
+      typeAssetID    mAssetID;
+  }; // class AssetLoadHandle
+} // namespace GQE
+
+#endif // CORE_ASSET_LOAD_HANDLE_HPP_INCLUDED
+
+/**
+ * @class GQE::AssetLoadHandle
+ * @ingroup Core
+ * The AssetLoadHandle class is a small copyable handle (similar to a future)
+ * that can be kept by whoever asked for an asset to be loaded in the
+ * background so they can poll for or wait on the result. The handle does
+ * not hold a reference to the asset itself, use TAsset for that.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,357 @@
+/**
+ * Provides the AssetLoader class in the GQE namespace which is responsible
+ * for loading assets on a pool of worker threads and finishing each load on
+ * the main thread within a per frame time budget.
+ *
+ * @file src/GQE/Core/classes/AssetLoader.cpp
+ * @author Ryan Lindeman
+ * @date 20130815 - Initial Release
+ * @date 20130826 - Prefetch the network assets queued together
+ */
+
+#include <new>
+#include <string>
+#include <vector>
+#include <TVSource/Interfaces/IAssetHandler.hpp>
+#include <TVSource/Loggers/Log_macros.hpp>
+#include <TVSource/Managers/AssetLoader.hpp>
+#include <TVSource/Managers/Profile_macros.hpp>
+#include <TVSource/Utils/NetworkSource.hpp>
+
+namespace GQE
+{
+  AssetLoader::AssetLoader() :
+    mNetworkSource(NULL),
+    mWorkerCount(DEFAULT_WORKERS),
+    mRunning(false),
+    mDecoding(0),
+    mUploadBudget(DEFAULT_UPLOAD_BUDGET)
+  {
+    ILOGM("AssetLoader::ctor()");
+
+    for(Uint32 iloop = 0; iloop < MAX_WORKERS; iloop++)
+    {
+      mWorkers[iloop] = NULL;
+    }
+  }
+
+  AssetLoader::~AssetLoader()
+  {
+    ILOGM("AssetLoader::dtor()");
+
+    // Make sure the worker threads are stopped
+    Stop();
+  }
+
+  Uint32 AssetLoader::GetWorkerCount(void) const
+  {
+    return mWorkerCount;
+  }
+
+  void AssetLoader::SetWorkerCount(const Uint32 theCount)
+  {
+    // Validate the worker count range first
+    if(1 <= theCount && MAX_WORKERS >= theCount)
+    {
+      mWorkerCount = theCount;
+    }
+    else
+    {
+      WLOG() << "AssetLoader::SetWorkerCount(" << theCount
+        << ") Worker count out of range!" << std::endl;
+    }
+  }
+
+  Uint32 AssetLoader::GetUploadBudget(void) const
+  {
+    return mUploadBudget;
+  }
+
+  void AssetLoader::SetUploadBudget(const Uint32 theBudget)
+  {
+    mUploadBudget = theBudget;
+  }
+
+  Uint32 AssetLoader::GetPendingCount(void) const
+  {
+    // Obtain a lock so the queues don't change while we count them
+    sf::Lock anLock(mMutex);
+
+    // Return the number of assets in each stage of loading
+    return (Uint32)(mQueued.size() + mDecoded.size()) + mDecoding;
+  }
+
+  void AssetLoader::AddAsset(IAssetHandler& theAssetHandler,
+    const typeAssetID theAssetID)
+  {
+    // Start the worker threads on the first asset queued
+    Start();
+
+    typeAssetJob anJob;
+    anJob.handler = &theAssetHandler;
+    anJob.assetID = theAssetID;
+
+    // Obtain a lock before adding the asset to the queue
+    sf::Lock anLock(mMutex);
+    mQueued.push_back(anJob);
+  }
+
+  Uint32 AssetLoader::Update(void)
+  {
+    // The number of assets finished so far
+    Uint32 anResult = 0;
+
+    // Clock used to limit the time spent to our upload budget
+    sf::Clock anClock;
+
+    // Finish at least one asset and then more until the budget is spent
+    bool anFound = true;
+    while(anFound && (0 == anResult ||
+      anClock.getElapsedTime().asMicroseconds() < (sf::Int64)mUploadBudget))
+    {
+      typeAssetJob anJob;
+      {
+        // Obtain a lock only while we remove the next decoded asset
+        sf::Lock anLock(mMutex);
+        anFound = !mDecoded.empty();
+        if(anFound)
+        {
+          anJob = mDecoded.front();
+          mDecoded.pop_front();
+        }
+      }
+
+      // Finish this asset on the main thread
+      if(anFound)
+      {
+        anJob.handler->CompleteAsset(anJob.assetID);
+        anResult++;
+      }
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  bool AssetLoader::Wait(IAssetHandler& theAssetHandler,
+    const typeAssetID theAssetID)
+  {
+    // Keep going until the asset is no longer being loaded
+    AssetLoadState anState = theAssetHandler.GetLoadState(theAssetID);
+    while(AssetLoadQueued == anState || AssetLoadDecoding == anState ||
+      AssetLoadDecoded == anState)
+    {
+      // Was the asset waiting for us in one of our queues?
+      bool anQueued = false;
+      bool anDecoded = false;
+      {
+        sf::Lock anLock(mMutex);
+        anQueued = Take(mQueued, theAssetHandler, theAssetID);
+        anDecoded = !anQueued && Take(mDecoded, theAssetHandler, theAssetID);
+      }
+
+      if(anQueued)
+      {
+        // No worker has started on it yet, decode it ourselves
+        theAssetHandler.DecodeAsset(theAssetID);
+        theAssetHandler.CompleteAsset(theAssetID);
+      }
+      else if(anDecoded)
+      {
+        theAssetHandler.CompleteAsset(theAssetID);
+      }
+      else
+      {
+        // A worker is decoding it, give the worker a chance to finish
+        sf::sleep(sf::milliseconds(WAIT_INTERVAL));
+      }
+
+      // Retrieve the loading state again
+      anState = theAssetHandler.GetLoadState(theAssetID);
+    }
+
+    // Return true if the asset is now loaded
+    return AssetLoadReady == anState;
+  }
+
+  void AssetLoader::SetNetworkSource(NetworkSource* theNetworkSource)
+  {
+    mNetworkSource = theNetworkSource;
+  }
+
+  void AssetLoader::Stop(void)
+  {
+    if(mRunning)
+    {
+      // Signal each worker thread to stop and wait for each one
+      mRunning = false;
+      for(Uint32 iloop = 0; iloop < MAX_WORKERS; iloop++)
+      {
+        if(NULL != mWorkers[iloop])
+        {
+          mWorkers[iloop]->wait();
+          delete mWorkers[iloop];
+          mWorkers[iloop] = NULL;
+        }
+      }
+    }
+
+    // Cancel every asset that was never finished
+    while(!mQueued.empty())
+    {
+      mQueued.front().handler->CancelAsset(mQueued.front().assetID);
+      mQueued.pop_front();
+    }
+    while(!mDecoded.empty())
+    {
+      mDecoded.front().handler->CancelAsset(mDecoded.front().assetID);
+      mDecoded.pop_front();
+    }
+  }
+
+  void AssetLoader::Start(void)
+  {
+    if(false == mRunning)
+    {
+      ILOG() << "AssetLoader::Start() Starting " << mWorkerCount
+        << " worker threads" << std::endl;
+
+      mRunning = true;
+      for(Uint32 iloop = 0; iloop < mWorkerCount; iloop++)
+      {
+        mWorkers[iloop] = new(std::nothrow) sf::Thread(&AssetLoader::Run, this);
+        if(NULL != mWorkers[iloop])
+        {
+          mWorkers[iloop]->launch();
+        }
+        else
+        {
+          ELOG() << "AssetLoader::Start() Unable to create worker thread "
+            << iloop << "!" << std::endl;
+        }
+      }
+    }
+  }
+
+  void AssetLoader::Run(void)
+  {
+    PROFILE_THREAD("AssetLoader");
+
+    while(mRunning)
+    {
+      typeAssetJob anJob;
+      bool anFound = false;
+      {
+        // Obtain a lock only while we remove the next queued asset
+        sf::Lock anLock(mMutex);
+        anFound = !mQueued.empty();
+        if(anFound)
+        {
+          anJob = mQueued.front();
+          mQueued.pop_front();
+          mDecoding++;
+        }
+      }
+
+      if(anFound)
+      {
+        // Fetch this asset together with the other network assets queued
+        PrefetchNetwork(anJob);
+
+        // Decode the asset without holding our lock
+        anJob.handler->DecodeAsset(anJob.assetID);
+
+        // Hand the asset to the main thread to be finished
+        sf::Lock anLock(mMutex);
+        mDecoding--;
+        mDecoded.push_back(anJob);
+      }
+      else
+      {
+        // Nothing to do, wait a little while before looking again
+        sf::sleep(sf::milliseconds(WAIT_INTERVAL));
+      }
+    }
+  }
+
+  void AssetLoader::PrefetchNetwork(const typeAssetJob& theJob)
+  {
+    if(NULL != mNetworkSource && mNetworkSource->IsEnabled() &&
+      AssetLoadFromNetwork == theJob.handler->GetLoadStyle(theJob.assetID))
+    {
+      // Copy the queued assets so each handler is asked without our lock
+      std::vector<typeAssetJob> anQueued;
+      {
+        sf::Lock anLock(mMutex);
+        size_t anCount = mQueued.size() < MAX_PREFETCH - 1 ?
+          mQueued.size() : MAX_PREFETCH - 1;
+        anQueued.assign(mQueued.begin(), mQueued.begin() + anCount);
+      }
+
+      // Gather the filename of this asset and each queued network asset
+      std::vector<std::string> anFilenames;
+      anFilenames.push_back(theJob.handler->GetFilename(theJob.assetID));
+      for(size_t iloop = 0; iloop < anQueued.size(); iloop++)
+      {
+        if(AssetLoadFromNetwork ==
+          anQueued[iloop].handler->GetLoadStyle(anQueued[iloop].assetID))
+        {
+          anFilenames.push_back(
+            anQueued[iloop].handler->GetFilename(anQueued[iloop].assetID));
+        }
+      }
+
+      // A single asset is simply fetched by the handler itself
+      if(1 < anFilenames.size())
+      {
+        mNetworkSource->Prefetch(anFilenames);
+      }
+    }
+  }
+
+  bool AssetLoader::Take(std::deque<typeAssetJob>& theQueue,
+    const IAssetHandler& theAssetHandler, const typeAssetID& theAssetID)
+  {
+    // Result if the asset was not found
+    bool anResult = false;
+
+    // Iterator used to find the asset in theQueue provided
+    std::deque<typeAssetJob>::iterator iter = theQueue.begin();
+    while(iter != theQueue.end() && false == anResult)
+    {
+      if(iter->handler == &theAssetHandler && iter->assetID == theAssetID)
+      {
+        iter = theQueue.erase(iter);
+        anResult = true;
+      }
+      else
+      {
+        iter++;
+      }
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,226 @@
+/**
+ * Provides the AssetLoader class in the GQE namespace which is responsible
+ * for loading assets on a pool of worker threads and finishing each load on
+ * the main thread within a per frame time budget.
+ *
+ * @file include/GQE/Core/classes/AssetLoader.hpp
+ * @author Ryan Lindeman
+ * @date 20130815 - Initial Release
+ * @date 20130826 - Prefetch the network assets queued together
+ */
+#ifndef   CORE_ASSET_LOADER_HPP_INCLUDED
+#define   CORE_ASSET_LOADER_HPP_INCLUDED
+
+#include <deque>
+#include <SFML/System.hpp>
+#include <TVSource/Core/Core_types.hpp>
+
+namespace GQE
+{
+  /// Provides the worker thread pool used to load assets in the background
+  class GQE_API AssetLoader
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Default number of worker threads started
+      static const Uint32 DEFAULT_WORKERS = 2;
+      /// Maximum number of worker threads that can be started
+      static const Uint32 MAX_WORKERS = 8;
+      /// Default time in microseconds spent finishing loads each frame
+      static const Uint32 DEFAULT_UPLOAD_BUDGET = 2000;
+      /// Time in milliseconds each worker sleeps when the queue is empty
+      static const Int32 WAIT_INTERVAL = 2;
+      /// Maximum number of network assets fetched together by a worker thread
+      static const Uint32 MAX_PREFETCH = 32;
+
+      /**
+       * AssetLoader constructor, no worker threads are started until the
+       * first asset is queued.
+       */
+      AssetLoader();
+
+      /**
+       * AssetLoader deconstructor will stop the worker threads
+       */
+      virtual ~AssetLoader();
+
+      /**
+       * GetWorkerCount will return the number of worker threads used.
+       * @return the number of worker threads
+       */
+      Uint32 GetWorkerCount(void) const;
+
+      /**
+       * SetWorkerCount will set the number of worker threads used, this has
+       * no effect once the worker threads have been started.
+       * @param[in] theCount of worker threads to use (1 to MAX_WORKERS)
+       */
+      void SetWorkerCount(const Uint32 theCount);
+
+      /**
+       * GetUploadBudget will return the time in microseconds spent finishing
+       * loads on the main thread each time Update is called.
+       * @return the upload budget in microseconds
+       */
+      Uint32 GetUploadBudget(void) const;
+
+      /**
+       * SetUploadBudget will set the time in microseconds spent finishing
+       * loads on the main thread each time Update is called. At least one
+       * load is always finished so loading never stalls.
+       * @param[in] theBudget in microseconds
+       */
+      void SetUploadBudget(const Uint32 theBudget);
+
+      /**
+       * GetPendingCount will return the number of assets queued, being
+       * decoded or waiting to be finished.
+       * @return the number of assets still loading
+       */
+      Uint32 GetPendingCount(void) const;
+
+      /**
+       * AddAsset will queue theAssetID provided to be decoded by a worker
+       * thread. The caller must have called theAssetHandler.QueueAsset first.
+       * @param[in] theAssetHandler that manages the asset
+       * @param[in] theAssetID of the asset to load
+       */
+      void AddAsset(IAssetHandler& theAssetHandler, const typeAssetID theAssetID);
+
+      /**
+       * Update is called once each frame from the main thread and will finish
+       * each decoded asset until the upload budget is spent.
+       * @return the number of assets finished
+       */
+      Uint32 Update(void);
+
+      /**
+       * Wait will block the main thread until theAssetID provided is loaded,
+       * decoding it on the calling thread if no worker has started on it yet.
+       * @param[in] theAssetHandler that manages the asset
+       * @param[in] theAssetID of the asset to wait for
+       * @return true if the asset was loaded, false otherwise
+       */
+      bool Wait(IAssetHandler& theAssetHandler, const typeAssetID theAssetID);
+
+      /**
+       * SetNetworkSource will set the content server used to fetch the network
+       * assets queued together (see NetworkSource::Prefetch).
+       * @param[in] theNetworkSource to use or NULL to fetch each asset alone
+       */
+      void SetNetworkSource(NetworkSource* theNetworkSource);
+
+      /**
+       * Stop will stop the worker threads and cancel every asset that hasn't
+       * been finished yet. Called by the AssetManager before each
+       * IAssetHandler is deleted.
+       */
+      void Stop(void);
+
+    private:
+      // Structures
+      ///////////////////////////////////////////////////////////////////////////
+      /// Structure holding each asset waiting in the queues below
+      struct typeAssetJob
+      {
+        IAssetHandler* handler; ///< The handler that manages the asset
+        typeAssetID    assetID; ///< The ID of the asset to load
+      };
+
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// Assets waiting to be decoded by a worker thread
+      std::deque<typeAssetJob> mQueued;
+      /// The content server used to prefetch network assets (see SetNetworkSource)
+      NetworkSource*           mNetworkSource;
+      /// Assets decoded and waiting to be finished on the main thread
+      std::deque<typeAssetJob> mDecoded;
+      /// Mutex that protects both queues above
+      mutable sf::Mutex        mMutex;
+      /// The worker threads started
+      sf::Thread*              mWorkers[MAX_WORKERS];
+      /// Number of worker threads to start
+      Uint32                   mWorkerCount;
+      /// True while the worker threads should keep running
+      volatile bool            mRunning;
+      /// Number of assets being decoded (protected by mMutex)
+      Uint32                   mDecoding;
+      /// Time in microseconds spent finishing loads each frame
+      Uint32                   mUploadBudget;
+
+      /**
+       * Start will start the worker threads if they aren't running yet.
+       */
+      void Start(void);
+
+      /**
+       * Run is the function run by each worker thread.
+       */
+      void Run(void);
+
+      /**
+       * PrefetchNetwork will fetch the asset of theJob provided together with
+       * the other network assets queued (up to MAX_PREFETCH) if theJob is
+       * loaded from the network, so their requests are pipelined instead of
+       * being sent one at a time by each worker thread.
+       * @param[in] theJob about to be decoded by the calling worker thread
+       */
+      void PrefetchNetwork(const typeAssetJob& theJob);
+
+      /**
+       * Take will remove theAssetID provided from theQueue provided.
+       * @param[in] theQueue to remove the asset from
+       * @param[in] theAssetHandler that manages the asset
+       * @param[in] theAssetID of the asset to remove
+       * @return true if the asset was found and removed, false otherwise
+       */
+      static bool Take(std::deque<typeAssetJob>& theQueue,
+        const IAssetHandler& theAssetHandler, const typeAssetID& theAssetID);
+
+      /**
+       * AssetLoader copy constructor is private because we do not allow copies
+       * of our class
+       */
+      AssetLoader(const AssetLoader&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      AssetLoader& operator=(const AssetLoader&); // Intentionally undefined
+  }; // class AssetLoader
+} // namespace GQE
+
+#endif // CORE_ASSET_LOADER_HPP_INCLUDED
+
+/**
+ * @class GQE::AssetLoader
+ * @ingroup Core
+ * The AssetLoader class keeps a small pool of worker threads which call
+ * IAssetHandler::DecodeAsset for each asset queued by
+ * AssetManager::LoadAssetAsync. Each decoded asset is then finished on the
+ * main thread by Update (called once each frame by IApp) which calls
+ * IAssetHandler::CompleteAsset until the upload budget is spent, so work
+ * that must happen on the main thread (e.g. uploading a texture) never
+ * causes a long frame.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -17,25 +17,55 @@
  * @date 20110831 - Support new SFML2 snapshot changes
  * @date 20120322 - Support new SFML2 snapshot changes
  * @date 20120503 - Redo AssetManager to be more flexible and use RAII techniques
+ * @date 20130815 - Add background loading using the new AssetLoader class
+ * @date 20130816 - Add asset packs using the new AssetPack class
+ * @date 20130817 - Resolve each TAssetHandler once per type using a static index
+ * @date 20130818 - Add the cache budget and statistics of every handler
+ * @date 20130819 - Record the assets referenced into state asset manifests
+ * @date 20130820 - Add the TextureCache of decoded images
+ * @date 20130821 - Add the SoundCache of decoded sounds
+ * @date 20130824 - Add the NetworkSource used to fetch assets from a content server
+ * @date 20130826 - Let the AssetLoader prefetch network assets queued together
  */
 
+#include <new>
 #include <TVSource/Managers/AssetManager.hpp>
 #include <TVSource/Loggers/Log_macros.hpp>
 
 namespace GQE
 {
-  AssetManager::AssetManager()
+  AssetManager::AssetManager() :
+    mCacheBudget((Uint64)DEFAULT_CACHE_BUDGET * 1024 * 1024),
+    mManifest(NULL)
   {
     ILOGM("AssetManager::ctor()");
+
+    // Let the worker threads fetch the network assets queued together
+    mLoader.SetNetworkSource(&mNetworkSource);
   }
 
   AssetManager::~AssetManager()
   {
     ILOGM("AssetManager::dtor()");
 
+    // Stop the background loads before any IAssetHandler is deleted
+    mLoader.Stop();
+
     // Iterator to use while deleting all assets
     std::map<const typeAssetHandlerID, IAssetHandler*>::iterator iter;
 
+    // Forget the handlers found by GetHandler
+    mHandlerIndex.clear();
+
+    // Log how well the cache of each asset handler worked
+    for(iter = mHandlers.begin(); iter != mHandlers.end(); ++iter)
+    {
+      typeAssetCacheStats anStats = iter->second->GetCacheStats();
+      ILOG() << "AssetManager::dtor(" << iter->first << ") cache hits="
+        << anStats.hits << " misses=" << anStats.misses << " evictions="
+        << anStats.evictions << " bytes=" << anStats.bytes << std::endl;
+    }
+
     // Loop through each asset handler and remove each one
     iter = mHandlers.begin();
     while(iter != mHandlers.end())
@@ -48,6 +78,13 @@ namespace GQE
       // Delete the Asset Handler
       delete anAssetHandler;
     }
+
+    // Unmap each asset pack now that no asset refers to its contents
+    for(size_t iloop = 0; iloop < mPacks.size(); iloop++)
+    {
+      delete mPacks[iloop];
+    }
+    mPacks.clear();
   }
 
   IAssetHandler& AssetManager::GetHandler(const typeAssetHandlerID theAssetHandlerID) const
@@ -79,6 +116,25 @@ namespace GQE
     return *anResult;
   }
 
+  IAssetHandler* AssetManager::FindHandler(const typeAssetHandlerID theAssetHandlerID) const
+  {
+    // The IAssetHandler derived class that will be returned
+    IAssetHandler* anResult = NULL;
+
+    // Iterator to the asset handler if found
+    std::map<const typeAssetHandlerID, IAssetHandler*>::const_iterator iter;
+
+    // Try to find the asset handler using theAssetHandlerID as the key
+    iter = mHandlers.find(theAssetHandlerID);
+    if(iter != mHandlers.end())
+    {
+      anResult = iter->second;
+    }
+
+    // Return the IAssetHandler found or NULL otherwise
+    return anResult;
+  }
+
   void AssetManager::RegisterHandler(IAssetHandler* theAssetHandler)
   {
     // Iterator to the asset if found
@@ -97,6 +153,9 @@ namespace GQE
         mHandlers.insert(
           std::pair<const typeAssetHandlerID, IAssetHandler*>(
           theAssetHandler->GetID(), theAssetHandler));
+
+        // Give the new handler the same cache budget as every other handler
+        theAssetHandler->SetCacheBudget(mCacheBudget);
       }
       else
       {
@@ -138,6 +197,147 @@ namespace GQE
     return anResult;
   }
 
+  AssetLoadHandle AssetManager::LoadAssetAsync(IAssetHandler& theAssetHandler,
+    const typeAssetID theAssetID)
+  {
+    // Only queue assets that aren't loaded or queued already
+    if(theAssetHandler.QueueAsset(theAssetID))
+    {
+      mLoader.AddAsset(theAssetHandler, theAssetID);
+    }
+
+    // Return a handle to follow the load
+    return AssetLoadHandle(mLoader, theAssetHandler, theAssetID);
+  }
+
+  Uint32 AssetManager::UpdateLoads(void)
+  {
+    return mLoader.Update();
+  }
+
+  Uint32 AssetManager::NewHandlerIndex(void)
+  {
+    // Index 0 means HandlerIndex wasn't initialized yet, so start at 1
+    static Uint32 gHandlerIndex = 0;
+    return ++gHandlerIndex;
+  }
+
+  AssetLoader& AssetManager::GetLoader(void)
+  {
+    return mLoader;
+  }
+
+  bool AssetManager::AddPack(const std::string& theFilename)
+  {
+    bool anResult = false;
+
+    // Map the asset pack and keep it if it was valid
+    AssetPack* anPack = new(std::nothrow) AssetPack();
+    if(NULL != anPack && anPack->Open(theFilename))
+    {
+      mPacks.push_back(anPack);
+      anResult = true;
+    }
+    else
+    {
+      delete anPack;
+    }
+
+    // Return anResult of true if successful, false otherwise
+    return anResult;
+  }
+
+  bool AssetManager::FindPackData(const std::string& theFilename,
+    const char*& theData, size_t& theSize) const
+  {
+    bool anResult = false;
+
+    // Search the asset packs added last first
+    for(size_t iloop = mPacks.size(); !anResult && iloop > 0; iloop--)
+    {
+      anResult = mPacks[iloop - 1]->Find(theFilename, theData, theSize);
+    }
+
+    // Let the log know an asset pack is missing this asset
+    if(!anResult && !mPacks.empty())
+    {
+      WLOG() << "AssetManager::FindPackData(" << theFilename
+        << ") not found in any asset pack" << std::endl;
+    }
+
+    // Return anResult of true if theFilename was found, false otherwise
+    return anResult;
+  }
+
+  TextureCache& AssetManager::GetTextureCache(void)
+  {
+    return mTextureCache;
+  }
+
+  SoundCache& AssetManager::GetSoundCache(void)
+  {
+    return mSoundCache;
+  }
+
+  NetworkSource& AssetManager::GetNetworkSource(void)
+  {
+    return mNetworkSource;
+  }
+
+  void AssetManager::SetCacheBudget(const Uint64 theBudget)
+  {
+    // Iterator to each asset handler
+    std::map<const typeAssetHandlerID, IAssetHandler*>::iterator iter;
+
+    // Remember the budget for handlers registered later
+    mCacheBudget = theBudget;
+
+    // Give the budget to each handler registered so far
+    for(iter = mHandlers.begin(); iter != mHandlers.end(); ++iter)
+    {
+      iter->second->SetCacheBudget(theBudget);
+    }
+  }
+
+  typeAssetCacheStats AssetManager::GetCacheStats(void) const
+  {
+    // Start with empty statistics
+    typeAssetCacheStats anResult = typeAssetCacheStats();
+
+    // Iterator to each asset handler
+    std::map<const typeAssetHandlerID, IAssetHandler*>::const_iterator iter;
+
+    // Add the statistics of each handler together
+    for(iter = mHandlers.begin(); iter != mHandlers.end(); ++iter)
+    {
+      typeAssetCacheStats anStats = iter->second->GetCacheStats();
+      anResult.hits += anStats.hits;
+      anResult.misses += anStats.misses;
+      anResult.evictions += anStats.evictions;
+      anResult.count += anStats.count;
+      anResult.bytes += anStats.bytes;
+      anResult.budget += anStats.budget;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  void AssetManager::SetManifest(typeAssetManifest* theManifest)
+  {
+    mManifest = theManifest;
+  }
+
+  void AssetManager::RecordAsset(const typeAssetHandlerID theAssetHandlerID,
+    const typeAssetID theAssetID)
+  {
+    // Add the asset to the manifest being recorded (if any)
+    if(NULL != mManifest)
+    {
+      mManifest->insert(std::make_pair(theAssetHandlerID, theAssetID));
+    }
+  }
+
 } // namespace GQE
 
 /**
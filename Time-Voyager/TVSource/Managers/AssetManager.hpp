@@ -13,13 +13,28 @@
  * @date 20110218 - Change to system include style
  * @date 20110627 - Remove extra , from enum and extra ; from namespace
  * @date 20120503 - Redo AssetManager to be more flexible and use RAII techniques
+ * @date 20130815 - Add background loading using the new AssetLoader class
+ * @date 20130816 - Add asset packs using the new AssetPack class
+ * @date 20130817 - Resolve each TAssetHandler once per type using a static index
+ * @date 20130818 - Add the cache budget and statistics of every handler
+ * @date 20130819 - Record the assets referenced into state asset manifests
+ * @date 20130820 - Add the TextureCache of decoded images
+ * @date 20130821 - Add the SoundCache of decoded sounds
+ * @date 20130824 - Add the NetworkSource used to fetch assets from a content server
  */
 #ifndef   CORE_ASSET_MANAGER_HPP_INCLUDED
 #define   CORE_ASSET_MANAGER_HPP_INCLUDED
 
 #include <map>
 #include <typeinfo>
+#include <vector>
 #include <TVSource/Interfaces/TAssetHandler.hpp>
+#include <TVSource/Managers/AssetLoader.hpp>
+#include <TVSource/Managers/AssetLoadHandle.hpp>
+#include <TVSource/Utils/AssetPack.hpp>
+#include <TVSource/Utils/NetworkSource.hpp>
+#include <TVSource/Utils/SoundCache.hpp>
+#include <TVSource/Utils/TextureCache.hpp>
 #include <TVSource/Core/Core_types.hpp>
 
 namespace GQE
@@ -28,6 +43,11 @@ namespace GQE
   class GQE_API AssetManager
   {
     public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Default cache budget in megabytes of each asset handler
+      static const Uint32 DEFAULT_CACHE_BUDGET = 32;
+
       /**
        * AssetManager constructor
        */
@@ -42,7 +62,8 @@ namespace GQE
        * GetHandler is responsible for returning an TAssetHandler derived
        * class that was previously registered under typeid(TYPE).name() of the
        * TYPE provided which can then be used to obtain Asset references by
-       * Asset ID.
+       * Asset ID. The handler found is remembered under the static index of
+       * TYPE so it is only looked up by name the first time.
        */
       template<class TYPE>
       TAssetHandler<TYPE>& GetHandler() const
@@ -50,17 +71,36 @@ namespace GQE
         // The TAssetHandler<TYPE> derived class that will be returned
         TAssetHandler<TYPE>* anResult = NULL;
 
-        // Iterator to the asset if found
-        std::map<const typeAssetHandlerID, IAssetHandler*>::const_iterator iter;
+        // Use the handler previously found for TYPE if any
+        const Uint32 anIndex = HandlerIndex<TYPE>::gIndex;
+        if(anIndex < mHandlerIndex.size() && NULL != mHandlerIndex[anIndex])
+        {
+          anResult = static_cast<TAssetHandler<TYPE>*>(mHandlerIndex[anIndex]);
+        }
+        else
+        {
+          // Iterator to the asset if found
+          std::map<const typeAssetHandlerID, IAssetHandler*>::const_iterator iter;
 
-        // Try to find the asset using theAssetID as the key
-        iter = mHandlers.find(typeid(TYPE).name());
+          // Try to find the asset using theAssetID as the key
+          iter = mHandlers.find(typeid(TYPE).name());
 
-        // Found asset? increment the count and return the reference
-        if(iter != mHandlers.end())
-        {
-          // Cast the IAssetHandler address found into TAssetHandler
-          anResult = static_cast<TAssetHandler<TYPE>*>(iter->second);
+          // Found asset? increment the count and return the reference
+          if(iter != mHandlers.end())
+          {
+            // Cast the IAssetHandler address found into TAssetHandler
+            anResult = static_cast<TAssetHandler<TYPE>*>(iter->second);
+
+            // Remember the handler found under the index of TYPE (if assigned)
+            if(anIndex > 0)
+            {
+              if(anIndex >= mHandlerIndex.size())
+              {
+                mHandlerIndex.resize(anIndex + 1, NULL);
+              }
+              mHandlerIndex[anIndex] = iter->second;
+            }
+          }
         }
 
         // Make sure we aren't returning NULL at this point
@@ -82,6 +122,15 @@ namespace GQE
        */
       IAssetHandler& GetHandler(const typeAssetHandlerID theAssetHandlerID) const;
 
+      /**
+       * FindHandler is responsible for returning the IAssetHandler derived
+       * class registered under theAssetHandlerID provided, or NULL if none
+       * was registered (unlike GetHandler this is not a fatal error).
+       * @param[in] theAssetHandlerID to find
+       * @return the IAssetHandler found or NULL otherwise
+       */
+      IAssetHandler* FindHandler(const typeAssetHandlerID theAssetHandlerID) const;
+
       /**
        * RegisterHandler is responsible for registering an IAssetHandler
        * derived class with the AssetManager. These handlers are used to manage
@@ -98,7 +147,115 @@ namespace GQE
        */
       bool LoadAllAssets(void);
 
+      /**
+       * LoadAssetAsync is responsible for queuing theAssetID provided to be
+       * loaded by the AssetLoader worker threads. Assets already loaded or
+       * already queued are not queued again.
+       * @param[in] theAssetHandler that manages the asset
+       * @param[in] theAssetID of the asset to load in the background
+       * @return a handle that can be used to follow or wait for the load
+       */
+      AssetLoadHandle LoadAssetAsync(IAssetHandler& theAssetHandler,
+        const typeAssetID theAssetID);
+
+      /**
+       * UpdateLoads is called once each frame from the main thread and will
+       * finish each asset decoded in the background until the upload budget
+       * of the AssetLoader is spent.
+       * @return the number of assets finished
+       */
+      Uint32 UpdateLoads(void);
+
+      /**
+       * GetLoader will return the AssetLoader used for background loading so
+       * its worker count and upload budget can be configured.
+       * @return the AssetLoader used by this AssetManager
+       */
+      AssetLoader& GetLoader(void);
+
+      /**
+       * AddPack is responsible for mapping theFilename asset pack provided
+       * so assets loaded from memory are found in it (see FindPackData).
+       * Asset packs must be added before any asset is loaded since they are
+       * searched by the AssetLoader worker threads without locking.
+       * @param[in] theFilename of the asset pack to add
+       * @return true if theFilename was found and is a valid asset pack
+       */
+      bool AddPack(const std::string& theFilename);
+
+      /**
+       * FindPackData is responsible for finding the contents of theFilename
+       * provided in the asset packs added so far. Asset packs added last are
+       * searched first so they can override files in earlier asset packs.
+       * @param[in] theFilename of the asset to find
+       * @param[out] theData of the asset found
+       * @param[out] theSize of the asset found in bytes
+       * @return true if theFilename was found, false otherwise
+       */
+      bool FindPackData(const std::string& theFilename, const char*& theData,
+        size_t& theSize) const;
+
+      /**
+       * GetTextureCache will return the TextureCache used by the ImageHandler
+       * to skip decoding images already decoded by a previous run.
+       * @return the TextureCache used by this AssetManager
+       */
+      TextureCache& GetTextureCache(void);
+
+      /**
+       * GetSoundCache will return the SoundCache used by the SoundHandler to
+       * skip decoding sounds already decoded by a previous run.
+       * @return the SoundCache used by this AssetManager
+       */
+      SoundCache& GetSoundCache(void);
+
+      /**
+       * GetNetworkSource will return the NetworkSource used by each handler
+       * to fetch assets loaded from the network (see AssetLoadFromNetwork).
+       * @return the NetworkSource used by this AssetManager
+       */
+      NetworkSource& GetNetworkSource(void);
+
+      /**
+       * SetCacheBudget is responsible for setting the cache budget (see
+       * AssetDropCached) of every IAssetHandler registered now or later.
+       * @param[in] theBudget in bytes each IAssetHandler may keep cached
+       */
+      void SetCacheBudget(const Uint64 theBudget);
+
+      /**
+       * GetCacheStats will return the cache statistics of every
+       * IAssetHandler registered added together.
+       * @return the cache statistics of all asset handlers
+       */
+      typeAssetCacheStats GetCacheStats(void) const;
+
+      /**
+       * SetManifest is responsible for setting theManifest provided that
+       * records every asset referenced by a TAsset from now on (see
+       * StateManager::RecordManifest). Providing NULL stops the recording.
+       * @param[in] theManifest to record into or NULL to stop recording
+       */
+      void SetManifest(typeAssetManifest* theManifest);
+
+      /**
+       * RecordAsset is called by TAsset each time an asset is referenced and
+       * will add theAssetID provided to the manifest being recorded (if any).
+       * @param[in] theAssetHandlerID of the handler managing the asset
+       * @param[in] theAssetID of the asset referenced
+       */
+      void RecordAsset(const typeAssetHandlerID theAssetHandlerID,
+        const typeAssetID theAssetID);
+
     private:
+      /// Provides the static index of each asset TYPE (see GetHandler)
+      template<class TYPE>
+      struct HandlerIndex
+      {
+        /// Index assigned to TYPE at startup (0 if not assigned yet)
+        static const Uint32 gIndex;
+      };
+
       // Constants
       ///////////////////////////////////////////////////////////////////////////
 
@@ -106,6 +263,22 @@ namespace GQE
       ///////////////////////////////////////////////////////////////////////////
       /// Map to hold all IAssetHandler derived classes that manage assets
       std::map<const typeAssetHandlerID, IAssetHandler*> mHandlers;
+      /// Each IAssetHandler found by GetHandler indexed by HandlerIndex
+      mutable std::vector<IAssetHandler*> mHandlerIndex;
+      /// The worker threads that load assets in the background
+      AssetLoader mLoader;
+      /// The asset packs mapped by AddPack
+      std::vector<AssetPack*> mPacks;
+      /// The images decoded by previous runs (see GetTextureCache)
+      TextureCache mTextureCache;
+      /// The sounds decoded by previous runs (see GetSoundCache)
+      SoundCache mSoundCache;
+      /// The content server assets are fetched from (see GetNetworkSource)
+      NetworkSource mNetworkSource;
+      /// The cache budget in bytes given to each IAssetHandler registered
+      Uint64 mCacheBudget;
+      /// The manifest recording each asset referenced (see SetManifest)
+      typeAssetManifest* mManifest;
 
       /**
        * AssetManager copy constructor is private because we do not allow copies
@@ -118,7 +291,18 @@ namespace GQE
        * of our class
        */
       AssetManager& operator=(const AssetManager&); // Intentionally undefined
+
+      /**
+       * NewHandlerIndex will return the next unused static index for
+       * HandlerIndex, starting at 1.
+       * @return the new index
+       */
+      static Uint32 NewHandlerIndex(void);
   }; // class AssetManager
+
+  // Each asset TYPE gets its index during static initialization
+  template<class TYPE>
+  const Uint32 AssetManager::HandlerIndex<TYPE>::gIndex = AssetManager::NewHandlerIndex();
 } // namespace GQE
 
 #endif // CORE_ASSET_MANAGER_HPP_INCLUDED
@@ -134,7 +318,15 @@ namespace GQE
  * assets in the foreground if specified.  The AssetManager also
  * manages the removal of shared assets as soon as it becomes clear that
  * the game asset is no longer in use by using internal reference counts
- * for each game asset requested.
+ * for each game asset requested. Assets can also be loaded in the background
+ * by the AssetLoader worker threads using LoadAssetAsync (see TAsset::LoadAsync).
+ * Assets loaded from memory are found in the asset packs added by AddPack.
+ * Images and sounds already decoded are kept in the TextureCache and
+ * SoundCache (see GetTextureCache and GetSoundCache).
+ * Assets loaded from the network are fetched from a content server into a
+ * local cache by the NetworkSource (see GetNetworkSource).
+ * Assets no longer referenced are kept in the cache of each handler until its
+ * cache budget (see SetCacheBudget) is exceeded.
  *
  * Copyright (c) 2010-2011 Ryan Lindeman
  * Permission is hereby granted, free of charge, to any person obtaining a copy
@@ -0,0 +1,425 @@
+/**
+ * Provides the BenchmarkManager class in the GQE namespace which is
+ * responsible for parsing the benchmark command line options, collecting the
+ * time spent in each game loop phase and writing the benchmark report.
+ *
+ * @file src/GQE/Core/classes/BenchmarkManager.cpp
+ * @author Ryan Lindeman
+ * @date 20130802 - Initial Release
+ * @date 20130807 - Add the hardware counters of each zone to the report
+ * @date 20130808 - Add the allocations per frame and per tag to the report
+ * @date 20130826 - Round the nearest rank of each percentile up
+ * @date 20130826 - Escape the scenario name written to the report
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <TVSource/Loggers/Log_macros.hpp>
+#include <TVSource/Managers/BenchmarkManager.hpp>
+#include <TVSource/Managers/StatManager.hpp>
+#include <TVSource/Utils/AllocTracker.hpp>
+#include <TVSource/Utils/StringUtil.hpp>
+#if defined(GQE_WINDOWS)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace GQE
+{
+  /// Default filename to write the benchmark report to
+  const char* BenchmarkManager::DEFAULT_REPORT = "benchmark.json";
+
+  BenchmarkManager::BenchmarkManager() :
+    mScenario(),
+    mReport(DEFAULT_REPORT),
+    mEntities(DEFAULT_ENTITIES),
+    mFrames(DEFAULT_FRAMES),
+    mSeed(DEFAULT_SEED),
+    mHeadless(false),
+    mElapsedClock(),
+    mAllocSamples(),
+    mByteSamples(),
+    mAllocCount(0),
+    mAllocBytes(0)
+  {
+    ILOGM("BenchmarkManager::ctor()");
+  }
+
+  BenchmarkManager::~BenchmarkManager()
+  {
+    ILOGM("BenchmarkManager::dtor()");
+  }
+
+  bool BenchmarkManager::ProcessArgument(const std::string theArgument)
+  {
+    // Assume theArgument provided is a benchmark argument
+    bool anResult = true;
+
+    // Split theArgument into its --name and value portions
+    size_t anEquals = theArgument.find('=');
+    std::string anName = theArgument.substr(0, anEquals);
+    std::string anValue;
+    if(anEquals != std::string::npos)
+    {
+      anValue = theArgument.substr(anEquals + 1);
+    }
+
+    if(anName == "--bench")
+    {
+      // Default to the movement scenario if no scenario name was provided
+      mScenario = anValue.empty() ? "movement" : anValue;
+    }
+    else if(anName == "--entities")
+    {
+      mEntities = ParseUint32(anValue, DEFAULT_ENTITIES);
+    }
+    else if(anName == "--frames")
+    {
+      mFrames = ParseUint32(anValue, DEFAULT_FRAMES);
+    }
+    else if(anName == "--seed")
+    {
+      mSeed = ParseUint32(anValue, DEFAULT_SEED);
+    }
+    else if(anName == "--headless")
+    {
+      mHeadless = true;
+    }
+    else if(anName == "--report" && !anValue.empty())
+    {
+      mReport = anValue;
+    }
+    else
+    {
+      // Not one of ours
+      anResult = false;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  bool BenchmarkManager::IsEnabled(void) const
+  {
+    return !mScenario.empty();
+  }
+
+  bool BenchmarkManager::IsHeadless(void) const
+  {
+    return mHeadless;
+  }
+
+  const std::string BenchmarkManager::GetScenario(void) const
+  {
+    return mScenario;
+  }
+
+  Uint32 BenchmarkManager::GetEntities(void) const
+  {
+    return mEntities;
+  }
+
+  Uint32 BenchmarkManager::GetFrames(void) const
+  {
+    return mFrames;
+  }
+
+  Uint32 BenchmarkManager::GetSeed(void) const
+  {
+    return mSeed;
+  }
+
+  void BenchmarkManager::DoInit(void)
+  {
+    ILOG() << "BenchmarkManager::DoInit() scenario=" << mScenario
+      << ", entities=" << mEntities << ", frames=" << mFrames
+      << ", seed=" << mSeed << ", headless=" << mHeadless << std::endl;
+
+    // Reserve room for every frame now so recording never allocates
+    for(Uint32 iloop = 0; iloop < PhaseCount; iloop++)
+    {
+      mSamples[iloop].clear();
+      mSamples[iloop].reserve(mFrames);
+    }
+    mAllocSamples.clear();
+    mAllocSamples.reserve(mFrames);
+    mByteSamples.clear();
+    mByteSamples.reserve(mFrames);
+
+    // Only count the allocations made from now on
+    mAllocCount = AllocTracker::GetAllocCount();
+    mAllocBytes = AllocTracker::GetAllocBytes();
+
+    // Restart our elapsed clock
+    mElapsedClock.restart();
+  }
+
+  bool BenchmarkManager::AddFrame(const Int64 thePhaseTimes[PhaseCount])
+  {
+    // Record the time spent in each phase during this frame
+    for(Uint32 iloop = 0; iloop < PhaseCount; iloop++)
+    {
+      mSamples[iloop].push_back(thePhaseTimes[iloop]);
+    }
+
+    // Record the allocations made during this frame
+    Uint64 anAllocCount = AllocTracker::GetAllocCount();
+    Uint64 anAllocBytes = AllocTracker::GetAllocBytes();
+    mAllocSamples.push_back((Int64)(anAllocCount - mAllocCount));
+    mByteSamples.push_back((Int64)(anAllocBytes - mAllocBytes));
+    mAllocCount = anAllocCount;
+    mAllocBytes = anAllocBytes;
+
+    // Return true if we have run the requested number of frames
+    return mSamples[PhaseFrame].size() >= mFrames;
+  }
+
+  bool BenchmarkManager::WriteReport(const StatManager& theStatManager) const
+  {
+    // Assume the report could not be written
+    bool anResult = false;
+
+    // Try to open the report file for writing
+    std::ofstream anReport(mReport.c_str(), std::ios::out | std::ios::trunc);
+    if(anReport.is_open())
+    {
+      anReport << "{" << std::endl;
+      anReport << "  \"scenario\": \"" << EscapeString(mScenario) << "\"," << std::endl;
+      anReport << "  \"entities\": " << mEntities << "," << std::endl;
+      anReport << "  \"frames\": " << mSamples[PhaseFrame].size() << "," << std::endl;
+      anReport << "  \"seed\": " << mSeed << "," << std::endl;
+      anReport << "  \"headless\": " << (mHeadless ? "true" : "false") << "," << std::endl;
+      anReport << "  \"elapsed_s\": " << mElapsedClock.getElapsedTime().asSeconds() << "," << std::endl;
+      anReport << "  \"peak_rss_bytes\": " << GetPeakMemory() << "," << std::endl;
+      anReport << "  \"phases\": {" << std::endl;
+
+      // Write the statistics for each game loop phase
+      for(Uint32 iloop = 0; iloop < PhaseCount; iloop++)
+      {
+        // Sort a copy of the samples so we can compute the percentiles
+        std::vector<Int64> anSorted(mSamples[iloop]);
+        std::sort(anSorted.begin(), anSorted.end());
+
+        // Compute the total time spent in this phase
+        Int64 anTotal = 0;
+        for(size_t jloop = 0; jloop < anSorted.size(); jloop++)
+        {
+          anTotal += anSorted[jloop];
+        }
+
+        // Compute the mean time spent in this phase
+        double anMean = anSorted.empty() ? 0.0 : (double)anTotal / (double)anSorted.size();
+
+        anReport << "    \"" << gPhaseNames[iloop] << "\": {"
+          << " \"total_us\": " << anTotal
+          << ", \"mean_us\": " << anMean
+          << ", \"min_us\": " << GetPercentile(anSorted, 0.0f)
+          << ", \"p50_us\": " << GetPercentile(anSorted, 50.0f)
+          << ", \"p90_us\": " << GetPercentile(anSorted, 90.0f)
+          << ", \"p95_us\": " << GetPercentile(anSorted, 95.0f)
+          << ", \"p99_us\": " << GetPercentile(anSorted, 99.0f)
+          << ", \"max_us\": " << GetPercentile(anSorted, 100.0f)
+          << " }" << (iloop + 1 < PhaseCount ? "," : "") << std::endl;
+      }
+
+      anReport << "  }," << std::endl;
+
+      // Write the allocations made per frame and by each tag
+      std::vector<Int64> anAllocs(mAllocSamples);
+      std::sort(anAllocs.begin(), anAllocs.end());
+      std::vector<Int64> anBytes(mByteSamples);
+      std::sort(anBytes.begin(), anBytes.end());
+      size_t anZeroFrames = std::upper_bound(anAllocs.begin(), anAllocs.end(), 0) - anAllocs.begin();
+      anReport << "  \"allocations\": {" << std::endl;
+      anReport << "    \"tracked\": " << (AllocTracker::IsEnabled() ? "true" : "false")
+        << "," << std::endl;
+      anReport << "    \"zero_alloc_frames\": " << anZeroFrames << "," << std::endl;
+      anReport << "    \"live_bytes\": " << AllocTracker::GetLiveBytes() << "," << std::endl;
+      anReport << "    \"allocs_per_frame\": {"
+        << " \"p50\": " << GetPercentile(anAllocs, 50.0f)
+        << ", \"p95\": " << GetPercentile(anAllocs, 95.0f)
+        << ", \"max\": " << GetPercentile(anAllocs, 100.0f) << " }," << std::endl;
+      anReport << "    \"bytes_per_frame\": {"
+        << " \"p50\": " << GetPercentile(anBytes, 50.0f)
+        << ", \"p95\": " << GetPercentile(anBytes, 95.0f)
+        << ", \"max\": " << GetPercentile(anBytes, 100.0f) << " }," << std::endl;
+      anReport << "    \"tags\": {" << std::endl;
+      for(Uint32 iloop = 0; iloop < AllocTracker::GetTagCount(); iloop++)
+      {
+        typeAllocTotals anTotals = AllocTracker::GetTotals(iloop);
+        anReport << "      \"" << anTotals.name << "\": {"
+          << " \"allocs\": " << anTotals.allocs
+          << ", \"bytes\": " << anTotals.bytes
+          << ", \"live_bytes\": " << anTotals.live
+          << " }" << (iloop + 1 < AllocTracker::GetTagCount() ? "," : "") << std::endl;
+      }
+      anReport << "    }" << std::endl;
+      anReport << "  }," << std::endl;
+      anReport << "  \"counters_available\": "
+        << (theStatManager.IsCounting() ? "true" : "false") << "," << std::endl;
+      anReport << "  \"counters\": {" << std::endl;
+
+      // Write the hardware counters of each system and game loop phase
+      const std::vector<typePerfTotals>& anCounters = theStatManager.GetCounters();
+      for(size_t iloop = 0; iloop < anCounters.size(); iloop++)
+      {
+        const typePerfTotals& anTotals = anCounters[iloop];
+        double anCycles = (double)anTotals.counters[PerfCycles];
+
+        anReport << "    \"" << anTotals.name << "\": {"
+          << " \"calls\": " << anTotals.calls
+          << ", \"entities\": " << anTotals.entities;
+        for(Uint32 jloop = 0; jloop < PerfCount; jloop++)
+        {
+          anReport << ", \"" << gPerfNames[jloop] << "\": " << anTotals.counters[jloop];
+        }
+        anReport << ", \"ipc\": "
+          << (anCycles > 0.0 ? (double)anTotals.counters[PerfInstructions] / anCycles : 0.0);
+
+        // Write each miss counter per call and per entity (0 if no entities)
+        for(Uint32 jloop = PerfL1Misses; jloop < PerfCount; jloop++)
+        {
+          double anMisses = (double)anTotals.counters[jloop];
+          anReport << ", \"" << gPerfNames[jloop] << "_per_call\": "
+            << (anTotals.calls > 0 ? anMisses / (double)anTotals.calls : 0.0)
+            << ", \"" << gPerfNames[jloop] << "_per_entity\": "
+            << (anTotals.entities > 0 ? anMisses / (double)anTotals.entities : 0.0);
+        }
+        anReport << " }" << (iloop + 1 < anCounters.size() ? "," : "") << std::endl;
+      }
+
+      anReport << "  }" << std::endl;
+      anReport << "}" << std::endl;
+
+      // Report was written if the stream is still good
+      anResult = anReport.good();
+
+      // Close the report file
+      anReport.close();
+    }
+
+    if(anResult)
+    {
+      ILOG() << "BenchmarkManager::WriteReport() wrote " << mReport << std::endl;
+    }
+    else
+    {
+      ELOG() << "BenchmarkManager::WriteReport() unable to write " << mReport << std::endl;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  Int64 BenchmarkManager::GetPercentile(const std::vector<Int64>& theSamples,
+    const float thePercentile)
+  {
+    // Default to 0 if no samples are available
+    Int64 anResult = 0;
+
+    if(!theSamples.empty())
+    {
+      // Use the nearest rank method to find the sample index
+      size_t anIndex = (size_t)ceil((thePercentile / 100.0f) * (float)theSamples.size());
+
+      // Nearest rank is 1 based, so step back one unless we are at the first
+      if(anIndex > 0)
+      {
+        anIndex--;
+      }
+
+      // Clamp to the last sample available
+      if(anIndex >= theSamples.size())
+      {
+        anIndex = theSamples.size() - 1;
+      }
+
+      anResult = theSamples[anIndex];
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  std::string BenchmarkManager::EscapeString(const std::string& theString)
+  {
+    std::ostringstream anResult;
+
+    for(size_t iloop = 0; iloop < theString.length(); iloop++)
+    {
+      const unsigned char anChar = (unsigned char)theString[iloop];
+      if('"' == anChar || '\\' == anChar)
+      {
+        anResult << '\\' << anChar;
+      }
+      else if(0x20 > anChar)
+      {
+        // Control characters must use the \u escape
+        anResult << "\\u" << std::hex << std::setfill('0') << std::setw(4)
+          << (int)anChar << std::dec;
+      }
+      else
+      {
+        anResult << anChar;
+      }
+    }
+
+    // Return anResult determined above
+    return anResult.str();
+  }
+
+  Uint64 BenchmarkManager::GetPeakMemory(void)
+  {
+    // Default to 0 if the peak memory can't be determined
+    Uint64 anResult = 0;
+
+#if defined(GQE_WINDOWS)
+    PROCESS_MEMORY_COUNTERS anCounters;
+    if(GetProcessMemoryInfo(GetCurrentProcess(), &anCounters, sizeof(anCounters)))
+    {
+      anResult = (Uint64)anCounters.PeakWorkingSetSize;
+    }
+#else
+    struct rusage anUsage;
+    if(getrusage(RUSAGE_SELF, &anUsage) == 0)
+    {
+#if defined(GQE_MACOS)
+      // Mac OS reports the maximum resident set size in bytes
+      anResult = (Uint64)anUsage.ru_maxrss;
+#else
+      // Linux and FreeBSD report the maximum resident set size in kilobytes
+      anResult = (Uint64)anUsage.ru_maxrss * 1024;
+#endif
+    }
+#endif
+
+    // Return anResult determined above
+    return anResult;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
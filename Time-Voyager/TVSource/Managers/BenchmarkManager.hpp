@@ -0,0 +1,226 @@
+/**
+ * Provides the BenchmarkManager class in the GQE namespace which is
+ * responsible for parsing the benchmark command line options, collecting the
+ * time spent in each game loop phase and writing the benchmark report.
+ *
+ * @file include/GQE/Core/classes/BenchmarkManager.hpp
+ * @author Ryan Lindeman
+ * @date 20130802 - Initial Release
+ * @date 20130807 - Add the hardware counters of each zone to the report
+ * @date 20130808 - Add the allocations per frame and per tag to the report
+ * @date 20130826 - Escape the scenario name written to the report
+ */
+#ifndef   CORE_BENCHMARK_MANAGER_HPP_INCLUDED
+#define   CORE_BENCHMARK_MANAGER_HPP_INCLUDED
+
+#include <string>
+#include <vector>
+#include <SFML/System.hpp>
+#include <TVSource/Core/Core_types.hpp>
+
+namespace GQE
+{
+  /// Provides command line benchmark scenarios and their JSON reports
+  class GQE_API BenchmarkManager
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Default filename to write the benchmark report to
+      static const char* DEFAULT_REPORT;
+      /// Default number of entities to create for a benchmark scenario
+      static const Uint32 DEFAULT_ENTITIES = 1000;
+      /// Default number of frames to run a benchmark scenario
+      static const Uint32 DEFAULT_FRAMES = 1000;
+      /// Default random seed to use for a benchmark scenario
+      static const Uint32 DEFAULT_SEED = 1;
+
+      /**
+       * BenchmarkManager constructor
+       */
+      BenchmarkManager();
+
+      /**
+       * BenchmarkManager deconstructor
+       */
+      virtual ~BenchmarkManager();
+
+      /**
+       * ProcessArgument is responsible for parsing a single command line
+       * argument (e.g. --bench=movement, --entities=50000, --frames=2000,
+       * --headless, --seed=N or --report=file.json).
+       * @param[in] theArgument to parse
+       * @return true if theArgument was a benchmark argument, false otherwise
+       */
+      bool ProcessArgument(const std::string theArgument);
+
+      /**
+       * IsEnabled will return true if a benchmark scenario was selected
+       * using the --bench command line argument.
+       * @return true if a benchmark scenario is to be run, false otherwise
+       */
+      bool IsEnabled(void) const;
+
+      /**
+       * IsHeadless will return true if the benchmark should be run without
+       * opening the Render window.
+       * @return true if no Render window should be opened, false otherwise
+       */
+      bool IsHeadless(void) const;
+
+      /**
+       * GetScenario will return the name of the benchmark scenario selected.
+       * @return the benchmark scenario name or an empty string if none
+       */
+      const std::string GetScenario(void) const;
+
+      /**
+       * GetEntities will return the number of entities the benchmark scenario
+       * should create.
+       * @return the number of entities to create
+       */
+      Uint32 GetEntities(void) const;
+
+      /**
+       * GetFrames will return the number of game loop frames the benchmark
+       * scenario should run before writing the report and exiting.
+       * @return the number of frames to run
+       */
+      Uint32 GetFrames(void) const;
+
+      /**
+       * GetSeed will return the random seed the benchmark scenario should use
+       * so the same scenario can be reproduced between runs.
+       * @return the random seed to use
+       */
+      Uint32 GetSeed(void) const;
+
+      /**
+       * DoInit will reset all the samples collected and reserve enough room
+       * to store the samples for every frame requested.
+       */
+      void DoInit(void);
+
+      /**
+       * AddFrame is responsible for recording the time spent in each game
+       * loop phase during the last frame.
+       * @param[in] thePhaseTimes in microseconds indexed by GameLoopPhase
+       * @return true if the requested number of frames has been reached
+       */
+      bool AddFrame(const Int64 thePhaseTimes[PhaseCount]);
+
+      /**
+       * WriteReport is responsible for writing the JSON benchmark report with
+       * the percentiles of each game loop phase, the peak memory usage, the
+       * allocations made per frame and per tag (see AllocTracker) and the
+       * hardware counters of each zone sampled by theStatManager.
+       * @param[in] theStatManager that sampled the hardware counters
+       * @return true if the report was written, false otherwise
+       */
+      bool WriteReport(const StatManager& theStatManager) const;
+
+    private:
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// The benchmark scenario to run (empty if no benchmark was requested)
+      std::string         mScenario;
+      /// The filename to write the benchmark report to
+      std::string         mReport;
+      /// The number of entities to create for the benchmark scenario
+      Uint32              mEntities;
+      /// The number of frames to run before writing the benchmark report
+      Uint32              mFrames;
+      /// The random seed to use for the benchmark scenario
+      Uint32              mSeed;
+      /// True if the benchmark should be run without a Render window
+      bool                mHeadless;
+      /// Elapsed time clock for the entire benchmark run
+      sf::Clock           mElapsedClock;
+      /// The time in microseconds recorded for each game loop phase
+      std::vector<Int64>  mSamples[PhaseCount];
+      /// The number of allocations made during each frame
+      std::vector<Int64>  mAllocSamples;
+      /// The number of bytes allocated during each frame
+      std::vector<Int64>  mByteSamples;
+      /// Total allocations made when the last frame ended
+      Uint64              mAllocCount;
+      /// Total bytes allocated when the last frame ended
+      Uint64              mAllocBytes;
+
+      /**
+       * GetPercentile will return the sample found at thePercentile provided
+       * using the nearest rank method.
+       * @param[in] theSamples sorted in ascending order
+       * @param[in] thePercentile to find in the range of [0,100]
+       * @return the sample value at thePercentile provided
+       */
+      static Int64 GetPercentile(const std::vector<Int64>& theSamples,
+        const float thePercentile);
+
+      /**
+       * EscapeString will return theString provided with each character
+       * that can't appear within a JSON string escaped.
+       * @param[in] theString to escape
+       * @return the escaped string without the surrounding quotes
+       */
+      static std::string EscapeString(const std::string& theString);
+
+      /**
+       * GetPeakMemory will return the peak resident memory (working set)
+       * used by this process so far.
+       * @return the peak resident memory in bytes or 0 if unavailable
+       */
+      static Uint64 GetPeakMemory(void);
+
+      /**
+       * BenchmarkManager copy constructor is private because we do not allow
+       * copies of our class
+       */
+      BenchmarkManager(const BenchmarkManager&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      BenchmarkManager& operator=(const BenchmarkManager&); // Intentionally undefined
+
+  }; // class BenchmarkManager
+} // namespace GQE
+
+#endif // CORE_BENCHMARK_MANAGER_HPP_INCLUDED
+
+/**
+ * @class GQE::BenchmarkManager
+ * @ingroup Core
+ * The BenchmarkManager class is used by the IApp class to run built-in load
+ * test scenarios selected from the command line, for example:
+ *
+ *   Time-Voyager --bench=movement --entities=50000 --frames=2000 --headless --seed=7
+ *
+ * When a scenario is selected the IApp class skips InitScreenFactory and
+ * makes the BenchmarkState the active state, disables vertical sync and runs
+ * exactly one UpdateFixed call per frame so each run performs the same amount
+ * of work. The time spent in each game loop phase is recorded every frame and
+ * after the requested number of frames a JSON report (benchmark.json by
+ * default) is written with the mean, min, max and percentiles of each phase
+ * and the peak resident memory of the process.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -19,10 +19,15 @@
  * @date 20110820 - Changed Read to LoadFromFile to match SFML style
  * @date 20110820 - Removed GetColor, use GetString and ParseColor instead
  * @date 20120512 - Renamed App to IApp since it really is just an interface
+ * @date 20130810 - Added GetNames
+ * @date 20130812 - Parse memory mapped files into a flat table with typed value cache
+ * @date 20130813 - Added compiled binary configuration files
+ * @date 20130814 - Parse typed values in place using the buffer Parse methods
+ * @date 20130816 - Added LoadFromMemory
  */
-
-#include <cstdio>
+#include <algorithm>
 #include <cstring>
+#include <fstream>
 #include <TVSource/Managers/ConfigReader.hpp>
 #include <TVSource/interfaces/IApp.hpp>
 #include <TVSource/loggers/Log_macros.hpp>
@@ -30,71 +35,152 @@
 
 namespace GQE
 {
-  ConfigReader::ConfigReader()
+  /// Provides the header of a compiled configuration file
+  struct ConfigReader::typeCompiledHeader
+  {
+    char   magic[COMPILED_MAGIC_LENGTH]; ///< Must be COMPILED_MAGIC
+    Uint32 version;      ///< Must be COMPILED_VERSION
+    Uint32 valueSize;    ///< Size of each name, value pair (detects layout changes)
+    Uint32 sectionCount; ///< Number of sections that follow the header
+    Uint32 valueCount;   ///< Number of name, value pairs that follow the sections
+    Uint32 indexSize;    ///< Number of index slots that follow the name, value pairs
+    Uint32 textLength;   ///< Number of characters in the string table at the end
+  };
+
+  /// Sorts the name, value pairs by section name and then by name
+  class ConfigReader::CompareValues
+  {
+    public:
+      CompareValues(const char* theData) :
+        mData(theData)
+      {
+      }
+
+      bool operator()(const typeConfigValue& theLeft, const typeConfigValue& theRight) const
+      {
+        int anResult = CompareSpans(theLeft.section, theRight.section);
+        if(0 == anResult)
+        {
+          anResult = CompareSpans(theLeft.name, theRight.name);
+        }
+        return anResult < 0;
+      }
+
+      int CompareSpans(const typeConfigSpan& theLeft, const typeConfigSpan& theRight) const
+      {
+        Uint32 anLength = std::min(theLeft.length, theRight.length);
+        int anResult = (anLength > 0) ?
+          memcmp(mData + theLeft.offset, mData + theRight.offset, anLength) : 0;
+        if(0 == anResult)
+        {
+          anResult = (theLeft.length < theRight.length) ? -1 :
+            (theLeft.length > theRight.length) ? 1 : 0;
+        }
+        return anResult;
+      }
+
+    private:
+      /// The configuration text every span refers to
+      const char* mData;
+  };
+
+  /**
+   * HashName will return the hash of theSection and theName provided which
+   * is used by the hashed index of name, value pairs (32 bit FNV-1a).
+   * @param[in] theSection name to hash
+   * @param[in] theSectionLength of theSection in characters
+   * @param[in] theName to hash
+   * @param[in] theNameLength of theName in characters
+   * @return the hash of theSection and theName
+   */
+  static Uint32 HashName(const char* theSection, const size_t theSectionLength,
+      const char* theName, const size_t theNameLength)
+  {
+    Uint32 anResult = 2166136261U;
+    for(size_t iloop = 0; iloop < theSectionLength; iloop++)
+    {
+      anResult = (anResult ^ (Uint8)theSection[iloop]) * 16777619U;
+    }
+
+    // Separate the section from the name so [ab] c and [a] bc differ
+    anResult = (anResult ^ 0xFF) * 16777619U;
+    for(size_t iloop = 0; iloop < theNameLength; iloop++)
+    {
+      anResult = (anResult ^ (Uint8)theName[iloop]) * 16777619U;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  const char* const ConfigReader::COMPILED_MAGIC = "GQECFGB1";
+
+  const char* const ConfigReader::COMPILED_SUFFIX = "b";
+
+  ConfigReader::ConfigReader() :
+    mData(NULL),
+    mLength(0),
+    mSectionTable(NULL),
+    mSectionCount(0),
+    mValueTable(NULL),
+    mValueCount(0),
+    mIndexTable(NULL),
+    mIndexSize(0)
   {
     ILOGM("ConfigReader::ctor()");
   }
 
   ConfigReader::ConfigReader(const ConfigReader& theCopy) :
-    mSections(theCopy.mSections)
+    mText(),
+    mData(NULL),
+    mLength(theCopy.mLength),
+    mSections(theCopy.mSectionTable, theCopy.mSectionTable + theCopy.mSectionCount),
+    mValues(theCopy.mValueTable, theCopy.mValueTable + theCopy.mValueCount),
+    mIndex(theCopy.mIndexTable, theCopy.mIndexTable + theCopy.mIndexSize)
   {
+    // Our spans refer to our own copy of the configuration text
+    if(mLength > 0)
+    {
+      mText.assign(theCopy.mData, mLength);
+    }
+    mData = mText.data();
+    UseTables();
   }
 
   ConfigReader::~ConfigReader()
   {
     ILOGM("ConfigReader::dtor()");
-
-    // Delete all section name, value maps
-    std::map<const std::string, typeNameValue*>::iterator iter;
-    iter = mSections.begin();
-    while(iter != mSections.end())
-    {
-      typeNameValue* anMap = iter->second;
-      mSections.erase(iter++);
-      delete anMap;
-    }
   }
 
-  bool ConfigReader::IsSectionEmpty(const std::string theSection) const
+  bool ConfigReader::IsSectionEmpty(const std::string& theSection) const
   {
     bool anResult = false;
 
     // Check if theSection really exists
-    std::map<const std::string, typeNameValue*>::const_iterator iter;
-    iter = mSections.find(theSection);
-    if(iter != mSections.end())
+    const typeConfigSection* anSection = FindSection(theSection);
+    if(NULL != anSection)
     {
-      typeNameValue* anMap = iter->second;
-      if(NULL != anMap)
-      {
-        anResult = anMap->empty();
-      }
+      anResult = (0 == anSection->count);
     }
 
     // Return the result found above or the default value of false
     return anResult;
   }
 
-  bool ConfigReader::GetBool(const std::string theSection,
-      const std::string theName, const bool theDefault) const
+  bool ConfigReader::GetBool(const std::string& theSection,
+      const std::string& theName, const bool theDefault) const
   {
     bool anResult = theDefault;
 
-    // Check if theSection really exists
-    std::map<const std::string, typeNameValue*>::const_iterator iter;
-    iter = mSections.find(theSection);
-    if(iter != mSections.end())
+    // Try to obtain the name, value pair
+    const typeConfigValue* anValue = FindValue(theSection, theName);
+    if(NULL != anValue)
     {
-      // Try to obtain the name, value pair
-      typeNameValue* anMap = iter->second;
-      if(NULL != anMap)
+      // Parse and cache the boolean value the first time it is requested
+      CacheValue(*anValue, CachedBool);
+      if(0 != (anValue->cached & CachedBoolValid))
       {
-        typeNameValueIter iterNameValue;
-        iterNameValue = anMap->find(theName);
-        if(iterNameValue != anMap->end())
-        {
-          anResult = ParseBool(iterNameValue->second, theDefault);
-        }
+        anResult = anValue->boolean;
       }
     }
 
@@ -102,26 +188,20 @@ namespace GQE
     return anResult;
   }
 
-  float ConfigReader::GetFloat(const std::string theSection,
-      const std::string theName, const float theDefault) const
+  float ConfigReader::GetFloat(const std::string& theSection,
+      const std::string& theName, const float theDefault) const
   {
     float anResult = theDefault;
 
-    // Check if theSection really exists
-    std::map<const std::string, typeNameValue*>::const_iterator iter;
-    iter = mSections.find(theSection);
-    if(iter != mSections.end())
+    // Try to obtain the name, value pair
+    const typeConfigValue* anValue = FindValue(theSection, theName);
+    if(NULL != anValue)
     {
-      // Try to obtain the name, value pair
-      typeNameValue* anMap = iter->second;
-      if(NULL != anMap)
+      // Parse and cache the floating point value the first time it is requested
+      CacheValue(*anValue, CachedFloat);
+      if(0 != (anValue->cached & CachedFloatValid))
       {
-        typeNameValueIter iterNameValue;
-        iterNameValue = anMap->find(theName);
-        if(iterNameValue != anMap->end())
-        {
-          anResult = ParseFloat(iterNameValue->second, theDefault);
-        }
+        anResult = anValue->number;
       }
     }
 
@@ -129,53 +209,57 @@ namespace GQE
     return anResult;
   }
 
-  std::string ConfigReader::GetString(const std::string theSection,
-      const std::string theName, const std::string theDefault) const
+  std::vector<std::string> ConfigReader::GetNames(const std::string& theSection) const
   {
-    std::string anResult = theDefault;
+    std::vector<std::string> anResult;
 
     // Check if theSection really exists
-    std::map<const std::string, typeNameValue*>::const_iterator iter;
-    iter = mSections.find(theSection);
-    if(iter != mSections.end())
+    const typeConfigSection* anSection = FindSection(theSection);
+    if(NULL != anSection)
     {
-      // Try to obtain the name, value pair
-      typeNameValue* anMap = iter->second;
-      if(NULL != anMap)
+      // Add the name of each name, value pair
+      anResult.reserve(anSection->count);
+      for(Uint32 iloop = 0; iloop < anSection->count; iloop++)
       {
-        typeNameValueIter iterNameValue;
-        iterNameValue = anMap->find(theName);
-        if(iterNameValue != anMap->end())
-        {
-          anResult = iterNameValue->second;
-        }
+        const typeConfigSpan& anName = mValueTable[anSection->first + iloop].name;
+        anResult.push_back(std::string(mData + anName.offset, anName.length));
       }
     }
 
+    // Return the names found above
+    return anResult;
+  }
+
+  std::string ConfigReader::GetString(const std::string& theSection,
+      const std::string& theName, const std::string theDefault) const
+  {
+    std::string anResult = theDefault;
+
+    // Try to obtain the name, value pair
+    const typeConfigValue* anValue = FindValue(theSection, theName);
+    if(NULL != anValue)
+    {
+      anResult = GetValue(*anValue);
+    }
+
     // Return the result found or theDefault assigned above
     return anResult;
   }
 
-  Uint32 ConfigReader::GetUint32(const std::string theSection,
-      const std::string theName, const Uint32 theDefault) const
+  Uint32 ConfigReader::GetUint32(const std::string& theSection,
+      const std::string& theName, const Uint32 theDefault) const
   {
     Uint32 anResult = theDefault;
 
-    // Check if theSection really exists
-    std::map<const std::string, typeNameValue*>::const_iterator iter;
-    iter = mSections.find(theSection);
-    if(iter != mSections.end())
+    // Try to obtain the name, value pair
+    const typeConfigValue* anValue = FindValue(theSection, theName);
+    if(NULL != anValue)
     {
-      // Try to obtain the name, value pair
-      typeNameValue* anMap = iter->second;
-      if(NULL != anMap)
+      // Parse and cache the unsigned 32 bit value the first time it is requested
+      CacheValue(*anValue, CachedUint32);
+      if(0 != (anValue->cached & CachedUint32Valid))
       {
-        typeNameValueIter iterNameValue;
-        iterNameValue = anMap->find(theName);
-        if(iterNameValue != anMap->end())
-        {
-          anResult = ParseUint32(iterNameValue->second, theDefault);
-        }
+        anResult = anValue->integer;
       }
     }
 
@@ -183,265 +267,592 @@ namespace GQE
     return anResult;
   }
 
-  bool ConfigReader::LoadFromFile(const std::string theFilename)
+  bool ConfigReader::LoadFromFile(const std::string& theFilename)
   {
     bool anResult = false;
-    char anLine[MAX_CHARS];
-    std::string anSection;
-    unsigned long anCount = 1;
 
     // Let the log know about the file we are about to read in
     ILOG() << "ConfigReader:Read(" << theFilename << ") opening..." << std::endl;
 
-    // Attempt to open the file
-    FILE* anFile = fopen(theFilename.c_str(), "r");
+    // Forget any configuration previously loaded
+    Clear();
 
-    // Read from the file if successful
-    if(NULL != anFile)
+    // Attempt to map the file into memory
+    if(mFile.Open(theFilename))
     {
-      // Keep reading from configuration file until we reach the end of file marker
-      while(!feof(anFile))
+      // Tokenize the file contents in place
+      mData = mFile.GetData();
+      mLength = mFile.GetSize();
+      Parse(mData, mLength);
+
+      ILOG() << "ConfigReader::Read(" << theFilename << ") read "
+        << mValueCount << " values in " << mSectionCount
+        << " sections" << std::endl;
+
+      // Set success result
+      anResult = true;
+    }
+    else
+    {
+      ELOG() << "ConfigReader::Read(" << theFilename << ") error opening file" << std::endl;
+    }
+
+    // Return anResult of true if successful, false otherwise
+    return anResult;
+  }
+
+  bool ConfigReader::LoadFromMemory(const char* theData, const size_t theLength)
+  {
+    bool anResult = false;
+
+    // Forget any configuration previously loaded
+    Clear();
+
+    if(NULL != theData && theLength > 0)
+    {
+      // Tokenize the configuration text in place
+      mData = theData;
+      mLength = theLength;
+      Parse(mData, mLength);
+
+      ILOG() << "ConfigReader::LoadFromMemory() read "
+        << mValueCount << " values in " << mSectionCount
+        << " sections" << std::endl;
+
+      // Set success result
+      anResult = true;
+    }
+    else
+    {
+      ELOG() << "ConfigReader::LoadFromMemory() bad memory location or size" << std::endl;
+    }
+
+    // Return anResult of true if successful, false otherwise
+    return anResult;
+  }
+
+  bool ConfigReader::LoadFromCompiled(const std::string& theFilename)
+  {
+    bool anResult = false;
+
+    // Let the log know about the file we are about to read in
+    ILOG() << "ConfigReader::LoadFromCompiled(" << theFilename << ") opening..." << std::endl;
+
+    // Forget any configuration previously loaded
+    Clear();
+
+    // Attempt to map the compiled file into memory
+    if(mFile.Open(theFilename) && mFile.GetSize() >= sizeof(typeCompiledHeader))
+    {
+      const char* anData = mFile.GetData();
+      const typeCompiledHeader* anHeader = (const typeCompiledHeader*)anData;
+
+      // Make sure the compiled file was written by this version and platform
+      size_t anSize = sizeof(typeCompiledHeader);
+      if(memcmp(anHeader->magic, COMPILED_MAGIC, COMPILED_MAGIC_LENGTH) == 0 &&
+          anHeader->version == COMPILED_VERSION &&
+          anHeader->valueSize == sizeof(typeConfigValue) &&
+          (0 == anHeader->indexSize ||
+            (0 == (anHeader->indexSize & (anHeader->indexSize - 1)) &&
+            anHeader->indexSize > anHeader->valueCount)))
+      {
+        anSize += (size_t)anHeader->sectionCount * sizeof(typeConfigSection) +
+          (size_t)anHeader->valueCount * sizeof(typeConfigValue) +
+          (size_t)anHeader->indexSize * sizeof(Uint32) + anHeader->textLength;
+        anResult = (anSize == mFile.GetSize());
+      }
+
+      if(anResult)
       {
-        // Get the first line from the file
-        if(fgets(anLine, MAX_CHARS, anFile) == NULL)
+        // Use each table in place from the mapping
+        mSectionTable = (const typeConfigSection*)(anHeader + 1);
+        mSectionCount = anHeader->sectionCount;
+        mValueTable = (const typeConfigValue*)(mSectionTable + mSectionCount);
+        mValueCount = anHeader->valueCount;
+        mIndexTable = (const Uint32*)(mValueTable + mValueCount);
+        mIndexSize = anHeader->indexSize;
+        mData = (const char*)(mIndexTable + mIndexSize);
+        mLength = anHeader->textLength;
+
+        // Make sure every span and range is within its table, the mapping is
+        // read only so every typed value must have been parsed already
+        const Uint32 anCached = CachedBool | CachedFloat | CachedUint32;
+        for(Uint32 iloop = 0; anResult && iloop < mSectionCount; iloop++)
         {
-          // Log the failure to read a line from the file if not at the end of the file
-          if(!feof(anFile))
-          {
-            ELOG() << "ConfigReader::Read(" << anFile << ") error reading line " << anCount << std::endl;
-          }
-          // Exit our while loop, were done!
-          break;
+          const typeConfigSection& anSection = mSectionTable[iloop];
+          anResult = anSection.name.offset <= mLength &&
+            anSection.name.length <= mLength - anSection.name.offset &&
+            anSection.first <= mValueCount &&
+            anSection.count <= mValueCount - anSection.first;
         }
-        else
+        for(Uint32 iloop = 0; anResult && iloop < mValueCount; iloop++)
         {
-          // Parse the line
-          anSection = ParseLine(anLine, anCount, anSection);
+          const typeConfigValue& anValue = mValueTable[iloop];
+          anResult = (anValue.cached & anCached) == anCached &&
+            anValue.section.offset <= mLength &&
+            anValue.section.length <= mLength - anValue.section.offset &&
+            anValue.name.offset <= mLength &&
+            anValue.name.length <= mLength - anValue.name.offset &&
+            anValue.value.offset <= mLength &&
+            anValue.value.length <= mLength - anValue.value.offset;
+        }
+        for(Uint32 iloop = 0; anResult && iloop < mIndexSize; iloop++)
+        {
+          anResult = mIndexTable[iloop] <= mValueCount;
         }
-
-        // Increment our Line counter
-        anCount++;
       }
+    }
 
-      // Don't forget to close the file
-      fclose(anFile);
-
-      // Set success result
-      anResult = true;
+    if(anResult)
+    {
+      ILOG() << "ConfigReader::LoadFromCompiled(" << theFilename << ") read "
+        << mValueCount << " values in " << mSectionCount
+        << " sections" << std::endl;
     }
     else
     {
-      ELOG() << "ConfigReader::Read(" << theFilename << ") error opening file" << std::endl;
+      ELOG() << "ConfigReader::LoadFromCompiled(" << theFilename
+        << ") error opening file or invalid compiled file" << std::endl;
+      Clear();
     }
 
     // Return anResult of true if successful, false otherwise
     return anResult;
   }
 
+  bool ConfigReader::SaveToCompiled(const std::string& theFilename) const
+  {
+    bool anResult = false;
+
+    // Pack the section names, names and values into a new string table
+    std::string anText;
+    std::vector<typeConfigSection> anSections(mSectionTable, mSectionTable + mSectionCount);
+    std::vector<typeConfigValue> anValues(mValueTable, mValueTable + mValueCount);
+    for(Uint32 iloop = 0; iloop < mSectionCount; iloop++)
+    {
+      typeConfigSection& anSection = anSections[iloop];
+      typeConfigSpan anName = anSection.name;
+      anSection.name.offset = (Uint32)anText.length();
+      anText.append(mData + anName.offset, anName.length);
+
+      // Every name, value pair of a section shares the section name
+      for(Uint32 jloop = anSection.first; jloop < anSection.first + anSection.count; jloop++)
+      {
+        typeConfigValue& anValue = anValues[jloop];
+        anValue.section = anSection.name;
+        anValue.name.offset = (Uint32)anText.length();
+        anText.append(mData + mValueTable[jloop].name.offset, anValue.name.length);
+        anValue.value.offset = (Uint32)anText.length();
+        anText.append(mData + mValueTable[jloop].value.offset, anValue.value.length);
+
+        // Parse every typed value now so they never need to be parsed again
+        CacheValue(mValueTable[jloop], CachedBool | CachedFloat | CachedUint32);
+        anValue.cached = mValueTable[jloop].cached;
+        anValue.boolean = mValueTable[jloop].boolean;
+        anValue.number = mValueTable[jloop].number;
+        anValue.integer = mValueTable[jloop].integer;
+      }
+    }
+
+    typeCompiledHeader anHeader;
+    memset(&anHeader, 0, sizeof(anHeader));
+    memcpy(anHeader.magic, COMPILED_MAGIC, COMPILED_MAGIC_LENGTH);
+    anHeader.version = COMPILED_VERSION;
+    anHeader.valueSize = sizeof(typeConfigValue);
+    anHeader.sectionCount = mSectionCount;
+    anHeader.valueCount = mValueCount;
+    anHeader.indexSize = mIndexSize;
+    anHeader.textLength = (Uint32)anText.length();
+
+    std::ofstream anFile(theFilename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if(anFile.is_open())
+    {
+      anFile.write((const char*)&anHeader, sizeof(anHeader));
+      if(!anSections.empty())
+      {
+        anFile.write((const char*)&anSections[0], anSections.size() * sizeof(typeConfigSection));
+      }
+      if(!anValues.empty())
+      {
+        anFile.write((const char*)&anValues[0], anValues.size() * sizeof(typeConfigValue));
+      }
+      if(mIndexSize > 0)
+      {
+        anFile.write((const char*)mIndexTable, mIndexSize * sizeof(Uint32));
+      }
+      anFile.write(anText.data(), anText.length());
+      anFile.close();
+      anResult = !anFile.fail();
+    }
+
+    if(!anResult)
+    {
+      ELOG() << "ConfigReader::SaveToCompiled(" << theFilename << ") error writing file" << std::endl;
+    }
+
+    // Return anResult of true if successful, false otherwise
+    return anResult;
+  }
+
+  std::string ConfigReader::GetCompiledFilename(const std::string& theFilename)
+  {
+    return theFilename + COMPILED_SUFFIX;
+  }
+
   ConfigReader& ConfigReader::operator=(const ConfigReader& theRight)
   {
     // Use copy constructor to duplicate theRight side
     ConfigReader temp(theRight);
 
     // Now swap my local copy with the copy from theRight
+    std::swap(mText, temp.mText);
+    std::swap(mLength, temp.mLength);
     std::swap(mSections, temp.mSections);
+    std::swap(mValues, temp.mValues);
+    std::swap(mIndex, temp.mIndex);
+
+    // Our spans now refer to our own copy of the configuration text
+    mFile.Close();
+    mData = mText.data();
+    UseTables();
 
     // Return my pointer
     return *this;
   }
 
-  std::string ConfigReader::ParseLine(const char* theLine,
-      const unsigned long theCount, const std::string theSection)
+  void ConfigReader::Clear(void)
   {
-    std::string anResult = theSection;
-    size_t anLength = strlen(theLine);
-    if(anLength > 1)
+    mFile.Close();
+    mText.clear();
+    mData = NULL;
+    mLength = 0;
+    mSections.clear();
+    mValues.clear();
+    mIndex.clear();
+    UseTables();
+  }
+
+  void ConfigReader::UseTables(void)
+  {
+    mSectionTable = mSections.empty() ? NULL : &mSections[0];
+    mSectionCount = (Uint32)mSections.size();
+    mValueTable = mValues.empty() ? NULL : &mValues[0];
+    mValueCount = (Uint32)mValues.size();
+    mIndexTable = mIndex.empty() ? NULL : &mIndex[0];
+    mIndexSize = (Uint32)mIndex.size();
+  }
+
+  void ConfigReader::BuildIndex(void)
+  {
+    // Use a power of 2 number of slots that is always at most half full
+    Uint32 anSize = 0;
+    if(!mValues.empty())
     {
+      anSize = 8;
+      while(anSize < mValues.size() * 2)
+      {
+        anSize <<= 1;
+      }
+    }
+    mIndex.assign(anSize, 0);
+
+    // Each slot holds the index of the name, value pair plus 1 (0 is empty)
+    for(Uint32 iloop = 0; iloop < mValues.size(); iloop++)
+    {
+      const typeConfigValue& anValue = mValues[iloop];
+      Uint32 anSlot = HashName(mData + anValue.section.offset, anValue.section.length,
+        mData + anValue.name.offset, anValue.name.length) & (anSize - 1);
+      while(0 != mIndex[anSlot])
+      {
+        anSlot = (anSlot + 1) & (anSize - 1);
+      }
+      mIndex[anSlot] = iloop + 1;
+    }
+  }
+
+  void ConfigReader::Parse(const char* theData, const size_t theLength)
+  {
+    typeConfigSpan anSection = {0, 0};
+    Uint32 anCount = 1;
+    size_t anOffset = 0;
+
+    // Tokenize each line in a single pass without copying any characters
+    while(anOffset < theLength)
+    {
+      // Find the end of this line and the start of the next line
+      size_t anStart = anOffset;
+      const char* anNewline = (const char*)memchr(theData + anOffset, '\n', theLength - anOffset);
+      size_t anEnd = (NULL != anNewline) ? (size_t)(anNewline - theData) : theLength;
+      anOffset = anEnd + 1;
+
+      // Ignore the carriage return of DOS line endings
+      while(anEnd > anStart && theData[anEnd-1] == '\r')
+      {
+        anEnd--;
+      }
+
       // Skip preceeding spaces at the begining of the line
-      size_t anOffset = 0;
-      while(anOffset < anLength && theLine[anOffset] == ' ')
+      while(anStart < anEnd && (theData[anStart] == ' ' || theData[anStart] == '\t'))
       {
-        anOffset++;
+        anStart++;
       }
 
-      // Now check for comments
-      if(theLine[anOffset] != '#' && theLine[anOffset] != ';')
+      // Skip empty lines and comments
+      if(anStart < anEnd && theData[anStart] != '#' && theData[anStart] != ';')
       {
         // Next check for the start of a new section
-        if(theLine[anOffset] == '[')
+        if(theData[anStart] == '[')
         {
-          // Skip over the begin section marker '['
-          anOffset++;
-
-          // Skip preceeding spaces of section name
-          while(anOffset < anLength && theLine[anOffset] == ' ')
+          // Skip over the begin section marker '[' and preceeding spaces
+          anStart++;
+          while(anStart < anEnd && theData[anStart] == ' ')
           {
-            anOffset++;
+            anStart++;
           }
 
-          // Retrieve the section name while looking for the section end marker ']'
-          size_t anIndex = 0;
-          char anSection[MAX_CHARS] = {0};
-          while((anOffset+anIndex) < anLength && theLine[anOffset+anIndex] != ']')
+          // Look for the section end marker ']' and remove trailing spaces
+          const char* anMarker = (const char*)memchr(theData + anStart, ']', anEnd - anStart);
+          size_t anLast = (NULL != anMarker) ? (size_t)(anMarker - theData) : anStart;
+          while(anLast > anStart && theData[anLast-1] == ' ')
           {
-            // Retrieve the section name from theLine
-            anSection[anIndex] = theLine[anOffset+anIndex];
-
-            // Increment anIndex
-            anIndex++;
-          }
-          // Add null terminator
-          anSection[anIndex] = '\0';
-          // Remove trailing spaces
-          while(anIndex > 0 && anSection[anIndex-1] == ' ')
-          {
-            // Put a null terminator at the end of the section name
-            anSection[--anIndex] = '\0';
+            anLast--;
           }
 
           // Only update the current section name if we found the section end
-          // marker before the end of the line
-          if((anOffset+anIndex) < anLength && anIndex > 0)
+          // marker and the section name isn't empty
+          if(NULL != anMarker && anLast > anStart)
           {
-            // Change the return string to the newly parsed section name
-            anResult = anSection;
+            anSection.offset = (Uint32)anStart;
+            anSection.length = (Uint32)(anLast - anStart);
           }
           else
           {
-            ELOG() << "ConfigReader::ParseLine(" << theCount << ") missing section end marker ']'" << std::endl;
+            ELOG() << "ConfigReader::ParseLine(" << anCount << ") missing section end marker ']'" << std::endl;
           }
         }
         // Just read the name=value pair into the current section
         else
         {
-          // Retrieve the name and value while looking for the comment flags ';' or '#'
-          size_t anNameIndex = 0;
-          char anName[MAX_CHARS];
-
-          // First retrieve the name while looking for either the '=' or ':' delimiter
-          while((anOffset+anNameIndex) < anLength &&
-              theLine[(anOffset+anNameIndex)] != '=' &&
-              theLine[(anOffset+anNameIndex)] != ':')
+          // First find either the '=' or ':' delimiter
+          size_t anDelimiter = anStart;
+          while(anDelimiter < anEnd &&
+              theData[anDelimiter] != '=' && theData[anDelimiter] != ':')
           {
-            // Retrieve anName from theLine
-            anName[anNameIndex] = theLine[anOffset+anNameIndex];
-
-            // Increment anNameIndex
-            anNameIndex++;
+            anDelimiter++;
           }
-          // Assign our starting offset value
-          anOffset += anNameIndex;
-          // Put a null terminator at the end of the name
-          anName[anNameIndex] = '\0';
+
           // Remove trailing spaces from the name
-          while(anNameIndex > 0 && anName[anNameIndex-1] == ' ')
+          size_t anLast = anDelimiter;
+          while(anLast > anStart && theData[anLast-1] == ' ')
           {
-            // Put a null terminator at the end of the name
-            anName[--anNameIndex] = '\0';
+            anLast--;
           }
 
-          // Only search for the value if we found the '=' or ':' delimiter
-          if(anOffset < anLength && anNameIndex > 0)
+          // Only retrieve the value if we found the '=' or ':' delimiter
+          if(anDelimiter < anEnd && anLast > anStart)
           {
-            size_t anValueIndex = 0;
-            char anValue[MAX_CHARS];
-
-            // Skip over the delimiter between name and value '=' or ':'
-            anOffset++;
-
-            // Skip preceeding spaces
-            while(anOffset < anLength && theLine[anOffset] == ' ')
+            typeConfigValue anValue;
+            anValue.section = anSection;
+            anValue.name.offset = (Uint32)anStart;
+            anValue.name.length = (Uint32)(anLast - anStart);
+            anValue.line = anCount;
+            anValue.cached = 0;
+            anValue.boolean = false;
+            anValue.number = 0.f;
+            anValue.integer = 0;
+
+            // Skip over the delimiter and preceeding spaces
+            size_t anFirst = anDelimiter + 1;
+            while(anFirst < anEnd && theData[anFirst] == ' ')
             {
-              anOffset++;
+              anFirst++;
             }
-            // Next retrieve the value while looking for comments flags ';' or '#'
-            while((anOffset + anValueIndex) < anLength &&
-                theLine[(anOffset+anValueIndex)] != '\r' &&
-                theLine[(anOffset+anValueIndex)] != '\n' &&
-                theLine[(anOffset+anValueIndex)] != ';' &&
-                theLine[(anOffset+anValueIndex)] != '#')
-            {
-              // Retrieve anValue from theLine
-              anValue[anValueIndex] = theLine[anOffset+anValueIndex];
 
-              // Increment anValueIndex
-              anValueIndex++;
+            // The value ends at the comment flags ';' or '#'
+            anLast = anFirst;
+            while(anLast < anEnd && theData[anLast] != ';' && theData[anLast] != '#')
+            {
+              anLast++;
             }
-            // Put a null terminator at the end of the section name
-            anValue[anValueIndex] = '\0';
-            // Remove trailing spaces from the name
-            while(anValueIndex > 0 && anValue[anValueIndex-1] == ' ')
+
+            // Remove trailing spaces from the value
+            while(anLast > anFirst && theData[anLast-1] == ' ')
             {
-              // Put a null terminator at the end of the name
-              anValue[--anValueIndex] = '\0';
+              anLast--;
             }
+            anValue.value.offset = (Uint32)anFirst;
+            anValue.value.length = (Uint32)(anLast - anFirst);
 
             // Store the name,value pair obtained into the current section
-            StoreNameValue(theSection,anName,anValue);
+            mValues.push_back(anValue);
           }
           else
           {
-            ELOG() << "ConfigReader::ParseLine(" << theCount << ") missing name or value delimiter of '=' or ':'" << std::endl;
+            ELOG() << "ConfigReader::ParseLine(" << anCount << ") missing name or value delimiter of '=' or ':'" << std::endl;
           }
         }
-      } // if(theLine[anOffset] != '#' && theLine[anOffset] != ';') // Not a comment
-    } // if(anLength > 1)
+      } // if(anStart < anEnd && ...) // Not empty or a comment
 
-    // Return either the previous section name or the new section name found
-    return anResult;
-  }
+      // Increment our Line counter
+      anCount++;
+    }
 
-  void ConfigReader::StoreNameValue(const std::string theSection,
-      const std::string theName, const std::string theValue)
-  {
-    // Check if the name, value map already exists for theSection
-    std::map<const std::string, typeNameValue*>::iterator iterSection;
-    iterSection = mSections.find(theSection);
-    if(iterSection == mSections.end())
-    {
-      // First try to create a new name, value pair map for this new section
-      typeNameValue* anMap = new(std::nothrow) typeNameValue;
+    // Sort the name, value pairs while keeping the first of any duplicates first
+    CompareValues anCompare(theData);
+    std::stable_sort(mValues.begin(), mValues.end(), anCompare);
 
-      // Make sure we were able to create the map ok
-      if(NULL != anMap)
+    // Remove the duplicates and create the table of sections
+    size_t anKept = 0;
+    for(size_t iloop = 0; iloop < mValues.size(); iloop++)
+    {
+      const typeConfigValue& anValue = mValues[iloop];
+      if(anKept > 0 && !anCompare(mValues[anKept-1], anValue))
+      {
+        ELOG() << "ConfigReader::StoreNameValue(" << anValue.line
+          << ") unable to add (" << std::string(theData + anValue.name.offset, anValue.name.length)
+          << "," << GetValue(anValue) << ") already exists!" << std::endl;
+      }
+      else
       {
-        ILOG() << "ConfigReader::StoreNameValue(" << theSection << ") adding (" << theName << "," << theValue << ")" << std::endl;
+        // Start a new section if the section name changed
+        if(mSections.empty() ||
+            0 != anCompare.CompareSpans(mSections.back().name, anValue.section))
+        {
+          typeConfigSection anSection;
+          anSection.name = anValue.section;
+          anSection.first = (Uint32)anKept;
+          anSection.count = 0;
+          mSections.push_back(anSection);
+        }
+        mSections.back().count++;
+        mValues[anKept++] = anValue;
+      }
+    }
+    mValues.resize(anKept);
 
-        // Add the new name, value pair to this map
-        anMap->insert(std::pair<const std::string, const std::string>(theName,theValue));
+    // Create the hashed index and use the tables created above
+    BuildIndex();
+    UseTables();
+  }
+
+  const ConfigReader::typeConfigSection* ConfigReader::FindSection(
+      const std::string& theSection) const
+  {
+    const typeConfigSection* anResult = NULL;
 
-        // Add the new name, value pair map for this new section
-        mSections.insert(std::pair<const std::string, typeNameValue*>(theSection, anMap));
+    // Binary search the sections sorted by name
+    size_t anLow = 0;
+    size_t anHigh = mSectionCount;
+    while(anLow < anHigh)
+    {
+      size_t anMiddle = anLow + (anHigh - anLow) / 2;
+      int anCompare = Compare(mSectionTable[anMiddle].name,
+        theSection.data(), theSection.length());
+      if(anCompare < 0)
+      {
+        anLow = anMiddle + 1;
+      }
+      else if(anCompare > 0)
+      {
+        anHigh = anMiddle;
       }
       else
       {
-        ELOG() << "ConfigReader::StoreNameValue(" << theSection << ") unable to add (" << theName << "," << theValue << ") out of memory!" << std::endl;
+        anResult = &mSectionTable[anMiddle];
+        break;
       }
     }
-    else
-    {
-      // Retrieve the existing name, value pair map
-      typeNameValue* anMap = iterSection->second;
 
-      // Make sure we were able to retrieve the map ok
-      if(NULL != anMap)
-      {
-        // Make sure the name, value pair doesn't already in the map
-        typeNameValueIter iterNameValue;
-        iterNameValue = anMap->find(theName);
-        if(iterNameValue == anMap->end())
-        {
-          ILOG() << "ConfigReader::StoreNameValue(" << theSection << ") adding (" << theName << "," << theValue << ")" << std::endl;
+    // Return the section found above or NULL if it doesn't exist
+    return anResult;
+  }
 
-          // Add the new name, value pair to this map
-          anMap->insert(std::pair<const std::string, const std::string>(theName,theValue));
-        }
-        else
+  const ConfigReader::typeConfigValue* ConfigReader::FindValue(
+      const std::string& theSection, const std::string& theName) const
+  {
+    const typeConfigValue* anResult = NULL;
+
+    if(mIndexSize > 0)
+    {
+      // Probe the hashed index until the name, value pair or an empty slot is found
+      Uint32 anSlot = HashName(theSection.data(), theSection.length(),
+        theName.data(), theName.length()) & (mIndexSize - 1);
+      for(Uint32 iloop = 0; iloop < mIndexSize && 0 != mIndexTable[anSlot]; iloop++)
+      {
+        const typeConfigValue& anValue = mValueTable[mIndexTable[anSlot] - 1];
+        if(0 == Compare(anValue.name, theName.data(), theName.length()) &&
+            0 == Compare(anValue.section, theSection.data(), theSection.length()))
         {
-          ELOG() << "ConfigReader::StoreNameValue(" << theSection << ") unable to add (" << theName << "," << theValue << ") already exists!" << std::endl;
+          anResult = &anValue;
+          break;
         }
+        anSlot = (anSlot + 1) & (mIndexSize - 1);
       }
-    } // else(iterSection == mSections.end())
+    }
+
+    // Return the value found above or NULL if it doesn't exist
+    return anResult;
+  }
+
+  void ConfigReader::CacheValue(const typeConfigValue& theValue, const Uint32 theTypes) const
+  {
+    // Parse the value in place, a value is only valid if parsing it with two
+    // different defaults returns the same result (the default wasn't used)
+    const char* anValue = mData + theValue.value.offset;
+    const size_t anLength = theValue.value.length;
+
+    if(0 != (theTypes & CachedBool) && 0 == (theValue.cached & CachedBool))
+    {
+      theValue.boolean = ParseBool(anValue, anLength, false);
+      Uint32 anCached = CachedBool;
+      if(theValue.boolean == ParseBool(anValue, anLength, true))
+      {
+        anCached |= CachedBoolValid;
+      }
+      theValue.cached |= anCached;
+    }
+
+    if(0 != (theTypes & CachedFloat) && 0 == (theValue.cached & CachedFloat))
+    {
+      theValue.number = ParseFloat(anValue, anLength, 0.f);
+      Uint32 anCached = CachedFloat;
+      if(theValue.number == ParseFloat(anValue, anLength, 1.f))
+      {
+        anCached |= CachedFloatValid;
+      }
+      theValue.cached |= anCached;
+    }
+
+    if(0 != (theTypes & CachedUint32) && 0 == (theValue.cached & CachedUint32))
+    {
+      theValue.integer = ParseUint32(anValue, anLength, 0);
+      Uint32 anCached = CachedUint32;
+      if(theValue.integer == ParseUint32(anValue, anLength, 1))
+      {
+        anCached |= CachedUint32Valid;
+      }
+      theValue.cached |= anCached;
+    }
+  }
+
+  std::string ConfigReader::GetValue(const typeConfigValue& theValue) const
+  {
+    return std::string(mData + theValue.value.offset, theValue.value.length);
+  }
+
+  int ConfigReader::Compare(const typeConfigSpan& theSpan, const char* theString,
+      const size_t theLength) const
+  {
+    size_t anLength = std::min((size_t)theSpan.length, theLength);
+    int anResult = (anLength > 0) ? memcmp(mData + theSpan.offset, theString, anLength) : 0;
+    if(0 == anResult)
+    {
+      anResult = (theSpan.length < theLength) ? -1 :
+        (theSpan.length > theLength) ? 1 : 0;
+    }
+
+    // Return anResult determined above
+    return anResult;
   }
 
 } // namespace GQE
@@ -17,13 +17,18 @@
  * @date 20110820 - Moved private Parse methods to StringUtil.hpp/cpp
  * @date 20110820 - Changed Read to LoadFromFile to match SFML style
  * @date 20110820 - Removed GetColor, use GetString and ParseColor instead
+ * @date 20130810 - Added GetNames
+ * @date 20130812 - Parse memory mapped files into a flat table with typed value cache
+ * @date 20130813 - Added compiled binary configuration files
+ * @date 20130816 - Added LoadFromMemory
  */
 #ifndef   CORE_CONFIG_READER_HPP_INCLUDED
 #define   CORE_CONFIG_READER_HPP_INCLUDED
 
-#include <map>
 #include <string>
+#include <vector>
 #include <TVSource/Core/Core_types.hpp>
+#include <TVSource/Utils/MappedFile.hpp>
 
 namespace GQE
 {
@@ -31,6 +36,17 @@ namespace GQE
   class GQE_API ConfigReader
   {
     public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Text found at the start of every compiled configuration file
+      static const char* const COMPILED_MAGIC;
+      /// Length of COMPILED_MAGIC in characters
+      static const Uint32 COMPILED_MAGIC_LENGTH = 8;
+      /// Version of the compiled configuration file format
+      static const Uint32 COMPILED_VERSION = 1;
+      /// Suffix appended to the filename of a compiled configuration file
+      static const char* const COMPILED_SUFFIX;
+
       /**
        * ConfigReader constructor
        */
@@ -54,7 +70,7 @@ namespace GQE
        * @param[in] theSection to check
        * @return true if theSection provided exists
        */
-      bool IsSectionEmpty(const std::string theSection) const;
+      bool IsSectionEmpty(const std::string& theSection) const;
 
       /**
        * GetBool will return the boolean value for theSection and theName
@@ -66,7 +82,7 @@ namespace GQE
        * @param[in] theDefault to use if the value is not found (optional)
        * @return the value found or theDefault if not found or correct
        */
-      bool GetBool(const std::string theSection, const std::string theName,
+      bool GetBool(const std::string& theSection, const std::string& theName,
           const bool theDefault = false) const;
 
       /**
@@ -78,9 +94,17 @@ namespace GQE
        * @param[in] theDefault to use if the value is not found (optional)
        * @return the value found or theDefault if not found or correct
        */
-      float GetFloat(const std::string theSection, const std::string theName,
+      float GetFloat(const std::string& theSection, const std::string& theName,
           const float theDefault = 0.f) const;
 
+      /**
+       * GetNames will return the name of each name, value pair found in
+       * theSection provided or an empty list if theSection does not exist.
+       * @param[in] theSection to return the names of
+       * @return the names found in theSection
+       */
+      std::vector<std::string> GetNames(const std::string& theSection) const;
+
       /**
        * GetString will return the string value for theSection and theName
        * specified or theDefault("") if the section or name does not exist.
@@ -89,8 +113,8 @@ namespace GQE
        * @param[in] theDefault to use if the value is not found (optional)
        * @return the value found or theDefault if not found
        */
-      std::string GetString(const std::string theSection,
-          const std::string theName, const std::string theDefault = "") const;
+      std::string GetString(const std::string& theSection,
+          const std::string& theName, const std::string theDefault = "") const;
 
       /**
        * GetUint32 will return an unsigned 32 bit number for theSection and
@@ -101,7 +125,7 @@ namespace GQE
        * @param[in] theDefault to use if the value is not found (optional)
        * @return the value found or theDefault if not found
        */
-      Uint32 GetUint32(const std::string theSection, const std::string theName,
+      Uint32 GetUint32(const std::string& theSection, const std::string& theName,
           const Uint32 theDefault = 0) const;
 
       /**
@@ -110,7 +134,44 @@ namespace GQE
        * @param[in] theFilename to use as the configuration file to read
        * @result true if theFilename was found and opened successfully
        */
-      bool LoadFromFile(const std::string theFilename);
+      bool LoadFromFile(const std::string& theFilename);
+
+      /**
+       * LoadFromMemory will read the configuration text found at theData
+       * provided (e.g. an AssetPack mapping) in place without copying it.
+       * theData must remain valid until this ConfigReader is cleared,
+       * reloaded or deleted.
+       * @param[in] theData of the configuration text to read
+       * @param[in] theLength of theData in characters
+       * @result true if theData provided was valid
+       */
+      bool LoadFromMemory(const char* theData, const size_t theLength);
+
+      /**
+       * LoadFromCompiled will map the compiled configuration file specified
+       * (see SaveToCompiled) into memory and use its tables in place without
+       * parsing or copying them.
+       * @param[in] theFilename of the compiled configuration file to read
+       * @result true if theFilename was found and is a valid compiled file
+       */
+      bool LoadFromCompiled(const std::string& theFilename);
+
+      /**
+       * SaveToCompiled will write the configuration read so far into
+       * theFilename specified as a compiled configuration file containing a
+       * string table, every typed value already parsed and a hashed index.
+       * @param[in] theFilename of the compiled configuration file to write
+       * @result true if theFilename was written successfully
+       */
+      bool SaveToCompiled(const std::string& theFilename) const;
+
+      /**
+       * GetCompiledFilename will return the filename of the compiled
+       * configuration file for the configuration file specified.
+       * @param[in] theFilename of the configuration file
+       * @return theFilename with COMPILED_SUFFIX appended
+       */
+      static std::string GetCompiledFilename(const std::string& theFilename);
 
       /**
        * Assignment operator will duplicate the information found in theRight
@@ -121,34 +182,150 @@ namespace GQE
       ConfigReader& operator=(const ConfigReader& theRight);
 
     private:
-      // Constants
-      ///////////////////////////////////////////////////////////////////////////
-      static const unsigned short MAX_CHARS = 100;
+      /// Enumeration of the typed values cached by each name, value pair
+      enum CachedType
+      {
+        CachedBool          = 0x01, ///< The boolean value has been parsed
+        CachedBoolValid     = 0x02, ///< The value is a valid boolean value
+        CachedFloat         = 0x04, ///< The floating point value has been parsed
+        CachedFloatValid    = 0x08, ///< The value is a valid floating point number
+        CachedUint32        = 0x10, ///< The unsigned 32 bit value has been parsed
+        CachedUint32Valid   = 0x20  ///< The value is a valid unsigned 32 bit number
+      };
+
+      /// Provides the location of a string within the configuration text
+      struct typeConfigSpan
+      {
+        Uint32 offset; ///< Offset of the first character in the text
+        Uint32 length; ///< Number of characters in the string
+      };
+
+      /// Provides a single name, value pair and its cached typed values
+      struct typeConfigValue
+      {
+        typeConfigSpan section; ///< The section this name, value pair belongs to
+        typeConfigSpan name;    ///< The name of this name, value pair
+        typeConfigSpan value;   ///< The value of this name, value pair
+        Uint32         line;    ///< The line number this pair was read from
+        mutable Uint32 cached;  ///< The CachedType flags of each value parsed
+        mutable bool   boolean; ///< The cached boolean value
+        mutable float  number;  ///< The cached floating point value
+        mutable Uint32 integer; ///< The cached unsigned 32 bit value
+      };
+
+      /// Provides the range of name, value pairs of a single section
+      struct typeConfigSection
+      {
+        typeConfigSpan name;  ///< The name of this section
+        Uint32         first; ///< Index of the first name, value pair
+        Uint32         count; ///< Number of name, value pairs in this section
+      };
+
+      /// Provides the header of a compiled configuration file
+      struct typeCompiledHeader;
 
       // Variables
       ///////////////////////////////////////////////////////////////////////////
-      /// Map to store all the sections and their corresponding name=value pairs
-      std::map<const std::string, typeNameValue*> mSections;
+      /// The file mapped that contains the configuration text or tables
+      MappedFile                     mFile;
+      /// Copy of the configuration text when it was copied from another reader
+      std::string                    mText;
+      /// The configuration text every span refers to
+      const char*                    mData;
+      /// The number of characters in mData
+      size_t                         mLength;
+      /// Every section parsed from the configuration text sorted by name
+      std::vector<typeConfigSection> mSections;
+      /// Every name, value pair parsed sorted by section name and then by name
+      std::vector<typeConfigValue>   mValues;
+      /// Hashed index of every name, value pair parsed
+      std::vector<Uint32>            mIndex;
+      /// The table of sections used (mSections or the compiled file)
+      const typeConfigSection*       mSectionTable;
+      /// The number of sections in mSectionTable
+      Uint32                         mSectionCount;
+      /// The table of name, value pairs used (mValues or the compiled file)
+      const typeConfigValue*         mValueTable;
+      /// The number of name, value pairs in mValueTable
+      Uint32                         mValueCount;
+      /// The hashed index used (mIndex or the compiled file)
+      const Uint32*                  mIndexTable;
+      /// The number of slots in mIndexTable (0 or a power of 2)
+      Uint32                         mIndexSize;
 
       /**
-       * ParseLine will parse the line provided by the Read method above.
-       * @param theLine to be parsed.
-       * @param theCount is the line number currently being processed
-       * @param theSection to be used if name, value pair is parsed
-       * @return string representing the new section name if section name was parsed
+       * Clear will forget any configuration previously loaded.
        */
-      std::string ParseLine(const char* theLine, const unsigned long theCount,
-          const std::string theSection);
+      void Clear(void);
 
       /**
-       * StoreNameValue will store theName and theValue pair into theSection.
-       * If theSection name value map doesn't yet exist, then it will be created.
-       * @param theSection is used to find the name, value pair map
-       * @param theName to be stored as the key for theValue below
-       * @param theValue to be stored in the current section name
+       * UseTables will point the tables used by each Get* method at the
+       * tables parsed or copied into mSections, mValues and mIndex.
        */
-      void StoreNameValue(const std::string theSection,
-          const std::string theName, const std::string theValue);
+      void UseTables(void);
+
+      /**
+       * BuildIndex will create the hashed index of every name, value pair
+       * found in mValues.
+       */
+      void BuildIndex(void);
+
+      /**
+       * Parse will tokenize theLength characters of theData into spans in a
+       * single pass and then sort them into the sections and values tables.
+       * @param[in] theData to parse which must be mData
+       * @param[in] theLength of theData in characters
+       */
+      void Parse(const char* theData, const size_t theLength);
+
+      /**
+       * FindSection will return the section named theSection provided.
+       * @param[in] theSection to find
+       * @return pointer to the section found or NULL if it doesn't exist
+       */
+      const typeConfigSection* FindSection(const std::string& theSection) const;
+
+      /**
+       * FindValue will return the name, value pair for theSection and
+       * theName provided.
+       * @param[in] theSection to use for finding theName
+       * @param[in] theName to find
+       * @return pointer to the value found or NULL if it doesn't exist
+       */
+      const typeConfigValue* FindValue(const std::string& theSection,
+          const std::string& theName) const;
+
+      /**
+       * CacheValue will parse and cache every typed value of theValue
+       * provided that hasn't been parsed yet.
+       * @param[in] theValue to parse
+       * @param[in] theTypes of CachedType values to parse
+       */
+      void CacheValue(const typeConfigValue& theValue, const Uint32 theTypes) const;
+
+      /**
+       * GetValue will return the value of theValue provided as a string.
+       * @param[in] theValue to return the value of
+       * @return the value as a string
+       */
+      std::string GetValue(const typeConfigValue& theValue) const;
+
+      /**
+       * Compare will compare theSpan provided with theString provided using
+       * the same ordering as std::string.
+       * @param[in] theSpan to compare
+       * @param[in] theString to compare with
+       * @param[in] theLength of theString in characters
+       * @return less than, equal to or greater than 0 like memcmp
+       */
+      int Compare(const typeConfigSpan& theSpan, const char* theString,
+          const size_t theLength) const;
+
+      /**
+       * CompareValues is used to sort the name, value pairs by section name
+       * and then by name.
+       */
+      class CompareValues;
 
   }; // class ConfigReader
 } // namespace GQE
@@ -162,6 +339,27 @@ namespace GQE
  * settings needed for the program.  For now these files are basic .INI
  * type files.
  *
+ * The file is mapped into memory and tokenized in a single pass without
+ * copying any names or values and without any limit on the line length.
+ * Each name, value pair is stored as offsets into the file contents in a
+ * flat table sorted by section and name, so each Get* method is a binary
+ * search over contiguous memory. The typed value returned by GetBool,
+ * GetFloat and GetUint32 is parsed the first time it is requested and
+ * cached, so reading the same setting every frame is cheap. The cache is
+ * updated from const methods, so a ConfigReader shouldn't be read from more
+ * than one thread at the same time. The file stays mapped for the lifetime
+ * of the ConfigReader, copies of a ConfigReader copy the text instead.
+ *
+ * SaveToCompiled writes the same tables into a compiled configuration file
+ * (see the compile-config command of Time-Voyager-Tools) with a packed
+ * string table, every typed value already parsed and a hashed index of each
+ * section and name. LoadFromCompiled maps the compiled file and uses these
+ * tables directly from the mapping, so loading is independent of the number
+ * of lines. Compiled files use the byte order and layout of the platform
+ * they were compiled on and are rejected if they don't match. The
+ * ConfigHandler class loads the compiled file instead of the configuration
+ * file whenever the compiled file is newer.
+ *
  * Copyright (c) 2010-2011 Ryan Lindeman
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
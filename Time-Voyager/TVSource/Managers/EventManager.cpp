@@ -6,6 +6,7 @@
  * @file src/GQE/Core/classes/EventManager.cpp
  * @author Ryan Lindeman
  * @date 20120630 - Initial Release
+ * @date 20130825 - Add typed event queues using the new TEventQueue class
  */
 
 #include <TVSource/Managers/EventManager.hpp>
@@ -14,6 +15,11 @@ namespace GQE
 {
   EventManager::EventManager()
   {
+    // No event queue has been added yet
+    for(Uint32 iloop = 0; iloop < MAX_EVENT_TYPES; iloop++)
+    {
+      mQueues[iloop] = NULL;
+    }
   }
 
   EventManager::~EventManager()
@@ -28,6 +34,13 @@ namespace GQE
       delete anEvent;
       anEvent = NULL;
     }
+
+    // Delete every event queue added
+    for(Uint32 iloop = 0; iloop < MAX_EVENT_TYPES; iloop++)
+    {
+      delete mQueues[iloop];
+      mQueues[iloop] = NULL;
+    }
   }
 
   bool EventManager::HasID(const typeEventID theEventID) const
@@ -58,6 +71,30 @@ namespace GQE
     }
   }
 
+  Uint32 EventManager::DispatchEvents(void)
+  {
+    Uint32 anResult = 0;
+
+    // Deliver the events posted to each queue added
+    for(Uint32 iloop = 0; iloop < MAX_EVENT_TYPES; iloop++)
+    {
+      if(NULL != mQueues[iloop])
+      {
+        anResult += mQueues[iloop]->DispatchEvents();
+      }
+    }
+
+    // Return anResult of the number of events delivered
+    return anResult;
+  }
+
+  Uint32 EventManager::NewQueueIndex(void)
+  {
+    // Index 0 means QueueIndex wasn't initialized yet, so start at 1
+    static Uint32 gQueueIndex = 0;
+    return ++gQueueIndex;
+  }
+
   IEvent* EventManager::Get(const typeEventID theEventID)
   {
     IEvent* anResult = NULL;
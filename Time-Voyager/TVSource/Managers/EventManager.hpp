@@ -6,6 +6,7 @@
  * @file include/GQE/Core/classes/EventManager.hpp
  * @author Ryan Lindeman
  * @date 20120630 - Initial Release
+ * @date 20130825 - Add typed event queues using the new TEventQueue class
  */
 #ifndef EVENT_MANAGER_HPP_INCLUDED
 #define EVENT_MANAGER_HPP_INCLUDED
@@ -16,6 +17,7 @@
 #include <TVSource/Loggers/Log_macros.hpp>
 #include <TVSource/Interfaces/IEvent.hpp>
 #include <TVSource/Interfaces/TEvent.hpp>
+#include <TVSource/Interfaces/TEventQueue.hpp>
 
 namespace GQE
 {
@@ -23,6 +25,13 @@ namespace GQE
   class GQE_API EventManager
   {
     public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Maximum number of event types that can be posted (see AddQueue)
+      static const Uint32 MAX_EVENT_TYPES = 64;
+      /// Default number of events of each type that can be posted each frame
+      static const Uint32 DEFAULT_QUEUE_CAPACITY = 256;
+
       /**
        * EventManager default constructor
        */
@@ -109,15 +118,157 @@ namespace GQE
        * @param[in] theEvent is a pointer to a class that derives from IEvent
        */
       void Add(IEvent* theEvent);
+
+      /**
+       * AddQueue will create the TEventQueue that stores each event of TYPE
+       * posted (see Post) if it doesn't already exist. Queues must be added
+       * from the main thread before any other thread posts events of TYPE.
+       * @param[in] theCapacity of events of TYPE that can be posted each frame
+       * @return true if the queue exists or was created, false otherwise
+       */
+      template<class TYPE>
+      bool AddQueue(const Uint32 theCapacity = DEFAULT_QUEUE_CAPACITY)
+      {
+        // Start with a return result of false
+        bool anResult = false;
+
+        const Uint32 anIndex = QueueIndex<TYPE>::gIndex;
+        if(0 < anIndex && MAX_EVENT_TYPES > anIndex)
+        {
+          if(NULL == mQueues[anIndex])
+          {
+            mQueues[anIndex] = new(std::nothrow) TEventQueue<TYPE>(theCapacity);
+          }
+          anResult = (NULL != mQueues[anIndex]);
+        }
+        else
+        {
+          ELOG() << "EventManager::AddQueue(" << typeid(TYPE).name()
+            << ") Too many event types!" << std::endl;
+        }
+
+        // Return anResult of true if the queue exists
+        return anResult;
+      }
+
+      /**
+       * Post will copy theEvent provided into the queue of its TYPE so it is
+       * delivered by the next call to DispatchEvents. Can be called from any
+       * thread and never allocates memory or takes a lock.
+       * @param[in] theEvent to post
+       * @return true if theEvent was posted, false otherwise
+       */
+      template<class TYPE>
+      bool Post(const TYPE& theEvent)
+      {
+        // Start with a return result of false
+        bool anResult = false;
+
+        TEventQueue<TYPE>* anQueue = GetQueue<TYPE>();
+        if(NULL != anQueue)
+        {
+          anResult = anQueue->Post(theEvent);
+        }
+        else
+        {
+          ELOG() << "EventManager::Post(" << typeid(TYPE).name()
+            << ") No queue added for this event type!" << std::endl;
+        }
+
+        // Return anResult of true if theEvent was posted
+        return anResult;
+      }
+
+      /**
+       * Subscribe will call theEventFunc of theEventClass provided with each
+       * batch of events of TYPE dispatched by DispatchEvents, adding the queue
+       * of TYPE with the default capacity if it doesn't exist yet.
+       * @param[in] theEventClass to use when calling theEventFunc
+       * @param[in] theEventFunc to call with each batch of events
+       */
+      template<class TYPE, class TCLASS>
+      void Subscribe(TCLASS& theEventClass,
+        void (TCLASS::*theEventFunc)(const TYPE* theEvents, const Uint32 theCount))
+      {
+        if(AddQueue<TYPE>())
+        {
+          GetQueue<TYPE>()->Subscribe(theEventClass, theEventFunc);
+        }
+      }
+
+      /**
+       * Unsubscribe will stop delivering events of TYPE to theEventClass
+       * provided.
+       * @param[in] theEventClass to stop delivering events to
+       */
+      template<class TYPE, class TCLASS>
+      void Unsubscribe(TCLASS& theEventClass)
+      {
+        TEventQueue<TYPE>* anQueue = GetQueue<TYPE>();
+        if(NULL != anQueue)
+        {
+          anQueue->Unsubscribe(&theEventClass);
+        }
+      }
+
+      /**
+       * DispatchEvents should be called once each frame from the main thread
+       * to deliver every event posted since the previous call, one batch for
+       * each type of event, to each subscriber.
+       * @return the number of events delivered
+       */
+      Uint32 DispatchEvents(void);
+
     protected:
 
     private:
+      /// Provides the static index of each event TYPE (see GetQueue)
+      template<class TYPE>
+      struct QueueIndex
+      {
+        /// Index assigned to TYPE at startup (0 if not assigned yet)
+        static const Uint32 gIndex;
+      };
+
       // Variables
       ///////////////////////////////////////////////////////////////////////////
       /// A map of all events available for this EventManager class
       std::map<const typeEventID, IEvent*> mList;
+      /// Each TEventQueue added indexed by QueueIndex, never moved once added
+      IEventQueue* mQueues[MAX_EVENT_TYPES];
+
+      /**
+       * GetQueue will return the TEventQueue of TYPE added by AddQueue.
+       * @return the TEventQueue of TYPE or NULL if it wasn't added
+       */
+      template<class TYPE>
+      TEventQueue<TYPE>* GetQueue(void) const
+      {
+        // Start with a return result of NULL
+        TEventQueue<TYPE>* anResult = NULL;
+
+        const Uint32 anIndex = QueueIndex<TYPE>::gIndex;
+        if(MAX_EVENT_TYPES > anIndex)
+        {
+          anResult = static_cast<TEventQueue<TYPE>*>(mQueues[anIndex]);
+        }
+
+        // Return anResult of the queue found or NULL otherwise
+        return anResult;
+      }
+
+      /**
+       * NewQueueIndex will return the next unused static index for
+       * QueueIndex, starting at 1.
+       * @return the new index
+       */
+      static Uint32 NewQueueIndex(void);
 
   }; // EventManager class
+
+  // Each event TYPE gets its index during static initialization
+  template<class TYPE>
+  const Uint32 EventManager::QueueIndex<TYPE>::gIndex = EventManager::NewQueueIndex();
 } // namespace GQE
 #endif
 
@@ -126,7 +277,9 @@ namespace GQE
  * @ingroup Core
  * The EventManager class is responsible for providing management for all
  * IEvent based classes used to provide Event calls to member functions of any
- * class provided.
+ * class provided. Typed events can also be posted from any thread (see Post)
+ * into a TEventQueue for each type of event and delivered in batches to each
+ * subscriber once each frame by DispatchEvents.
  *
  * Copyright (c) 2010-2012 Ryan Lindeman
  * Permission is hereby granted, free of charge, to any person obtaining a copy
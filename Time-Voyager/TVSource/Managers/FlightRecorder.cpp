@@ -0,0 +1,887 @@
+/**
+ * Provides the FlightRecorder class in the GQE namespace which is responsible
+ * for keeping the most recent log records and game loop frames in memory and
+ * dumping them to a file when the application fails.
+ *
+ * @file src/GQE/Core/classes/FlightRecorder.cpp
+ * @author Ryan Lindeman
+ * @date 20130811 - Initial Release
+ * @date 20130826 - Keep text messages without copying them twice
+ * @date 20130826 - Write the dump from signal handlers without iostreams
+ */
+
+#include <csignal>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <TVSource/Interfaces/ILogger.hpp>
+#include <TVSource/Loggers/Log_macros.hpp>
+#include <TVSource/Loggers/LogRecord.hpp>
+#include <TVSource/Managers/FlightRecorder.hpp>
+#include <TVSource/Managers/ProfileManager.hpp>
+#include <TVSource/Managers/StatManager.hpp>
+#include <TVSource/Utils/AtomicUtil.hpp>
+#if defined(GQE_WINDOWS)
+#include <io.h>
+#include <share.h>
+#elif defined(GQE_LINUX) || defined(GQE_MACOS) || defined(GQE_FREEBSD)
+#include <unistd.h>
+#endif
+
+namespace GQE
+{
+  /// Format used by every text message kept (the text is a single argument)
+  static const char* const TEXT_FORMAT = "{}";
+
+  /// The signals handled by the flight recorder
+  static const int gSignals[FlightRecorder::SIGNAL_COUNT] =
+  {
+    SIGSEGV, SIGABRT, SIGFPE, SIGILL
+  };
+
+  /// The names of the signals handled by the flight recorder
+  static const char* gSignalNames[FlightRecorder::SIGNAL_COUNT] =
+  {
+    "SIGSEGV", "SIGABRT", "SIGFPE", "SIGILL"
+  };
+
+  /// Number of characters formatted before the signal dump writes them
+  static const Uint32 SIGNAL_BUFFER_SIZE = 4096;
+
+  /// Provides the fixed buffer a dump written from a signal handler uses
+  struct typeSignalWriter
+  {
+    int    file;                        ///< Dump file descriptor to write to
+    Uint32 length;                      ///< Number of characters used in buffer
+    Uint32 total;                       ///< Number of characters written so far
+    char   buffer[SIGNAL_BUFFER_SIZE];  ///< Characters not yet written
+  };
+
+  /// The signal handlers format the dump here instead of on a small stack
+  static typeSignalWriter gSignalWriter;
+
+  /**
+   * FlushSignal will write every character in the buffer of theWriter using
+   * only async-signal-safe calls.
+   * @param[in,out] theWriter to write the buffer of
+   */
+  static void FlushSignal(typeSignalWriter& theWriter)
+  {
+    Uint32 anOffset = 0;
+    while(anOffset < theWriter.length)
+    {
+#if defined(GQE_WINDOWS)
+      int anWritten = _write(theWriter.file, theWriter.buffer + anOffset,
+        theWriter.length - anOffset);
+#else
+      ssize_t anWritten = write(theWriter.file, theWriter.buffer + anOffset,
+        theWriter.length - anOffset);
+#endif
+      if(anWritten <= 0)
+      {
+        // Give up on the rest, the application is going down anyway
+        break;
+      }
+      anOffset += (Uint32)anWritten;
+    }
+    theWriter.total += anOffset;
+    theWriter.length = 0;
+  }
+
+  /**
+   * WriteSignal will copy theText provided into the buffer of theWriter and
+   * write the buffer each time it is full.
+   * @param[in,out] theWriter to copy theText into
+   * @param[in] theText to copy
+   * @param[in] theLength of theText in characters
+   */
+  static void WriteSignal(typeSignalWriter& theWriter, const char* theText,
+      Uint32 theLength)
+  {
+    while(theLength > 0)
+    {
+      Uint32 anRoom = SIGNAL_BUFFER_SIZE - theWriter.length;
+      Uint32 anCount = theLength < anRoom ? theLength : anRoom;
+      memcpy(theWriter.buffer + theWriter.length, theText, anCount);
+      theWriter.length += anCount;
+      theText += anCount;
+      theLength -= anCount;
+      if(SIGNAL_BUFFER_SIZE == theWriter.length)
+      {
+        FlushSignal(theWriter);
+      }
+    }
+  }
+
+  /**
+   * WriteSignal will copy the '\0' terminated theText provided into the
+   * buffer of theWriter.
+   * @param[in,out] theWriter to copy theText into
+   * @param[in] theText to copy
+   */
+  static void WriteSignal(typeSignalWriter& theWriter, const char* theText)
+  {
+    WriteSignal(theWriter, theText, (Uint32)strlen(theText));
+  }
+
+  /**
+   * WriteSignalNumber will write theValue provided in decimal into the
+   * buffer of theWriter without using any iostream formatting.
+   * @param[in,out] theWriter to write theValue into
+   * @param[in] theValue to write
+   * @param[in] theNegative flag to write a minus sign in front of theValue
+   */
+  static void WriteSignalNumber(typeSignalWriter& theWriter, Uint64 theValue,
+      bool theNegative = false)
+  {
+    // Output the digits in reverse order first
+    char anDigits[21];
+    Uint32 anCount = sizeof(anDigits);
+    do
+    {
+      anDigits[--anCount] = (char)('0' + theValue % 10);
+      theValue /= 10;
+    } while(theValue > 0);
+    if(theNegative)
+    {
+      anDigits[--anCount] = '-';
+    }
+    WriteSignal(theWriter, &anDigits[anCount], sizeof(anDigits) - anCount);
+  }
+
+  /**
+   * WriteSignalArgument will write the next argument found in theArguments
+   * into the buffer of theWriter (see ILogger::WriteArguments).
+   * @param[in,out] theWriter to write the argument into
+   * @param[in,out] theArguments to read the next argument from
+   * @param[in] theEnd of theArguments
+   * @return true if an argument was written, false otherwise
+   */
+  static bool WriteSignalArgument(typeSignalWriter& theWriter,
+      const char*& theArguments, const char* theEnd)
+  {
+    // Assume no argument is left
+    bool anResult = false;
+
+    if(theArguments < theEnd)
+    {
+      // Each argument starts with its type followed by its raw bytes
+      Uint8 anType = (Uint8)*theArguments++;
+      Uint32 anLeft = (Uint32)(theEnd - theArguments);
+      switch(anType)
+      {
+        case LogArgumentInt32:
+        case LogArgumentUint32:
+          if(anLeft >= sizeof(Uint32))
+          {
+            Uint32 anValue;
+            memcpy(&anValue, theArguments, sizeof(anValue));
+            theArguments += sizeof(anValue);
+            if(LogArgumentInt32 == anType && (Int32)anValue < 0)
+            {
+              WriteSignalNumber(theWriter, 0 - (Uint64)(Int32)anValue, true);
+            }
+            else
+            {
+              WriteSignalNumber(theWriter, anValue);
+            }
+            anResult = true;
+          }
+          break;
+        case LogArgumentInt64:
+        case LogArgumentUint64:
+          if(anLeft >= sizeof(Uint64))
+          {
+            Uint64 anValue;
+            memcpy(&anValue, theArguments, sizeof(anValue));
+            theArguments += sizeof(anValue);
+            if(LogArgumentInt64 == anType && (Int64)anValue < 0)
+            {
+              WriteSignalNumber(theWriter, 0 - anValue, true);
+            }
+            else
+            {
+              WriteSignalNumber(theWriter, anValue);
+            }
+            anResult = true;
+          }
+          break;
+        case LogArgumentDouble:
+          if(anLeft >= sizeof(double))
+          {
+            double anValue;
+            memcpy(&anValue, theArguments, sizeof(anValue));
+            theArguments += sizeof(anValue);
+
+            // Write the whole part and 3 decimals of anValue if it fits
+            bool anNegative = anValue < 0.0;
+            double anMagnitude = anNegative ? -anValue : anValue;
+            if(anMagnitude < 1.0e18)
+            {
+              Uint64 anThousandths = (Uint64)(anMagnitude * 1000.0 + 0.5);
+              WriteSignalNumber(theWriter, anThousandths / 1000, anNegative);
+              WriteSignal(theWriter, ".", 1);
+              char anDecimals[3];
+              anDecimals[0] = (char)('0' + anThousandths / 100 % 10);
+              anDecimals[1] = (char)('0' + anThousandths / 10 % 10);
+              anDecimals[2] = (char)('0' + anThousandths % 10);
+              WriteSignal(theWriter, anDecimals, sizeof(anDecimals));
+            }
+            else
+            {
+              WriteSignal(theWriter, anValue != anValue ? "nan" : "big");
+            }
+            anResult = true;
+          }
+          break;
+        case LogArgumentBool:
+          if(anLeft >= 1)
+          {
+            WriteSignal(theWriter, 0 != *theArguments++ ? "true" : "false");
+            anResult = true;
+          }
+          break;
+        case LogArgumentChar:
+          if(anLeft >= 1)
+          {
+            WriteSignal(theWriter, theArguments++, 1);
+            anResult = true;
+          }
+          break;
+        case LogArgumentString:
+          if(anLeft >= sizeof(Uint16))
+          {
+            Uint16 anLength;
+            memcpy(&anLength, theArguments, sizeof(anLength));
+            theArguments += sizeof(anLength);
+            if(anLength <= anLeft - sizeof(anLength))
+            {
+              WriteSignal(theWriter, theArguments, anLength);
+              theArguments += anLength;
+              anResult = true;
+            }
+          }
+          break;
+        default:
+          break;
+      }
+
+      // Stop at the first argument that can't be read
+      if(!anResult)
+      {
+        theArguments = theEnd;
+      }
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  /// Provides a single log record kept by the flight recorder
+  struct FlightRecorder::typeFlightLog
+  {
+    volatile Uint32 sequence; ///< Index of the record + 1 once it is complete
+    Uint32          time;     ///< Time in seconds the message was logged
+    SeverityType    severity; ///< Severity of the message
+    const char*     file;     ///< Source file of the message (NULL if tagged)
+    Int32           line;     ///< Source line of the message
+    const char*     format;   ///< Format of the message with {} for each argument
+    Uint32          length;   ///< Number of bytes used in arguments
+    char            arguments[LogRecord::MAX_ARGUMENTS]; ///< Raw arguments
+  };
+
+  /// Provides a single game loop frame kept by the flight recorder
+  struct FlightRecorder::typeFlightFrame
+  {
+    Uint32 frame;               ///< Number of the frame since DoInit
+    Uint32 phases[PhaseCount];  ///< Time in microseconds spent in each phase
+    Uint32 hitches;             ///< Hitches counted since DoInit
+    Uint64 allocs;              ///< Allocations made during the frame
+    Uint64 bytes;               ///< Bytes allocated during the frame
+  };
+
+  /// Default filename to write the dump to
+  const char* FlightRecorder::DEFAULT_DUMP = "flight.txt";
+
+  /// True if log records and frames are currently being recorded
+  volatile bool FlightRecorder::gRecording = false;
+
+  /// The most recent FlightRecorder created
+  FlightRecorder* FlightRecorder::gInstance = NULL;
+
+  FlightRecorder::FlightRecorder() :
+    mLogs(NULL),
+    mLogNext(0),
+    mFrames(NULL),
+    mFrameNext(0),
+    mStatManager(NULL),
+    mDumpFile(DEFAULT_DUMP),
+    mDumpDescriptor(-1),
+    mDumping(0),
+    mEnabled(true),
+    mZones(true)
+  {
+    ILOGM("FlightRecorder::ctor()");
+
+    for(Uint32 iloop = 0; iloop < SIGNAL_COUNT; iloop++)
+    {
+      mHandlers[iloop] = SIG_DFL;
+    }
+
+    // Make note of our instance
+    gInstance = this;
+  }
+
+  FlightRecorder::~FlightRecorder()
+  {
+    ILOGM("FlightRecorder::dtor()");
+
+    // Stop recording and restore the signal handlers before our rings are deleted
+    DeInit();
+
+    // Clear our instance if it is us
+    if(gInstance == this)
+    {
+      gInstance = NULL;
+    }
+
+    // Delete our rings
+    delete[] mLogs;
+    mLogs = NULL;
+    delete[] mFrames;
+    mFrames = NULL;
+  }
+
+  FlightRecorder* FlightRecorder::GetFlightRecorder(void)
+  {
+    return gInstance;
+  }
+
+  bool FlightRecorder::ProcessArgument(const std::string theArgument)
+  {
+    // Assume theArgument provided is a flight recorder argument
+    bool anResult = true;
+
+    // Split theArgument into its --name and value portions
+    size_t anEquals = theArgument.find('=');
+    std::string anName = theArgument.substr(0, anEquals);
+    std::string anValue;
+    if(anEquals != std::string::npos)
+    {
+      anValue = theArgument.substr(anEquals + 1);
+    }
+
+    if(anName == "--flight-dump" && !anValue.empty())
+    {
+      mDumpFile = anValue;
+    }
+    else if(anName == "--no-flight-recorder")
+    {
+      mEnabled = false;
+    }
+    else
+    {
+      // Not one of ours
+      anResult = false;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  void FlightRecorder::SetEnabled(bool theEnabled)
+  {
+    mEnabled = theEnabled;
+  }
+
+  void FlightRecorder::SetDumpFile(const std::string theFilename)
+  {
+    if(!theFilename.empty())
+    {
+      mDumpFile = theFilename;
+    }
+  }
+
+  void FlightRecorder::SetZones(bool theZones)
+  {
+    mZones = theZones;
+  }
+
+  void FlightRecorder::DoInit(void)
+  {
+    ILOGM("FlightRecorder::DoInit()");
+
+    if(mEnabled)
+    {
+      // Create our rings the first time we start recording
+      if(NULL == mLogs)
+      {
+        mLogs = new(std::nothrow) typeFlightLog[LOG_SIZE];
+        mFrames = new(std::nothrow) typeFlightFrame[FRAME_SIZE];
+      }
+
+      if(NULL != mLogs && NULL != mFrames)
+      {
+        // No record is complete until its sequence is written
+        for(Uint32 iloop = 0; iloop < LOG_SIZE; iloop++)
+        {
+          mLogs[iloop].sequence = 0;
+        }
+        mLogNext = 0;
+        mFrameNext = 0;
+
+        // Open the dump file now since it can't be opened from a signal
+        // handler (the previous dump is kept until a new one is written)
+        if(-1 == mDumpDescriptor)
+        {
+#if defined(GQE_WINDOWS)
+          mDumpDescriptor = _sopen(mDumpFile.c_str(), _O_WRONLY | _O_CREAT | _O_BINARY,
+            _SH_DENYNO, _S_IREAD | _S_IWRITE);
+#else
+          mDumpDescriptor = open(mDumpFile.c_str(), O_WRONLY | O_CREAT,
+            S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+#endif
+          if(-1 == mDumpDescriptor)
+          {
+            WLOG() << "FlightRecorder::DoInit() unable to open " << mDumpFile
+              << ", no dump will be written from signal handlers" << std::endl;
+          }
+        }
+
+        // Install our signal handlers and keep the previous ones
+        for(Uint32 iloop = 0; iloop < SIGNAL_COUNT; iloop++)
+        {
+          mHandlers[iloop] = std::signal(gSignals[iloop], HandleSignal);
+        }
+
+        // Ask the ProfileManager to record zones for our dump
+        ProfileManager* anProfileManager = ProfileManager::GetProfileManager();
+        if(mZones && NULL != anProfileManager && !anProfileManager->IsRecording())
+        {
+          anProfileManager->SetRecording(true);
+        }
+
+        gRecording = true;
+      }
+      else
+      {
+        ELOG() << "FlightRecorder::DoInit() unable to allocate rings" << std::endl;
+      }
+    }
+  }
+
+  void FlightRecorder::DeInit(void)
+  {
+    if(gRecording && gInstance == this)
+    {
+      ILOGM("FlightRecorder::DeInit()");
+
+      // Stop recording
+      gRecording = false;
+
+      // Restore the signal handlers replaced by DoInit
+      for(Uint32 iloop = 0; iloop < SIGNAL_COUNT; iloop++)
+      {
+        std::signal(gSignals[iloop], mHandlers[iloop]);
+        mHandlers[iloop] = SIG_DFL;
+      }
+
+      // Close the dump file opened for our signal handlers
+      if(-1 != mDumpDescriptor)
+      {
+#if defined(GQE_WINDOWS)
+        _close(mDumpDescriptor);
+#else
+        close(mDumpDescriptor);
+#endif
+        mDumpDescriptor = -1;
+      }
+    }
+  }
+
+  void FlightRecorder::AddFrame(const Int64 thePhaseTimes[PhaseCount],
+      const StatManager& theStatManager)
+  {
+    if(gRecording)
+    {
+      typeFlightFrame& anFrame = mFrames[mFrameNext & (FRAME_SIZE - 1)];
+      anFrame.frame = mFrameNext;
+      for(Uint32 iloop = 0; iloop < PhaseCount; iloop++)
+      {
+        anFrame.phases[iloop] = (Uint32)thePhaseTimes[iloop];
+      }
+      anFrame.hitches = theStatManager.GetHitches();
+      anFrame.allocs = theStatManager.GetFrameAllocs();
+      anFrame.bytes = theStatManager.GetFrameBytes();
+      mStatManager = &theStatManager;
+
+      // Only the main thread adds frames
+      mFrameNext++;
+    }
+  }
+
+  void FlightRecorder::HandleHotkey(void)
+  {
+    WriteDump("hotkey");
+  }
+
+  bool FlightRecorder::WriteDump(const char* theReason)
+  {
+    // Assume the dump could not be written
+    bool anResult = false;
+
+    // Only write one dump at a time (e.g. a signal raised while writing)
+    if(gRecording && AtomicCompareExchange(mDumping, 1, 0) == 0)
+    {
+      // Try to open the dump file for writing
+      std::ofstream anDump(mDumpFile.c_str(), std::ios::out | std::ios::trunc);
+      if(anDump.is_open())
+      {
+        char anTimestamp[ILogger::TIMESTAMP_LENGTH + 1];
+        ILogger::FormatTimestamp(std::time(NULL), anTimestamp);
+        anDump << "Flight recorder dump " << anTimestamp << "(" << theReason
+          << ")" << std::endl;
+
+        anDump << std::endl << "[log]" << std::endl;
+        WriteLogs(anDump);
+
+        anDump << std::endl << "[frames]" << std::endl;
+        WriteFrames(anDump);
+
+        ProfileManager* anProfileManager = ProfileManager::GetProfileManager();
+        if(NULL != anProfileManager)
+        {
+          anDump << std::endl << "[zones]" << std::endl;
+          anProfileManager->WriteZones(anDump, DUMP_ZONES);
+        }
+
+        // Dump was written if the stream is still good
+        anResult = anDump.good();
+
+        // Close the dump file
+        anDump.close();
+      }
+
+      // Allow the next dump to be written
+      mDumping = 0;
+
+      if(anResult)
+      {
+        ILOG() << "FlightRecorder::WriteDump(" << theReason << ") wrote "
+          << mDumpFile << std::endl;
+      }
+      else
+      {
+        ELOG() << "FlightRecorder::WriteDump(" << theReason << ") unable to write "
+          << mDumpFile << std::endl;
+      }
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  void FlightRecorder::AddLog(const typeLogSite& theSite, const char* theArguments,
+      Uint32 theLength)
+  {
+    FlightRecorder* anRecorder = gInstance;
+    if(gRecording && NULL != anRecorder)
+    {
+      Uint32 anIndex = anRecorder->ClaimLog(theSite.severity, theSite.file,
+        theSite.line, theSite.format);
+      typeFlightLog& anLog = anRecorder->mLogs[anIndex & (LOG_SIZE - 1)];
+      anLog.length = theLength < LogRecord::MAX_ARGUMENTS ?
+        theLength : LogRecord::MAX_ARGUMENTS;
+      memcpy(anLog.arguments, theArguments, anLog.length);
+
+      // The record is complete once its sequence is written
+      anLog.sequence = anIndex + 1;
+    }
+  }
+
+  void FlightRecorder::AddText(SeverityType theSeverity, const char* theSourceFile,
+      int theSourceLine, const char* theText, Uint32 theLength)
+  {
+    FlightRecorder* anRecorder = gInstance;
+    if(gRecording && NULL != anRecorder)
+    {
+      // Leave out the newline written by std::endl
+      if(theLength > 0 && '\n' == theText[theLength - 1])
+      {
+        theLength--;
+      }
+
+      // Keep theText as a single string argument (type, 16 bit length, characters)
+      const Uint32 anRoom = LogRecord::MAX_ARGUMENTS - 1 - sizeof(Uint16);
+      Uint16 anLength = (Uint16)(theLength < anRoom ? theLength : anRoom);
+
+      Uint32 anIndex = anRecorder->ClaimLog(theSeverity, theSourceFile,
+        theSourceLine, TEXT_FORMAT);
+      typeFlightLog& anLog = anRecorder->mLogs[anIndex & (LOG_SIZE - 1)];
+      anLog.length = 1 + sizeof(anLength) + anLength;
+      anLog.arguments[0] = (char)LogArgumentString;
+      memcpy(&anLog.arguments[1], &anLength, sizeof(anLength));
+      memcpy(&anLog.arguments[1 + sizeof(anLength)], theText, anLength);
+
+      // The record is complete once its sequence is written
+      anLog.sequence = anIndex + 1;
+    }
+  }
+
+  void FlightRecorder::Dump(const char* theReason)
+  {
+    FlightRecorder* anRecorder = gInstance;
+    if(NULL != anRecorder)
+    {
+      anRecorder->WriteDump(theReason);
+    }
+  }
+
+  Uint32 FlightRecorder::ClaimLog(SeverityType theSeverity,
+      const char* theSourceFile, int theSourceLine, const char* theFormat)
+  {
+    // Claim the next record of the ring
+    Uint32 anResult = AtomicIncrement(mLogNext) - 1;
+    typeFlightLog& anLog = mLogs[anResult & (LOG_SIZE - 1)];
+    anLog.sequence = 0;
+    anLog.time = (Uint32)std::time(NULL);
+    anLog.severity = theSeverity;
+    anLog.file = theSourceFile;
+    anLog.line = theSourceLine;
+    anLog.format = theFormat;
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  void FlightRecorder::WriteLogs(std::ostream& theOstream)
+  {
+    char anTimestamp[ILogger::TIMESTAMP_LENGTH + 1];
+
+    // Write each record still kept from oldest to newest
+    Uint32 anNext = mLogNext;
+    Uint32 anCount = anNext < LOG_SIZE ? anNext : LOG_SIZE;
+    for(Uint32 iloop = anNext - anCount; iloop != anNext; iloop++)
+    {
+      const typeFlightLog& anLog = mLogs[iloop & (LOG_SIZE - 1)];
+
+      // Skip records that are still being written
+      if(anLog.sequence != iloop + 1)
+      {
+        continue;
+      }
+
+      // Text messages logged with their own tag are written as is
+      if(NULL != anLog.file)
+      {
+        ILogger::FormatTimestamp((std::time_t)anLog.time, anTimestamp);
+        theOstream << anTimestamp << ILogger::GetSeverityCharacter(anLog.severity)
+          << " " << anLog.file << ":" << anLog.line << " ";
+      }
+      ILogger::WriteArguments(theOstream, anLog.format, anLog.arguments, anLog.length);
+      theOstream << std::endl;
+    }
+  }
+
+  void FlightRecorder::WriteFrames(std::ostream& theOstream)
+  {
+    // Write the name of each column first
+    theOstream << "frame";
+    for(Uint32 iloop = 0; iloop < PhaseCount; iloop++)
+    {
+      theOstream << " " << gPhaseNames[iloop];
+    }
+    theOstream << " hitches allocs bytes" << std::endl;
+
+    // Write each frame still kept from oldest to newest (times in microseconds)
+    Uint32 anCount = mFrameNext < FRAME_SIZE ? mFrameNext : FRAME_SIZE;
+    for(Uint32 iloop = mFrameNext - anCount; iloop != mFrameNext; iloop++)
+    {
+      const typeFlightFrame& anFrame = mFrames[iloop & (FRAME_SIZE - 1)];
+      theOstream << anFrame.frame;
+      for(Uint32 jloop = 0; jloop < PhaseCount; jloop++)
+      {
+        theOstream << " " << anFrame.phases[jloop];
+      }
+      theOstream << " " << anFrame.hitches << " " << anFrame.allocs << " "
+        << anFrame.bytes << std::endl;
+    }
+
+    // Write the percentiles of the StatManager window last
+    if(NULL != mStatManager)
+    {
+      for(Uint32 iloop = 0; iloop < PhaseCount; iloop++)
+      {
+        typeStatSummary anSummary = mStatManager->GetSummary((GameLoopPhase)iloop);
+        theOstream << gPhaseNames[iloop] << " p50=" << anSummary.p50
+          << " p95=" << anSummary.p95 << " p99=" << anSummary.p99
+          << " max=" << anSummary.max << std::endl;
+      }
+    }
+  }
+
+  void FlightRecorder::WriteSignalDump(const char* theReason)
+  {
+    // Only write one dump at a time (e.g. a signal raised while writing)
+    if(gRecording && -1 != mDumpDescriptor &&
+      AtomicCompareExchange(mDumping, 1, 0) == 0)
+    {
+      typeSignalWriter& anWriter = gSignalWriter;
+      anWriter.file = mDumpDescriptor;
+      anWriter.length = 0;
+      anWriter.total = 0;
+
+      // Write over any dump previously written
+#if defined(GQE_WINDOWS)
+      _lseek(anWriter.file, 0, SEEK_SET);
+#else
+      lseek(anWriter.file, 0, SEEK_SET);
+#endif
+
+      // Local time can't be found from a signal handler, use seconds instead
+      WriteSignal(anWriter, "Flight recorder dump ");
+      WriteSignalNumber(anWriter, (Uint64)std::time(NULL));
+      WriteSignal(anWriter, " (");
+      WriteSignal(anWriter, theReason);
+      WriteSignal(anWriter, ")\n\n[log]\n");
+
+      // Write each record still kept from oldest to newest
+      Uint32 anNext = mLogNext;
+      Uint32 anCount = anNext < LOG_SIZE ? anNext : LOG_SIZE;
+      for(Uint32 iloop = anNext - anCount; iloop != anNext; iloop++)
+      {
+        const typeFlightLog& anLog = mLogs[iloop & (LOG_SIZE - 1)];
+
+        // Skip records that are still being written
+        if(anLog.sequence != iloop + 1)
+        {
+          continue;
+        }
+
+        // Text messages logged with their own tag are written as is
+        if(NULL != anLog.file)
+        {
+          char anSeverity[3] = {' ', ILogger::GetSeverityCharacter(anLog.severity), ' '};
+          WriteSignalNumber(anWriter, anLog.time);
+          WriteSignal(anWriter, anSeverity, sizeof(anSeverity));
+          WriteSignal(anWriter, anLog.file);
+          WriteSignal(anWriter, ":", 1);
+          WriteSignalNumber(anWriter, (Uint64)(anLog.line < 0 ? 0 : anLog.line));
+          WriteSignal(anWriter, " ", 1);
+        }
+
+        // Replace each {} in the format with the next argument
+        const char* anArguments = anLog.arguments;
+        const char* anEnd = anLog.arguments + anLog.length;
+        for(const char* anCharacter = anLog.format; '\0' != *anCharacter; anCharacter++)
+        {
+          if('{' == anCharacter[0] && '}' == anCharacter[1] &&
+            WriteSignalArgument(anWriter, anArguments, anEnd))
+          {
+            anCharacter++;
+          }
+          else
+          {
+            WriteSignal(anWriter, anCharacter, 1);
+          }
+        }
+
+        // Write any arguments left over at the end
+        while(anArguments < anEnd)
+        {
+          WriteSignal(anWriter, " ", 1);
+          WriteSignalArgument(anWriter, anArguments, anEnd);
+        }
+        WriteSignal(anWriter, "\n", 1);
+      }
+
+      // Write each frame still kept from oldest to newest (times in microseconds)
+      WriteSignal(anWriter, "\n[frames]\nframe");
+      for(Uint32 iloop = 0; iloop < PhaseCount; iloop++)
+      {
+        WriteSignal(anWriter, " ", 1);
+        WriteSignal(anWriter, gPhaseNames[iloop]);
+      }
+      WriteSignal(anWriter, " hitches allocs bytes\n");
+      anCount = mFrameNext < FRAME_SIZE ? mFrameNext : FRAME_SIZE;
+      for(Uint32 iloop = mFrameNext - anCount; iloop != mFrameNext; iloop++)
+      {
+        const typeFlightFrame& anFrame = mFrames[iloop & (FRAME_SIZE - 1)];
+        WriteSignalNumber(anWriter, anFrame.frame);
+        for(Uint32 jloop = 0; jloop < PhaseCount; jloop++)
+        {
+          WriteSignal(anWriter, " ", 1);
+          WriteSignalNumber(anWriter, anFrame.phases[jloop]);
+        }
+        WriteSignal(anWriter, " ", 1);
+        WriteSignalNumber(anWriter, anFrame.hitches);
+        WriteSignal(anWriter, " ", 1);
+        WriteSignalNumber(anWriter, anFrame.allocs);
+        WriteSignal(anWriter, " ", 1);
+        WriteSignalNumber(anWriter, anFrame.bytes);
+        WriteSignal(anWriter, "\n", 1);
+      }
+
+      // Write whatever is left and cut off the rest of any previous dump
+      FlushSignal(anWriter);
+#if defined(GQE_WINDOWS)
+      _chsize(anWriter.file, (long)anWriter.total);
+#else
+      if(0 != ftruncate(anWriter.file, (off_t)anWriter.total))
+      {
+        // Nothing else can be done from a signal handler
+      }
+#endif
+
+      // Allow the next dump to be written
+      mDumping = 0;
+    }
+  }
+
+  void FlightRecorder::HandleSignal(int theSignal)
+  {
+    // Restore the default handler so raising theSignal again ends the application
+    std::signal(theSignal, SIG_DFL);
+
+    const char* anName = "signal";
+    for(Uint32 iloop = 0; iloop < SIGNAL_COUNT; iloop++)
+    {
+      if(gSignals[iloop] == theSignal)
+      {
+        anName = gSignalNames[iloop];
+      }
+    }
+
+    // Write the dump and let the default handler end the application
+    FlightRecorder* anRecorder = gInstance;
+    if(NULL != anRecorder)
+    {
+      anRecorder->WriteSignalDump(anName);
+    }
+    std::raise(theSignal);
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,296 @@
+/**
+ * Provides the FlightRecorder class in the GQE namespace which is responsible
+ * for keeping the most recent log records and game loop frames in memory and
+ * dumping them to a file when the application fails.
+ *
+ * @file include/GQE/Core/classes/FlightRecorder.hpp
+ * @author Ryan Lindeman
+ * @date 20130811 - Initial Release
+ * @date 20130826 - Added theLength to AddText for the AsyncLogger
+ * @date 20130826 - Added WriteSignalDump for the signal handlers
+ */
+#ifndef   CORE_FLIGHT_RECORDER_HPP_INCLUDED
+#define   CORE_FLIGHT_RECORDER_HPP_INCLUDED
+
+#include <ostream>
+#include <string>
+#include <TVSource/Core/Core_types.hpp>
+
+namespace GQE
+{
+  /// Provides the in memory flight recorder dumped on fatal errors
+  class GQE_API FlightRecorder
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Default filename to write the dump to
+      static const char* DEFAULT_DUMP;
+      /// Number of log records kept (must be a power of 2)
+      static const Uint32 LOG_SIZE = 1024;
+      /// Number of game loop frames kept (must be a power of 2)
+      static const Uint32 FRAME_SIZE = 512;
+      /// Number of profile zones of each thread written to the dump
+      static const Uint32 DUMP_ZONES = 256;
+      /// Number of signals handled by the flight recorder
+      static const Uint32 SIGNAL_COUNT = 4;
+
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// True if log records and frames are currently being recorded
+      static volatile bool gRecording;
+
+      /**
+       * FlightRecorder constructor
+       */
+      FlightRecorder();
+
+      /**
+       * FlightRecorder deconstructor
+       */
+      virtual ~FlightRecorder();
+
+      /**
+       * GetFlightRecorder will return the most recent FlightRecorder created.
+       * @return pointer to the FlightRecorder or NULL if none exists
+       */
+      static FlightRecorder* GetFlightRecorder(void);
+
+      /**
+       * ProcessArgument is responsible for parsing a single command line
+       * argument (e.g. --flight-dump=file.txt or --no-flight-recorder).
+       * @param[in] theArgument to parse
+       * @return true if theArgument was a flight recorder argument, false otherwise
+       */
+      bool ProcessArgument(const std::string theArgument);
+
+      /**
+       * SetEnabled will enable or disable the flight recorder when DoInit is
+       * called.
+       * @param[in] theEnabled is the new enabled value
+       */
+      void SetEnabled(bool theEnabled);
+
+      /**
+       * SetDumpFile will set the filename the dump is written to.
+       * @param[in] theFilename to write the dump to
+       */
+      void SetDumpFile(const std::string theFilename);
+
+      /**
+       * SetZones will ask the ProfileManager to record zones from DoInit on
+       * so the most recent zones of each thread are written to the dump.
+       * @param[in] theZones flag to record zones
+       */
+      void SetZones(bool theZones);
+
+      /**
+       * DoInit will start recording, open the dump file and install the
+       * signal handlers that write the dump when the application crashes.
+       */
+      void DoInit(void);
+
+      /**
+       * DeInit will stop recording, restore the previous signal handlers and
+       * close the dump file opened by DoInit.
+       */
+      void DeInit(void);
+
+      /**
+       * AddFrame is called at the end of each game loop iteration and will
+       * keep the time spent in each phase and the StatManager metrics of the
+       * frame.
+       * @param[in] thePhaseTimes in microseconds indexed by GameLoopPhase
+       * @param[in] theStatManager to read the metrics of the frame from
+       */
+      void AddFrame(const Int64 thePhaseTimes[PhaseCount],
+          const StatManager& theStatManager);
+
+      /**
+       * HandleHotkey is called when the flight recorder hotkey is pressed and
+       * will write the dump.
+       */
+      void HandleHotkey(void);
+
+      /**
+       * WriteDump will write every log record and frame kept so far along
+       * with the most recent profile zones to the dump file. This uses
+       * iostreams and must not be called from a signal handler (see
+       * WriteSignalDump).
+       * @param[in] theReason the dump is being written (e.g. "SIGSEGV")
+       * @return true if the dump was written, false otherwise
+       */
+      bool WriteDump(const char* theReason);
+
+      /**
+       * AddLog will keep the arguments of a binary log message (see
+       * LogRecord) logged from theSite provided. This never locks or
+       * allocates memory and should only be called if gRecording is true.
+       * @param[in] theSite the message was logged from
+       * @param[in] theArguments recorded for the message
+       * @param[in] theLength of theArguments in bytes
+       */
+      static void AddLog(const typeLogSite& theSite, const char* theArguments,
+          Uint32 theLength);
+
+      /**
+       * AddText will keep the text message provided (see AsyncLogger). This
+       * never locks or allocates memory and should only be called if
+       * gRecording is true.
+       * @param[in] theSeverity of the message
+       * @param[in] theSourceFile where the message was logged from (NULL if
+       *            theText already includes its tag)
+       * @param[in] theSourceLine where the message was logged from
+       * @param[in] theText of the message (doesn't need to end with '\0')
+       * @param[in] theLength of theText in characters
+       */
+      static void AddText(SeverityType theSeverity, const char* theSourceFile,
+          int theSourceLine, const char* theText, Uint32 theLength);
+
+      /**
+       * Dump will write the dump of the most recent FlightRecorder created if
+       * it is recording.
+       * @param[in] theReason the dump is being written (e.g. "FatalShutdown")
+       */
+      static void Dump(const char* theReason);
+
+    private:
+      /// Provides a single log record kept by the flight recorder
+      struct typeFlightLog;
+      /// Provides a single game loop frame kept by the flight recorder
+      struct typeFlightFrame;
+      /// Declare the signal handler function type
+      typedef void (*typeSignalHandler)(int);
+
+      /// Instance variable assigned at construction time
+      static FlightRecorder* gInstance;
+
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// The ring of the most recent log records
+      typeFlightLog*     mLogs;
+      /// Total log records added (next index to write)
+      volatile Uint32    mLogNext;
+      /// The ring of the most recent game loop frames
+      typeFlightFrame*   mFrames;
+      /// Total frames added (next index to write)
+      Uint32             mFrameNext;
+      /// The StatManager of the frames added
+      const StatManager* mStatManager;
+      /// The filename to write the dump to
+      std::string        mDumpFile;
+      /// The dump file opened by DoInit for our signal handlers (-1 if closed)
+      int                mDumpDescriptor;
+      /// The signal handler of each signal replaced in DoInit
+      typeSignalHandler  mHandlers[SIGNAL_COUNT];
+      /// True while the dump is being written
+      volatile Uint32    mDumping;
+      /// True if recording should start when DoInit is called
+      bool               mEnabled;
+      /// True if the ProfileManager should record zones from DoInit on
+      bool               mZones;
+
+      /**
+       * ClaimLog will claim the next log record of the ring with a single
+       * atomic increment and fill in everything but its arguments.
+       * @param[in] theSeverity of the message
+       * @param[in] theSourceFile where the message was logged from
+       * @param[in] theSourceLine where the message was logged from
+       * @param[in] theFormat of the message with {} for each argument
+       * @return the index of the record claimed
+       */
+      Uint32 ClaimLog(SeverityType theSeverity, const char* theSourceFile,
+          int theSourceLine, const char* theFormat);
+
+      /**
+       * WriteLogs will write each log record kept to theOstream provided
+       * from oldest to newest.
+       * @param[in] theOstream to write the log records to
+       */
+      void WriteLogs(std::ostream& theOstream);
+
+      /**
+       * WriteFrames will write each frame kept to theOstream provided from
+       * oldest to newest.
+       * @param[in] theOstream to write the frames to
+       */
+      void WriteFrames(std::ostream& theOstream);
+
+      /**
+       * WriteSignalDump will write every log record and frame kept so far to
+       * the dump file opened by DoInit. Only async-signal-safe calls are made
+       * (the dump is formatted into a static buffer and written with write)
+       * so it can be called from a signal handler.
+       * @param[in] theReason the dump is being written (e.g. "SIGSEGV")
+       */
+      void WriteSignalDump(const char* theReason);
+
+      /**
+       * HandleSignal is installed by DoInit and writes the dump before the
+       * default handler of theSignal is called.
+       * @param[in] theSignal that was raised
+       */
+      static void HandleSignal(int theSignal);
+
+      /**
+       * FlightRecorder copy constructor is private because we do not allow
+       * copies of our class
+       */
+      FlightRecorder(const FlightRecorder&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      FlightRecorder& operator=(const FlightRecorder&); // Intentionally undefined
+  }; // class FlightRecorder
+} // namespace GQE
+
+#endif // CORE_FLIGHT_RECORDER_HPP_INCLUDED
+
+/**
+ * @class GQE::FlightRecorder
+ * @ingroup Core
+ * The FlightRecorder class is used by the IApp class to keep the last few
+ * seconds of context in memory at all times so it can be written to a file
+ * when something goes wrong. It keeps a ring of the most recent LOG_SIZE log
+ * records and FRAME_SIZE game loop frames (time spent in each phase, hitches
+ * and allocations of the frame). Text messages (see ILOG, WLOG, ILOGM, etc)
+ * are kept when the AsyncLogger publishes them. Binary log messages (see
+ * ILOGB, WLOGB and ELOGB) are kept at every severity, even those below the
+ * runtime log level, so verbose context is available without writing it to
+ * the log file. Adding a record claims a slot with a single atomic increment
+ * and copies the raw arguments or text, nothing is formatted until the dump
+ * is written. The ProfileManager
+ * is asked to record zones so the most recent DUMP_ZONES zones of each thread
+ * are included as well.
+ *
+ * The dump is written to flight.txt (see --flight-dump) when:
+ *   - ILogger::FatalShutdown is called (FLOG, FLOGM, etc)
+ *   - SIGSEGV, SIGABRT, SIGFPE or SIGILL is raised
+ *   - the F10 hotkey is pressed
+ *
+ * The dump file is opened by DoInit so the signal handlers never open files,
+ * allocate memory, lock or log. They format the dump into a static buffer and
+ * write it with write(), leaving out the profile zones and StatManager
+ * percentiles, and the log times are written in seconds since 1970.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,442 @@
+/**
+ * Provides the MusicManager class in the GQE namespace which is responsible
+ * for opening music tracks on a background thread and crossfading between
+ * the current track and the next one.
+ *
+ * @file src/GQE/Core/classes/MusicManager.cpp
+ * @author Ryan Lindeman
+ * @date 20130823 - Initial Release
+ */
+
+#include <new>
+#include <TVSource/Interfaces/IApp.hpp>
+#include <TVSource/Loggers/Log_macros.hpp>
+#include <TVSource/Managers/MusicManager.hpp>
+#include <TVSource/Managers/Profile_macros.hpp>
+
+namespace GQE
+{
+  MusicManager::MusicManager() :
+    mReady(NULL),
+    mStandby(NULL),
+    mCurrent(NULL),
+    mFading(NULL),
+    mWorker(NULL),
+    mRunning(false),
+    mCrossfading(false),
+    mSwitching(0),
+    mFadeTime(DEFAULT_FADE_TIME),
+    mFadeElapsed(0.0f),
+    mFadeFrom(0.0f),
+    mVolume((float)DEFAULT_VOLUME)
+  {
+    ILOGM("MusicManager::ctor()");
+  }
+
+  MusicManager::~MusicManager()
+  {
+    ILOGM("MusicManager::dtor()");
+
+    // Make sure the worker thread is stopped and every track closed
+    DeInit();
+  }
+
+  Uint32 MusicManager::GetFadeTime(void) const
+  {
+    return mFadeTime;
+  }
+
+  void MusicManager::SetFadeTime(const Uint32 theFadeTime)
+  {
+    mFadeTime = theFadeTime;
+  }
+
+  float MusicManager::GetVolume(void) const
+  {
+    return mVolume;
+  }
+
+  void MusicManager::SetVolume(const float theVolume)
+  {
+    // Validate the volume range first
+    if(0.0f <= theVolume && 100.0f >= theVolume)
+    {
+      mVolume = theVolume;
+
+      // Not crossfading? then change the volume of the current track now
+      if(false == mCrossfading && NULL != mCurrent)
+      {
+        mCurrent->music.setVolume(mVolume);
+      }
+    }
+    else
+    {
+      WLOG() << "MusicManager::SetVolume(" << theVolume
+        << ") Volume out of range!" << std::endl;
+    }
+  }
+
+  const typeAssetID MusicManager::GetTrack(void) const
+  {
+    // Return empty string if no track is playing
+    typeAssetID anResult;
+
+    if(NULL != mCurrent)
+    {
+      anResult = mCurrent->musicID;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  bool MusicManager::IsSwitching(void) const
+  {
+    // Obtain a lock so the worker doesn't change the count while we look
+    sf::Lock anLock(mMutex);
+
+    // Return true if a track is being opened or crossfaded
+    return 0 < mSwitching || mCrossfading;
+  }
+
+  void MusicManager::Prepare(const typeAssetID theMusicID)
+  {
+    typeMusicRequest anRequest;
+    anRequest.musicID = theMusicID;
+    anRequest.play = false;
+    anRequest.loop = false;
+    AddRequest(anRequest);
+  }
+
+  void MusicManager::Play(const typeAssetID theMusicID, const bool theLoop)
+  {
+    ILOG() << "MusicManager::Play(" << theMusicID << ")" << std::endl;
+
+    typeMusicRequest anRequest;
+    anRequest.musicID = theMusicID;
+    anRequest.play = true;
+    anRequest.loop = theLoop;
+    AddRequest(anRequest);
+  }
+
+  void MusicManager::FadeOut(void)
+  {
+    if(NULL != mCurrent)
+    {
+      // Only one track can fade out at a time, close the previous one
+      Retire(mFading);
+
+      // Fade out from wherever the current track is now
+      mFadeFrom = mCurrent->music.getVolume();
+      mFading = mCurrent;
+      mCurrent = NULL;
+      mFadeElapsed = 0.0f;
+      mCrossfading = true;
+    }
+  }
+
+  void MusicManager::Update(const float theElapsedTime)
+  {
+    PROFILE_ZONE("MusicManager::Update");
+
+    // Take the track prebuffered by the worker thread (if any)
+    typeMusicTrack* anReady = NULL;
+    {
+      sf::Lock anLock(mMutex);
+      anReady = mReady;
+      mReady = NULL;
+      if(NULL != anReady)
+      {
+        mSwitching--;
+      }
+    }
+
+    // Start crossfading from the current track to the new track
+    if(NULL != anReady)
+    {
+      // Still fading out after FadeOut? then continue from its volume now
+      if(NULL == mCurrent && NULL != mFading)
+      {
+        mFadeFrom = mFading->music.getVolume();
+      }
+      FadeOut();
+      mCurrent = anReady;
+      mFadeElapsed = 0.0f;
+      mCrossfading = true;
+    }
+
+    // Adjust the volume of both tracks while crossfading
+    if(mCrossfading)
+    {
+      mFadeElapsed += theElapsedTime;
+
+      // Fraction of the crossfade completed so far
+      float anFraction = 1.0f;
+      if(0 < mFadeTime)
+      {
+        anFraction = (mFadeElapsed * 1000.0f) / (float)mFadeTime;
+      }
+
+      if(1.0f <= anFraction)
+      {
+        // Crossfade is complete, close the track faded out
+        Retire(mFading);
+        mFading = NULL;
+        mCrossfading = false;
+        if(NULL != mCurrent)
+        {
+          mCurrent->music.setVolume(mVolume);
+        }
+      }
+      else
+      {
+        if(NULL != mFading)
+        {
+          mFading->music.setVolume(mFadeFrom * (1.0f - anFraction));
+        }
+        if(NULL != mCurrent)
+        {
+          mCurrent->music.setVolume(mVolume * anFraction);
+        }
+      }
+    }
+  }
+
+  void MusicManager::DeInit(void)
+  {
+    if(mRunning)
+    {
+      // Signal the worker thread to stop and wait for it
+      mRunning = false;
+      mWorker->wait();
+      delete mWorker;
+      mWorker = NULL;
+    }
+
+    // Close every track still open
+    CloseTrack(mCurrent);
+    mCurrent = NULL;
+    CloseTrack(mFading);
+    mFading = NULL;
+    CloseTrack(mReady);
+    mReady = NULL;
+    CloseTrack(mStandby);
+    mStandby = NULL;
+    for(size_t iloop = 0; iloop < mRetired.size(); iloop++)
+    {
+      CloseTrack(mRetired[iloop]);
+    }
+    mRetired.clear();
+    mRequests.clear();
+    mSwitching = 0;
+    mCrossfading = false;
+  }
+
+  void MusicManager::AddRequest(const typeMusicRequest& theRequest)
+  {
+    // Start the worker thread on the first track requested
+    if(false == mRunning)
+    {
+      mWorker = new(std::nothrow) sf::Thread(&MusicManager::Run, this);
+      if(NULL != mWorker)
+      {
+        mRunning = true;
+        mWorker->launch();
+      }
+      else
+      {
+        ELOG() << "MusicManager::AddRequest() Unable to create worker thread!"
+          << std::endl;
+      }
+    }
+
+    // Obtain a lock before adding the request to the queue
+    if(mRunning)
+    {
+      sf::Lock anLock(mMutex);
+      mRequests.push_back(theRequest);
+      if(theRequest.play)
+      {
+        mSwitching++;
+      }
+    }
+  }
+
+  void MusicManager::Retire(typeMusicTrack* theTrack)
+  {
+    if(NULL != theTrack)
+    {
+      // Obtain a lock before handing the track to the worker thread
+      sf::Lock anLock(mMutex);
+      mRetired.push_back(theTrack);
+    }
+  }
+
+  void MusicManager::Run(void)
+  {
+    PROFILE_THREAD("MusicManager");
+
+    while(mRunning)
+    {
+      typeMusicRequest anRequest;
+      bool anFound = false;
+      std::vector<typeMusicTrack*> anRetired;
+      {
+        // Obtain a lock only while we take the next request and retired tracks
+        sf::Lock anLock(mMutex);
+        anFound = !mRequests.empty();
+        if(anFound)
+        {
+          anRequest = mRequests.front();
+          mRequests.pop_front();
+        }
+        anRetired.swap(mRetired);
+      }
+
+      // Stop and close each track no longer heard without holding our lock
+      for(size_t iloop = 0; iloop < anRetired.size(); iloop++)
+      {
+        CloseTrack(anRetired[iloop]);
+      }
+
+      if(anFound)
+      {
+        // Use the track opened by Prepare if it is the one requested
+        typeMusicTrack* anTrack = NULL;
+        if(NULL != mStandby && mStandby->musicID == anRequest.musicID)
+        {
+          anTrack = mStandby;
+          mStandby = NULL;
+        }
+        else
+        {
+          anTrack = OpenTrack(anRequest.musicID);
+        }
+
+        if(false == anRequest.play)
+        {
+          // Keep the track opened for a later Play request
+          CloseTrack(mStandby);
+          mStandby = anTrack;
+        }
+        else
+        {
+          // Start the stream silently so its audio buffers are filled before
+          // Update starts fading it in
+          if(NULL != anTrack)
+          {
+            anTrack->music.setLoop(anRequest.loop);
+            anTrack->music.setVolume(0.0f);
+            anTrack->music.play();
+          }
+
+          // Hand the track to the main thread, replacing one never picked up
+          typeMusicTrack* anSkipped = NULL;
+          {
+            sf::Lock anLock(mMutex);
+            anSkipped = mReady;
+            if(NULL != anTrack)
+            {
+              mReady = anTrack;
+              if(NULL != anSkipped)
+              {
+                mSwitching--;
+              }
+            }
+            else
+            {
+              anSkipped = NULL;
+              mSwitching--;
+            }
+          }
+          CloseTrack(anSkipped);
+        }
+      }
+      else if(anRetired.empty())
+      {
+        // Nothing to do, wait a little while before looking again
+        sf::sleep(sf::milliseconds(WAIT_INTERVAL));
+      }
+    }
+  }
+
+  MusicManager::typeMusicTrack* MusicManager::OpenTrack(const typeAssetID theMusicID)
+  {
+    PROFILE_ZONE("MusicManager::OpenTrack");
+
+    // The location and size in bytes of the track in memory
+    const char* anData = NULL;
+    size_t anDataSize = 0;
+
+    typeMusicTrack* anResult = new(std::nothrow) typeMusicTrack;
+    if(NULL != anResult)
+    {
+      anResult->musicID = theMusicID;
+
+      // Try the asset packs mapped by the AssetManager first, otherwise map
+      // the loose file so the stream reads it from memory
+      if(false == IApp::GetApp()->mAssetManager.FindPackData(theMusicID,
+        anData, anDataSize) && anResult->file.Open(theMusicID))
+      {
+        anData = anResult->file.GetData();
+        anDataSize = anResult->file.GetSize();
+      }
+
+      if(NULL != anData && anResult->music.openFromMemory(anData, anDataSize))
+      {
+        // Touch each page of the track so the stream never waits on the disk
+        volatile char anTouch = 0;
+        for(size_t iloop = 0; iloop < anDataSize; iloop += PREBUFFER_STRIDE)
+        {
+          anTouch += anData[iloop];
+        }
+      }
+      else
+      {
+        ELOG() << "MusicManager::OpenTrack(" << theMusicID
+          << ") Unable to open track!" << std::endl;
+        delete anResult;
+        anResult = NULL;
+      }
+    }
+    else
+    {
+      ELOG() << "MusicManager::OpenTrack(" << theMusicID
+        << ") Unable to allocate track!" << std::endl;
+    }
+
+    // Return anResult of the track opened, NULL otherwise
+    return anResult;
+  }
+
+  void MusicManager::CloseTrack(typeMusicTrack* theTrack)
+  {
+    if(NULL != theTrack)
+    {
+      // Stop the stream before the memory it reads from is unmapped
+      theTrack->music.stop();
+      delete theTrack;
+    }
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,262 @@
+/**
+ * Provides the MusicManager class in the GQE namespace which is responsible
+ * for opening music tracks on a background thread and crossfading between
+ * the current track and the next one.
+ *
+ * @file include/GQE/Core/classes/MusicManager.hpp
+ * @author Ryan Lindeman
+ * @date 20130823 - Initial Release
+ */
+#ifndef   CORE_MUSIC_MANAGER_HPP_INCLUDED
+#define   CORE_MUSIC_MANAGER_HPP_INCLUDED
+
+#include <deque>
+#include <vector>
+#include <SFML/Audio.hpp>
+#include <SFML/System.hpp>
+#include <TVSource/Core/Core_types.hpp>
+#include <TVSource/Utils/MappedFile.hpp>
+
+namespace GQE
+{
+  /// Provides the background opening and crossfading of music tracks
+  class GQE_API MusicManager
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Default time in milliseconds spent crossfading between two tracks
+      static const Uint32 DEFAULT_FADE_TIME = 2000;
+      /// Default volume of the music (0 to 100)
+      static const Uint32 DEFAULT_VOLUME = 100;
+      /// Time in milliseconds the worker sleeps when there is nothing to do
+      static const Int32 WAIT_INTERVAL = 5;
+      /// Bytes between each page touched when prebuffering a track
+      static const size_t PREBUFFER_STRIDE = 4096;
+
+      /**
+       * MusicManager constructor, the worker thread isn't started until the
+       * first track is requested.
+       */
+      MusicManager();
+
+      /**
+       * MusicManager deconstructor will stop the worker thread and close
+       * every track
+       */
+      virtual ~MusicManager();
+
+      /**
+       * GetFadeTime will return the time in milliseconds spent crossfading
+       * between two tracks.
+       * @return the crossfade time in milliseconds
+       */
+      Uint32 GetFadeTime(void) const;
+
+      /**
+       * SetFadeTime will set the time in milliseconds spent crossfading
+       * between two tracks (0 switches tracks immediately).
+       * @param[in] theFadeTime in milliseconds
+       */
+      void SetFadeTime(const Uint32 theFadeTime);
+
+      /**
+       * GetVolume will return the volume of the music.
+       * @return the volume of the music (0 to 100)
+       */
+      float GetVolume(void) const;
+
+      /**
+       * SetVolume will set the volume of the music.
+       * @param[in] theVolume of the music (0 to 100)
+       */
+      void SetVolume(const float theVolume);
+
+      /**
+       * GetTrack will return the ID of the track currently playing (or
+       * fading in).
+       * @return the ID of the current track, empty if none
+       */
+      const typeAssetID GetTrack(void) const;
+
+      /**
+       * IsSwitching will return true while a requested track is being opened
+       * or crossfaded with the previous track.
+       * @return true if a track switch is in progress, false otherwise
+       */
+      bool IsSwitching(void) const;
+
+      /**
+       * Prepare will ask the worker thread to open theMusicID provided ahead
+       * of time so a later call to Play with the same track starts as soon
+       * as possible. Only the most recently prepared track is kept open.
+       * @param[in] theMusicID (filename) of the track to open
+       */
+      void Prepare(const typeAssetID theMusicID);
+
+      /**
+       * Play will ask the worker thread to open (if not prepared) and
+       * prebuffer theMusicID provided, after which Update crossfades from the
+       * current track to it. This never blocks the calling thread.
+       * @param[in] theMusicID (filename) of the track to play
+       * @param[in] theLoop is true if the track should repeat forever
+       */
+      void Play(const typeAssetID theMusicID, const bool theLoop = true);
+
+      /**
+       * FadeOut will fade out the current track (if any) over the crossfade
+       * time.
+       */
+      void FadeOut(void);
+
+      /**
+       * Update is called once each frame from the main thread and will start
+       * crossfading to each track prebuffered by the worker thread and adjust
+       * the volume of both tracks during a crossfade.
+       * @param[in] theElapsedTime in seconds since the last call
+       */
+      void Update(const float theElapsedTime);
+
+      /**
+       * DeInit will stop the worker thread and close every track, called by
+       * IApp before the application exits.
+       */
+      void DeInit(void);
+
+    private:
+      // Structures
+      ///////////////////////////////////////////////////////////////////////////
+      /// Structure holding each track opened by the worker thread
+      struct typeMusicTrack
+      {
+        typeAssetID musicID; ///< The ID (filename) of the track
+        MappedFile  file;    ///< The loose file mapped (if not in an asset pack)
+        sf::Music   music;   ///< The stream decoding the track
+      };
+
+      /// Structure holding each request waiting for the worker thread
+      struct typeMusicRequest
+      {
+        typeAssetID musicID; ///< The ID (filename) of the track requested
+        bool        play;    ///< True to play the track, false to prepare it
+        bool        loop;    ///< True if the track should repeat forever
+      };
+
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// Requests waiting for the worker thread
+      std::deque<typeMusicRequest> mRequests;
+      /// Tracks no longer heard waiting to be closed by the worker thread
+      std::vector<typeMusicTrack*> mRetired;
+      /// Track prebuffered by the worker waiting to be faded in by Update
+      typeMusicTrack*          mReady;
+      /// Mutex that protects the requests, retired and ready tracks above
+      mutable sf::Mutex        mMutex;
+      /// Track opened by Prepare (only used by the worker thread)
+      typeMusicTrack*          mStandby;
+      /// Track currently playing or fading in (only used by the main thread)
+      typeMusicTrack*          mCurrent;
+      /// Track fading out (only used by the main thread)
+      typeMusicTrack*          mFading;
+      /// The worker thread started
+      sf::Thread*              mWorker;
+      /// True while the worker thread should keep running
+      volatile bool            mRunning;
+      /// True while crossfading (only used by the main thread)
+      bool                     mCrossfading;
+      /// Number of Play requests not yet faded in (protected by mMutex)
+      Uint32                   mSwitching;
+      /// Time in milliseconds spent crossfading between two tracks
+      Uint32                   mFadeTime;
+      /// Time in seconds since the current crossfade started
+      float                    mFadeElapsed;
+      /// Volume of the fading track when its fade out started
+      float                    mFadeFrom;
+      /// Volume of the music (0 to 100)
+      float                    mVolume;
+
+      /**
+       * AddRequest will queue theRequest provided for the worker thread,
+       * starting the worker thread if it isn't running yet.
+       * @param[in] theRequest to queue
+       */
+      void AddRequest(const typeMusicRequest& theRequest);
+
+      /**
+       * Retire will hand theTrack provided to the worker thread to be stopped
+       * and closed, since stopping a stream waits for its decoding thread.
+       * @param[in] theTrack to close (NULL is ignored)
+       */
+      void Retire(typeMusicTrack* theTrack);
+
+      /**
+       * Run is the worker thread which opens and prebuffers each track
+       * requested and closes each track retired.
+       */
+      void Run(void);
+
+      /**
+       * OpenTrack is called by the worker thread to open theMusicID provided
+       * from the asset packs mapped by the AssetManager, or else by mapping
+       * the loose file into memory, and touch each page of it so the stream
+       * never waits on the disk.
+       * @param[in] theMusicID (filename) of the track to open
+       * @return pointer to the track opened, NULL otherwise
+       */
+      typeMusicTrack* OpenTrack(const typeAssetID theMusicID);
+
+      /**
+       * CloseTrack will stop and delete theTrack provided.
+       * @param[in] theTrack to close (NULL is ignored)
+       */
+      static void CloseTrack(typeMusicTrack* theTrack);
+
+      /**
+       * MusicManager copy constructor is private because we do not allow
+       * copies of our class
+       */
+      MusicManager(const MusicManager&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      MusicManager& operator=(const MusicManager&); // Intentionally undefined
+  }; // class MusicManager
+} // namespace GQE
+
+#endif // CORE_MUSIC_MANAGER_HPP_INCLUDED
+
+/**
+ * @class GQE::MusicManager
+ * @ingroup Core
+ * The MusicManager class switches music tracks without stalling the main
+ * thread. Play and Prepare only queue a request for a worker thread which
+ * opens the track from the asset packs mapped by the AssetManager or by
+ * mapping the loose file into memory (sf::Music keeps reading from that
+ * memory while it plays), touches each page of it so the stream never waits
+ * on the disk, and starts the stream at zero volume so its audio buffers are
+ * filled before it is heard. Update (called once each frame by IApp) then
+ * crossfades from the current track to the new one. Tracks that are no
+ * longer heard are stopped and closed by the worker thread since stopping a
+ * stream waits for its decoding thread to exit.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
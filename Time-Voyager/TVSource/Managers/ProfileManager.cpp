@@ -0,0 +1,432 @@
+/**
+ * Provides the ProfileManager class in the GQE namespace which is responsible
+ * for collecting the zones recorded by each thread into ring buffers and
+ * exporting them as a Chrome trace event JSON file.
+ *
+ * @file src/GQE/Core/classes/ProfileManager.cpp
+ * @author Ryan Lindeman
+ * @date 20130806 - Initial Release
+ * @date 20130811 - Added WriteZones for the FlightRecorder dump
+ */
+
+#include <fstream>
+#include <iomanip>
+#include <TVSource/Loggers/Log_macros.hpp>
+#include <TVSource/Managers/ProfileManager.hpp>
+#include <TVSource/Utils/StringUtil.hpp>
+
+namespace GQE
+{
+  /// Generation of the most recent ProfileManager created
+  static Uint32 gGeneration = 0;
+
+  /// The ring of the calling thread (registered on its first zone)
+  static GQE_THREAD_LOCAL typeProfileRing* gRing = NULL;
+
+  /// The ProfileManager generation gRing was registered with
+  static GQE_THREAD_LOCAL Uint32 gRingGeneration = 0;
+
+  /// Default filename to write the Chrome trace to
+  const char* ProfileManager::DEFAULT_TRACE = "trace.json";
+
+  /// True if zones are currently being recorded
+  volatile bool ProfileManager::gRecording = false;
+
+  /// The most recent ProfileManager created
+  ProfileManager* ProfileManager::gInstance = NULL;
+
+  ProfileManager::ProfileManager() :
+    mMutex(),
+    mRings(),
+    mClock(),
+    mStartTicks(GetTicks()),
+    mTrace(DEFAULT_TRACE),
+    mTraceFrames(0),
+    mFrames(0),
+    mEnabled(false)
+  {
+    ILOGM("ProfileManager::ctor()");
+
+    // Rings registered with a previous ProfileManager are no longer valid
+    gGeneration++;
+
+    // Make note of our instance
+    gInstance = this;
+  }
+
+  ProfileManager::~ProfileManager()
+  {
+    ILOGM("ProfileManager::dtor()");
+
+    // Stop recording zones before our rings are deleted
+    gRecording = false;
+
+    // Clear our instance if it is us
+    if(gInstance == this)
+    {
+      gInstance = NULL;
+    }
+
+    // Delete the ring of each thread
+    std::vector<typeProfileRing*>::iterator anIter = mRings.begin();
+    while(anIter != mRings.end())
+    {
+      // Get the ring to delete
+      typeProfileRing* anRing = *anIter;
+
+      // Increment our iterator first
+      anIter++;
+
+      // Delete the ring and its zones
+      delete[] anRing->zones;
+      delete anRing;
+
+      // Don't keep pointers to objects we have just deleted
+      anRing = NULL;
+    }
+
+    // Last of all clear our list of rings
+    mRings.clear();
+  }
+
+  ProfileManager* ProfileManager::GetProfileManager(void)
+  {
+    return gInstance;
+  }
+
+  bool ProfileManager::ProcessArgument(const std::string theArgument)
+  {
+    // Assume theArgument provided is a profile argument
+    bool anResult = true;
+
+    // Split theArgument into its --name and value portions
+    size_t anEquals = theArgument.find('=');
+    std::string anName = theArgument.substr(0, anEquals);
+    std::string anValue;
+    if(anEquals != std::string::npos)
+    {
+      anValue = theArgument.substr(anEquals + 1);
+    }
+
+    if(anName == "--profile")
+    {
+      mEnabled = true;
+    }
+    else if(anName == "--profile-frames")
+    {
+      mTraceFrames = ParseUint32(anValue, 0);
+      mEnabled = true;
+    }
+    else if(anName == "--profile-trace" && !anValue.empty())
+    {
+      mTrace = anValue;
+    }
+    else
+    {
+      // Not one of ours
+      anResult = false;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  void ProfileManager::DoInit(void)
+  {
+    ILOGM("ProfileManager::DoInit()");
+
+    // The calling thread is the main thread
+    SetThreadName("Main");
+
+    // Start recording if it was requested
+    if(mEnabled)
+    {
+      SetRecording(true);
+    }
+  }
+
+  void ProfileManager::DeInit(void)
+  {
+    ILOGM("ProfileManager::DeInit()");
+
+    // Stop recording zones
+    SetRecording(false);
+  }
+
+  bool ProfileManager::IsRecording(void) const
+  {
+    return gRecording;
+  }
+
+  void ProfileManager::SetRecording(bool theRecording)
+  {
+    // Count the frames recorded from now on
+    mFrames = 0;
+
+    gRecording = theRecording;
+  }
+
+  void ProfileManager::AddFrame(void)
+  {
+    // Write the trace once the number of frames requested were recorded
+    if(gRecording && mTraceFrames > 0 && ++mFrames >= mTraceFrames)
+    {
+      WriteTrace();
+
+      // Only write the trace once and stop recording
+      mTraceFrames = 0;
+      SetRecording(false);
+    }
+  }
+
+  void ProfileManager::HandleHotkey(void)
+  {
+    if(gRecording)
+    {
+      // Write the zones recorded so far
+      WriteTrace();
+    }
+    else
+    {
+      ILOG() << "ProfileManager::HandleHotkey() recording zones" << std::endl;
+      SetRecording(true);
+    }
+  }
+
+  bool ProfileManager::WriteTrace(void)
+  {
+    // Assume the trace could not be written
+    bool anResult = false;
+
+    // Pause recording so the rings don't change while we write them
+    bool anRecording = gRecording;
+    gRecording = false;
+
+    // Determine the ticks per microsecond since our clock was started
+    double anTicksPerUs = GetTicksPerUs();
+
+    // Try to open the trace file for writing
+    std::ofstream anTrace(mTrace.c_str(), std::ios::out | std::ios::trunc);
+    if(anTrace.is_open())
+    {
+      // Number of zones written to the trace
+      Uint32 anZones = 0;
+
+      anTrace << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [" << std::endl;
+      anTrace << std::fixed << std::setprecision(3);
+
+      // Obtain a lock so no threads are registered while we write
+      sf::Lock anLock(mMutex);
+
+      for(size_t iloop = 0; iloop < mRings.size(); iloop++)
+      {
+        typeProfileRing* anRing = mRings[iloop];
+
+        // Write the name of this thread first
+        anTrace << (iloop > 0 ? "," : "")
+          << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": "
+          << anRing->id << ", \"args\": {\"name\": \"" << anRing->name << "\"}}"
+          << std::endl;
+
+        // Write each zone still kept by this ring from oldest to newest
+        Uint32 anNext = anRing->next;
+        Uint32 anCount = anNext < RING_SIZE ? anNext : RING_SIZE;
+        for(Uint32 jloop = anNext - anCount; jloop != anNext; jloop++)
+        {
+          const typeProfileZone& anZone = anRing->zones[jloop & (RING_SIZE - 1)];
+
+          // Skip zones that started before our clock or never ended
+          if(anZone.begin < mStartTicks || anZone.end < anZone.begin)
+          {
+            continue;
+          }
+
+          // Zone names are string literals which never need escaping
+          anTrace << ",{\"name\": \"" << anZone.name
+            << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << anRing->id
+            << ", \"ts\": " << (double)(anZone.begin - mStartTicks) / anTicksPerUs
+            << ", \"dur\": " << (double)(anZone.end - anZone.begin) / anTicksPerUs
+            << "}" << std::endl;
+          anZones++;
+        }
+      }
+
+      anTrace << "]}" << std::endl;
+
+      // Trace was written if the stream is still good
+      anResult = anTrace.good();
+
+      // Close the trace file
+      anTrace.close();
+
+      if(anResult)
+      {
+        ILOG() << "ProfileManager::WriteTrace() wrote " << anZones
+          << " zones to " << mTrace << std::endl;
+      }
+    }
+
+    if(!anResult)
+    {
+      ELOG() << "ProfileManager::WriteTrace() unable to write " << mTrace << std::endl;
+    }
+
+    // Resume recording if we were recording before
+    gRecording = anRecording;
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  void ProfileManager::WriteZones(std::ostream& theOstream, const Uint32 theCount)
+  {
+    double anTicksPerUs = GetTicksPerUs();
+    theOstream << std::fixed << std::setprecision(3);
+
+    // Never lock, the rings are only deleted by our deconstructor
+    for(size_t iloop = 0; iloop < mRings.size(); iloop++)
+    {
+      typeProfileRing* anRing = mRings[iloop];
+      theOstream << "thread " << anRing->id << " " << anRing->name << std::endl;
+
+      // Write the most recent zones of this ring from oldest to newest
+      Uint32 anNext = anRing->next;
+      Uint32 anCount = anNext < RING_SIZE ? anNext : RING_SIZE;
+      if(anCount > theCount)
+      {
+        anCount = theCount;
+      }
+      for(Uint32 jloop = anNext - anCount; jloop != anNext; jloop++)
+      {
+        const typeProfileZone& anZone = anRing->zones[jloop & (RING_SIZE - 1)];
+
+        // Skip zones that started before our clock or never ended
+        if(anZone.begin < mStartTicks || anZone.end < anZone.begin)
+        {
+          continue;
+        }
+
+        theOstream << "  " << (double)(anZone.begin - mStartTicks) / anTicksPerUs
+          << "us " << anZone.name << " "
+          << (double)(anZone.end - anZone.begin) / anTicksPerUs << "us" << std::endl;
+      }
+    }
+  }
+
+  void ProfileManager::SetThreadName(const std::string theName)
+  {
+    // Register the calling thread if it hasn't been registered yet
+    if(NULL == gRing || gRingGeneration != gGeneration)
+    {
+      gRing = RegisterThread();
+      gRingGeneration = gGeneration;
+    }
+
+    // Change the name of the calling thread
+    if(NULL != gRing)
+    {
+      sf::Lock anLock(mMutex);
+      gRing->name = theName;
+    }
+  }
+
+  void ProfileManager::AddZone(const char* theName, const Uint64 theBegin, const Uint64 theEnd)
+  {
+    typeProfileRing* anRing = gRing;
+
+    // Register the calling thread on its first zone
+    if(NULL == anRing || gRingGeneration != gGeneration)
+    {
+      if(NULL == gInstance)
+      {
+        return;
+      }
+      anRing = gInstance->RegisterThread();
+      gRing = anRing;
+      gRingGeneration = gGeneration;
+    }
+
+    // Only the calling thread writes to its ring so no locking is needed
+    if(NULL != anRing)
+    {
+      typeProfileZone& anZone = anRing->zones[anRing->next & (RING_SIZE - 1)];
+      anZone.name = theName;
+      anZone.begin = theBegin;
+      anZone.end = theEnd;
+      anRing->next++;
+    }
+  }
+
+  typeProfileRing* ProfileManager::RegisterThread(void)
+  {
+    // Create a new ring for the calling thread
+    typeProfileRing* anResult = new(std::nothrow) typeProfileRing();
+    if(NULL != anResult)
+    {
+      anResult->next = 0;
+      anResult->zones = new(std::nothrow) typeProfileZone[RING_SIZE];
+      if(NULL == anResult->zones)
+      {
+        ELOG() << "ProfileManager::RegisterThread() unable to allocate ring" << std::endl;
+        delete anResult;
+        anResult = NULL;
+      }
+    }
+
+    if(NULL != anResult)
+    {
+      // Obtain a lock before adding the new ring to our list of rings
+      sf::Lock anLock(mMutex);
+      anResult->id = (Uint32)mRings.size() + 1;
+      anResult->name = "Thread " + ConvertUint32(anResult->id);
+      mRings.push_back(anResult);
+    }
+
+    // Return anResult created above
+    return anResult;
+  }
+
+  double ProfileManager::GetTicksPerUs(void) const
+  {
+    // Determine the ticks per microsecond since our clock was started
+    double anElapsed = (double)mClock.getElapsedTime().asMicroseconds();
+    double anResult = (double)(GetTicks() - mStartTicks) / (anElapsed > 1.0 ? anElapsed : 1.0);
+    if(anResult <= 0.0)
+    {
+      anResult = 1.0;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  Uint64 ProfileManager::GetClockTicks(void)
+  {
+    // Clock started the first time this method is called
+    static sf::Clock gClock;
+
+    // Return the microseconds elapsed as our ticks
+    return (Uint64)gClock.getElapsedTime().asMicroseconds();
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
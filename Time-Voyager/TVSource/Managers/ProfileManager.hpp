@@ -0,0 +1,289 @@
+/**
+ * Provides the ProfileManager class in the GQE namespace which is responsible
+ * for collecting the zones recorded by each thread into ring buffers and
+ * exporting them as a Chrome trace event JSON file.
+ *
+ * @file include/GQE/Core/classes/ProfileManager.hpp
+ * @author Ryan Lindeman
+ * @date 20130806 - Initial Release
+ * @date 20130811 - Added WriteZones for the FlightRecorder dump
+ */
+#ifndef   CORE_PROFILE_MANAGER_HPP_INCLUDED
+#define   CORE_PROFILE_MANAGER_HPP_INCLUDED
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include <SFML/System.hpp>
+#include <TVSource/Core/Core_types.hpp>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+namespace GQE
+{
+  /// Provides the zone profiler and its Chrome trace export
+  class GQE_API ProfileManager
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Default filename to write the Chrome trace to
+      static const char* DEFAULT_TRACE;
+      /// Number of zones kept by the ring of each thread (must be a power of 2)
+      static const Uint32 RING_SIZE = 65536;
+
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// True if zones are currently being recorded (checked by ProfileZone)
+      static volatile bool gRecording;
+
+      /**
+       * ProfileManager constructor
+       */
+      ProfileManager();
+
+      /**
+       * ProfileManager deconstructor
+       */
+      virtual ~ProfileManager();
+
+      /**
+       * GetProfileManager will return the most recent ProfileManager created.
+       * @return pointer to the ProfileManager or NULL if none exists
+       */
+      static ProfileManager* GetProfileManager(void);
+
+      /**
+       * ProcessArgument is responsible for parsing a single command line
+       * argument (e.g. --profile, --profile-frames=300 or
+       * --profile-trace=file.json).
+       * @param[in] theArgument to parse
+       * @return true if theArgument was a profile argument, false otherwise
+       */
+      bool ProcessArgument(const std::string theArgument);
+
+      /**
+       * DoInit will register the calling thread as the main thread, calibrate
+       * the timestamp ticks and start recording if it was requested.
+       */
+      void DoInit(void);
+
+      /**
+       * DeInit will stop recording zones.
+       */
+      void DeInit(void);
+
+      /**
+       * IsRecording will return true if zones are currently being recorded.
+       * @return true if zones are being recorded, false otherwise
+       */
+      bool IsRecording(void) const;
+
+      /**
+       * SetRecording will start or stop recording zones.
+       * @param[in] theRecording is the new recording value
+       */
+      void SetRecording(bool theRecording);
+
+      /**
+       * AddFrame is called at the end of each game loop iteration and will
+       * write the trace once the number of frames requested were recorded.
+       */
+      void AddFrame(void);
+
+      /**
+       * HandleHotkey is called when the profile hotkey is pressed and will
+       * start recording zones or write the zones recorded so far.
+       */
+      void HandleHotkey(void);
+
+      /**
+       * WriteTrace will write every zone kept by the ring of each thread to
+       * the Chrome trace event JSON file requested (see chrome://tracing).
+       * @return true if the trace was written, false otherwise
+       */
+      bool WriteTrace(void);
+
+      /**
+       * WriteZones will write the most recent zones kept by the ring of each
+       * thread as text to theOstream provided. This doesn't lock so it can be
+       * used while the application is crashing.
+       * @param[in] theOstream to write the zones to
+       * @param[in] theCount of zones to write for each thread
+       */
+      void WriteZones(std::ostream& theOstream, const Uint32 theCount);
+
+      /**
+       * SetThreadName will set the name shown in the trace for the calling
+       * thread.
+       * @param[in] theName to show for the calling thread
+       */
+      void SetThreadName(const std::string theName);
+
+      /**
+       * AddZone will add the zone provided to the ring of the calling thread.
+       * This is called by ProfileZone and never locks once the calling thread
+       * has been registered.
+       * @param[in] theName of the zone which must be a string literal
+       * @param[in] theBegin timestamp in ticks when the zone was entered
+       * @param[in] theEnd timestamp in ticks when the zone was exited
+       */
+      static void AddZone(const char* theName, const Uint64 theBegin, const Uint64 theEnd);
+
+      /**
+       * GetTicks will return the current timestamp in ticks which uses the
+       * CPU time stamp counter where available.
+       * @return the current timestamp in ticks
+       */
+      static Uint64 GetTicks(void)
+      {
+#if defined(_MSC_VER) || defined(__i386__) || defined(__x86_64__)
+        return __rdtsc();
+#else
+        return GetClockTicks();
+#endif
+      }
+
+    private:
+      /// Instance variable assigned at construction time
+      static ProfileManager* gInstance;
+
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// Mutex used to register each new thread
+      sf::Mutex                     mMutex;
+      /// The ring of zones registered for each thread
+      std::vector<typeProfileRing*> mRings;
+      /// Clock used to convert ticks into microseconds
+      sf::Clock                     mClock;
+      /// The timestamp in ticks when mClock was started
+      Uint64                        mStartTicks;
+      /// The filename to write the Chrome trace to
+      std::string                   mTrace;
+      /// Number of frames to record before writing the trace (0 for none)
+      Uint32                        mTraceFrames;
+      /// Number of frames recorded since recording started
+      Uint32                        mFrames;
+      /// True if recording should start when DoInit is called
+      bool                          mEnabled;
+
+      /**
+       * RegisterThread will create the ring for the calling thread.
+       * @return pointer to the ring of the calling thread
+       */
+      typeProfileRing* RegisterThread(void);
+
+      /**
+       * GetTicksPerUs will return the number of ticks per microsecond
+       * measured since our clock was started.
+       * @return the number of ticks per microsecond
+       */
+      double GetTicksPerUs(void) const;
+
+      /**
+       * GetClockTicks will return the current timestamp in microseconds for
+       * platforms where the CPU time stamp counter is not available.
+       * @return the current timestamp in microseconds
+       */
+      static Uint64 GetClockTicks(void);
+
+      /**
+       * ProfileManager copy constructor is private because we do not allow
+       * copies of our class
+       */
+      ProfileManager(const ProfileManager&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      ProfileManager& operator=(const ProfileManager&); // Intentionally undefined
+  }; // class ProfileManager
+
+  /// Provides the RAII zone used by the PROFILE_ZONE macro
+  class ProfileZone
+  {
+    public:
+      /**
+       * ProfileZone constructor will take note of the time the zone was
+       * entered if zones are currently being recorded.
+       * @param[in] theName of the zone which must be a string literal
+       */
+      explicit ProfileZone(const char* theName) :
+        mName(theName),
+        mBegin(ProfileManager::gRecording ? ProfileManager::GetTicks() : 0)
+      {
+      }
+
+      /**
+       * ProfileZone deconstructor will record the zone with the ProfileManager
+       * if zones were being recorded when the zone was entered.
+       */
+      ~ProfileZone()
+      {
+        if(0 != mBegin)
+        {
+          ProfileManager::AddZone(mName, mBegin, ProfileManager::GetTicks());
+        }
+      }
+
+    private:
+      /// The name of this zone
+      const char* mName;
+      /// The timestamp in ticks when this zone was entered (0 if not recording)
+      Uint64      mBegin;
+
+      /**
+       * ProfileZone copy constructor is private because we do not allow
+       * copies of our class
+       */
+      ProfileZone(const ProfileZone&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      ProfileZone& operator=(const ProfileZone&); // Intentionally undefined
+  }; // class ProfileZone
+} // namespace GQE
+
+#endif // CORE_PROFILE_MANAGER_HPP_INCLUDED
+
+/**
+ * @class GQE::ProfileManager
+ * @ingroup Core
+ * The ProfileManager class is used by the IApp class to collect the zones
+ * recorded by the PROFILE_ZONE macro (see Profile_macros.hpp). Each thread
+ * records into its own ring of the last RING_SIZE zones so recording never
+ * locks and costs two time stamp counter reads and one store per zone. The
+ * zones kept by every ring can be written as a Chrome trace event JSON file
+ * which can be opened using chrome://tracing:
+ *
+ *   Time-Voyager --profile-frames=300 --profile-trace=trace.json
+ *
+ * The trace is written once the number of frames requested were recorded or
+ * when the F9 hotkey is pressed (the first press starts recording when the
+ * --profile or --profile-frames options were not provided).
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
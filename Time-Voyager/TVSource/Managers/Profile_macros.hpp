@@ -0,0 +1,80 @@
+/**
+ * Provides several macros for recording profile zones with the ProfileManager
+ * (see GQE::ProfileManager) which are used by several GQE Core modules.
+ *
+ * @file include/GQE/Core/classes/Profile_macros.hpp
+ * @author Ryan Lindeman
+ * @date 20130806 - Initial Release
+ */
+#ifndef   GQE_PROFILE_MACROS_HPP_INCLUDED
+#define   GQE_PROFILE_MACROS_HPP_INCLUDED
+
+#include <TVSource/Core/Core_types.hpp>
+
+/**
+ * Define GQE_STRIP_PROFILE when compiling the GQE Libraries or GQE based game
+ * engines to strip every profile zone from the library or executable.
+ */
+#if !defined(GQE_STRIP_PROFILE)
+#include <TVSource/Managers/ProfileManager.hpp>
+
+/////////////////////////////////////////////////////////////////////////////
+// Profile Macros
+/////////////////////////////////////////////////////////////////////////////
+/// Helper macros used to create a unique ProfileZone variable name per line
+#define GQE_PROFILE_CONCAT_(theLeft, theRight) theLeft##theRight
+#define GQE_PROFILE_CONCAT(theLeft, theRight) GQE_PROFILE_CONCAT_(theLeft, theRight)
+
+/**
+ * PROFILE_ZONE macro defines a simple macro that will record the time spent
+ * from this macro until the end of the enclosing scope with the ProfileManager.
+ * @param[in] theName of the zone which must be a string literal
+ */
+#define PROFILE_ZONE(theName) \
+  GQE::ProfileZone GQE_PROFILE_CONCAT(anProfileZone, __LINE__)(theName)
+
+/**
+ * PROFILE_FUNCTION macro defines a simple macro that will record the time
+ * spent in the enclosing function with the ProfileManager.
+ */
+#define PROFILE_FUNCTION() PROFILE_ZONE(__FUNCTION__)
+
+/**
+ * PROFILE_THREAD macro defines a simple macro that will set the name shown in
+ * the Chrome trace for the calling thread.
+ * @param[in] theName of the calling thread
+ */
+#define PROFILE_THREAD(theName) \
+  do { \
+    if(GQE::ProfileManager::GetProfileManager()) { \
+      GQE::ProfileManager::GetProfileManager()->SetThreadName(theName); \
+    } \
+  } while(false)
+#else
+#define PROFILE_ZONE(theName) do {} while(false)
+#define PROFILE_FUNCTION() do {} while(false)
+#define PROFILE_THREAD(theName) do {} while(false)
+#endif
+
+#endif // GQE_PROFILE_MACROS_HPP_INCLUDED
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
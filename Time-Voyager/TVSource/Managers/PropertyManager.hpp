@@ -8,6 +8,7 @@
  * @date 20120615 - Initial Release
  * @date 20120622 - Fix warning and error comments
  * @date 20120630 - Fix documentation of various methods
+ * @date 20130810 - Rate limit the returning blank property warnings
  */
 #ifndef PROPERTY_MANAGER_HPP_INCLUDED
 #define PROPERTY_MANAGER_HPP_INCLUDED
@@ -25,6 +26,11 @@ namespace GQE
   class GQE_API PropertyManager
   {
     public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Number of blank property warnings per warning logged
+      static const Uint32 BLANK_WARNING_INTERVAL = 1000;
+
       /**
        * PropertyManager default constructor
        */
@@ -59,7 +65,8 @@ namespace GQE
         }
         else
         {
-          WLOG() << "PropertyManager:Get() returning blank property("
+          WLOG_EVERY_N(BLANK_WARNING_INTERVAL)
+            << "PropertyManager:Get() returning blank property("
             << thePropertyID << ") type" << std::endl;
         }
         TYPE anReturn=TYPE();
@@ -80,7 +87,8 @@ namespace GQE
         }
         else
         {
-          WLOG() << "PropertyManager:Get() returning blank property("
+          WLOG_EVERY_N(BLANK_WARNING_INTERVAL)
+            << "PropertyManager:Get() returning blank property("
             << thePropertyID << ") type" << std::endl;
         }
         TYPE anReturn=TYPE();
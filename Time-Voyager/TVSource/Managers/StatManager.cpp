@@ -20,13 +20,19 @@
  * @date 20120518 - Use sf::Font instead of FontAsset to remove circular dependency
  * @date 20120609 - Whitespace changes
  * @date 20120616 - Add std::nothrow to new commands for mFPS and mUPS
+ * @date 20130805 - Add game loop phase histograms, hitch counter and frame graph
+ * @date 20130807 - Add hardware counters per system and game loop phase
+ * @date 20130808 - Add allocations per frame and live bytes per scope tag
+ * @date 20130822 - Add the voice statistics of the SoundSystem
  */
 
 #include <assert.h>
+#include <cstring>
 #include <sstream>
 #include <TVSource/loggers/Log_macros.hpp>
 #include <TVSource/Managers/StatManager.hpp>
 #include <TVSource/interfaces/IApp.hpp>
+#include <TVSource/Utils/AtomicUtil.hpp>
 
 namespace GQE
 {
@@ -39,7 +45,34 @@ namespace GQE
     mFPS(NULL),
     mUpdates(0),
     mUpdateClock(),
-    mUPS(NULL)
+    mUPS(NULL),
+    mHitchThreshold(DEFAULT_HITCH_THRESHOLD),
+    mWindowSize(DEFAULT_WINDOW_SIZE),
+    mSlots(NULL),
+    mSlot(0),
+    mWindow(NULL),
+    mSlotClock(),
+    mHitches(0),
+    mGraphIndex(0),
+#if (SFML_VERSION_MAJOR < 2)
+    mTimes(NULL),
+#else
+    mTimes(NULL),
+    mGraph(sf::Lines, GRAPH_FRAMES * 2 + 2),
+#endif
+    mCounters(),
+    mCounterTotals(),
+    mCounterLast(),
+    mCounterText(NULL),
+    mAllocCount(0),
+    mAllocBytes(0),
+    mFrameAllocs(0),
+    mFrameBytes(0),
+    mAllocFrames(0),
+    mAllocText(NULL),
+    mVoiceStats(),
+    mVoicePeak(0),
+    mVoiceText(NULL)
   {
     ILOGM("StatManager::ctor()");
 
@@ -50,6 +83,12 @@ namespace GQE
   {
     ILOGM("StatManager::dtor()");
 
+    // Delete our histograms if DeInit was never called
+    delete[] mSlots;
+    mSlots = NULL;
+    delete[] mWindow;
+    mWindow = NULL;
+
     // Clear pointers we don't need anymore
     mApp = NULL;
   }
@@ -61,6 +100,37 @@ namespace GQE
     // Reset our counters
     mFrames = 0;
     mUpdates = 0;
+    mHitches = 0;
+
+    // Create a histogram of each phase for each second of the window plus
+    // the current second and one more of each phase for the merged window
+    delete[] mSlots;
+    mSlots = new(std::nothrow) StatHistogram[PhaseCount * (mWindowSize + 1)];
+    delete[] mWindow;
+    mWindow = new(std::nothrow) StatHistogram[PhaseCount];
+    mSlot = 0;
+
+    // Reset our hardware counter totals
+    mCounterTotals.clear();
+    mCounterLast.clear();
+
+    // Only count the allocations made from now on
+    mAllocCount = AllocTracker::GetAllocCount();
+    mAllocBytes = AllocTracker::GetAllocBytes();
+    mFrameAllocs = 0;
+    mFrameBytes = 0;
+    mAllocFrames = 0;
+    for(Uint32 iloop = 0; iloop < AllocTracker::MAX_TAGS; iloop++)
+    {
+      mAllocLast[iloop] = AllocTracker::GetTotals(iloop);
+    }
+
+    // Reset our frame time graph
+    for(Uint32 iloop = 0; iloop < GRAPH_FRAMES; iloop++)
+    {
+      mGraphTimes[iloop] = 0;
+    }
+    mGraphIndex = 0;
 
     // Reset our clocks
 #if (SFML_VERSION_MAJOR < 2)
@@ -75,6 +145,27 @@ namespace GQE
     mUPS = new(std::nothrow) sf::String("", mDefaultFont, 30.0F);
     mUPS->SetColor(sf::Color(0,255,0,128));
     mUPS->SetPosition(0,30);
+
+    // Position and color for the frame time percentiles string
+    mSlotClock.Reset();
+    mTimes = new(std::nothrow) sf::String("", mDefaultFont, 20.0F);
+    mTimes->SetColor(sf::Color(0,255,0,128));
+    mTimes->SetPosition(0,60);
+
+    // Position and color for the hardware counters string
+    mCounterText = new(std::nothrow) sf::String("", mDefaultFont, 14.0F);
+    mCounterText->SetColor(sf::Color(0,255,0,128));
+    mCounterText->SetPosition(0,160);
+
+    // Position and color for the allocations string
+    mAllocText = new(std::nothrow) sf::String("", mDefaultFont, 14.0F);
+    mAllocText->SetColor(sf::Color(0,255,0,128));
+    mAllocText->SetPosition(260,90);
+
+    // Position and color for the voices string
+    mVoiceText = new(std::nothrow) sf::String("", mDefaultFont, 14.0F);
+    mVoiceText->SetColor(sf::Color(0,255,0,128));
+    mVoiceText->SetPosition(260,30);
 #else
     mFrameClock.restart();
     mUpdateClock.restart();
@@ -87,6 +178,27 @@ namespace GQE
     mUPS = new(std::nothrow) sf::Text("", mDefaultFont, 30);
     mUPS->setColor(sf::Color(0,255,0,128));
     mUPS->setPosition(0,30);
+
+    // Position and color for the frame time percentiles string
+    mSlotClock.restart();
+    mTimes = new(std::nothrow) sf::Text("", mDefaultFont, 20);
+    mTimes->setColor(sf::Color(0,255,0,128));
+    mTimes->setPosition(0,60);
+
+    // Position and color for the hardware counters string
+    mCounterText = new(std::nothrow) sf::Text("", mDefaultFont, 14);
+    mCounterText->setColor(sf::Color(0,255,0,128));
+    mCounterText->setPosition(0,160);
+
+    // Position and color for the allocations string
+    mAllocText = new(std::nothrow) sf::Text("", mDefaultFont, 14);
+    mAllocText->setColor(sf::Color(0,255,0,128));
+    mAllocText->setPosition(260,90);
+
+    // Position and color for the voices string
+    mVoiceText = new(std::nothrow) sf::Text("", mDefaultFont, 14);
+    mVoiceText->setColor(sf::Color(0,255,0,128));
+    mVoiceText->setPosition(260,30);
 #endif
   }
 
@@ -101,6 +213,105 @@ namespace GQE
     // Delete our UPS string
     delete mUPS;
     mUPS = NULL;
+
+    // Log a summary of each game loop phase before deleting our histograms
+    if(NULL != mSlots && NULL != mWindow)
+    {
+      // Include the current second in our summary
+      RotateWindow();
+
+      for(Uint32 iloop = 0; iloop < PhaseCount; iloop++)
+      {
+        typeStatSummary anSummary = GetSummary((GameLoopPhase)iloop);
+        ILOG() << "StatManager::DeInit() " << gPhaseNames[iloop]
+          << " count=" << anSummary.count << " p50=" << anSummary.p50
+          << "us p95=" << anSummary.p95 << "us p99=" << anSummary.p99
+          << "us max=" << anSummary.max << "us" << std::endl;
+      }
+      ILOG() << "StatManager::DeInit() hitches=" << mHitches
+        << " (above " << mHitchThreshold << "us)" << std::endl;
+    }
+
+    // Log the hardware counter totals of each zone sampled
+    for(size_t iloop = 0; iloop < mCounterTotals.size(); iloop++)
+    {
+      const typePerfTotals& anTotals = mCounterTotals[iloop];
+
+      // Totals string stream
+      std::ostringstream totals;
+      totals << anTotals.name << " calls=" << anTotals.calls
+        << " entities=" << anTotals.entities;
+      for(Uint32 jloop = 0; jloop < PerfCount; jloop++)
+      {
+        totals << " " << gPerfNames[jloop] << "=" << anTotals.counters[jloop];
+      }
+      ILOG() << "StatManager::DeInit() " << totals.str() << std::endl;
+    }
+
+    // Log the allocations made under each tag
+    if(AllocTracker::IsEnabled())
+    {
+      for(Uint32 iloop = 0; iloop < AllocTracker::GetTagCount(); iloop++)
+      {
+        typeAllocTotals anTotals = AllocTracker::GetTotals(iloop);
+        ILOG() << "StatManager::DeInit() " << anTotals.name
+          << " allocs=" << anTotals.allocs << " bytes=" << anTotals.bytes
+          << " live=" << anTotals.live << std::endl;
+      }
+    }
+
+    // Log the totals of the voice pool (if any)
+    if(mVoiceStats.total > 0)
+    {
+      ILOG() << "StatManager::DeInit() voices=" << mVoiceStats.total
+        << " played=" << mVoiceStats.played << " coalesced=" << mVoiceStats.coalesced
+        << " limited=" << mVoiceStats.limited << " stolen=" << mVoiceStats.stolen
+        << " dropped=" << mVoiceStats.dropped << std::endl;
+    }
+
+    // Stop sampling the hardware counters
+    mCounters.Close();
+
+    // Delete our voices string
+    delete mVoiceText;
+    mVoiceText = NULL;
+
+    // Delete our allocations string
+    delete mAllocText;
+    mAllocText = NULL;
+
+    // Delete our hardware counters string
+    delete mCounterText;
+    mCounterText = NULL;
+
+    // Delete our frame time percentiles string
+    delete mTimes;
+    mTimes = NULL;
+
+    // Delete our histograms
+    delete[] mSlots;
+    mSlots = NULL;
+    delete[] mWindow;
+    mWindow = NULL;
+  }
+
+  bool StatManager::ProcessArgument(const std::string theArgument)
+  {
+    // Assume theArgument provided is a stat argument
+    bool anResult = true;
+
+    if(theArgument == "--counters")
+    {
+      SetCounting(true);
+    }
+    else
+    {
+      // Not one of ours
+      anResult = false;
+    }
+
+    // Return anResult determined above
+    return anResult;
   }
 
   bool StatManager::IsShowing(void) const
@@ -123,6 +334,228 @@ namespace GQE
     return mFrames;
   }
 
+  Uint32 StatManager::GetHitchThreshold(void) const
+  {
+    return mHitchThreshold;
+  }
+
+  void StatManager::SetHitchThreshold(const Uint32 theThreshold)
+  {
+    // Validate theThreshold provided first
+    if(theThreshold > 0)
+    {
+      mHitchThreshold = theThreshold;
+    }
+  }
+
+  Uint32 StatManager::GetWindowSize(void) const
+  {
+    return mWindowSize;
+  }
+
+  void StatManager::SetWindowSize(const Uint32 theSeconds)
+  {
+    // Validate theSeconds provided first
+    if(1 <= theSeconds && MAX_WINDOW_SIZE >= theSeconds)
+    {
+      mWindowSize = theSeconds;
+    }
+  }
+
+  void StatManager::AddFrame(const Int64 thePhaseTimes[PhaseCount])
+  {
+    // Record the time spent in each phase of this frame
+    for(Uint32 iloop = 0; iloop < PhaseCount; iloop++)
+    {
+      RecordTime((GameLoopPhase)iloop, (Uint32)thePhaseTimes[iloop]);
+    }
+
+    // Count this frame as a hitch if it took too long
+    if(thePhaseTimes[PhaseFrame] > (Int64)mHitchThreshold)
+    {
+      AtomicIncrement(mHitches);
+    }
+
+    // Count the allocations made during this frame
+    if(AllocTracker::IsEnabled())
+    {
+      Uint64 anAllocCount = AllocTracker::GetAllocCount();
+      Uint64 anAllocBytes = AllocTracker::GetAllocBytes();
+      mFrameAllocs = anAllocCount - mAllocCount;
+      mFrameBytes = anAllocBytes - mAllocBytes;
+      mAllocCount = anAllocCount;
+      mAllocBytes = anAllocBytes;
+      mAllocFrames++;
+    }
+
+    // Add this frame to our frame time graph
+    mGraphTimes[mGraphIndex] = (Uint32)thePhaseTimes[PhaseFrame];
+    mGraphIndex = (mGraphIndex + 1) % GRAPH_FRAMES;
+
+    // Move to the next slot of our window once per second
+#if (SFML_VERSION_MAJOR < 2)
+    if(NULL != mSlots && mSlotClock.GetElapsedTime() > 1.0f)
+#else
+    if(NULL != mSlots && mSlotClock.getElapsedTime().asSeconds() > 1.0f)
+#endif
+    {
+      RotateWindow();
+    }
+  }
+
+  void StatManager::RecordTime(const GameLoopPhase thePhase, const Uint32 theTime)
+  {
+    // Ignore times recorded before DoInit or after DeInit
+    if(NULL != mSlots && thePhase < PhaseCount)
+    {
+      mSlots[mSlot * PhaseCount + thePhase].Record(theTime);
+    }
+  }
+
+  typeStatSummary StatManager::GetSummary(const GameLoopPhase thePhase) const
+  {
+    // Default to an empty summary if no window is available
+    typeStatSummary anResult = {0, 0, 0, 0, 0};
+
+    if(NULL != mWindow && thePhase < PhaseCount)
+    {
+      const StatHistogram& anWindow = mWindow[thePhase];
+      anResult.count = anWindow.GetCount();
+      anResult.p50 = anWindow.GetPercentile(50.0f);
+      anResult.p95 = anWindow.GetPercentile(95.0f);
+      anResult.p99 = anWindow.GetPercentile(99.0f);
+      anResult.max = anWindow.GetMaximum();
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  Uint32 StatManager::GetPercentile(const GameLoopPhase thePhase,
+    const float thePercentile) const
+  {
+    // Default to 0 if no window is available
+    Uint32 anResult = 0;
+
+    if(NULL != mWindow && thePhase < PhaseCount)
+    {
+      anResult = mWindow[thePhase].GetPercentile(thePercentile);
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  Uint32 StatManager::GetHitches(void) const
+  {
+    return mHitches;
+  }
+
+  Uint32 StatManager::GetWindowHitches(void) const
+  {
+    // Default to 0 if no window is available
+    Uint32 anResult = 0;
+
+    if(NULL != mWindow)
+    {
+      anResult = mWindow[PhaseFrame].GetCountAbove(mHitchThreshold);
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  bool StatManager::IsCounting(void) const
+  {
+    return mCounters.IsAvailable();
+  }
+
+  void StatManager::SetCounting(bool theCounting)
+  {
+    if(theCounting && !mCounters.IsAvailable())
+    {
+      // Fall back to wall clock times only if the counters can't be opened
+      if(mCounters.Open())
+      {
+        ILOG() << "StatManager::SetCounting() sampling hardware counters" << std::endl;
+      }
+      else
+      {
+        WLOG() << "StatManager::SetCounting() hardware counters are not available"
+          << std::endl;
+      }
+    }
+    else if(!theCounting)
+    {
+      mCounters.Close();
+    }
+  }
+
+  bool StatManager::ReadCounters(typePerfSample& theSample) const
+  {
+    return mCounters.Read(theSample);
+  }
+
+  void StatManager::AddCounters(const char* theName, const typePerfSample& theBegin,
+    const typePerfSample& theEnd, const Uint32 theEntities)
+  {
+    // Find the totals of theName provided (only a few zones are ever sampled)
+    size_t anIndex = 0;
+    while(anIndex < mCounterTotals.size() &&
+      mCounterTotals[anIndex].name != theName &&
+      strcmp(mCounterTotals[anIndex].name, theName) != 0)
+    {
+      anIndex++;
+    }
+
+    // Add new totals the first time theName is sampled
+    if(anIndex == mCounterTotals.size())
+    {
+      typePerfTotals anTotals;
+      memset(&anTotals, 0, sizeof(anTotals));
+      anTotals.name = theName;
+      mCounterTotals.push_back(anTotals);
+    }
+
+    // Add the difference of each counter to the totals of theName
+    typePerfTotals& anTotals = mCounterTotals[anIndex];
+    for(Uint32 iloop = 0; iloop < PerfCount; iloop++)
+    {
+      anTotals.counters[iloop] += theEnd.counters[iloop] - theBegin.counters[iloop];
+    }
+    anTotals.calls++;
+    anTotals.entities += theEntities;
+  }
+
+  const std::vector<typePerfTotals>& StatManager::GetCounters(void) const
+  {
+    return mCounterTotals;
+  }
+
+  Uint64 StatManager::GetFrameAllocs(void) const
+  {
+    return mFrameAllocs;
+  }
+
+  Uint64 StatManager::GetFrameBytes(void) const
+  {
+    return mFrameBytes;
+  }
+
+  void StatManager::SetVoiceStats(const typeVoiceStats& theStats)
+  {
+    mVoiceStats = theStats;
+    if(mVoiceStats.active > mVoicePeak)
+    {
+      mVoicePeak = mVoiceStats.active;
+    }
+  }
+
+  const typeVoiceStats& StatManager::GetVoiceStats(void) const
+  {
+    return mVoiceStats;
+  }
+
   void StatManager::RegisterApp(IApp* theApp)
   {
     // Check that our pointer is good
@@ -213,14 +646,264 @@ namespace GQE
 
       // Draw the Updates Per Second debug value on the screen
       mApp->mWindow.Draw(*mUPS);
+
+      // Draw the frame time percentiles on the screen
+      mApp->mWindow.Draw(*mTimes);
+
+      // Draw the hardware counters of each zone on the screen
+      if(IsCounting())
+      {
+        mApp->mWindow.Draw(*mCounterText);
+      }
+
+      // Draw the allocations of each tag on the screen
+      if(AllocTracker::IsEnabled())
+      {
+        mApp->mWindow.Draw(*mAllocText);
+      }
+
+      // Draw the voices of the SoundSystem on the screen
+      if(mVoiceStats.total > 0)
+      {
+        mApp->mWindow.Draw(*mVoiceText);
+      }
 #else
       // Draw the Frames Per Second debug value on the screen
       mApp->mWindow.draw(*mFPS);
 
       // Draw the Updates Per Second debug value on the screen
       mApp->mWindow.draw(*mUPS);
+
+      // Draw the frame time percentiles on the screen
+      mApp->mWindow.draw(*mTimes);
+
+      // Draw the hardware counters of each zone on the screen
+      if(IsCounting())
+      {
+        mApp->mWindow.draw(*mCounterText);
+      }
+
+      // Draw the allocations of each tag on the screen
+      if(AllocTracker::IsEnabled())
+      {
+        mApp->mWindow.draw(*mAllocText);
+      }
+
+      // Draw the voices of the SoundSystem on the screen
+      if(mVoiceStats.total > 0)
+      {
+        mApp->mWindow.draw(*mVoiceText);
+      }
 #endif
+
+      // Draw the most recent frame times on the screen
+      DrawGraph();
+    }
+  }
+
+  void StatManager::RotateWindow(void)
+  {
+    // The oldest slot of our window becomes the current slot
+    Uint32 anSlot = (mSlot + 1) % (mWindowSize + 1);
+    for(Uint32 iloop = 0; iloop < PhaseCount; iloop++)
+    {
+      mSlots[anSlot * PhaseCount + iloop].Reset();
     }
+    mSlot = anSlot;
+
+    // Merge every slot into the window histogram of each phase
+    for(Uint32 iloop = 0; iloop < PhaseCount; iloop++)
+    {
+      mWindow[iloop].Reset();
+      for(Uint32 jloop = 0; jloop <= mWindowSize; jloop++)
+      {
+        mWindow[iloop].Merge(mSlots[jloop * PhaseCount + iloop]);
+      }
+    }
+
+    // Times string stream
+    std::ostringstream times;
+
+    // Update our frame time percentiles string to be displayed
+    typeStatSummary anFrame = GetSummary(PhaseFrame);
+    times.precision(1);
+    times << "Frame ms p50/p95/p99/max: " << std::fixed
+      << anFrame.p50 / 1000.0f << "/" << anFrame.p95 / 1000.0f << "/"
+      << anFrame.p99 / 1000.0f << "/" << anFrame.max / 1000.0f
+      << " Hitches: " << GetWindowHitches() << " (" << mHitches << ")";
+#if (SFML_VERSION_MAJOR < 2)
+    mTimes->SetText(times.str());
+#else
+    mTimes->setString(times.str());
+#endif
+
+    // Update the hardware counters of each zone over the last second
+    if(IsCounting())
+    {
+      UpdateCounterText();
+    }
+
+    // Update the allocations of each tag over the last second
+    if(AllocTracker::IsEnabled())
+    {
+      UpdateAllocText();
+    }
+
+    // Update the voices of the SoundSystem over the last second
+    if(mVoiceStats.total > 0)
+    {
+      UpdateVoiceText();
+    }
+
+#if (SFML_VERSION_MAJOR < 2)
+    // Reset our slot clock
+    mSlotClock.Reset();
+#else
+    // Reset our slot clock
+    mSlotClock.restart();
+#endif
+  }
+
+  void StatManager::UpdateCounterText(void)
+  {
+    // Counters string stream
+    std::ostringstream counters;
+    counters.precision(2);
+    counters << std::fixed;
+
+    for(size_t iloop = 0; iloop < mCounterTotals.size(); iloop++)
+    {
+      // Compute the difference since the window last rotated
+      typePerfTotals anDelta = mCounterTotals[iloop];
+      if(iloop < mCounterLast.size())
+      {
+        for(Uint32 jloop = 0; jloop < PerfCount; jloop++)
+        {
+          anDelta.counters[jloop] -= mCounterLast[iloop].counters[jloop];
+        }
+        anDelta.calls -= mCounterLast[iloop].calls;
+        anDelta.entities -= mCounterLast[iloop].entities;
+      }
+
+      // Skip zones that were not sampled during the last second
+      if(anDelta.calls == 0)
+      {
+        continue;
+      }
+
+      // Misses are per entity if the zone processes entities, per call otherwise
+      double anPer = (double)(anDelta.entities > 0 ? anDelta.entities : anDelta.calls);
+      double anCycles = (double)anDelta.counters[PerfCycles];
+      counters << anDelta.name << " IPC: "
+        << (anCycles > 0.0 ? (double)anDelta.counters[PerfInstructions] / anCycles : 0.0)
+        << (anDelta.entities > 0 ? " per entity" : " per call")
+        << " L1: " << (double)anDelta.counters[PerfL1Misses] / anPer
+        << " LLC: " << (double)anDelta.counters[PerfLLCMisses] / anPer
+        << " Branch: " << (double)anDelta.counters[PerfBranchMisses] / anPer
+        << std::endl;
+    }
+
+#if (SFML_VERSION_MAJOR < 2)
+    mCounterText->SetText(counters.str());
+#else
+    mCounterText->setString(counters.str());
+#endif
+
+    // Remember the totals for the next rotation
+    mCounterLast = mCounterTotals;
+  }
+
+  void StatManager::UpdateAllocText(void)
+  {
+    // Never divide by zero below
+    double anFrames = (double)(mAllocFrames > 0 ? mAllocFrames : 1);
+
+    // Allocations string stream
+    std::ostringstream allocs;
+    allocs.precision(1);
+    allocs << std::fixed << "Allocs/frame: " << mFrameAllocs
+      << " (" << mFrameBytes << " bytes) Live: "
+      << AllocTracker::GetLiveBytes() / 1024 << " KB" << std::endl;
+
+    // Add each tag that allocated during the last second
+    for(Uint32 iloop = 0; iloop < AllocTracker::GetTagCount(); iloop++)
+    {
+      typeAllocTotals anTotals = AllocTracker::GetTotals(iloop);
+      Uint64 anAllocs = anTotals.allocs - mAllocLast[iloop].allocs;
+      if(anAllocs > 0)
+      {
+        allocs << anTotals.name << " allocs/frame: " << (double)anAllocs / anFrames
+          << " bytes/frame: " << (double)(anTotals.bytes - mAllocLast[iloop].bytes) / anFrames
+          << " live: " << anTotals.live / 1024 << " KB" << std::endl;
+      }
+
+      // Remember the totals for the next rotation
+      mAllocLast[iloop] = anTotals;
+    }
+    mAllocFrames = 0;
+
+#if (SFML_VERSION_MAJOR < 2)
+    mAllocText->SetText(allocs.str());
+#else
+    mAllocText->setString(allocs.str());
+#endif
+  }
+
+  void StatManager::UpdateVoiceText(void)
+  {
+    // Voices string stream
+    std::ostringstream voices;
+    voices << "Voices: " << mVoiceStats.active << "/" << mVoiceStats.total
+      << " peak: " << mVoicePeak << " coalesced: " << mVoiceStats.coalesced
+      << " limited: " << mVoiceStats.limited << " stolen: " << mVoiceStats.stolen
+      << " dropped: " << mVoiceStats.dropped;
+    mVoicePeak = mVoiceStats.active;
+
+#if (SFML_VERSION_MAJOR < 2)
+    mVoiceText->SetText(voices.str());
+#else
+    mVoiceText->setString(voices.str());
+#endif
+  }
+
+  void StatManager::DrawGraph(void)
+  {
+#if (SFML_VERSION_MAJOR >= 2)
+    // The top of the graph is twice the hitch threshold
+    const float anTop = 90.0f;
+    const float anBottom = anTop + (float)GRAPH_HEIGHT;
+    const float anScale = (float)GRAPH_HEIGHT / (2.0f * (float)mHitchThreshold);
+
+    // Add a vertical bar for each frame from the oldest to the newest
+    for(Uint32 iloop = 0; iloop < GRAPH_FRAMES; iloop++)
+    {
+      Uint32 anTime = mGraphTimes[(mGraphIndex + iloop) % GRAPH_FRAMES];
+      float anHeight = (float)anTime * anScale;
+      if(anHeight > (float)GRAPH_HEIGHT)
+      {
+        anHeight = (float)GRAPH_HEIGHT;
+      }
+
+      // Hitches are drawn in red, every other frame in green
+      sf::Color anColor = anTime > mHitchThreshold ?
+        sf::Color(255,0,0,192) : sf::Color(0,255,0,128);
+      float anX = (float)(iloop * 2);
+      mGraph[iloop * 2].position = sf::Vector2f(anX, anBottom);
+      mGraph[iloop * 2].color = anColor;
+      mGraph[iloop * 2 + 1].position = sf::Vector2f(anX, anBottom - anHeight);
+      mGraph[iloop * 2 + 1].color = anColor;
+    }
+
+    // Add a horizontal line at the hitch threshold
+    float anThreshold = anBottom - (float)GRAPH_HEIGHT / 2.0f;
+    mGraph[GRAPH_FRAMES * 2].position = sf::Vector2f(0.0f, anThreshold);
+    mGraph[GRAPH_FRAMES * 2].color = sf::Color(255,255,0,128);
+    mGraph[GRAPH_FRAMES * 2 + 1].position = sf::Vector2f((float)(GRAPH_FRAMES * 2), anThreshold);
+    mGraph[GRAPH_FRAMES * 2 + 1].color = sf::Color(255,255,0,128);
+
+    // Draw the frame time graph on the screen
+    mApp->mWindow.draw(mGraph);
+#endif
   }
 } // namespace GQE
 
@@ -15,13 +15,22 @@
  * @date 20110627 - Removed extra ; from namespace
  * @date 20120421 - Use arial.ttf font since SFML 2 crashes on exit when using default font
  * @date 20120518 - Use sf::Font instead of FontAsset to remove circular dependency
+ * @date 20130805 - Add game loop phase histograms, hitch counter and frame graph
+ * @date 20130807 - Add hardware counters per system and game loop phase
+ * @date 20130808 - Add allocations per frame and live bytes per scope tag
+ * @date 20130822 - Add the voice statistics of the SoundSystem
  */
 #ifndef   CORE_STAT_MANAGER_HPP_INCLUDED
 #define   CORE_STAT_MANAGER_HPP_INCLUDED
 
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
+#include <string>
+#include <vector>
 #include <TVSource/Core/Core_types.hpp>
+#include <TVSource/Utils/AllocTracker.hpp>
+#include <TVSource/Utils/PerfCounters.hpp>
+#include <TVSource/Utils/StatHistogram.hpp>
 
 namespace GQE
 {
@@ -29,6 +38,18 @@ namespace GQE
   class GQE_API StatManager
   {
     public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Default frame time in microseconds above which a frame is a hitch
+      static const Uint32 DEFAULT_HITCH_THRESHOLD = 33333;
+      /// Default number of seconds covered by the rolling window
+      static const Uint32 DEFAULT_WINDOW_SIZE = 5;
+      /// Maximum number of seconds covered by the rolling window
+      static const Uint32 MAX_WINDOW_SIZE = 60;
+      /// Number of frames shown by the frame time graph
+      static const Uint32 GRAPH_FRAMES = 120;
+      /// Height in pixels of the frame time graph
+      static const Uint32 GRAPH_HEIGHT = 60;
 
       /**
        * StatManager constructor
@@ -52,6 +73,14 @@ namespace GQE
        */
       void DeInit(void);
 
+      /**
+       * ProcessArgument is responsible for parsing a single command line
+       * argument (e.g. --counters).
+       * @param[in] theArgument to parse
+       * @return true if theArgument was a stat argument, false otherwise
+       */
+      bool ProcessArgument(const std::string theArgument);
+
       /**
        * IsShowing will return true if the current statistics are being displayed.
        * @return true if stats are being displayed, false otherwise
@@ -79,6 +108,151 @@ namespace GQE
        */
       Uint32 GetFrames(void) const;
 
+      /**
+       * GetHitchThreshold will return the frame time in microseconds above
+       * which a frame is counted as a hitch.
+       * @return the hitch threshold in microseconds
+       */
+      Uint32 GetHitchThreshold(void) const;
+
+      /**
+       * SetHitchThreshold will set the frame time in microseconds above which
+       * a frame is counted as a hitch.
+       * @param[in] theThreshold in microseconds
+       */
+      void SetHitchThreshold(const Uint32 theThreshold);
+
+      /**
+       * GetWindowSize will return the number of seconds covered by the rolling
+       * window used by GetSummary and GetPercentile.
+       * @return the number of seconds in the rolling window
+       */
+      Uint32 GetWindowSize(void) const;
+
+      /**
+       * SetWindowSize will set the number of seconds covered by the rolling
+       * window and must be called before DoInit to take effect.
+       * @param[in] theSeconds to cover in the range of [1,MAX_WINDOW_SIZE]
+       */
+      void SetWindowSize(const Uint32 theSeconds);
+
+      /**
+       * AddFrame is responsible for recording the time spent in each game
+       * loop phase of the frame just completed and counting hitches.
+       * @param[in] thePhaseTimes in microseconds indexed by GameLoopPhase
+       */
+      void AddFrame(const Int64 thePhaseTimes[PhaseCount]);
+
+      /**
+       * RecordTime will record theTime provided for thePhase provided. This
+       * method can be called from any thread without locking.
+       * @param[in] thePhase to record theTime for
+       * @param[in] theTime in microseconds
+       */
+      void RecordTime(const GameLoopPhase thePhase, const Uint32 theTime);
+
+      /**
+       * GetSummary will return the sample count, 50th, 95th and 99th
+       * percentile and maximum time of thePhase provided over the rolling
+       * window, which is updated once per second.
+       * @param[in] thePhase to summarize
+       * @return the summary of thePhase in microseconds
+       */
+      typeStatSummary GetSummary(const GameLoopPhase thePhase) const;
+
+      /**
+       * GetPercentile will return the time at thePercentile provided of
+       * thePhase provided over the rolling window.
+       * @param[in] thePhase to find thePercentile of
+       * @param[in] thePercentile to find in the range of [0,100]
+       * @return the time in microseconds at thePercentile
+       */
+      Uint32 GetPercentile(const GameLoopPhase thePhase, const float thePercentile) const;
+
+      /**
+       * GetHitches will return the number of frames above the hitch
+       * threshold since DoInit was called.
+       * @return the number of hitches since DoInit
+       */
+      Uint32 GetHitches(void) const;
+
+      /**
+       * GetWindowHitches will return the number of frames above the hitch
+       * threshold over the rolling window.
+       * @return the number of hitches in the rolling window
+       */
+      Uint32 GetWindowHitches(void) const;
+
+      /**
+       * IsCounting will return true if the hardware counters are available
+       * and being sampled by each CounterZone.
+       * @return true if hardware counters are being sampled, false otherwise
+       */
+      bool IsCounting(void) const;
+
+      /**
+       * SetCounting will open or close the hardware counters of the calling
+       * thread, which must be the thread running the game loop. If the
+       * counters are not available a warning is logged and IsCounting will
+       * continue to return false.
+       * @param[in] theCounting is the new counting value
+       */
+      void SetCounting(bool theCounting);
+
+      /**
+       * ReadCounters will read the current value of every hardware counter.
+       * @param[out] theSample to store each counter value in
+       * @return true if theSample was read, false if not counting
+       */
+      bool ReadCounters(typePerfSample& theSample) const;
+
+      /**
+       * AddCounters will add the difference between theBegin and theEnd
+       * samples provided to the totals of theName provided. This is called
+       * by CounterZone from the game loop thread.
+       * @param[in] theName of the zone which must be a string literal
+       * @param[in] theBegin sample read when the zone was entered
+       * @param[in] theEnd sample read when the zone was exited
+       * @param[in] theEntities processed by the zone (0 if not applicable)
+       */
+      void AddCounters(const char* theName, const typePerfSample& theBegin,
+        const typePerfSample& theEnd, const Uint32 theEntities);
+
+      /**
+       * GetCounters will return the hardware counter totals of each zone
+       * sampled since DoInit was called.
+       * @return the hardware counter totals of each zone
+       */
+      const std::vector<typePerfTotals>& GetCounters(void) const;
+
+      /**
+       * GetFrameAllocs will return the number of allocations made during the
+       * last frame (see AllocTracker).
+       * @return the allocations made during the last frame
+       */
+      Uint64 GetFrameAllocs(void) const;
+
+      /**
+       * GetFrameBytes will return the number of bytes allocated during the
+       * last frame (see AllocTracker).
+       * @return the bytes allocated during the last frame
+       */
+      Uint64 GetFrameBytes(void) const;
+
+      /**
+       * SetVoiceStats is called by the SoundSystem each update to publish
+       * the statistics of its voice pool.
+       * @param[in] theStats of the voice pool
+       */
+      void SetVoiceStats(const typeVoiceStats& theStats);
+
+      /**
+       * GetVoiceStats will return the statistics of the voice pool published
+       * last by the SoundSystem (see SetVoiceStats).
+       * @return the statistics of the voice pool
+       */
+      const typeVoiceStats& GetVoiceStats(void) const;
+
       /**
        * RegisterApp will register a pointer to the App class so it can be used
        * by the StatManager for error handling and log reporting.
@@ -99,9 +273,6 @@ namespace GQE
       void Draw(void);
 
     private:
-      // Constants
-      ///////////////////////////////////////////////////////////////////////////
-
       // Variables
       ///////////////////////////////////////////////////////////////////////////
       /// Pointer to the App class for error handling and logging
@@ -132,6 +303,107 @@ namespace GQE
       sf::Text*   mUPS;
 #endif
 
+      /// Frame time in microseconds above which a frame is a hitch
+      Uint32          mHitchThreshold;
+      /// Number of seconds covered by the rolling window
+      Uint32          mWindowSize;
+      /// One histogram per phase for each second of the window plus the current one
+      StatHistogram*  mSlots;
+      /// Index of the slot currently being recorded into
+      volatile Uint32 mSlot;
+      /// One histogram per phase with every slot merged, updated once per second
+      StatHistogram*  mWindow;
+      /// Clock used to move to the next slot once per second
+      sf::Clock       mSlotClock;
+      /// Total number of hitches since DoInit was called
+      volatile Uint32 mHitches;
+      /// The most recent frame times in microseconds for the frame time graph
+      Uint32          mGraphTimes[GRAPH_FRAMES];
+      /// Index of the oldest frame time in mGraphTimes
+      Uint32          mGraphIndex;
+#if (SFML_VERSION_MAJOR < 2)
+      /// Debug string to display that shows the frame time percentiles
+      sf::String*     mTimes;
+#else
+      sf::Text*       mTimes;
+      /// Vertices used to draw the frame time graph
+      sf::VertexArray mGraph;
+#endif
+
+      /// The hardware counters of the game loop thread
+      PerfCounters    mCounters;
+      /// The hardware counter totals of each zone since DoInit was called
+      std::vector<typePerfTotals> mCounterTotals;
+      /// The hardware counter totals of each zone when the window last rotated
+      std::vector<typePerfTotals> mCounterLast;
+#if (SFML_VERSION_MAJOR < 2)
+      /// Debug string to display that shows the hardware counters of each zone
+      sf::String*     mCounterText;
+#else
+      sf::Text*       mCounterText;
+#endif
+
+      /// Total allocations made when the last frame ended
+      Uint64          mAllocCount;
+      /// Total bytes allocated when the last frame ended
+      Uint64          mAllocBytes;
+      /// Allocations made during the last frame
+      Uint64          mFrameAllocs;
+      /// Bytes allocated during the last frame
+      Uint64          mFrameBytes;
+      /// Number of frames added since the window last rotated
+      Uint32          mAllocFrames;
+      /// The totals of each allocation tag when the window last rotated
+      typeAllocTotals mAllocLast[AllocTracker::MAX_TAGS];
+#if (SFML_VERSION_MAJOR < 2)
+      /// Debug string to display that shows the allocations of each tag
+      sf::String*     mAllocText;
+#else
+      sf::Text*       mAllocText;
+#endif
+
+      /// The voice statistics published last by the SoundSystem
+      typeVoiceStats  mVoiceStats;
+      /// Most voices active at once since the window last rotated
+      Uint32          mVoicePeak;
+#if (SFML_VERSION_MAJOR < 2)
+      /// Debug string to display that shows the voice statistics
+      sf::String*     mVoiceText;
+#else
+      sf::Text*       mVoiceText;
+#endif
+
+      /**
+       * RotateWindow is responsible for moving to the next slot of the
+       * rolling window, merging the slots into the window histograms and
+       * updating the frame time percentiles displayed.
+       */
+      void RotateWindow(void);
+
+      /**
+       * DrawGraph is responsible for drawing the most recent frame times as a
+       * bar graph along with the hitch threshold.
+       */
+      void DrawGraph(void);
+
+      /**
+       * UpdateCounterText is responsible for updating the IPC and misses per
+       * entity of each zone sampled since the window last rotated.
+       */
+      void UpdateCounterText(void);
+
+      /**
+       * UpdateAllocText is responsible for updating the allocations per frame
+       * and live bytes of each allocation tag since the window last rotated.
+       */
+      void UpdateAllocText(void);
+
+      /**
+       * UpdateVoiceText is responsible for updating the active and peak
+       * voices and the voices stolen and dropped by the SoundSystem.
+       */
+      void UpdateVoiceText(void);
+
       /**
        * StatManager copy constructor is private because we do not allow copies
        * of our class
@@ -145,6 +417,64 @@ namespace GQE
       StatManager& operator=(const StatManager&); // Intentionally undefined
 
   }; // class StatManager
+
+  /// Provides the RAII hardware counter zone used around systems and phases
+  class CounterZone
+  {
+    public:
+      /**
+       * CounterZone constructor will read the hardware counters if the
+       * StatManager provided is counting.
+       * @param[in] theStatManager to add the counters to
+       * @param[in] theName of the zone which must be a string literal
+       * @param[in] theEntities processed by the zone (0 if not applicable)
+       */
+      CounterZone(StatManager& theStatManager, const char* theName,
+        const Uint32 theEntities = 0) :
+        mStatManager(theStatManager),
+        mName(theName),
+        mEntities(theEntities),
+        mCounting(theStatManager.ReadCounters(mBegin))
+      {
+      }
+
+      /**
+       * CounterZone deconstructor will add the hardware counters of this zone
+       * to the StatManager if they were read when the zone was entered.
+       */
+      ~CounterZone()
+      {
+        typePerfSample anEnd;
+        if(mCounting && mStatManager.ReadCounters(anEnd))
+        {
+          mStatManager.AddCounters(mName, mBegin, anEnd, mEntities);
+        }
+      }
+
+    private:
+      /// The StatManager to add the counters to
+      StatManager&   mStatManager;
+      /// The name of this zone
+      const char*    mName;
+      /// The number of entities processed by this zone
+      Uint32         mEntities;
+      /// The hardware counters read when this zone was entered
+      typePerfSample mBegin;
+      /// True if the hardware counters were read when this zone was entered
+      bool           mCounting;
+
+      /**
+       * CounterZone copy constructor is private because we do not allow
+       * copies of our class
+       */
+      CounterZone(const CounterZone&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      CounterZone& operator=(const CounterZone&); // Intentionally undefined
+  }; // class CounterZone
 } // namespace GQE
 
 #endif // CORE_STAT_MANAGER_HPP_INCLUDED
@@ -160,6 +490,32 @@ namespace GQE
  * These statistics can be reported back to the publisher or written to
  * a file for debug, development, or sale purposes.
  *
+ * The time spent in each GameLoopPhase of every frame is recorded into a
+ * StatHistogram for the current second. Once per second the histograms of
+ * the last few seconds (see SetWindowSize) are merged so GetSummary and
+ * GetPercentile can report the p50/p95/p99/max of each phase without storing
+ * every sample. Frames slower than the hitch threshold are counted by
+ * GetHitches and GetWindowHitches and the overlay shows the frame time
+ * percentiles and a graph of the most recent frames. The [stats] section of
+ * settings.cfg provides the show, hitch (milliseconds) and window values.
+ *
+ * When the counters value of the [stats] section or the --counters command
+ * line option is provided, each CounterZone (placed around every ISystem
+ * update and each game loop phase) samples the CPU hardware counters of the
+ * game loop thread (see PerfCounters). The overlay then shows the IPC and the
+ * cache and branch misses per entity of each zone over the last second and
+ * the totals are added to the benchmark report. Where the counters are not
+ * available a warning is logged and every CounterZone costs a single check.
+ *
+ * When allocation tracking is compiled in (see AllocTracker) the allocations
+ * and bytes of each frame are available from GetFrameAllocs/GetFrameBytes and
+ * the overlay shows the allocations per frame of each scope tag over the
+ * last second along with the bytes each tag still holds.
+ *
+ * When a SoundSystem publishes its voice pool (see SetVoiceStats) the
+ * overlay shows the voices active now and at most during the last second
+ * along with the sounds coalesced, limited, stolen and dropped so far.
+ *
  * Copyright (c) 2010-2011 Ryan Lindeman
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -20,11 +20,15 @@
  * @date 20120426 - Add another sanity check in HandleCleanup for active state
  * @date 20120512 - Renamed App to IApp since it really is just an interface
  * @date 20120702 - Rename HandleCleanup to Cleanup.
+ * @date 20130806 - Add profile zones for each state transition
+ * @date 20130819 - Prefetch the asset manifests of the likely next states
  */
 
 #include <assert.h>
 #include <stddef.h>
+#include <fstream>
 #include <TVSource/loggers/Log_macros.hpp>
+#include <TVSource/Managers/Profile_macros.hpp>
 #include <TVSource/Managers/StateManager.hpp>
 #include <TVSource/interfaces/IApp.hpp>
 #include <TVSource/interfaces/IState.hpp>
@@ -32,7 +36,8 @@
 namespace GQE
 {
   StateManager::StateManager() :
-    mApp(NULL)
+    mApp(NULL),
+    mPrefetching(true)
   {
     ILOGM("StateManager::ctor()");
   }
@@ -41,6 +46,13 @@ namespace GQE
   {
     ILOGM("StateManager::dtor()");
 
+    // Drop the assets prefetched for the likely next states
+    for(size_t iloop = 0; iloop < mPrefetches.size(); iloop++)
+    {
+      mPrefetches[iloop].first->DropReference(mPrefetches[iloop].second);
+    }
+    mPrefetches.clear();
+
     // Drop all active states
     while(!mStack.empty())
     {
@@ -112,17 +124,26 @@ namespace GQE
 
   void StateManager::AddActiveState(IState* theState)
   {
+    PROFILE_ZONE("StateManager::AddActiveState");
+
     // Check that they didn't provide a bad pointer
     assert(NULL != theState && "StateManager::AddActiveState() received a bad pointer");
 
     // Log the adding of each state
     ILOG() << "StateManager::AddActiveState(" << theState->GetID() << ")" << std::endl;
 
+    // Stop recording the assets created by the state constructor
+    StopManifest();
+
+    // The ID of the state currently running (if any)
+    typeStateID anPreviousID;
+
     // Is there a state currently running? then Pause it
     if(!mStack.empty())
     {
       // Pause the currently running state since we are changing the
       // currently active state to the one provided
+      anPreviousID = mStack.back()->GetID();
       mStack.back()->Pause();
     }
 
@@ -130,17 +151,25 @@ namespace GQE
     mStack.push_back(theState);
 
     // Initialize the new active state
-    mStack.back()->DoInit();
+    InitState(mStack.back());
+
+    // Start loading the assets of the states likely to follow
+    PrefetchNextStates(anPreviousID);
   }
 
   void StateManager::AddInactiveState(IState* theState)
   {
+    PROFILE_ZONE("StateManager::AddInactiveState");
+
     // Check that they didn't provide a bad pointer
     assert(NULL != theState && "StateManager::AddInactiveState() received a bad pointer");
 
     // Log the adding of each state
     ILOG() << "StateManager::AddInactiveState(" << theState->GetID() << ")" << std::endl;
 
+    // Stop recording the assets created by the state constructor
+    StopManifest();
+
     // Add the inactive state to the bottom of the stack
     mStack.insert(mStack.begin(), theState);
   }
@@ -152,11 +181,17 @@ namespace GQE
 
   void StateManager::InactivateActivateState(void)
   {
+    PROFILE_ZONE("StateManager::InactivateActivateState");
+
+    // The ID of the state being replaced
+    typeStateID anPreviousID;
+
     // Is there no currently active state to drop?
     if(!mStack.empty())
     {
       // Retrieve the currently active state
       IState* anState = mStack.back();
+      anPreviousID = anState->GetID();
 
       // Log the inactivating an active state
       ILOG() << "StateManager::InactivateActiveState(" << anState->GetID() << ")" << std::endl;
@@ -195,8 +230,11 @@ namespace GQE
       else
       {
         // Initialize the new active state
-        mStack.back()->DoInit();
+        InitState(mStack.back());
       }
+
+      // Start loading the assets of the states likely to follow
+      PrefetchNextStates(anPreviousID);
     }
     else
     {
@@ -210,11 +248,17 @@ namespace GQE
 
   void StateManager::DropActiveState(void)
   {
+    PROFILE_ZONE("StateManager::DropActiveState");
+
+    // The ID of the state being replaced
+    typeStateID anPreviousID;
+
     // Is there no currently active state to drop?
     if(!mStack.empty())
     {
       // Retrieve the currently active state
       IState* anState = mStack.back();
+      anPreviousID = anState->GetID();
 
       // Log the dropping of an active state
       ILOG() << "StateManager::DropActiveState(" << anState->GetID() << ")" << std::endl;
@@ -258,8 +302,11 @@ namespace GQE
       else
       {
         // Initialize the new active state
-        mStack.back()->DoInit();
+        InitState(mStack.back());
       }
+
+      // Start loading the assets of the states likely to follow
+      PrefetchNextStates(anPreviousID);
     }
     else
     {
@@ -273,6 +320,8 @@ namespace GQE
 
   void StateManager::ResetActiveState(void)
   {
+    PROFILE_ZONE("StateManager::ResetActiveState");
+
     // Is there no currently active state to reset?
     if(!mStack.empty())
     {
@@ -307,11 +356,17 @@ namespace GQE
 
   void StateManager::RemoveActiveState(void)
   {
+    PROFILE_ZONE("StateManager::RemoveActiveState");
+
+    // The ID of the state being replaced
+    typeStateID anPreviousID;
+
     // Is there no currently active state to drop?
     if(!mStack.empty())
     {
       // Retrieve the currently active state
       IState* anState = mStack.back();
+      anPreviousID = anState->GetID();
 
       // Log the removing of an active state
       ILOG() << "StateManager::RemoveActiveState(" << anState->GetID() << ")" << std::endl;
@@ -353,8 +408,11 @@ namespace GQE
       else
       {
         // Initialize the new active state
-        mStack.back()->DoInit();
+        InitState(mStack.back());
       }
+
+      // Start loading the assets of the states likely to follow
+      PrefetchNextStates(anPreviousID);
     }
     else
     {
@@ -368,6 +426,8 @@ namespace GQE
 
   void StateManager::SetActiveState(typeStateID theStateID)
   {
+    PROFILE_ZONE("StateManager::SetActiveState");
+
     std::vector<IState*>::iterator it;
 
     // Find the state that matches theStateID
@@ -383,6 +443,9 @@ namespace GQE
         // Log the setting of a previously active state as the current active state
         ILOG() << "StateManager::SetActiveState(" << anState->GetID() << ")" << std::endl;
 
+        // The ID of the state being replaced
+        typeStateID anPreviousID = mStack.back()->GetID();
+
         // Erase it from the list of previously active states
         mStack.erase(it);
 
@@ -409,9 +472,12 @@ namespace GQE
         else
         {
           // Initialize the new active state
-          mStack.back()->DoInit();
+          InitState(mStack.back());
         }
 
+        // Start loading the assets of the states likely to follow
+        PrefetchNextStates(anPreviousID);
+
         // Exit our find loop
         break;
       } // if((*it)->GetID() == theStateID)
@@ -426,6 +492,8 @@ namespace GQE
     // Remove one of our dead states
     if(!mDead.empty())
     {
+      PROFILE_ZONE("StateManager::Cleanup(dead state)");
+
       // Retrieve the dead state
       IState* anState = mDead.back();
       assert(NULL != anState && "StateManager::HandleCleanup() invalid dropped state pointer");
@@ -460,6 +528,212 @@ namespace GQE
     }
   }
 
+  void StateManager::AddManifestAsset(const typeStateID theStateID,
+    const typeAssetHandlerID theAssetHandlerID, const typeAssetID theAssetID)
+  {
+    mManifests[theStateID].insert(std::make_pair(theAssetHandlerID, theAssetID));
+  }
+
+  void StateManager::AddNextState(const typeStateID theStateID,
+    const typeStateID theNextStateID)
+  {
+    mNextStates[theStateID].insert(theNextStateID);
+  }
+
+  void StateManager::RecordManifest(const typeStateID theStateID)
+  {
+    if(NULL != mApp)
+    {
+      mApp->mAssetManager.SetManifest(&mManifests[theStateID]);
+    }
+  }
+
+  void StateManager::StopManifest(void)
+  {
+    if(NULL != mApp)
+    {
+      mApp->mAssetManager.SetManifest(NULL);
+    }
+  }
+
+  void StateManager::SetPrefetching(bool theEnabled)
+  {
+    mPrefetching = theEnabled;
+  }
+
+  bool StateManager::LoadManifests(const std::string& theFilename)
+  {
+    // Result if theFilename could not be opened
+    bool anResult = false;
+
+    std::ifstream anFile(theFilename.c_str());
+    if(anFile.is_open())
+    {
+      // The state each line that follows belongs to
+      typeStateID anStateID;
+      std::string anLine;
+      while(std::getline(anFile, anLine))
+      {
+        // Ignore the carriage return of files saved on Windows
+        if(!anLine.empty() && '\r' == anLine[anLine.length() - 1])
+        {
+          anLine.erase(anLine.length() - 1);
+        }
+
+        // Each [section] names a state followed by next=StateID and
+        // asset=HandlerID|AssetID lines
+        if(anLine.length() > 2 && '[' == anLine[0] && ']' == anLine[anLine.length() - 1])
+        {
+          anStateID = anLine.substr(1, anLine.length() - 2);
+        }
+        else if(!anStateID.empty() && 0 == anLine.compare(0, 5, "next="))
+        {
+          AddNextState(anStateID, anLine.substr(5));
+        }
+        else if(!anStateID.empty() && 0 == anLine.compare(0, 6, "asset="))
+        {
+          std::string::size_type anBar = anLine.find('|', 6);
+          if(std::string::npos != anBar)
+          {
+            AddManifestAsset(anStateID, anLine.substr(6, anBar - 6),
+              anLine.substr(anBar + 1));
+          }
+        }
+      }
+      anResult = true;
+
+      ILOG() << "StateManager::LoadManifests(" << theFilename << ") loaded "
+        << mManifests.size() << " asset manifests" << std::endl;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  bool StateManager::SaveManifests(const std::string& theFilename) const
+  {
+    // Result if theFilename could not be written
+    bool anResult = false;
+
+    std::ofstream anFile(theFilename.c_str());
+    if(anFile.is_open())
+    {
+      // Every state with a manifest or a likely next state gets a section
+      std::set<typeStateID> anStates;
+      std::map<const typeStateID, typeAssetManifest>::const_iterator iter;
+      std::map<const typeStateID, std::set<typeStateID> >::const_iterator iterNext;
+      for(iter = mManifests.begin(); iter != mManifests.end(); ++iter)
+      {
+        anStates.insert(iter->first);
+      }
+      for(iterNext = mNextStates.begin(); iterNext != mNextStates.end(); ++iterNext)
+      {
+        anStates.insert(iterNext->first);
+      }
+
+      anFile << "; State asset manifests saved by the StateManager" << std::endl;
+      std::set<typeStateID>::const_iterator iterState;
+      for(iterState = anStates.begin(); iterState != anStates.end(); ++iterState)
+      {
+        anFile << "[" << *iterState << "]" << std::endl;
+
+        iterNext = mNextStates.find(*iterState);
+        if(iterNext != mNextStates.end())
+        {
+          std::set<typeStateID>::const_iterator iterID;
+          for(iterID = iterNext->second.begin(); iterID != iterNext->second.end(); ++iterID)
+          {
+            anFile << "next=" << *iterID << std::endl;
+          }
+        }
+
+        iter = mManifests.find(*iterState);
+        if(iter != mManifests.end())
+        {
+          typeAssetManifest::const_iterator iterAsset;
+          for(iterAsset = iter->second.begin(); iterAsset != iter->second.end(); ++iterAsset)
+          {
+            anFile << "asset=" << iterAsset->first << "|" << iterAsset->second << std::endl;
+          }
+        }
+      }
+      anResult = anFile.good();
+    }
+    else
+    {
+      WLOG() << "StateManager::SaveManifests(" << theFilename
+        << ") unable to open file" << std::endl;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  void StateManager::InitState(IState* theState)
+  {
+    // Record the assets created by DoInit into the state asset manifest
+    RecordManifest(theState->GetID());
+    theState->DoInit();
+    StopManifest();
+  }
+
+  void StateManager::PrefetchNextStates(const typeStateID thePreviousID)
+  {
+    // The assets prefetched for the state now active
+    std::vector<std::pair<IAssetHandler*, typeAssetID> > anPrefetches;
+
+    if(NULL != mApp && !mStack.empty())
+    {
+      PROFILE_ZONE("StateManager::PrefetchNextStates");
+
+      const typeStateID anStateID = mStack.back()->GetID();
+
+      // Remember this state change so it is prefetched from now on
+      if(!thePreviousID.empty() && thePreviousID != anStateID)
+      {
+        AddNextState(thePreviousID, anStateID);
+      }
+
+      // Find the states likely to follow the state now active
+      std::map<const typeStateID, std::set<typeStateID> >::const_iterator iterNext;
+      iterNext = mNextStates.find(anStateID);
+      if(mPrefetching && iterNext != mNextStates.end())
+      {
+        std::set<typeStateID>::const_iterator iterID;
+        for(iterID = iterNext->second.begin(); iterID != iterNext->second.end(); ++iterID)
+        {
+          std::map<const typeStateID, typeAssetManifest>::const_iterator iter;
+          iter = mManifests.find(*iterID);
+          if(iter != mManifests.end())
+          {
+            // Hold a reference to each asset and load it in the background
+            typeAssetManifest::const_iterator iterAsset;
+            for(iterAsset = iter->second.begin(); iterAsset != iter->second.end(); ++iterAsset)
+            {
+              IAssetHandler* anHandler = mApp->mAssetManager.FindHandler(iterAsset->first);
+              if(NULL != anHandler && anHandler->AddReference(iterAsset->second))
+              {
+                anPrefetches.push_back(std::make_pair(anHandler, iterAsset->second));
+                mApp->mAssetManager.LoadAssetAsync(*anHandler, iterAsset->second);
+              }
+            }
+          }
+        }
+
+        ILOG() << "StateManager::PrefetchNextStates(" << anStateID << ") prefetching "
+          << anPrefetches.size() << " assets" << std::endl;
+      }
+    }
+
+    // Drop the assets prefetched before now that the new ones are held, so
+    // assets shared with the new prefetches are never released in between
+    mPrefetches.swap(anPrefetches);
+    for(size_t iloop = 0; iloop < anPrefetches.size(); iloop++)
+    {
+      anPrefetches[iloop].first->DropReference(anPrefetches[iloop].second);
+    }
+  }
+
 } // namespace GQE
 
 /**
@@ -18,12 +18,17 @@
  * @date 20110627 - Removed extra ; from namespace
  * @date 20110810 - Return address not pointer for GetActiveState method
  * @date 20120702 - Rename HandleCleanup to Cleanup.
+ * @date 20130819 - Prefetch the asset manifests of the likely next states
  */
 #ifndef   CORE_STATE_MANAGER_HPP_INCLUDED
 #define   CORE_STATE_MANAGER_HPP_INCLUDED
 
-#include <vector>
+#include <map>
+#include <set>
 #include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
 #include <TVSource/Core/Core_types.hpp>
 #include <TVSource/Managers/EventManager.hpp>
 
@@ -134,6 +139,74 @@ namespace GQE
        */
       void Cleanup(void);
 
+      /**
+       * AddManifestAsset will declare theAssetID managed by the asset handler
+       * registered under theAssetHandlerID as part of the asset manifest of
+       * the state identified by theStateID so it can be prefetched before
+       * that state becomes active.
+       * @param[in] theStateID of the state using the asset
+       * @param[in] theAssetHandlerID of the handler managing the asset
+       * @param[in] theAssetID of the asset to prefetch
+       */
+      void AddManifestAsset(const typeStateID theStateID,
+        const typeAssetHandlerID theAssetHandlerID, const typeAssetID theAssetID);
+
+      /**
+       * AddManifestAsset will declare theAssetID of the TYPE provided as
+       * part of the asset manifest of the state identified by theStateID.
+       * @param[in] theStateID of the state using the asset
+       * @param[in] theAssetID of the asset to prefetch
+       */
+      template<class TYPE>
+      void AddManifestAsset(const typeStateID theStateID, const typeAssetID theAssetID)
+      {
+        AddManifestAsset(theStateID, typeid(TYPE).name(), theAssetID);
+      }
+
+      /**
+       * AddNextState will declare theNextStateID as a state likely to become
+       * active after theStateID so the asset manifest of theNextStateID is
+       * prefetched while theStateID is active. Each state change is also
+       * recorded this way automatically.
+       * @param[in] theStateID of the state that will be active
+       * @param[in] theNextStateID of the state likely to follow
+       */
+      void AddNextState(const typeStateID theStateID, const typeStateID theNextStateID);
+
+      /**
+       * RecordManifest will start recording every asset referenced by a
+       * TAsset into the asset manifest of theStateID provided. It is called
+       * by the IState constructor so the assets created by the derived state
+       * constructor are recorded until the state is added to the
+       * StateManager, and again around each call to DoInit.
+       * @param[in] theStateID of the state to record the asset manifest for
+       */
+      void RecordManifest(const typeStateID theStateID);
+
+      /**
+       * SetPrefetching will enable or disable prefetching the asset manifests
+       * of the likely next states each time a state becomes active.
+       * @param[in] theEnabled true to prefetch, false otherwise
+       */
+      void SetPrefetching(bool theEnabled);
+
+      /**
+       * LoadManifests will add the asset manifests and likely next states
+       * previously saved to theFilename provided (see SaveManifests).
+       * @param[in] theFilename to load the asset manifests from
+       * @return true if theFilename was loaded, false otherwise
+       */
+      bool LoadManifests(const std::string& theFilename);
+
+      /**
+       * SaveManifests will save every asset manifest and likely next state
+       * declared or recorded so far to theFilename provided so the next run
+       * can prefetch them before each state is first used.
+       * @param[in] theFilename to save the asset manifests to
+       * @return true if theFilename was written, false otherwise
+       */
+      bool SaveManifests(const std::string& theFilename) const;
+
     private:
       // Constants
       ///////////////////////////////////////////////////////////////////////////
@@ -148,6 +221,36 @@ namespace GQE
       std::vector<IState*>  mDead;
       /// The event manager to store cleanup events
       EventManager          mCleanupEvents;
+      /// The asset manifest of each state declared, recorded or loaded
+      std::map<const typeStateID, typeAssetManifest> mManifests;
+      /// The states likely to become active after each state
+      std::map<const typeStateID, std::set<typeStateID> > mNextStates;
+      /// The assets prefetched for the likely next states
+      std::vector<std::pair<IAssetHandler*, typeAssetID> > mPrefetches;
+      /// True if the asset manifests of the likely next states are prefetched
+      bool                  mPrefetching;
+
+      /**
+       * StopManifest will stop recording the asset manifest started by
+       * RecordManifest.
+       */
+      void StopManifest(void);
+
+      /**
+       * InitState will call DoInit for theState provided while recording its
+       * asset manifest.
+       * @param[in] theState to initialize
+       */
+      void InitState(IState* theState);
+
+      /**
+       * PrefetchNextStates is called each time a state becomes active and
+       * will record the change from thePreviousID state before loading the
+       * asset manifests of the likely next states in the background and
+       * dropping the assets prefetched for the previous state.
+       * @param[in] thePreviousID of the state that was active before
+       */
+      void PrefetchNextStates(const typeStateID thePreviousID);
 
       /**
        * StateManager copy constructor is private because we do not allow copies
@@ -177,7 +280,10 @@ namespace GQE
  * state as a realization of an entire game or level if desired. The
  * StateManager is responsible for switching between game states and
  * facilitating game state management (adding, deleting, inactivating,
- * pausing, resuming, etc).
+ * pausing, resuming, etc). Each state has an asset manifest, declared with
+ * AddManifestAsset or recorded from the assets it creates, and while a state
+ * is active the manifests of the states likely to follow it are loaded in
+ * the background so the next state starts without waiting for its assets.
  *
  * Copyright (c) 2010-2011 Ryan Lindeman
  * Permission is hereby granted, free of charge, to any person obtaining a copy
@@ -0,0 +1,209 @@
+/**
+ * Provides the BenchmarkState class in the GQE namespace which is responsible
+ * for running the built-in benchmark scenarios selected on the command line.
+ *
+ * @file src/GQE/Core/states/BenchmarkState.cpp
+ * @author Ryan Lindeman
+ * @date 20130802 - Initial Release
+ */
+
+#include <stdlib.h>
+#include <TVSource/States/BenchmarkState.hpp>
+#include <TVSource/Entity/classes/Instance.hpp>
+#include <TVSource/Interfaces/IApp.hpp>
+#include <TVSource/Loggers/Log_macros.hpp>
+
+namespace GQE
+{
+  BenchmarkState::BenchmarkState(IApp& theApp) :
+    IState("Benchmark", theApp),
+    mAnimationSystem(theApp),
+    mMovementSystem(theApp),
+    mRenderSystem(theApp),
+    mPrototype("benchmark"),
+    mTexture(),
+    mAnimation(false),
+    mMovement(false)
+  {
+  }
+
+  BenchmarkState::~BenchmarkState(void)
+  {
+  }
+
+  void BenchmarkState::DoInit(void)
+  {
+    // First call our base class implementation
+    IState::DoInit();
+
+    // Determine which ISystem classes are needed by the selected scenario
+    const std::string anScenario = mApp.mBenchmarkManager.GetScenario();
+    if(anScenario == "movement")
+    {
+      mMovement = true;
+    }
+    else if(anScenario == "animation")
+    {
+      mAnimation = true;
+    }
+    else if(anScenario == "full")
+    {
+      mAnimation = true;
+      mMovement = true;
+    }
+    else if(anScenario != "render")
+    {
+      ELOG() << "BenchmarkState::DoInit() unknown scenario(" << anScenario
+        << "), expected movement, animation, render or full" << std::endl;
+
+      // Signal the application to exit
+      mApp.Quit(StatusAppInitFailed);
+      return;
+    }
+
+    // Generate a 4 frame sprite sheet so no resource files are needed
+    sf::Image anImage;
+    anImage.create(128, 32, sf::Color::White);
+    mTexture.loadFromImage(anImage);
+
+    // Register all ISystems used by the selected scenario
+    if(mAnimation)
+    {
+      mPrototype.AddSystem(&mAnimationSystem);
+    }
+    if(mMovement)
+    {
+      mPrototype.AddSystem(&mMovementSystem);
+    }
+    mPrototype.AddSystem(&mRenderSystem);
+
+    // Now create each Instance requested
+    CreateInstances(mApp.mBenchmarkManager.GetEntities());
+  }
+
+  void BenchmarkState::ReInit(void)
+  {
+    // Destroy and recreate each Instance with the same seed
+    mPrototype.Destroy();
+    CreateInstances(mApp.mBenchmarkManager.GetEntities());
+  }
+
+  void BenchmarkState::HandleEvents(sf::Event theEvent)
+  {
+    // Exit program if Escape key is pressed
+    if((theEvent.type == sf::Event::KeyReleased) && (theEvent.key.code == sf::Keyboard::Escape))
+    {
+      // Signal the application to exit
+      mApp.Quit(StatusAppOK);
+    }
+  }
+
+  void BenchmarkState::UpdateFixed(void)
+  {
+    if(mAnimation)
+    {
+      mAnimationSystem.UpdateFixed();
+    }
+    if(mMovement)
+    {
+      mMovementSystem.UpdateFixed();
+    }
+    mRenderSystem.UpdateFixed();
+  }
+
+  void BenchmarkState::UpdateVariable(float theElapsedTime)
+  {
+    if(mAnimation)
+    {
+      mAnimationSystem.UpdateVariable(theElapsedTime);
+    }
+    if(mMovement)
+    {
+      mMovementSystem.UpdateVariable(theElapsedTime);
+    }
+    mRenderSystem.UpdateVariable(theElapsedTime);
+  }
+
+  void BenchmarkState::Draw(void)
+  {
+    // Allow our RenderSystem to draw each Instance
+    mRenderSystem.Draw();
+  }
+
+  void BenchmarkState::HandleCleanup(void)
+  {
+    // Drop and delete every Instance we created
+    mPrototype.Destroy();
+  }
+
+  void BenchmarkState::CreateInstances(const Uint32 theCount)
+  {
+    // Use the benchmark seed so each run creates the same Instances
+    srand(mApp.mBenchmarkManager.GetSeed());
+
+    // Retrieve the screen size to spread our Instances across
+    const int anWidth = (int)mApp.mVideoMode.width;
+    const int anHeight = (int)mApp.mVideoMode.height;
+
+    for(Uint32 iloop = 0; iloop < theCount; iloop++)
+    {
+      Instance* anInstance = mPrototype.MakeInstance();
+
+      // Did we get a valid Instance? then set some of its properties now
+      if(anInstance != NULL)
+      {
+        anInstance->mProperties.Set<sf::Sprite>("Sprite", sf::Sprite(mTexture));
+        anInstance->mProperties.Set<sf::IntRect>("rSpriteRect", sf::IntRect(0, 0, 32, 32));
+        anInstance->mProperties.Set<sf::Vector2f>("vPosition",
+          sf::Vector2f((float)(rand() % anWidth), (float)(rand() % anHeight)));
+        anInstance->mProperties.Set<float>("fRotation", (float)(rand() % 360));
+
+        if(mMovement)
+        {
+          // Use fixed movement for half of our Instances and variable for the rest
+          anInstance->mProperties.Set<bool>("bFixedMovement", (rand() % 2) == 0);
+          anInstance->mProperties.Set<sf::Vector2f>("vVelocity",
+            sf::Vector2f((float)(rand() % 11 - 5), (float)(rand() % 11 - 5)));
+          anInstance->mProperties.Set<float>("fRotationalVelocity", (float)(rand() % 5 - 2));
+        }
+
+        if(mAnimation)
+        {
+          anInstance->mProperties.Set<float>("fFrameDelay", 0.08f);
+          anInstance->mProperties.Set<sf::Vector2u>("wFrameModifier", sf::Vector2u(1,0));
+          anInstance->mProperties.Set<sf::IntRect>("rFrameRect", sf::IntRect(0, 0, 128, 32));
+        }
+      }
+      else
+      {
+        ELOG() << "BenchmarkState::CreateInstances() out of memory after "
+          << iloop << " instances" << std::endl;
+
+        // Signal the application to exit
+        mApp.Quit(StatusError);
+        break;
+      }
+    }
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
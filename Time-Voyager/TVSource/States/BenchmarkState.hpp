@@ -0,0 +1,143 @@
+/**
+ * Provides the BenchmarkState class in the GQE namespace which is responsible
+ * for running the built-in benchmark scenarios selected on the command line.
+ *
+ * @file include/GQE/Core/states/BenchmarkState.hpp
+ * @author Ryan Lindeman
+ * @date 20130802 - Initial Release
+ */
+#ifndef   CORE_BENCHMARK_STATE_HPP_INCLUDED
+#define   CORE_BENCHMARK_STATE_HPP_INCLUDED
+
+#include <SFML/Graphics.hpp>
+#include <TVSource/Core/Core_types.hpp>
+#include <TVSource/Interfaces/IState.hpp>
+#include <TVSource/Entity/classes/Prototype.hpp>
+#include <TVSource/Entity/systems/AnimationSystem.hpp>
+#include <TVSource/Entity/systems/MovementSystem.hpp>
+#include <TVSource/Entity/systems/RenderSystem.hpp>
+
+namespace GQE
+{
+  /// Provides the state used to run the built-in benchmark scenarios
+  class GQE_API BenchmarkState : public IState
+  {
+    public:
+      /**
+       * BenchmarkState constructor
+       * @param[in] theApp is an address to the App class.
+       */
+      BenchmarkState(IApp& theApp);
+
+      /**
+       * BenchmarkState deconstructor
+       */
+      virtual ~BenchmarkState(void);
+
+      /**
+       * DoInit is responsible for registering the ISystem classes used by the
+       * selected scenario and creating each Instance requested.
+       */
+      virtual void DoInit(void);
+
+      /**
+       * ReInit is responsible for Reseting this state when the
+       * StateManager::ResetActiveState() method is called.
+       */
+      virtual void ReInit(void);
+
+      /**
+       * HandleEvents is responsible for handling input events for this
+       * State when it is the active State.
+       * @param[in] theEvent to process from the App class Loop method
+       */
+      virtual void HandleEvents(sf::Event theEvent);
+
+      /**
+       * UpdateFixed is responsible for calling UpdateFixed on each ISystem
+       * used by the selected scenario.
+       */
+      virtual void UpdateFixed(void);
+
+      /**
+       * UpdateVariable is responsible for calling UpdateVariable on each
+       * ISystem used by the selected scenario.
+       * @param[in] theElapsedTime since the last Draw was called
+       */
+      virtual void UpdateVariable(float theElapsedTime);
+
+      /**
+       * Draw is responsible for calling Draw on each ISystem used by the
+       * selected scenario.
+       */
+      virtual void Draw(void);
+
+    protected:
+      /**
+       * HandleCleanup is responsible for destroying each Instance created by
+       * this state before it is removed.
+       */
+      virtual void HandleCleanup(void);
+
+    private:
+      // Variables
+      /////////////////////////////////////////////////////////////////////////
+      /// The animation system used by the animation and full scenarios
+      AnimationSystem mAnimationSystem;
+      /// The movement system used by the movement and full scenarios
+      MovementSystem  mMovementSystem;
+      /// The render system used by every scenario
+      RenderSystem    mRenderSystem;
+      /// The prototype used to create every benchmark Instance
+      Prototype       mPrototype;
+      /// The generated sprite sheet used by every benchmark Instance
+      sf::Texture     mTexture;
+      /// True if the animation system is used by the selected scenario
+      bool            mAnimation;
+      /// True if the movement system is used by the selected scenario
+      bool            mMovement;
+
+      /**
+       * CreateInstances is responsible for creating theCount Instance classes
+       * with random positions and velocities from the benchmark seed.
+       * @param[in] theCount of Instance classes to create
+       */
+      void CreateInstances(const Uint32 theCount);
+  }; // class BenchmarkState
+} // namespace GQE
+
+#endif // CORE_BENCHMARK_STATE_HPP_INCLUDED
+
+/**
+ * @class GQE::BenchmarkState
+ * @ingroup Core
+ * The BenchmarkState class is made the active state by the IApp class when a
+ * benchmark scenario is selected using the --bench command line argument. It
+ * creates the number of Instance classes requested using the standard Entity
+ * systems needed by the scenario:
+ * - movement: MovementSystem and RenderSystem
+ * - animation: AnimationSystem and RenderSystem
+ * - render: RenderSystem only
+ * - full: AnimationSystem, MovementSystem and RenderSystem
+ * Each Instance is given a random position, velocity and rotation derived
+ * from the --seed value so each run of a scenario performs the same work.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
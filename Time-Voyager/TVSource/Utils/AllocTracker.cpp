@@ -0,0 +1,338 @@
+/**
+ * Provides the AllocTracker class in the GQE namespace which is responsible
+ * for counting every heap allocation made through the global operator new
+ * and attributing it to the scope tag active on the calling thread.
+ *
+ * @file src/GQE/Core/utils/AllocTracker.cpp
+ * @author Ryan Lindeman
+ * @date 20130808 - Initial Release
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <TVSource/Utils/AllocTracker.hpp>
+#include <TVSource/Utils/AtomicUtil.hpp>
+
+namespace GQE
+{
+  /// Value stored in each allocation header to recognize our allocations
+  static const Uint32 ALLOC_MAGIC = 0x41455147;
+
+  /// Provides the header placed in front of each allocation
+  struct typeAllocHeader
+  {
+    Uint64 size;  ///< Number of bytes requested
+    Uint32 tag;   ///< Tag active when the allocation was made
+    Uint32 magic; ///< Always ALLOC_MAGIC for our allocations
+  };
+
+  /// Provides the counters of a single tag
+  struct typeAllocTag
+  {
+    char            name[AllocTracker::MAX_NAME]; ///< Copy of the tag name
+    volatile Uint64 allocs; ///< Number of allocations made
+    volatile Uint64 bytes;  ///< Number of bytes allocated
+    volatile Uint64 live;   ///< Number of bytes allocated and not yet freed
+  };
+
+  /// The counters of each tag (statically initialized before any allocation)
+  static typeAllocTag gTags[AllocTracker::MAX_TAGS] =
+  {
+    { "untagged", 0, 0, 0 }
+  };
+
+  /// Number of tags registered in gTags
+  static volatile Uint32 gTagCount = 1;
+
+  /// Lock used while registering a new tag (never allocates)
+  static volatile Uint32 gTagLock = 0;
+
+  /// The tag stack of the calling thread
+  static GQE_THREAD_LOCAL Uint32 gStack[AllocTracker::MAX_DEPTH];
+
+  /// Number of tags pushed onto the tag stack of the calling thread
+  static GQE_THREAD_LOCAL Uint32 gDepth = 0;
+
+  bool AllocTracker::IsEnabled(void)
+  {
+#if defined(GQE_TRACK_ALLOCATIONS)
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  Uint32 AllocTracker::GetTag(const char* theName)
+  {
+    // Default to UNTAGGED if no name was provided
+    Uint32 anResult = UNTAGGED;
+
+    if(NULL != theName)
+    {
+      // Search the tags already registered without locking
+      Uint32 anCount = gTagCount;
+      for(Uint32 iloop = 1; iloop < anCount && UNTAGGED == anResult; iloop++)
+      {
+        if(strncmp(gTags[iloop].name, theName, MAX_NAME - 1) == 0)
+        {
+          anResult = iloop;
+        }
+      }
+
+      if(UNTAGGED == anResult)
+      {
+        // Spin until we own the lock, registering tags is very rare
+        while(AtomicCompareExchange(gTagLock, 1, 0) != 0)
+        {
+        }
+
+        // Search any tags registered since we last looked
+        for(Uint32 iloop = anCount; iloop < gTagCount && UNTAGGED == anResult; iloop++)
+        {
+          if(strncmp(gTags[iloop].name, theName, MAX_NAME - 1) == 0)
+          {
+            anResult = iloop;
+          }
+        }
+
+        // Register a new tag if there is still room for one
+        if(UNTAGGED == anResult && gTagCount < MAX_TAGS)
+        {
+          typeAllocTag& anTag = gTags[gTagCount];
+          strncpy(anTag.name, theName, MAX_NAME - 1);
+          anTag.name[MAX_NAME - 1] = '\0';
+          anResult = gTagCount;
+
+          // Only count the new tag once it can be found by other threads
+          AtomicIncrement(gTagCount);
+        }
+
+        // Release the lock
+        AtomicCompareExchange(gTagLock, 0, 1);
+      }
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  void AllocTracker::PushTag(const Uint32 theTag)
+  {
+    // Tags pushed beyond MAX_DEPTH are counted under the deepest tag kept
+    if(gDepth < MAX_DEPTH)
+    {
+      gStack[gDepth] = theTag < MAX_TAGS ? theTag : UNTAGGED;
+    }
+    gDepth++;
+  }
+
+  void AllocTracker::PopTag(void)
+  {
+    if(gDepth > 0)
+    {
+      gDepth--;
+    }
+  }
+
+  Uint32 AllocTracker::GetActiveTag(void)
+  {
+    // Default to UNTAGGED if no tag is active
+    Uint32 anResult = UNTAGGED;
+
+    if(gDepth > 0)
+    {
+      anResult = gStack[(gDepth < MAX_DEPTH ? gDepth : MAX_DEPTH) - 1];
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  Uint32 AllocTracker::GetTagCount(void)
+  {
+    return gTagCount;
+  }
+
+  typeAllocTotals AllocTracker::GetTotals(const Uint32 theTag)
+  {
+    // Default to empty totals if theTag isn't registered
+    typeAllocTotals anResult = {"", 0, 0, 0};
+
+    if(theTag < gTagCount)
+    {
+      const typeAllocTag& anTag = gTags[theTag];
+      anResult.name = anTag.name;
+      anResult.allocs = anTag.allocs;
+      anResult.bytes = anTag.bytes;
+      anResult.live = anTag.live;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  Uint64 AllocTracker::GetAllocCount(void)
+  {
+    Uint64 anResult = 0;
+
+    // Add the allocations made under each tag
+    Uint32 anCount = gTagCount;
+    for(Uint32 iloop = 0; iloop < anCount; iloop++)
+    {
+      anResult += gTags[iloop].allocs;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  Uint64 AllocTracker::GetAllocBytes(void)
+  {
+    Uint64 anResult = 0;
+
+    // Add the bytes allocated under each tag
+    Uint32 anCount = gTagCount;
+    for(Uint32 iloop = 0; iloop < anCount; iloop++)
+    {
+      anResult += gTags[iloop].bytes;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  Uint64 AllocTracker::GetLiveBytes(void)
+  {
+    Uint64 anResult = 0;
+
+    // Add the bytes still allocated under each tag
+    Uint32 anCount = gTagCount;
+    for(Uint32 iloop = 0; iloop < anCount; iloop++)
+    {
+      anResult += gTags[iloop].live;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  void* AllocTracker::Allocate(std::size_t theSize)
+  {
+    // Default to NULL if no memory is available
+    void* anResult = NULL;
+
+    // Allocate room for our header in front of the memory requested
+    typeAllocHeader* anHeader = (typeAllocHeader*)malloc(sizeof(typeAllocHeader) + theSize);
+    if(NULL != anHeader)
+    {
+      Uint32 anTag = GetActiveTag();
+      anHeader->size = theSize;
+      anHeader->tag = anTag;
+      anHeader->magic = ALLOC_MAGIC;
+
+      // Count this allocation under the active tag
+      AtomicAdd(gTags[anTag].allocs, 1);
+      AtomicAdd(gTags[anTag].bytes, theSize);
+      AtomicAdd(gTags[anTag].live, theSize);
+
+      // The memory requested follows our header
+      anResult = anHeader + 1;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  void AllocTracker::Free(void* theMemory)
+  {
+    if(NULL != theMemory)
+    {
+      typeAllocHeader* anHeader = (typeAllocHeader*)theMemory - 1;
+      if(ALLOC_MAGIC == anHeader->magic && anHeader->tag < MAX_TAGS)
+      {
+        // Return the bytes to the tag that allocated them
+        AtomicAdd(gTags[anHeader->tag].live, (Uint64)0 - anHeader->size);
+        anHeader->magic = 0;
+        free(anHeader);
+      }
+      else
+      {
+        // Not one of our allocations, free it as is
+        free(theMemory);
+      }
+    }
+  }
+} // namespace GQE
+
+#if defined(GQE_TRACK_ALLOCATIONS)
+void* operator new(size_t theSize) throw(std::bad_alloc)
+{
+  // Never ask malloc for zero bytes
+  void* anResult = GQE::AllocTracker::Allocate(theSize > 0 ? theSize : 1);
+  if(anResult == NULL)
+  {
+    throw std::bad_alloc();
+  }
+
+  // Return the memory allocated
+  return anResult;
+}
+
+void* operator new(size_t theSize, const std::nothrow_t&) throw()
+{
+  // Never ask malloc for zero bytes
+  return GQE::AllocTracker::Allocate(theSize > 0 ? theSize : 1);
+}
+
+void* operator new[](size_t theSize) throw(std::bad_alloc)
+{
+  return operator new(theSize);
+}
+
+void* operator new[](size_t theSize, const std::nothrow_t& theNothrow) throw()
+{
+  return operator new(theSize, theNothrow);
+}
+
+void operator delete(void* theMemory) throw()
+{
+  GQE::AllocTracker::Free(theMemory);
+}
+
+void operator delete(void* theMemory, const std::nothrow_t&) throw()
+{
+  GQE::AllocTracker::Free(theMemory);
+}
+
+void operator delete[](void* theMemory) throw()
+{
+  GQE::AllocTracker::Free(theMemory);
+}
+
+void operator delete[](void* theMemory, const std::nothrow_t&) throw()
+{
+  GQE::AllocTracker::Free(theMemory);
+}
+#endif
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
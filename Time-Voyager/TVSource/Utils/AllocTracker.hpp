@@ -0,0 +1,207 @@
+/**
+ * Provides the AllocTracker class in the GQE namespace which is responsible
+ * for counting every heap allocation made through the global operator new
+ * and attributing it to the scope tag active on the calling thread.
+ *
+ * @file include/GQE/Core/utils/AllocTracker.hpp
+ * @author Ryan Lindeman
+ * @date 20130808 - Initial Release
+ */
+#ifndef   CORE_ALLOC_TRACKER_HPP_INCLUDED
+#define   CORE_ALLOC_TRACKER_HPP_INCLUDED
+
+#include <cstddef>
+#include <TVSource/Core/Core_types.hpp>
+
+namespace GQE
+{
+  /// Provides the allocation counters of each scope tag
+  class GQE_API AllocTracker
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Maximum number of tags that can be registered (including UNTAGGED)
+      static const Uint32 MAX_TAGS = 64;
+      /// Maximum length of a tag name (longer names are truncated)
+      static const Uint32 MAX_NAME = 48;
+      /// Maximum depth of the tag stack of each thread
+      static const Uint32 MAX_DEPTH = 32;
+      /// Tag used for allocations made while no tag is active
+      static const Uint32 UNTAGGED = 0;
+
+      /**
+       * IsEnabled will return true if the global operator new and delete
+       * were replaced (see GQE_TRACK_ALLOCATIONS) and allocations are counted.
+       * @return true if allocations are being tracked, false otherwise
+       */
+      static bool IsEnabled(void);
+
+      /**
+       * GetTag will return the tag registered for theName provided and will
+       * register a new tag the first time theName is used.
+       * @param[in] theName of the tag (e.g. system name or game loop phase)
+       * @return the tag of theName or UNTAGGED if MAX_TAGS were registered
+       */
+      static Uint32 GetTag(const char* theName);
+
+      /**
+       * PushTag will make theTag provided the active tag of the calling
+       * thread until PopTag is called.
+       * @param[in] theTag to make active
+       */
+      static void PushTag(const Uint32 theTag);
+
+      /**
+       * PopTag will restore the tag that was active on the calling thread
+       * before the last PushTag call.
+       */
+      static void PopTag(void);
+
+      /**
+       * GetActiveTag will return the tag currently active on the calling thread.
+       * @return the active tag or UNTAGGED if no tag is active
+       */
+      static Uint32 GetActiveTag(void);
+
+      /**
+       * GetTagCount will return the number of tags registered so far.
+       * @return the number of tags registered (always at least 1)
+       */
+      static Uint32 GetTagCount(void);
+
+      /**
+       * GetTotals will return the allocations made while theTag was active.
+       * @param[in] theTag to return the totals of
+       * @return the totals of theTag (all zero if theTag isn't registered)
+       */
+      static typeAllocTotals GetTotals(const Uint32 theTag);
+
+      /**
+       * GetAllocCount will return the number of allocations made since the
+       * program was started.
+       * @return the total number of allocations made
+       */
+      static Uint64 GetAllocCount(void);
+
+      /**
+       * GetAllocBytes will return the number of bytes allocated since the
+       * program was started.
+       * @return the total number of bytes allocated
+       */
+      static Uint64 GetAllocBytes(void);
+
+      /**
+       * GetLiveBytes will return the number of bytes allocated and not yet
+       * freed.
+       * @return the number of bytes currently allocated
+       */
+      static Uint64 GetLiveBytes(void);
+
+      /**
+       * Allocate is called by the global operator new to allocate and count
+       * theSize bytes under the tag active on the calling thread.
+       * @param[in] theSize in bytes to allocate
+       * @return pointer to the memory allocated or NULL if none is available
+       */
+      static void* Allocate(std::size_t theSize);
+
+      /**
+       * Free is called by the global operator delete to free theMemory
+       * previously returned by Allocate.
+       * @param[in] theMemory to free (NULL is ignored)
+       */
+      static void Free(void* theMemory);
+
+    private:
+      /**
+       * AllocTracker constructor is private because this class only provides
+       * static methods
+       */
+      AllocTracker(); // Intentionally undefined
+
+      /**
+       * AllocTracker copy constructor is private because we do not allow
+       * copies of our class
+       */
+      AllocTracker(const AllocTracker&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      AllocTracker& operator=(const AllocTracker&); // Intentionally undefined
+  }; // class AllocTracker
+
+  /// Provides the RAII scope tag used by the ALLOC_SCOPE macro
+  class AllocScope
+  {
+    public:
+      /**
+       * AllocScope constructor will make theTag provided the active tag of the
+       * calling thread.
+       * @param[in] theTag to make active (see AllocTracker::GetTag)
+       */
+      explicit AllocScope(const Uint32 theTag)
+      {
+        AllocTracker::PushTag(theTag);
+      }
+
+      /**
+       * AllocScope deconstructor will restore the previously active tag.
+       */
+      ~AllocScope()
+      {
+        AllocTracker::PopTag();
+      }
+
+    private:
+      /**
+       * AllocScope copy constructor is private because we do not allow
+       * copies of our class
+       */
+      AllocScope(const AllocScope&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      AllocScope& operator=(const AllocScope&); // Intentionally undefined
+  }; // class AllocScope
+} // namespace GQE
+
+#endif // CORE_ALLOC_TRACKER_HPP_INCLUDED
+
+/**
+ * @class GQE::AllocTracker
+ * @ingroup Core
+ * The AllocTracker class is used by the StatManager and BenchmarkManager
+ * classes to report the allocations made per frame and the bytes still
+ * allocated by each scope tag. Tracking is opt-in: define
+ * GQE_TRACK_ALLOCATIONS when compiling the GQE Libraries or GQE based game
+ * engines to replace the global operator new and delete and to compile each
+ * ALLOC_SCOPE macro (see Alloc_macros.hpp). Each allocation is prefixed by a
+ * small header holding its size and tag so the bytes are returned to the
+ * right tag when freed, and every counter is updated with atomic operations
+ * so allocations can be made from any thread. Memory allocated by another
+ * module (e.g. a shared SFML library) is never seen by the tracker.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,61 @@
+/**
+ * Provides the ALLOC_SCOPE macro for attributing heap allocations to a scope
+ * tag with the AllocTracker (see GQE::AllocTracker) which is used by several
+ * GQE Core modules.
+ *
+ * @file include/GQE/Core/utils/Alloc_macros.hpp
+ * @author Ryan Lindeman
+ * @date 20130808 - Initial Release
+ */
+#ifndef   GQE_ALLOC_MACROS_HPP_INCLUDED
+#define   GQE_ALLOC_MACROS_HPP_INCLUDED
+
+#include <TVSource/Core/Core_types.hpp>
+
+/**
+ * Define GQE_TRACK_ALLOCATIONS when compiling the GQE Libraries or GQE based
+ * game engines to count every heap allocation under the active scope tag.
+ */
+#if defined(GQE_TRACK_ALLOCATIONS)
+#include <TVSource/Utils/AllocTracker.hpp>
+
+/////////////////////////////////////////////////////////////////////////////
+// Alloc Macros
+/////////////////////////////////////////////////////////////////////////////
+/// Helper macros used to create a unique AllocScope variable name per line
+#define GQE_ALLOC_CONCAT_(theLeft, theRight) theLeft##theRight
+#define GQE_ALLOC_CONCAT(theLeft, theRight) GQE_ALLOC_CONCAT_(theLeft, theRight)
+
+/**
+ * ALLOC_SCOPE macro defines a simple macro that will count every allocation
+ * made from this macro until the end of the enclosing scope under theName.
+ * @param[in] theName of the tag (e.g. system name or game loop phase)
+ */
+#define ALLOC_SCOPE(theName) \
+  GQE::AllocScope GQE_ALLOC_CONCAT(anAllocScope, __LINE__)(GQE::AllocTracker::GetTag(theName))
+#else
+#define ALLOC_SCOPE(theName) do {} while(false)
+#endif
+
+#endif // GQE_ALLOC_MACROS_HPP_INCLUDED
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,385 @@
+/**
+ * Provides the AssetPack class in the GQE namespace which is responsible for
+ * mapping a pack of asset files into memory so assets can be loaded from
+ * memory instead of opening each file one by one.
+ *
+ * @file src/GQE/Core/utils/AssetPack.cpp
+ * @author Ryan Lindeman
+ * @date 20130816 - Initial Release
+ */
+
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <utility>
+#include <TVSource/Utils/AssetPack.hpp>
+#include <TVSource/Loggers/Log_macros.hpp>
+
+namespace GQE
+{
+  /// Provides the header of an asset pack
+  struct AssetPack::typePackHeader
+  {
+    char   magic[PACK_MAGIC_LENGTH]; ///< Must be PACK_MAGIC
+    Uint32 version;     ///< Must be PACK_VERSION
+    Uint32 alignment;   ///< Alignment in bytes of the contents of each file
+    Uint32 count;       ///< Number of index entries that follow the header
+    Uint32 namesLength; ///< Number of characters in the filenames after the index
+  };
+
+  /// Provides the index entry of a single file in an asset pack
+  struct AssetPack::typePackEntry
+  {
+    Uint32 hash;       ///< Hash of the normalized filename
+    Uint32 nameOffset; ///< Offset of the normalized filename in the filenames
+    Uint32 nameLength; ///< Number of characters in the normalized filename
+    Uint32 offset;     ///< Offset of the contents from the start of the asset pack
+    Uint32 size;       ///< Size of the contents in bytes
+  };
+
+  /**
+   * HashFilename will return the hash of theFilename provided which must
+   * already be normalized (32 bit FNV-1a).
+   * @param[in] theFilename to hash
+   * @return the hash of theFilename
+   */
+  static Uint32 HashFilename(const std::string& theFilename)
+  {
+    Uint32 anResult = 2166136261U;
+    for(size_t iloop = 0; iloop < theFilename.length(); iloop++)
+    {
+      anResult = (anResult ^ (Uint8)theFilename[iloop]) * 16777619U;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  /**
+   * AlignOffset will return theOffset provided rounded up to the next
+   * multiple of AssetPack::PACK_ALIGNMENT.
+   * @param[in] theOffset to align
+   * @return the aligned offset
+   */
+  static Uint64 AlignOffset(const Uint64 theOffset)
+  {
+    return (theOffset + AssetPack::PACK_ALIGNMENT - 1) &
+      ~(Uint64)(AssetPack::PACK_ALIGNMENT - 1);
+  }
+
+  const char* const AssetPack::PACK_MAGIC = "GQEPAK01";
+
+  AssetPack::AssetPack() :
+    mEntries(NULL),
+    mCount(0),
+    mNames(NULL)
+  {
+  }
+
+  AssetPack::~AssetPack()
+  {
+    // Make sure the asset pack is unmapped
+    Close();
+  }
+
+  bool AssetPack::Open(const std::string& theFilename)
+  {
+    bool anResult = false;
+
+    // Forget any asset pack previously opened
+    Close();
+
+    // Attempt to map the asset pack into memory
+    if(!mFile.Open(theFilename))
+    {
+      ILOG() << "AssetPack::Open(" << theFilename << ") not found" << std::endl;
+    }
+    else
+    {
+      const size_t anSize = mFile.GetSize();
+      const typePackHeader* anHeader = (const typePackHeader*)mFile.GetData();
+
+      // Make sure the asset pack was written by this version
+      if(anSize >= sizeof(typePackHeader) &&
+          memcmp(anHeader->magic, PACK_MAGIC, PACK_MAGIC_LENGTH) == 0 &&
+          anHeader->version == PACK_VERSION &&
+          anHeader->alignment == PACK_ALIGNMENT &&
+          anHeader->count <= (anSize - sizeof(typePackHeader)) / sizeof(typePackEntry))
+      {
+        const size_t anIndexEnd = sizeof(typePackHeader) +
+          (size_t)anHeader->count * sizeof(typePackEntry);
+        anResult = (anHeader->namesLength <= anSize - anIndexEnd);
+
+        // Use the index and filenames in place from the mapping
+        mEntries = (const typePackEntry*)(anHeader + 1);
+        mCount = anHeader->count;
+        mNames = (const char*)(mEntries + mCount);
+
+        // Make sure every entry is within the asset pack and sorted by hash
+        const size_t anDataStart = anIndexEnd + anHeader->namesLength;
+        for(Uint32 iloop = 0; anResult && iloop < mCount; iloop++)
+        {
+          const typePackEntry& anEntry = mEntries[iloop];
+          anResult = anEntry.nameOffset <= anHeader->namesLength &&
+            anEntry.nameLength <= anHeader->namesLength - anEntry.nameOffset &&
+            anEntry.offset >= anDataStart && anEntry.offset <= anSize &&
+            anEntry.size <= anSize - anEntry.offset &&
+            (0 == iloop || mEntries[iloop - 1].hash <= anEntry.hash);
+        }
+      }
+
+      if(anResult)
+      {
+        ILOG() << "AssetPack::Open(" << theFilename << ") mapped "
+          << mCount << " files" << std::endl;
+      }
+      else
+      {
+        ELOG() << "AssetPack::Open(" << theFilename
+          << ") invalid asset pack" << std::endl;
+        Close();
+      }
+    }
+
+    // Return anResult of true if successful, false otherwise
+    return anResult;
+  }
+
+  void AssetPack::Close(void)
+  {
+    mFile.Close();
+    mEntries = NULL;
+    mCount = 0;
+    mNames = NULL;
+  }
+
+  bool AssetPack::IsOpen(void) const
+  {
+    return mFile.IsOpen();
+  }
+
+  Uint32 AssetPack::GetCount(void) const
+  {
+    return mCount;
+  }
+
+  bool AssetPack::Find(const std::string& theFilename, const char*& theData,
+    size_t& theSize) const
+  {
+    bool anResult = false;
+
+    if(mCount > 0)
+    {
+      const std::string anName = NormalizeFilename(theFilename);
+      const Uint32 anHash = HashFilename(anName);
+
+      // Binary search for the first entry with anHash
+      Uint32 anFirst = 0;
+      Uint32 anLast = mCount;
+      while(anFirst < anLast)
+      {
+        Uint32 anMiddle = anFirst + (anLast - anFirst) / 2;
+        if(mEntries[anMiddle].hash < anHash)
+        {
+          anFirst = anMiddle + 1;
+        }
+        else
+        {
+          anLast = anMiddle;
+        }
+      }
+
+      // Compare the filename of each entry with anHash to rule out collisions
+      for(Uint32 iloop = anFirst; !anResult && iloop < mCount &&
+          mEntries[iloop].hash == anHash; iloop++)
+      {
+        const typePackEntry& anEntry = mEntries[iloop];
+        if(anEntry.nameLength == anName.length() &&
+            memcmp(mNames + anEntry.nameOffset, anName.data(), anName.length()) == 0)
+        {
+          theData = mFile.GetData() + anEntry.offset;
+          theSize = anEntry.size;
+          anResult = true;
+        }
+      }
+    }
+
+    // Return anResult of true if theFilename was found, false otherwise
+    return anResult;
+  }
+
+  bool AssetPack::Build(const std::string& theFilename,
+    const std::vector<std::string>& theFiles)
+  {
+    bool anResult = true;
+
+    // Sort each file by the hash of its normalized filename
+    std::map<std::pair<Uint32, std::string>, std::string> anFiles;
+    for(size_t iloop = 0; iloop < theFiles.size(); iloop++)
+    {
+      std::string anName = NormalizeFilename(theFiles[iloop]);
+      if(!anFiles.insert(std::make_pair(std::make_pair(HashFilename(anName), anName),
+          theFiles[iloop])).second)
+      {
+        WLOG() << "AssetPack::Build(" << theFilename << ") skipping duplicate "
+          << theFiles[iloop] << std::endl;
+      }
+    }
+
+    // Create each index entry and the filenames that follow the index
+    std::vector<typePackEntry> anEntries;
+    std::string anNames;
+    std::map<std::pair<Uint32, std::string>, std::string>::const_iterator iter;
+    for(iter = anFiles.begin(); anResult && iter != anFiles.end(); ++iter)
+    {
+      MappedFile anFile;
+      typePackEntry anEntry;
+      anEntry.hash = iter->first.first;
+      anEntry.nameOffset = (Uint32)anNames.length();
+      anEntry.nameLength = (Uint32)iter->first.second.length();
+      anEntry.offset = 0;
+      anEntry.size = 0;
+      anNames.append(iter->first.second);
+
+      // Empty files can't be mapped but are still stored
+      if(anFile.Open(iter->second))
+      {
+        anEntry.size = (Uint32)anFile.GetSize();
+        anResult = (anFile.GetSize() == anEntry.size);
+      }
+      else
+      {
+        std::ifstream anEmpty(iter->second.c_str(), std::ios::in | std::ios::binary);
+        anResult = anEmpty.is_open() && anEmpty.peek() == std::ifstream::traits_type::eof();
+      }
+
+      if(!anResult)
+      {
+        ELOG() << "AssetPack::Build(" << theFilename << ") unable to read "
+          << iter->second << std::endl;
+      }
+      anEntries.push_back(anEntry);
+    }
+
+    // Place the contents of each file after the filenames at aligned offsets
+    Uint64 anOffset = AlignOffset(sizeof(typePackHeader) +
+      anEntries.size() * sizeof(typePackEntry) + anNames.length());
+    for(size_t iloop = 0; anResult && iloop < anEntries.size(); iloop++)
+    {
+      anEntries[iloop].offset = (Uint32)anOffset;
+      anResult = (anOffset == anEntries[iloop].offset);
+      anOffset = AlignOffset(anOffset + anEntries[iloop].size);
+    }
+    if(anResult && anOffset > 0xFFFFFFFFULL)
+    {
+      ELOG() << "AssetPack::Build(" << theFilename << ") asset pack too large" << std::endl;
+      anResult = false;
+    }
+
+    if(anResult)
+    {
+      typePackHeader anHeader;
+      memset(&anHeader, 0, sizeof(anHeader));
+      memcpy(anHeader.magic, PACK_MAGIC, PACK_MAGIC_LENGTH);
+      anHeader.version = PACK_VERSION;
+      anHeader.alignment = PACK_ALIGNMENT;
+      anHeader.count = (Uint32)anEntries.size();
+      anHeader.namesLength = (Uint32)anNames.length();
+
+      std::ofstream anPack(theFilename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+      anResult = anPack.is_open();
+      if(anResult)
+      {
+        const char anPadding[PACK_ALIGNMENT] = {0};
+        anPack.write((const char*)&anHeader, sizeof(anHeader));
+        if(!anEntries.empty())
+        {
+          anPack.write((const char*)&anEntries[0], anEntries.size() * sizeof(typePackEntry));
+        }
+        anPack.write(anNames.data(), anNames.length());
+
+        // Copy the contents of each file into the asset pack
+        size_t anIndex = 0;
+        for(iter = anFiles.begin(); anResult && iter != anFiles.end(); ++iter, ++anIndex)
+        {
+          const typePackEntry& anEntry = anEntries[anIndex];
+          anPack.write(anPadding, anEntry.offset - (std::streamoff)anPack.tellp());
+          if(anEntry.size > 0)
+          {
+            MappedFile anFile;
+            anResult = anFile.Open(iter->second) && anFile.GetSize() == anEntry.size;
+            if(anResult)
+            {
+              anPack.write(anFile.GetData(), anEntry.size);
+            }
+            else
+            {
+              ELOG() << "AssetPack::Build(" << theFilename << ") "
+                << iter->second << " changed while packing" << std::endl;
+            }
+          }
+        }
+        anPack.close();
+        anResult = anResult && !anPack.fail();
+      }
+
+      if(anResult)
+      {
+        ILOG() << "AssetPack::Build(" << theFilename << ") packed "
+          << anEntries.size() << " files" << std::endl;
+      }
+      else
+      {
+        ELOG() << "AssetPack::Build(" << theFilename << ") error writing file" << std::endl;
+      }
+    }
+
+    // Return anResult of true if successful, false otherwise
+    return anResult;
+  }
+
+  std::string AssetPack::NormalizeFilename(const std::string& theFilename)
+  {
+    std::string anResult;
+    anResult.reserve(theFilename.length());
+
+    // Skip any leading "./" so relative filenames match
+    size_t anStart = 0;
+    while(anStart + 1 < theFilename.length() && '.' == theFilename[anStart] &&
+        ('/' == theFilename[anStart + 1] || '\\' == theFilename[anStart + 1]))
+    {
+      anStart += 2;
+    }
+
+    for(size_t iloop = anStart; iloop < theFilename.length(); iloop++)
+    {
+      char anChar = theFilename[iloop];
+      anResult += ('\\' == anChar) ? '/' : (char)tolower((unsigned char)anChar);
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
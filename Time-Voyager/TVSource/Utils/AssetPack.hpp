@@ -0,0 +1,164 @@
+/**
+ * Provides the AssetPack class in the GQE namespace which is responsible for
+ * mapping a pack of asset files into memory so assets can be loaded from
+ * memory instead of opening each file one by one.
+ *
+ * @file include/GQE/Core/utils/AssetPack.hpp
+ * @author Ryan Lindeman
+ * @date 20130816 - Initial Release
+ */
+#ifndef   CORE_ASSET_PACK_HPP_INCLUDED
+#define   CORE_ASSET_PACK_HPP_INCLUDED
+
+#include <string>
+#include <vector>
+#include <TVSource/Core/Core_types.hpp>
+#include <TVSource/Utils/MappedFile.hpp>
+
+namespace GQE
+{
+  /// Provides read only access to each file stored in an asset pack
+  class GQE_API AssetPack
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Text found at the start of every asset pack
+      static const char* const PACK_MAGIC;
+      /// Length of PACK_MAGIC in characters
+      static const Uint32 PACK_MAGIC_LENGTH = 8;
+      /// Version of the asset pack format
+      static const Uint32 PACK_VERSION = 1;
+      /// Alignment in bytes of the contents of each file in the asset pack
+      static const Uint32 PACK_ALIGNMENT = 16;
+
+      /**
+       * AssetPack constructor
+       */
+      AssetPack();
+
+      /**
+       * AssetPack deconstructor will unmap the asset pack if it is still open
+       */
+      virtual ~AssetPack();
+
+      /**
+       * Open will map theFilename asset pack provided into memory and check
+       * its index. Any asset pack previously opened is closed first.
+       * @param[in] theFilename of the asset pack to open
+       * @return true if theFilename was found and is a valid asset pack
+       */
+      bool Open(const std::string& theFilename);
+
+      /**
+       * Close will unmap the asset pack previously opened (if any). Every
+       * pointer returned by Find is no longer valid afterwards.
+       */
+      void Close(void);
+
+      /**
+       * IsOpen will return true if an asset pack is currently mapped.
+       * @return true if an asset pack is mapped, false otherwise
+       */
+      bool IsOpen(void) const;
+
+      /**
+       * GetCount will return the number of files stored in the asset pack.
+       * @return the number of files in the asset pack
+       */
+      Uint32 GetCount(void) const;
+
+      /**
+       * Find will look up theFilename provided in the index of the asset
+       * pack and return the location of its contents within the mapping.
+       * @param[in] theFilename to find (see NormalizeFilename)
+       * @param[out] theData of the file found
+       * @param[out] theSize of the file found in bytes
+       * @return true if theFilename was found, false otherwise
+       */
+      bool Find(const std::string& theFilename, const char*& theData,
+        size_t& theSize) const;
+
+      /**
+       * Build will write each file in theFiles provided into a new asset pack
+       * called theFilename. Each file is stored under its normalized filename
+       * (see NormalizeFilename) which must match the filename used to load it.
+       * @param[in] theFilename of the asset pack to write
+       * @param[in] theFiles to store in the asset pack
+       * @return true if every file was stored successfully
+       */
+      static bool Build(const std::string& theFilename,
+        const std::vector<std::string>& theFiles);
+
+      /**
+       * NormalizeFilename will return theFilename provided using forward
+       * slashes, without a leading "./" and in lower case so the same file
+       * is found no matter how its filename was spelled on Windows.
+       * @param[in] theFilename to normalize
+       * @return the normalized filename
+       */
+      static std::string NormalizeFilename(const std::string& theFilename);
+
+    private:
+      /// Provides the header of an asset pack
+      struct typePackHeader;
+      /// Provides the index entry of a single file in an asset pack
+      struct typePackEntry;
+
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// The asset pack mapped
+      MappedFile           mFile;
+      /// The index entries sorted by hash
+      const typePackEntry* mEntries;
+      /// The number of index entries
+      Uint32               mCount;
+      /// The normalized filename of every index entry
+      const char*          mNames;
+
+      /**
+       * AssetPack copy constructor is private because we do not allow
+       * copies of our class
+       */
+      AssetPack(const AssetPack&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      AssetPack& operator=(const AssetPack&); // Intentionally undefined
+  }; // class AssetPack
+} // namespace GQE
+
+#endif // CORE_ASSET_PACK_HPP_INCLUDED
+
+/**
+ * @class GQE::AssetPack
+ * @ingroup Core
+ * The AssetPack class maps a single archive of asset files into memory so
+ * the AssetManager can hand each IAssetHandler the contents of an asset
+ * without opening the asset file itself. An asset pack starts with a header
+ * followed by an index of filename hash, offset and size entries sorted by
+ * hash, the normalized filename of each entry and finally the contents of
+ * each file aligned to PACK_ALIGNMENT bytes. Asset packs are written by the
+ * pack-assets command of the Time-Voyager-Tools application.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
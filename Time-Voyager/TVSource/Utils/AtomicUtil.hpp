@@ -0,0 +1,158 @@
+/**
+ * Provides several lock-free atomic integer operations used throughout the
+ * GQE namespace to share counters between threads without a mutex.
+ *
+ * @file include/GQE/Core/utils/AtomicUtil.hpp
+ * @author Ryan Lindeman
+ * @date 20130805 - Initial Release
+ * @date 20130808 - Added AtomicAdd for Uint64 values
+ * @date 20130825 - Added AtomicExchange
+ */
+#ifndef   CORE_ATOMIC_UTIL_HPP_INCLUDED
+#define   CORE_ATOMIC_UTIL_HPP_INCLUDED
+
+#include <TVSource/Core/Core_types.hpp>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace GQE
+{
+  /**
+   * AtomicIncrement will atomically add one to theValue provided.
+   * @param[in] theValue to increment
+   * @return the incremented value
+   */
+  inline Uint32 AtomicIncrement(volatile Uint32& theValue)
+  {
+#if defined(_MSC_VER)
+    return (Uint32)_InterlockedIncrement((volatile long*)&theValue);
+#else
+    return __sync_add_and_fetch(&theValue, 1);
+#endif
+  }
+
+  /**
+   * AtomicAdd will atomically add theAmount provided to theValue provided.
+   * @param[in] theValue to add theAmount to
+   * @param[in] theAmount to add
+   * @return the value before theAmount was added
+   */
+  inline Uint32 AtomicAdd(volatile Uint32& theValue, const Uint32 theAmount)
+  {
+#if defined(_MSC_VER)
+    return (Uint32)_InterlockedExchangeAdd((volatile long*)&theValue, (long)theAmount);
+#else
+    return __sync_fetch_and_add(&theValue, theAmount);
+#endif
+  }
+
+  /**
+   * AtomicAdd will atomically add theAmount provided to theValue provided.
+   * Use a wrapped around amount (e.g. (Uint64)0 - theSize) to subtract.
+   * @param[in] theValue to add theAmount to
+   * @param[in] theAmount to add
+   * @return the value before theAmount was added
+   */
+  inline Uint64 AtomicAdd(volatile Uint64& theValue, const Uint64 theAmount)
+  {
+#if defined(_MSC_VER)
+    // 32 bit Windows has no 64 bit exchange add so retry a compare exchange
+    Uint64 anCurrent = theValue;
+    while(true)
+    {
+      Uint64 anPrevious = (Uint64)_InterlockedCompareExchange64(
+        (volatile __int64*)&theValue, (__int64)(anCurrent + theAmount), (__int64)anCurrent);
+      if(anPrevious == anCurrent)
+      {
+        break;
+      }
+      anCurrent = anPrevious;
+    }
+    return anCurrent;
+#else
+    return __sync_fetch_and_add(&theValue, theAmount);
+#endif
+  }
+
+  /**
+   * AtomicExchange will atomically set theValue provided to theExchange
+   * provided.
+   * @param[in] theValue to change
+   * @param[in] theExchange to store in theValue
+   * @return the value before the exchange
+   */
+  inline Uint32 AtomicExchange(volatile Uint32& theValue, const Uint32 theExchange)
+  {
+#if defined(_MSC_VER)
+    return (Uint32)_InterlockedExchange((volatile long*)&theValue, (long)theExchange);
+#else
+    // __sync_lock_test_and_set is only an acquire barrier, add a full one
+    __sync_synchronize();
+    return __sync_lock_test_and_set(&theValue, theExchange);
+#endif
+  }
+
+  /**
+   * AtomicCompareExchange will atomically set theValue provided to
+   * theExchange provided only if it is still equal to theComparand provided.
+   * @param[in] theValue to change
+   * @param[in] theExchange to store in theValue
+   * @param[in] theComparand that theValue must be equal to
+   * @return the value before the exchange (equal to theComparand on success)
+   */
+  inline Uint32 AtomicCompareExchange(volatile Uint32& theValue,
+    const Uint32 theExchange, const Uint32 theComparand)
+  {
+#if defined(_MSC_VER)
+    return (Uint32)_InterlockedCompareExchange((volatile long*)&theValue,
+      (long)theExchange, (long)theComparand);
+#else
+    return __sync_val_compare_and_swap(&theValue, theComparand, theExchange);
+#endif
+  }
+
+  /**
+   * AtomicMaximum will atomically raise theValue provided to theCandidate
+   * provided if theCandidate is larger.
+   * @param[in] theValue to raise
+   * @param[in] theCandidate to compare against theValue
+   */
+  inline void AtomicMaximum(volatile Uint32& theValue, const Uint32 theCandidate)
+  {
+    Uint32 anCurrent = theValue;
+    while(theCandidate > anCurrent)
+    {
+      // Try again if another thread changed theValue before we did
+      Uint32 anPrevious = AtomicCompareExchange(theValue, theCandidate, anCurrent);
+      if(anPrevious == anCurrent)
+      {
+        break;
+      }
+      anCurrent = anPrevious;
+    }
+  }
+} // namespace GQE
+
+#endif // CORE_ATOMIC_UTIL_HPP_INCLUDED
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
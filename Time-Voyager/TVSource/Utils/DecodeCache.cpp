@@ -0,0 +1,227 @@
+/**
+ * Provides the DecodeCache class in the GQE namespace which is responsible
+ * for keeping a directory of asset files already decoded so they can be
+ * mapped and used without decoding the asset file again.
+ *
+ * @file src/GQE/Core/utils/DecodeCache.cpp
+ * @author Ryan Lindeman
+ * @date 20130821 - Initial Release
+ * @date 20130824 - Made MakeDirectory public for the NetworkSource cache
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <TVSource/Utils/DecodeCache.hpp>
+#include <TVSource/Utils/AssetPack.hpp>
+#include <TVSource/Loggers/Log_macros.hpp>
+#if defined(GQE_WINDOWS)
+#include <direct.h>
+#endif
+
+namespace GQE
+{
+  DecodeCache::DecodeCache(const char* theMagic, const char* theExtension) :
+    mMagic(theMagic),
+    mExtension(theExtension)
+  {
+  }
+
+  DecodeCache::~DecodeCache()
+  {
+  }
+
+  bool DecodeCache::MakeDirectory(const std::string& theDirectory)
+  {
+    bool anResult = false;
+
+    // Create each parent directory first
+    for(size_t iloop = 1; iloop <= theDirectory.length(); iloop++)
+    {
+      if(iloop == theDirectory.length() ||
+        '/' == theDirectory[iloop] || '\\' == theDirectory[iloop])
+      {
+        std::string anDirectory = theDirectory.substr(0, iloop);
+#if defined(GQE_WINDOWS)
+        _mkdir(anDirectory.c_str());
+#else
+        mkdir(anDirectory.c_str(), 0755);
+#endif
+      }
+    }
+
+    struct stat anStat;
+    anResult = (0 == stat(theDirectory.c_str(), &anStat) &&
+      0 != (anStat.st_mode & S_IFDIR));
+
+    // Return anResult of true if theDirectory exists, false otherwise
+    return anResult;
+  }
+
+  void DecodeCache::SetDirectory(const std::string& theDirectory)
+  {
+    mDirectory = theDirectory;
+
+    // Make sure the directory exists before the first file is stored
+    if(!mDirectory.empty())
+    {
+      if(MakeDirectory(mDirectory))
+      {
+        ILOG() << "DecodeCache::SetDirectory(" << mDirectory << ")" << std::endl;
+      }
+      else
+      {
+        WLOG() << "DecodeCache::SetDirectory(" << mDirectory
+          << ") unable to create directory, caching disabled" << std::endl;
+        mDirectory.clear();
+      }
+    }
+  }
+
+  const std::string& DecodeCache::GetDirectory(void) const
+  {
+    return mDirectory;
+  }
+
+  bool DecodeCache::IsEnabled(void) const
+  {
+    return !mDirectory.empty();
+  }
+
+  std::string DecodeCache::GetCacheFilename(const std::string& theFilename) const
+  {
+    // Name each cached file after the hash of its normalized filename
+    const std::string anName = AssetPack::NormalizeFilename(theFilename);
+    std::ostringstream anResult;
+    anResult << mDirectory << "/" << std::hex << std::setfill('0') << std::setw(8)
+      << HashSource(anName.data(), anName.length()) << mExtension;
+
+    // Return anResult determined above
+    return anResult.str();
+  }
+
+  Uint32 DecodeCache::HashSource(const char* theSource, size_t theSourceSize)
+  {
+    Uint32 anResult = 2166136261U;
+    for(size_t iloop = 0; iloop < theSourceSize; iloop++)
+    {
+      anResult = (anResult ^ (Uint8)theSource[iloop]) * 16777619U;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  bool DecodeCache::FindData(const std::string& theFilename, const char* theSource,
+    size_t theSourceSize, MappedFile& theFile, const typeCacheHeader*& theHeader) const
+  {
+    bool anResult = false;
+
+    if(IsEnabled() && NULL != theSource && theFile.Open(GetCacheFilename(theFilename)))
+    {
+      const size_t anSize = theFile.GetSize();
+      const typeCacheHeader* anHeader = (const typeCacheHeader*)theFile.GetData();
+
+      // Make sure the cached file is valid and was decoded from theSource
+      anResult = anSize >= sizeof(typeCacheHeader) &&
+        memcmp(anHeader->magic, mMagic, CACHE_MAGIC_LENGTH) == 0 &&
+        anHeader->version == CACHE_VERSION &&
+        anHeader->offset >= sizeof(typeCacheHeader) && anHeader->offset <= anSize &&
+        anHeader->size <= anSize - anHeader->offset &&
+        anHeader->sourceSize == theSourceSize &&
+        anHeader->sourceHash == HashSource(theSource, theSourceSize);
+
+      if(anResult)
+      {
+        theHeader = anHeader;
+      }
+      else
+      {
+        ILOG() << "DecodeCache::FindData(" << theFilename << ") stale" << std::endl;
+        theFile.Close();
+      }
+    }
+
+    // Return anResult of true if an up to date cached file was found
+    return anResult;
+  }
+
+  bool DecodeCache::StoreData(const std::string& theFilename, const char* theSource,
+    size_t theSourceSize, const Uint32* theFormat, const void* theData,
+    Uint64 theSize) const
+  {
+    bool anResult = false;
+
+    if(IsEnabled() && NULL != theSource && NULL != theData &&
+      theSourceSize <= 0xFFFFFFFFU)
+    {
+      typeCacheHeader anHeader;
+      memset(&anHeader, 0, sizeof(anHeader));
+      memcpy(anHeader.magic, mMagic, CACHE_MAGIC_LENGTH);
+      anHeader.version = CACHE_VERSION;
+      anHeader.sourceSize = (Uint32)theSourceSize;
+      anHeader.sourceHash = HashSource(theSource, theSourceSize);
+      anHeader.offset = (sizeof(typeCacheHeader) + CACHE_ALIGNMENT - 1) &
+        ~(CACHE_ALIGNMENT - 1);
+      anHeader.size = theSize;
+      memcpy(anHeader.format, theFormat, sizeof(anHeader.format));
+
+      // Write a temporary file first so a partial cached file is never found
+      const std::string anFilename = GetCacheFilename(theFilename);
+      const std::string anTemporary = anFilename + ".tmp";
+      std::ofstream anFile(anTemporary.c_str(),
+        std::ios::out | std::ios::binary | std::ios::trunc);
+      if(anFile.is_open())
+      {
+        const char anPadding[CACHE_ALIGNMENT] = {0};
+        anFile.write((const char*)&anHeader, sizeof(anHeader));
+        anFile.write(anPadding, anHeader.offset - sizeof(anHeader));
+        anFile.write((const char*)theData, (std::streamsize)theSize);
+        anFile.close();
+
+        // Replace the stale cached file (if any) with the new one
+        std::remove(anFilename.c_str());
+        anResult = !anFile.fail() &&
+          0 == std::rename(anTemporary.c_str(), anFilename.c_str());
+        if(!anResult)
+        {
+          std::remove(anTemporary.c_str());
+        }
+      }
+
+      if(!anResult)
+      {
+        WLOG() << "DecodeCache::StoreData(" << theFilename << ") unable to write "
+          << anFilename << std::endl;
+      }
+    }
+
+    // Return anResult of true if successful, false otherwise
+    return anResult;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,192 @@
+/**
+ * Provides the DecodeCache class in the GQE namespace which is responsible
+ * for keeping a directory of asset files already decoded so they can be
+ * mapped and used without decoding the asset file again.
+ *
+ * @file include/GQE/Core/utils/DecodeCache.hpp
+ * @author Ryan Lindeman
+ * @date 20130821 - Initial Release
+ * @date 20130824 - Made MakeDirectory public for the NetworkSource cache
+ */
+#ifndef   CORE_DECODE_CACHE_HPP_INCLUDED
+#define   CORE_DECODE_CACHE_HPP_INCLUDED
+
+#include <string>
+#include <TVSource/Core/Core_types.hpp>
+#include <TVSource/Utils/MappedFile.hpp>
+
+namespace GQE
+{
+  /// Provides a directory of asset files already decoded
+  class GQE_API DecodeCache
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Length of the text found at the start of every cached file
+      static const Uint32 CACHE_MAGIC_LENGTH = 8;
+      /// Version of the cached file format
+      static const Uint32 CACHE_VERSION = 1;
+      /// Alignment in bytes of the decoded contents of each cached file
+      static const Uint32 CACHE_ALIGNMENT = 16;
+      /// Number of values describing the format of the decoded contents
+      static const Uint32 CACHE_FORMAT_LENGTH = 4;
+
+      /**
+       * DecodeCache constructor
+       * @param[in] theMagic text (CACHE_MAGIC_LENGTH characters) found at the
+       *   start of every file cached by the derived class
+       * @param[in] theExtension of every file cached by the derived class
+       */
+      DecodeCache(const char* theMagic, const char* theExtension);
+
+      /**
+       * DecodeCache deconstructor
+       */
+      virtual ~DecodeCache();
+
+      /**
+       * SetDirectory will set theDirectory provided where decoded files are
+       * cached and create it if it doesn't exist yet. The directory must be
+       * set before any asset is loaded since it is read by the AssetLoader
+       * worker threads without locking.
+       * @param[in] theDirectory to use or an empty string to disable caching
+       */
+      void SetDirectory(const std::string& theDirectory);
+
+      /**
+       * GetDirectory will return the directory where decoded files are cached.
+       * @return the directory or an empty string if caching is disabled
+       */
+      const std::string& GetDirectory(void) const;
+
+      /**
+       * IsEnabled will return true if a directory was set.
+       * @return true if decoded files are cached, false otherwise
+       */
+      bool IsEnabled(void) const;
+
+      /**
+       * GetCacheFilename will return the filename of the cached file of
+       * theFilename provided within the directory set.
+       * @param[in] theFilename of the asset file
+       * @return the filename of the cached file
+       */
+      std::string GetCacheFilename(const std::string& theFilename) const;
+
+      /**
+       * HashSource will return the hash of theSource provided (32 bit FNV-1a)
+       * used to detect asset files that changed since they were cached.
+       * @param[in] theSource to hash
+       * @param[in] theSourceSize of theSource in bytes
+       * @return the hash of theSource
+       */
+      static Uint32 HashSource(const char* theSource, size_t theSourceSize);
+
+      /**
+       * MakeDirectory will create theDirectory provided and each of its
+       * parent directories that don't exist yet.
+       * @param[in] theDirectory to create
+       * @return true if theDirectory exists afterwards, false otherwise
+       */
+      static bool MakeDirectory(const std::string& theDirectory);
+
+    protected:
+      /// Provides the header of a cached file
+      struct typeCacheHeader
+      {
+        char   magic[CACHE_MAGIC_LENGTH]; ///< Must be the magic of the derived class
+        Uint32 version;    ///< Must be CACHE_VERSION
+        Uint32 sourceSize; ///< Size in bytes of the asset file decoded
+        Uint32 sourceHash; ///< Hash of the asset file decoded (see HashSource)
+        Uint32 offset;     ///< Offset of the decoded contents from the start of the file
+        Uint64 size;       ///< Size in bytes of the decoded contents
+        Uint32 format[CACHE_FORMAT_LENGTH]; ///< Format of the decoded contents
+      };
+
+      /**
+       * FindData will map the cached file of theFilename provided into
+       * theFile provided if it was decoded from exactly theSource provided,
+       * so stale cached files are never used once the asset file changes.
+       * @param[in] theFilename of the asset file (see AssetPack::NormalizeFilename)
+       * @param[in] theSource contents of the asset file
+       * @param[in] theSourceSize of the asset file in bytes
+       * @param[out] theFile to map the cached file into
+       * @param[out] theHeader of the cached file found within theFile
+       * @return true if an up to date cached file was found
+       */
+      bool FindData(const std::string& theFilename, const char* theSource,
+        size_t theSourceSize, MappedFile& theFile,
+        const typeCacheHeader*& theHeader) const;
+
+      /**
+       * StoreData will write theData provided as the cached file of
+       * theFilename provided, replacing any stale cached file.
+       * @param[in] theFilename of the asset file (see AssetPack::NormalizeFilename)
+       * @param[in] theSource contents of the asset file
+       * @param[in] theSourceSize of the asset file in bytes
+       * @param[in] theFormat of theData (CACHE_FORMAT_LENGTH values)
+       * @param[in] theData decoded from theSource
+       * @param[in] theSize of theData in bytes
+       * @return true if the cached file was written successfully
+       */
+      bool StoreData(const std::string& theFilename, const char* theSource,
+        size_t theSourceSize, const Uint32* theFormat, const void* theData,
+        Uint64 theSize) const;
+
+    private:
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// Text found at the start of every cached file
+      const char* const mMagic;
+      /// Extension of every cached filename
+      const char* const mExtension;
+      /// The directory where decoded files are cached
+      std::string mDirectory;
+
+      /**
+       * DecodeCache copy constructor is private because we do not allow
+       * copies of our class
+       */
+      DecodeCache(const DecodeCache&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      DecodeCache& operator=(const DecodeCache&); // Intentionally undefined
+  }; // class DecodeCache
+} // namespace GQE
+
+#endif // CORE_DECODE_CACHE_HPP_INCLUDED
+
+/**
+ * @class GQE::DecodeCache
+ * @ingroup Core
+ * The DecodeCache class keeps one file for each asset file decoded in a
+ * cache directory and is the base of the TextureCache and SoundCache
+ * classes. Each cached file starts with a header holding the size and hash
+ * of the asset file it was decoded from and the format of its decoded
+ * contents, followed by the decoded contents aligned to CACHE_ALIGNMENT
+ * bytes so they can be used straight from the mapping. Cached files are
+ * rewritten whenever the asset file changes.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
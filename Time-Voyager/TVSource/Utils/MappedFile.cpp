@@ -0,0 +1,240 @@
+/**
+ * Provides the MappedFile class in the GQE namespace which is responsible
+ * for mapping the contents of a file read only into memory.
+ *
+ * @file src/GQE/Core/utils/MappedFile.cpp
+ * @author Ryan Lindeman
+ * @date 20130812 - Initial Release
+ * @date 20130813 - Added IsNewer
+ * @date 20130826 - IsNewer treats files modified at the same time as stale
+ */
+
+#include <cstdio>
+#include <new>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <TVSource/Utils/MappedFile.hpp>
+#if defined(GQE_WINDOWS)
+#include <windows.h>
+#elif defined(GQE_LINUX) || defined(GQE_MACOS) || defined(GQE_FREEBSD)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace GQE
+{
+  MappedFile::MappedFile() :
+    mData(NULL),
+    mSize(0),
+    mOpen(false),
+    mBuffered(false)
+#if defined(GQE_WINDOWS)
+    , mMapping(NULL)
+#endif
+  {
+  }
+
+  MappedFile::~MappedFile()
+  {
+    // Make sure the file is unmapped
+    Close();
+  }
+
+  bool MappedFile::Open(const std::string& theFilename)
+  {
+    // Close any file previously opened first
+    Close();
+
+#if defined(GQE_WINDOWS)
+    HANDLE anFile = CreateFileA(theFilename.c_str(), GENERIC_READ,
+      FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if(INVALID_HANDLE_VALUE != anFile)
+    {
+      LARGE_INTEGER anSize;
+      if(GetFileSizeEx(anFile, &anSize))
+      {
+        mSize = (size_t)anSize.QuadPart;
+
+        // Empty files can't be mapped but are still opened successfully
+        if(0 == mSize)
+        {
+          mOpen = true;
+        }
+        else
+        {
+          mMapping = CreateFileMappingA(anFile, NULL, PAGE_READONLY, 0, 0, NULL);
+          if(NULL != mMapping)
+          {
+            mData = (const char*)MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0);
+            if(NULL != mData)
+            {
+              mOpen = true;
+            }
+            else
+            {
+              CloseHandle(mMapping);
+              mMapping = NULL;
+            }
+          }
+        }
+      }
+
+      // The mapping keeps its own reference to the file
+      CloseHandle(anFile);
+    }
+#elif defined(GQE_LINUX) || defined(GQE_MACOS) || defined(GQE_FREEBSD)
+    int anFile = open(theFilename.c_str(), O_RDONLY);
+    if(-1 != anFile)
+    {
+      struct stat anStat;
+      if(0 == fstat(anFile, &anStat))
+      {
+        mSize = (size_t)anStat.st_size;
+
+        // Empty files can't be mapped but are still opened successfully
+        if(0 == mSize)
+        {
+          mOpen = true;
+        }
+        else
+        {
+          void* anData = mmap(NULL, mSize, PROT_READ, MAP_PRIVATE, anFile, 0);
+          if(MAP_FAILED != anData)
+          {
+            mData = (const char*)anData;
+            mOpen = true;
+          }
+        }
+      }
+
+      // The mapping keeps its own reference to the file
+      close(anFile);
+    }
+#endif
+
+    // Fall back to reading the file into a heap buffer if it wasn't mapped
+    if(!mOpen)
+    {
+      mSize = 0;
+      FILE* anFile = fopen(theFilename.c_str(), "rb");
+      if(NULL != anFile)
+      {
+        // Determine the size of the file
+        long anSize = 0;
+        if(0 == fseek(anFile, 0, SEEK_END))
+        {
+          anSize = ftell(anFile);
+          fseek(anFile, 0, SEEK_SET);
+        }
+
+        if(anSize > 0)
+        {
+          char* anData = new(std::nothrow) char[anSize];
+          if(NULL != anData && fread(anData, 1, (size_t)anSize, anFile) == (size_t)anSize)
+          {
+            mData = anData;
+            mSize = (size_t)anSize;
+            mBuffered = true;
+            mOpen = true;
+          }
+          else
+          {
+            delete[] anData;
+          }
+        }
+        else if(0 == anSize)
+        {
+          mOpen = true;
+        }
+
+        // Don't forget to close the file
+        fclose(anFile);
+      }
+    }
+
+    // Return true if the file was opened above
+    return mOpen;
+  }
+
+  void MappedFile::Close(void)
+  {
+    if(mBuffered)
+    {
+      delete[] mData;
+    }
+#if defined(GQE_WINDOWS)
+    else if(NULL != mData)
+    {
+      UnmapViewOfFile(mData);
+    }
+    if(NULL != mMapping)
+    {
+      CloseHandle(mMapping);
+      mMapping = NULL;
+    }
+#elif defined(GQE_LINUX) || defined(GQE_MACOS) || defined(GQE_FREEBSD)
+    else if(NULL != mData)
+    {
+      munmap((void*)mData, mSize);
+    }
+#endif
+
+    mData = NULL;
+    mSize = 0;
+    mOpen = false;
+    mBuffered = false;
+  }
+
+  bool MappedFile::IsOpen(void) const
+  {
+    return mOpen;
+  }
+
+  const char* MappedFile::GetData(void) const
+  {
+    return mData;
+  }
+
+  size_t MappedFile::GetSize(void) const
+  {
+    return mSize;
+  }
+
+  bool MappedFile::IsNewer(const std::string& theFilename, const std::string& theSource)
+  {
+    bool anResult = false;
+
+    struct stat anFile;
+    if(0 == stat(theFilename.c_str(), &anFile))
+    {
+      struct stat anSource;
+      anResult = (0 != stat(theSource.c_str(), &anSource)) ||
+        anFile.st_mtime > anSource.st_mtime;
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
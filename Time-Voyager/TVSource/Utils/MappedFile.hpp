@@ -0,0 +1,140 @@
+/**
+ * Provides the MappedFile class in the GQE namespace which is responsible
+ * for mapping the contents of a file read only into memory.
+ *
+ * @file include/GQE/Core/utils/MappedFile.hpp
+ * @author Ryan Lindeman
+ * @date 20130812 - Initial Release
+ * @date 20130813 - Added IsNewer
+ * @date 20130826 - IsNewer treats files modified at the same time as stale
+ */
+#ifndef   CORE_MAPPED_FILE_HPP_INCLUDED
+#define   CORE_MAPPED_FILE_HPP_INCLUDED
+
+#include <string>
+#include <TVSource/Core/Core_types.hpp>
+
+namespace GQE
+{
+  /// Provides read only access to the contents of a file mapped into memory
+  class GQE_API MappedFile
+  {
+    public:
+      /**
+       * MappedFile constructor
+       */
+      MappedFile();
+
+      /**
+       * MappedFile deconstructor will unmap the file if it is still open
+       */
+      virtual ~MappedFile();
+
+      /**
+       * Open will map the contents of theFilename provided into memory. Any
+       * file previously opened is closed first.
+       * @param[in] theFilename to map into memory
+       * @return true if theFilename was opened and mapped successfully
+       */
+      bool Open(const std::string& theFilename);
+
+      /**
+       * Close will unmap the file previously opened (if any).
+       */
+      void Close(void);
+
+      /**
+       * IsOpen will return true if a file is currently mapped.
+       * @return true if a file is mapped, false otherwise
+       */
+      bool IsOpen(void) const;
+
+      /**
+       * GetData will return the contents of the file mapped or NULL if no
+       * file is mapped or the file is empty. The contents are not null
+       * terminated and must not be modified.
+       * @return pointer to the first byte of the file mapped
+       */
+      const char* GetData(void) const;
+
+      /**
+       * GetSize will return the size of the file mapped in bytes.
+       * @return the number of bytes available at GetData
+       */
+      size_t GetSize(void) const;
+
+      /**
+       * IsNewer will determine if theFilename provided exists and was
+       * modified after theSource provided. This is used to decide if a file
+       * generated from theSource is still up to date. Modification times are
+       * only kept in seconds, so a tie is treated as out of date since
+       * theSource might have been changed after theFilename was generated.
+       * @param[in] theFilename to check
+       * @param[in] theSource theFilename was generated from
+       * @return true if theFilename exists and theSource is missing or older
+       */
+      static bool IsNewer(const std::string& theFilename, const std::string& theSource);
+
+    private:
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// The contents of the file mapped
+      const char* mData;
+      /// The size of the file mapped in bytes
+      size_t      mSize;
+      /// True if a file is currently open
+      bool        mOpen;
+      /// True if mData was read into a heap buffer instead of being mapped
+      bool        mBuffered;
+#if defined(GQE_WINDOWS)
+      /// The handle of the file mapping object
+      void*       mMapping;
+#endif
+
+      /**
+       * MappedFile copy constructor is private because we do not allow
+       * copies of our class
+       */
+      MappedFile(const MappedFile&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      MappedFile& operator=(const MappedFile&); // Intentionally undefined
+  }; // class MappedFile
+} // namespace GQE
+
+#endif // CORE_MAPPED_FILE_HPP_INCLUDED
+
+/**
+ * @class GQE::MappedFile
+ * @ingroup Core
+ * The MappedFile class maps a file read only into the address space of the
+ * application so its contents can be parsed in place without copying them
+ * into intermediate buffers first. Pages are only read from disk when they
+ * are first touched and are shared with the operating system file cache.
+ * On Windows the file is mapped using CreateFileMapping/MapViewOfFile and
+ * on Linux, Mac OS and FreeBSD using mmap. If the file can't be mapped (or
+ * the platform doesn't support it) the file is read into a heap buffer
+ * instead, so callers never need to handle both cases.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
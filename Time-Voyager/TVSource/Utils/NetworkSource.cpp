@@ -0,0 +1,835 @@
+/**
+ * Provides the NetworkSource class in the GQE namespace which is responsible
+ * for fetching asset files from a content server into a local cache.
+ *
+ * @file src/GQE/Core/utils/NetworkSource.cpp
+ * @author Ryan Lindeman
+ * @date 20130824 - Initial Release
+ * @date 20130826 - Fetch uses the copies brought up to date by Prefetch
+ * @date 20130826 - Check the filename saved with each cached copy
+ * @date 20130826 - Limit the size of each response received
+ */
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <new>
+#include <sstream>
+#include <TVSource/Utils/NetworkSource.hpp>
+#include <TVSource/Utils/AssetPack.hpp>
+#include <TVSource/Utils/DecodeCache.hpp>
+#include <TVSource/Utils/StringUtil.hpp>
+#include <TVSource/Loggers/Log_macros.hpp>
+
+namespace GQE
+{
+  NetworkSource::NetworkSource() :
+    mConnections(0),
+    mConnectionCount(DEFAULT_CONNECTIONS),
+    mPort(DEFAULT_PORT),
+    mTimeout(DEFAULT_TIMEOUT),
+    mOffline(false)
+  {
+    memset(&mStats, 0, sizeof(mStats));
+  }
+
+  NetworkSource::~NetworkSource()
+  {
+    // Log what was fetched from the content server (if anything)
+    if(0 < mStats.requests || 0 < mStats.offline)
+    {
+      ILOG() << "NetworkSource::dtor() connects=" << mStats.connects
+        << " requests=" << mStats.requests << " fetched=" << mStats.fetched
+        << " validated=" << mStats.validated << " offline=" << mStats.offline
+        << " failed=" << mStats.failed << " bytes=" << mStats.bytes << std::endl;
+    }
+
+    // Close every connection still open
+    Close();
+  }
+
+  void NetworkSource::SetServer(const std::string& theAddress,
+    const unsigned short thePort)
+  {
+    // Connections to the previous content server are no longer useful
+    Close();
+
+    mAddress = theAddress;
+    mPort = thePort;
+    mOffline = false;
+
+    if(!mAddress.empty())
+    {
+      ILOG() << "NetworkSource::SetServer(" << mAddress << ":" << mPort << ")"
+        << std::endl;
+    }
+  }
+
+  bool NetworkSource::IsEnabled(void) const
+  {
+    return !mAddress.empty() && !mDirectory.empty();
+  }
+
+  void NetworkSource::SetDirectory(const std::string& theDirectory)
+  {
+    mDirectory = theDirectory;
+
+    // Make sure the directory exists before the first file is fetched
+    if(!mDirectory.empty() && !DecodeCache::MakeDirectory(mDirectory))
+    {
+      WLOG() << "NetworkSource::SetDirectory(" << mDirectory
+        << ") unable to create directory, network loading disabled" << std::endl;
+      mDirectory.clear();
+    }
+  }
+
+  const std::string& NetworkSource::GetDirectory(void) const
+  {
+    return mDirectory;
+  }
+
+  void NetworkSource::SetConnectionCount(const Uint32 theCount)
+  {
+    // Validate the connection count range first
+    if(1 <= theCount && MAX_CONNECTIONS >= theCount)
+    {
+      mConnectionCount = theCount;
+    }
+    else
+    {
+      WLOG() << "NetworkSource::SetConnectionCount(" << theCount
+        << ") Connection count out of range!" << std::endl;
+    }
+  }
+
+  void NetworkSource::SetTimeout(const Uint32 theTimeout)
+  {
+    mTimeout = theTimeout;
+  }
+
+  std::string NetworkSource::GetCacheFilename(const std::string& theFilename) const
+  {
+    // Name each cached copy after the hash of its normalized filename and
+    // keep its extension so it can be loaded like the original file
+    const std::string anName = AssetPack::NormalizeFilename(theFilename);
+    std::string anExtension;
+    size_t anDot = anName.find_last_of("./");
+    if(std::string::npos != anDot && '.' == anName[anDot])
+    {
+      anExtension = anName.substr(anDot);
+    }
+
+    std::ostringstream anResult;
+    anResult << mDirectory << "/" << std::hex << std::setfill('0') << std::setw(8)
+      << DecodeCache::HashSource(anName.data(), anName.length()) << anExtension;
+
+    // Return anResult determined above
+    return anResult.str();
+  }
+
+  bool NetworkSource::Fetch(const std::string& theFilename, std::string& theCacheFilename)
+  {
+    bool anResult = false;
+
+    theCacheFilename = GetCacheFilename(theFilename);
+
+    // Use the copy Prefetch just brought up to date without asking again
+    bool anPrefetched = false;
+    {
+      sf::Lock anLock(mMutex);
+      anPrefetched = (0 < mPrefetched.erase(AssetPack::NormalizeFilename(theFilename)));
+    }
+
+    if(anPrefetched)
+    {
+      anResult = true;
+    }
+    else if(IsEnabled())
+    {
+      std::vector<std::string> anFilenames(1, theFilename);
+      std::vector<bool> anFetched(1, false);
+      size_t anReceived = 0;
+
+      // Fetch the file on a connection only used by this thread
+      typeConnection* anConnection = Acquire(true);
+      if(NULL != anConnection)
+      {
+        anReceived = Exchange(*anConnection, anFilenames, 0, anFetched);
+        Release(anConnection);
+      }
+
+      anResult = (1 == Finish(anFilenames, anReceived, anFetched));
+    }
+    else
+    {
+      ELOG() << "NetworkSource::Fetch(" << theFilename
+        << ") No content server or cache directory set!" << std::endl;
+    }
+
+    // Return anResult of true if the cached copy can be loaded
+    return anResult;
+  }
+
+  Uint32 NetworkSource::Prefetch(const std::vector<std::string>& theFilenames)
+  {
+    Uint32 anResult = 0;
+
+    if(IsEnabled() && !theFilenames.empty())
+    {
+      // Wait for the first connection, then use every other idle connection
+      std::vector<typeConnection*> anConnections;
+      typeConnection* anConnection = Acquire(true);
+      while(NULL != anConnection)
+      {
+        anConnections.push_back(anConnection);
+        anConnection = NULL;
+        if(anConnections.size() < theFilenames.size())
+        {
+          anConnection = Acquire(false);
+        }
+      }
+
+      // Spread the files over the connections acquired
+      std::vector<std::vector<std::string> > anBatches(anConnections.size());
+      for(size_t iloop = 0; iloop < theFilenames.size() && !anBatches.empty(); iloop++)
+      {
+        anBatches[iloop % anBatches.size()].push_back(theFilenames[iloop]);
+      }
+
+      // Send every request before waiting for any response so the content
+      // server works on all of them at once
+      std::vector<bool> anSent(anConnections.size(), false);
+      for(size_t iloop = 0; iloop < anConnections.size(); iloop++)
+      {
+        anSent[iloop] = Connect(*anConnections[iloop]) &&
+          SendRequests(*anConnections[iloop], anBatches[iloop]);
+      }
+
+      // Receive the responses of each connection, sending the requests again
+      // for any response that never arrived
+      for(size_t iloop = 0; iloop < anConnections.size(); iloop++)
+      {
+        std::vector<bool> anFetched(anBatches[iloop].size(), false);
+        size_t anReceived = 0;
+        if(anSent[iloop])
+        {
+          anReceived = ReceiveResponses(*anConnections[iloop], anBatches[iloop],
+            0, anFetched);
+        }
+        else
+        {
+          Disconnect(*anConnections[iloop]);
+        }
+        if(anReceived < anBatches[iloop].size())
+        {
+          anReceived = Exchange(*anConnections[iloop], anBatches[iloop],
+            anReceived, anFetched);
+        }
+        anResult += Finish(anBatches[iloop], anReceived, anFetched);
+        Release(anConnections[iloop]);
+
+        // Let the next Fetch of each file use the copy brought up to date
+        sf::Lock anLock(mMutex);
+        for(size_t jloop = 0; jloop < anBatches[iloop].size(); jloop++)
+        {
+          if(anFetched[jloop])
+          {
+            mPrefetched.insert(AssetPack::NormalizeFilename(anBatches[iloop][jloop]));
+          }
+        }
+      }
+    }
+
+    // Return anResult of the number of cached copies up to date
+    return anResult;
+  }
+
+  void NetworkSource::Close(void)
+  {
+    // Obtain a lock so no other thread uses the idle connections
+    sf::Lock anLock(mMutex);
+
+    for(size_t iloop = 0; iloop < mIdle.size(); iloop++)
+    {
+      mIdle[iloop]->socket.disconnect();
+      delete mIdle[iloop];
+    }
+    mConnections -= (Uint32)mIdle.size();
+    mIdle.clear();
+
+    // Prefetched copies of assets never loaded are checked again next time
+    mPrefetched.clear();
+  }
+
+  typeNetworkStats NetworkSource::GetStats(void) const
+  {
+    // Obtain a lock so the statistics don't change while we copy them
+    sf::Lock anLock(mMutex);
+
+    return mStats;
+  }
+
+  bool NetworkSource::ParseHeader(const std::string& theLine, std::string& theName,
+    std::string& theValue)
+  {
+    bool anResult = false;
+
+    size_t anColon = theLine.find(':');
+    if(std::string::npos != anColon && 0 < anColon)
+    {
+      // Header names are not case sensitive
+      theName = theLine.substr(0, anColon);
+      for(size_t iloop = 0; iloop < theName.length(); iloop++)
+      {
+        theName[iloop] = (char)tolower((unsigned char)theName[iloop]);
+      }
+
+      // Strip the spaces around the value
+      size_t anFirst = theLine.find_first_not_of(" \t", anColon + 1);
+      size_t anLast = theLine.find_last_not_of(" \t\r\n");
+      theValue.clear();
+      if(std::string::npos != anFirst && anLast >= anFirst)
+      {
+        theValue = theLine.substr(anFirst, anLast - anFirst + 1);
+      }
+      anResult = true;
+    }
+
+    // Return anResult of true if theLine is a header
+    return anResult;
+  }
+
+  NetworkSource::typeConnection* NetworkSource::Acquire(const bool theWait)
+  {
+    typeConnection* anResult = NULL;
+
+    bool anWait = true;
+    while(anWait)
+    {
+      {
+        // Obtain a lock only while we take or add a connection
+        sf::Lock anLock(mMutex);
+        if(!mIdle.empty())
+        {
+          anResult = mIdle.back();
+          mIdle.pop_back();
+          anWait = false;
+        }
+        else if(mConnections < mConnectionCount)
+        {
+          anResult = new(std::nothrow) typeConnection;
+          if(NULL != anResult)
+          {
+            anResult->connected = false;
+            mConnections++;
+          }
+          else
+          {
+            ELOG() << "NetworkSource::Acquire() Unable to allocate connection!"
+              << std::endl;
+          }
+          anWait = false;
+        }
+        else
+        {
+          anWait = theWait;
+        }
+      }
+
+      // Every connection is in use, wait for another thread to release one
+      if(anWait)
+      {
+        sf::sleep(sf::milliseconds(WAIT_INTERVAL));
+      }
+    }
+
+    // Return anResult of the connection acquired, NULL otherwise
+    return anResult;
+  }
+
+  void NetworkSource::Release(typeConnection* theConnection)
+  {
+    // Obtain a lock before returning the connection to the idle connections
+    sf::Lock anLock(mMutex);
+    mIdle.push_back(theConnection);
+  }
+
+  bool NetworkSource::Connect(typeConnection& theConnection)
+  {
+    bool anResult = theConnection.connected;
+
+    if(!anResult)
+    {
+      // Don't wait on a content server that couldn't be reached recently
+      bool anTry = true;
+      {
+        sf::Lock anLock(mMutex);
+        anTry = !mOffline ||
+          mOfflineClock.getElapsedTime().asMilliseconds() >= (sf::Int32)RETRY_INTERVAL;
+      }
+
+      if(anTry)
+      {
+        theConnection.buffer.clear();
+        anResult = (sf::Socket::Done == theConnection.socket.connect(
+          sf::IpAddress(mAddress), mPort, sf::milliseconds((sf::Int32)mTimeout)));
+
+        sf::Lock anLock(mMutex);
+        if(anResult)
+        {
+          // The socket handle changes with each connect, watch the new one
+          theConnection.connected = true;
+          theConnection.selector.clear();
+          theConnection.selector.add(theConnection.socket);
+          mStats.connects++;
+          if(mOffline)
+          {
+            ILOG() << "NetworkSource::Connect(" << mAddress << ":" << mPort
+              << ") content server reached again" << std::endl;
+          }
+          mOffline = false;
+        }
+        else
+        {
+          if(!mOffline)
+          {
+            WLOG() << "NetworkSource::Connect(" << mAddress << ":" << mPort
+              << ") content server unreachable, using cached copies" << std::endl;
+          }
+          mOffline = true;
+          mOfflineClock.restart();
+        }
+      }
+    }
+
+    // Return anResult of true if theConnection is connected
+    return anResult;
+  }
+
+  void NetworkSource::Disconnect(typeConnection& theConnection)
+  {
+    theConnection.socket.disconnect();
+    theConnection.connected = false;
+    theConnection.buffer.clear();
+  }
+
+  bool NetworkSource::SendRequests(typeConnection& theConnection,
+    const std::vector<std::string>& theFilenames)
+  {
+    std::string anRequests;
+    for(size_t iloop = 0; iloop < theFilenames.size(); iloop++)
+    {
+      const std::string& anFilename = theFilenames[iloop];
+
+      // Convert the filename into a path, escaping any unsafe character
+      std::ostringstream anPath;
+      anPath << std::hex << std::uppercase;
+      size_t anStart = 0;
+      while(anStart + 1 < anFilename.length() && '.' == anFilename[anStart] &&
+        ('/' == anFilename[anStart + 1] || '\\' == anFilename[anStart + 1]))
+      {
+        anStart += 2;
+      }
+      for(size_t jloop = anStart; jloop < anFilename.length(); jloop++)
+      {
+        unsigned char anChar = (unsigned char)anFilename[jloop];
+        if('\\' == anChar || '/' == anChar)
+        {
+          anPath << '/';
+        }
+        else if(isalnum(anChar) || strchr("-._~", anChar))
+        {
+          anPath << (char)anChar;
+        }
+        else
+        {
+          anPath << '%' << std::setw(2) << std::setfill('0') << (unsigned int)anChar;
+        }
+      }
+
+      anRequests += "GET /" + anPath.str() + " HTTP/1.1\r\nHost: " + mAddress +
+        "\r\nConnection: keep-alive\r\n";
+
+      // Let the server skip sending files that haven't changed
+      std::string anETag = ReadETag(anFilename);
+      if(!anETag.empty())
+      {
+        anRequests += "If-None-Match: " + anETag + "\r\n";
+      }
+      anRequests += "\r\n";
+    }
+
+    // Send every request at once
+    bool anResult = (sf::Socket::Done ==
+      theConnection.socket.send(anRequests.data(), anRequests.length()));
+    if(anResult)
+    {
+      sf::Lock anLock(mMutex);
+      mStats.requests += (Uint32)theFilenames.size();
+    }
+    else
+    {
+      Disconnect(theConnection);
+    }
+
+    // Return anResult of true if every request was sent
+    return anResult;
+  }
+
+  size_t NetworkSource::ReceiveResponses(typeConnection& theConnection,
+    const std::vector<std::string>& theFilenames, size_t theFirst,
+    std::vector<bool>& theFetched)
+  {
+    size_t anResult = theFirst;
+
+    bool anReceived = true;
+    while(anReceived && anResult < theFilenames.size())
+    {
+      typeResponse anResponse;
+      anReceived = ReceiveResponse(theConnection, anResponse);
+      if(anReceived)
+      {
+        theFetched[anResult] = StoreResponse(theFilenames[anResult], anResponse);
+        anResult++;
+
+        // The server will close the connection after this response
+        if(!anResponse.keepAlive)
+        {
+          anReceived = false;
+        }
+      }
+    }
+
+    // Don't reuse a connection in an unknown state
+    if(!anReceived)
+    {
+      Disconnect(theConnection);
+    }
+
+    // Return anResult of the first file not received
+    return anResult;
+  }
+
+  bool NetworkSource::ReceiveResponse(typeConnection& theConnection,
+    typeResponse& theResponse)
+  {
+    bool anResult = false;
+
+    theResponse.status = 0;
+    theResponse.etag.clear();
+    theResponse.body.clear();
+    theResponse.keepAlive = false;
+
+    // Receive until the end of the status line and headers
+    size_t anEnd = theConnection.buffer.find("\r\n\r\n");
+    while(std::string::npos == anEnd &&
+      theConnection.buffer.length() <= MAX_HEADER_SIZE && Receive(theConnection))
+    {
+      anEnd = theConnection.buffer.find("\r\n\r\n");
+    }
+
+    if(std::string::npos != anEnd)
+    {
+      std::istringstream anHeaders(theConnection.buffer.substr(0, anEnd));
+      theConnection.buffer.erase(0, anEnd + 4);
+
+      // Parse the status line, HTTP/1.1 connections are kept alive by default
+      std::string anLine;
+      std::string anVersion;
+      anHeaders >> anVersion >> theResponse.status;
+      std::getline(anHeaders, anLine);
+      theResponse.keepAlive = ("HTTP/1.1" == anVersion);
+
+      // Parse each header we use
+      Uint64 anLength = 0;
+      bool anHasLength = false;
+      bool anChunked = false;
+      std::string anName;
+      std::string anValue;
+      while(std::getline(anHeaders, anLine))
+      {
+        if(ParseHeader(anLine, anName, anValue))
+        {
+          if("content-length" == anName)
+          {
+            anLength = ParseUint64(anValue, 0);
+            anHasLength = true;
+          }
+          else if("etag" == anName)
+          {
+            theResponse.etag = anValue;
+          }
+          else if("connection" == anName)
+          {
+            theResponse.keepAlive = (std::string::npos == anValue.find("close"));
+          }
+          else if("transfer-encoding" == anName)
+          {
+            anChunked = ("identity" != anValue);
+          }
+        }
+      }
+
+      if(anChunked)
+      {
+        ELOG() << "NetworkSource::ReceiveResponse() chunked responses are not supported"
+          << std::endl;
+      }
+      else
+      {
+        // Without a length the body ends when the server closes the connection
+        if(!anHasLength && 304 != theResponse.status && 204 != theResponse.status)
+        {
+          while(theConnection.buffer.length() <= MAX_BODY_SIZE &&
+            Receive(theConnection))
+          {
+            // Keep receiving until the connection is closed
+          }
+          anLength = theConnection.buffer.length();
+          theResponse.keepAlive = false;
+        }
+
+        if(anLength > MAX_BODY_SIZE)
+        {
+          // Don't let the content server make us hold more than we can cache
+          ELOG() << "NetworkSource::ReceiveResponse() response body of " << anLength
+            << " bytes is larger than " << MAX_BODY_SIZE << " bytes" << std::endl;
+        }
+        else
+        {
+          // Receive the rest of the body
+          while(theConnection.buffer.length() < anLength && Receive(theConnection))
+          {
+            // Keep receiving until the entire body arrives
+          }
+
+          if(theConnection.buffer.length() >= anLength)
+          {
+            theResponse.body.assign(theConnection.buffer, 0, (size_t)anLength);
+            theConnection.buffer.erase(0, (size_t)anLength);
+            anResult = true;
+          }
+        }
+      }
+    }
+
+    // Return anResult of true if a complete response was received
+    return anResult;
+  }
+
+  bool NetworkSource::Receive(typeConnection& theConnection)
+  {
+    bool anResult = false;
+
+    // Wait for more bytes without blocking forever on a silent server
+    if(theConnection.selector.wait(sf::milliseconds((sf::Int32)mTimeout)))
+    {
+      char anBuffer[RECEIVE_SIZE];
+      size_t anReceived = 0;
+      if(sf::Socket::Done == theConnection.socket.receive(anBuffer,
+        sizeof(anBuffer), anReceived) && 0 < anReceived)
+      {
+        theConnection.buffer.append(anBuffer, anReceived);
+        anResult = true;
+      }
+    }
+
+    // Return anResult of true if more bytes were received
+    return anResult;
+  }
+
+  size_t NetworkSource::Exchange(typeConnection& theConnection,
+    const std::vector<std::string>& theFilenames, size_t theFirst,
+    std::vector<bool>& theFetched)
+  {
+    size_t anResult = theFirst;
+
+    bool anRetry = true;
+    while(anResult < theFilenames.size() && anRetry)
+    {
+      bool anReused = theConnection.connected;
+      size_t anFirst = anResult;
+      anRetry = false;
+
+      if(Connect(theConnection))
+      {
+        std::vector<std::string> anRemaining(theFilenames.begin() + anFirst,
+          theFilenames.end());
+        if(SendRequests(theConnection, anRemaining))
+        {
+          anResult = ReceiveResponses(theConnection, theFilenames, anFirst, theFetched);
+        }
+
+        // Keep going while responses arrive, and reconnect once if the server
+        // closed a connection while it was idle
+        anRetry = (anResult > anFirst) || anReused;
+      }
+    }
+
+    // Return anResult of the first file not received
+    return anResult;
+  }
+
+  Uint32 NetworkSource::Finish(const std::vector<std::string>& theFilenames,
+    size_t theReceived, std::vector<bool>& theFetched)
+  {
+    Uint32 anResult = 0;
+
+    for(size_t iloop = 0; iloop < theFilenames.size(); iloop++)
+    {
+      if(theFetched[iloop])
+      {
+        anResult++;
+      }
+      else if(iloop >= theReceived && IsCached(theFilenames[iloop]))
+      {
+        // The server never answered, use the copy cached by an earlier run
+        theFetched[iloop] = true;
+        anResult++;
+        sf::Lock anLock(mMutex);
+        mStats.offline++;
+      }
+      else
+      {
+        WLOG() << "NetworkSource::Fetch(" << theFilenames[iloop]
+          << ") unable to fetch file" << std::endl;
+        sf::Lock anLock(mMutex);
+        mStats.failed++;
+      }
+    }
+
+    // Return anResult of the number of cached copies that can be used
+    return anResult;
+  }
+
+  bool NetworkSource::StoreResponse(const std::string& theFilename,
+    const typeResponse& theResponse)
+  {
+    bool anResult = false;
+
+    if(304 == theResponse.status)
+    {
+      // The cached copy is still up to date
+      anResult = IsCached(theFilename);
+      if(anResult)
+      {
+        sf::Lock anLock(mMutex);
+        mStats.validated++;
+      }
+    }
+    else if(200 == theResponse.status)
+    {
+      // Write a temporary file first so a partial cached copy is never found
+      const std::string anFilename = GetCacheFilename(theFilename);
+      const std::string anTemporary = anFilename + ".tmp";
+      const std::string anETagFilename = anFilename + ".etag";
+      std::ofstream anFile(anTemporary.c_str(),
+        std::ios::out | std::ios::binary | std::ios::trunc);
+      if(anFile.is_open())
+      {
+        anFile.write(theResponse.body.data(), (std::streamsize)theResponse.body.length());
+        anFile.close();
+
+        // Replace the stale cached copy (if any), its ETag file marks it complete
+        std::remove(anETagFilename.c_str());
+        std::remove(anFilename.c_str());
+        anResult = !anFile.fail() &&
+          0 == std::rename(anTemporary.c_str(), anFilename.c_str());
+        if(anResult)
+        {
+          // Save the filename too since another file might share this copy
+          std::ofstream anETag(anETagFilename.c_str(), std::ios::out | std::ios::trunc);
+          anETag << AssetPack::NormalizeFilename(theFilename) << "\n" << theResponse.etag;
+          anETag.close();
+          anResult = !anETag.fail();
+        }
+        else
+        {
+          std::remove(anTemporary.c_str());
+        }
+      }
+
+      if(anResult)
+      {
+        sf::Lock anLock(mMutex);
+        mStats.fetched++;
+        mStats.bytes += theResponse.body.length();
+      }
+      else
+      {
+        ELOG() << "NetworkSource::StoreResponse(" << theFilename
+          << ") unable to write " << anFilename << std::endl;
+      }
+    }
+    else
+    {
+      WLOG() << "NetworkSource::StoreResponse(" << theFilename
+        << ") content server returned " << theResponse.status << std::endl;
+    }
+
+    // Return anResult of true if the cached copy is up to date
+    return anResult;
+  }
+
+  bool NetworkSource::ReadCacheInfo(const std::string& theFilename,
+    std::string& theETag) const
+  {
+    bool anResult = false;
+
+    // The ETag file holds the filename on the first line and the ETag next
+    std::ifstream anFile((GetCacheFilename(theFilename) + ".etag").c_str());
+    std::string anName;
+    if(anFile.is_open() && std::getline(anFile, anName))
+    {
+      anResult = (AssetPack::NormalizeFilename(theFilename) == anName);
+      if(anResult)
+      {
+        std::getline(anFile, theETag);
+      }
+    }
+
+    // Return anResult of true if the cached copy belongs to theFilename
+    return anResult;
+  }
+
+  std::string NetworkSource::ReadETag(const std::string& theFilename) const
+  {
+    std::string anResult;
+
+    ReadCacheInfo(theFilename, anResult);
+
+    // Return anResult of the ETag found, empty otherwise
+    return anResult;
+  }
+
+  bool NetworkSource::IsCached(const std::string& theFilename) const
+  {
+    std::string anETag;
+
+    // Return true if the ETag file written after the cached copy exists
+    return ReadCacheInfo(theFilename, anETag);
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
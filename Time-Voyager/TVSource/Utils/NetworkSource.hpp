@@ -0,0 +1,387 @@
+/**
+ * Provides the NetworkSource class in the GQE namespace which is responsible
+ * for fetching asset files from a content server into a local cache.
+ *
+ * @file include/GQE/Core/utils/NetworkSource.hpp
+ * @author Ryan Lindeman
+ * @date 20130824 - Initial Release
+ * @date 20130826 - Fetch uses the copies brought up to date by Prefetch
+ * @date 20130826 - Check the filename saved with each cached copy
+ * @date 20130826 - Limit the size of each response received
+ */
+#ifndef   CORE_NETWORK_SOURCE_HPP_INCLUDED
+#define   CORE_NETWORK_SOURCE_HPP_INCLUDED
+
+#include <set>
+#include <string>
+#include <vector>
+#include <SFML/Network.hpp>
+#include <SFML/System.hpp>
+#include <TVSource/Core/Core_types.hpp>
+
+namespace GQE
+{
+  /// Provides the keep-alive HTTP client that fetches assets into a cache
+  class GQE_API NetworkSource
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Default port of the content server
+      static const unsigned short DEFAULT_PORT = 8080;
+      /// Default number of connections kept open to the content server
+      static const Uint32 DEFAULT_CONNECTIONS = 4;
+      /// Maximum number of connections kept open to the content server
+      static const Uint32 MAX_CONNECTIONS = 8;
+      /// Default time in milliseconds to wait for the content server
+      static const Uint32 DEFAULT_TIMEOUT = 5000;
+      /// Time in milliseconds before trying a content server that couldn't be reached
+      static const Uint32 RETRY_INTERVAL = 10000;
+      /// Time in milliseconds to wait for another thread to release a connection
+      static const Int32 WAIT_INTERVAL = 2;
+      /// Size in bytes of each receive from the content server
+      static const size_t RECEIVE_SIZE = 16384;
+      /// Maximum size in bytes of the status line and headers of a response
+      static const size_t MAX_HEADER_SIZE = 65536;
+      /// Maximum size in bytes of the body of a response
+      static const size_t MAX_BODY_SIZE = 268435456;
+
+      /**
+       * NetworkSource constructor, no connection is opened until the first
+       * file is fetched.
+       */
+      NetworkSource();
+
+      /**
+       * NetworkSource deconstructor will close every connection
+       */
+      virtual ~NetworkSource();
+
+      /**
+       * SetServer will set the address and port of the content server and
+       * close every connection to the previous one. This must be done before
+       * any asset is loaded from the network.
+       * @param[in] theAddress of the content server or empty to disable
+       * @param[in] thePort of the content server
+       */
+      void SetServer(const std::string& theAddress,
+        const unsigned short thePort = DEFAULT_PORT);
+
+      /**
+       * IsEnabled will return true if a content server and cache directory
+       * were set.
+       * @return true if files can be fetched, false otherwise
+       */
+      bool IsEnabled(void) const;
+
+      /**
+       * SetDirectory will set theDirectory provided where fetched files are
+       * cached and create it if it doesn't exist yet.
+       * @param[in] theDirectory to use or an empty string to disable
+       */
+      void SetDirectory(const std::string& theDirectory);
+
+      /**
+       * GetDirectory will return the directory where fetched files are cached.
+       * @return the directory or an empty string if disabled
+       */
+      const std::string& GetDirectory(void) const;
+
+      /**
+       * SetConnectionCount will set the number of connections kept open to
+       * the content server which is the number of files fetched in parallel.
+       * @param[in] theCount of connections to use (1 to MAX_CONNECTIONS)
+       */
+      void SetConnectionCount(const Uint32 theCount);
+
+      /**
+       * SetTimeout will set the time to wait for the content server before
+       * giving up and using the cached file (if any) instead.
+       * @param[in] theTimeout in milliseconds
+       */
+      void SetTimeout(const Uint32 theTimeout);
+
+      /**
+       * GetCacheFilename will return the filename of the cached copy of
+       * theFilename provided within the directory set. Two filenames might
+       * share the same cached copy, so the filename is saved with the ETag
+       * and a cached copy of another file is never used.
+       * @param[in] theFilename of the asset file
+       * @return the filename of the cached copy
+       */
+      std::string GetCacheFilename(const std::string& theFilename) const;
+
+      /**
+       * Fetch will make sure the cached copy of theFilename provided is up to
+       * date, sending its ETag so unchanged files aren't downloaded again.
+       * If the content server can't be reached the cached copy (if any) is
+       * used instead. A copy brought up to date by Prefetch is used once
+       * without asking the content server again. This is safe to call from
+       * several AssetLoader worker threads at once, each using its own
+       * connection.
+       * @param[in] theFilename of the asset file to fetch
+       * @param[out] theCacheFilename of the cached copy to load
+       * @return true if an up to date (or offline) cached copy exists
+       */
+      bool Fetch(const std::string& theFilename, std::string& theCacheFilename);
+
+      /**
+       * Prefetch will bring the cached copies of theFilenames provided up to
+       * date by spreading them over every connection and pipelining the
+       * requests on each connection, so the content server works on all of
+       * them without waiting for each response in turn. Called by the
+       * AssetLoader worker threads for the network assets queued together.
+       * @param[in] theFilenames of the asset files to fetch
+       * @return the number of cached copies now up to date
+       */
+      Uint32 Prefetch(const std::vector<std::string>& theFilenames);
+
+      /**
+       * Close will close every connection to the content server and forget
+       * the copies prefetched but never used by Fetch.
+       */
+      void Close(void);
+
+      /**
+       * GetStats will return the statistics of this NetworkSource.
+       * @return the statistics of this NetworkSource
+       */
+      typeNetworkStats GetStats(void) const;
+
+      /**
+       * ParseHeader will split theLine provided of an HTTP header into its
+       * name (in lower case) and value (without surrounding spaces).
+       * @param[in] theLine of the header to parse
+       * @param[out] theName of the header
+       * @param[out] theValue of the header
+       * @return true if theLine is a header, false otherwise
+       */
+      static bool ParseHeader(const std::string& theLine, std::string& theName,
+        std::string& theValue);
+
+    private:
+      // Structures
+      ///////////////////////////////////////////////////////////////////////////
+      /// Structure holding each connection to the content server
+      struct typeConnection
+      {
+        sf::TcpSocket      socket;    ///< The socket connected to the server
+        sf::SocketSelector selector;  ///< Used to wait on the socket with a timeout
+        std::string        buffer;    ///< Bytes received but not yet parsed
+        bool               connected; ///< True if the socket is connected
+      };
+
+      /// Structure holding each response received from the content server
+      struct typeResponse
+      {
+        Uint32      status;    ///< The HTTP status code
+        std::string etag;      ///< The ETag of the file (if any)
+        std::string body;      ///< The contents of the file (if any)
+        bool        keepAlive; ///< False if the server will close the connection
+      };
+
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// Connections open and not in use by any thread
+      std::vector<typeConnection*> mIdle;
+      /// Files brought up to date by Prefetch and not yet used by Fetch
+      std::set<std::string>    mPrefetched;
+      /// Mutex that protects the idle connections and statistics
+      mutable sf::Mutex        mMutex;
+      /// Number of connections in use or idle
+      Uint32                   mConnections;
+      /// Number of connections kept open to the content server
+      Uint32                   mConnectionCount;
+      /// Address of the content server
+      std::string              mAddress;
+      /// Port of the content server
+      unsigned short           mPort;
+      /// Time in milliseconds to wait for the content server
+      Uint32                   mTimeout;
+      /// Directory where fetched files are cached
+      std::string              mDirectory;
+      /// Statistics of this NetworkSource
+      typeNetworkStats         mStats;
+      /// True if the content server couldn't be reached recently
+      bool                     mOffline;
+      /// Time since the content server couldn't be reached
+      sf::Clock                mOfflineClock;
+
+      /**
+       * Acquire will return an idle connection or a new one if fewer than
+       * the connection count are open, otherwise waits for one to be
+       * released (if theWait is true).
+       * @param[in] theWait is true to wait for a connection to be released
+       * @return a connection only used by the calling thread, NULL if none
+       */
+      typeConnection* Acquire(const bool theWait);
+
+      /**
+       * Release will return theConnection provided to the idle connections.
+       * @param[in] theConnection to release
+       */
+      void Release(typeConnection* theConnection);
+
+      /**
+       * Connect will connect theConnection provided if it isn't connected.
+       * @param[in] theConnection to connect
+       * @return true if theConnection is connected, false otherwise
+       */
+      bool Connect(typeConnection& theConnection);
+
+      /**
+       * Disconnect will close theConnection provided and discard any bytes
+       * received but not yet parsed.
+       * @param[in] theConnection to close
+       */
+      void Disconnect(typeConnection& theConnection);
+
+      /**
+       * SendRequests will send one GET request for each of theFilenames
+       * provided on theConnection without waiting for any response.
+       * @param[in] theConnection to send the requests on
+       * @param[in] theFilenames of the asset files to request
+       * @return true if every request was sent, false otherwise
+       */
+      bool SendRequests(typeConnection& theConnection,
+        const std::vector<std::string>& theFilenames);
+
+      /**
+       * ReceiveResponse will receive the next response from theConnection.
+       * @param[in] theConnection to receive from
+       * @param[out] theResponse received
+       * @return true if a complete response was received, false otherwise
+       */
+      bool ReceiveResponse(typeConnection& theConnection, typeResponse& theResponse);
+
+      /**
+       * ReceiveResponses will receive the response of each of theFilenames
+       * provided starting at theFirst and store it into the cache, stopping
+       * early if theConnection is closed.
+       * @param[in] theConnection to receive from
+       * @param[in] theFilenames requested on theConnection
+       * @param[in] theFirst of theFilenames whose response is expected next
+       * @param[out] theFetched is set for each file whose cached copy is up to date
+       * @return the index of the first of theFilenames not received
+       */
+      size_t ReceiveResponses(typeConnection& theConnection,
+        const std::vector<std::string>& theFilenames, size_t theFirst,
+        std::vector<bool>& theFetched);
+
+      /**
+       * Receive will wait up to the timeout for more bytes on theConnection
+       * and append them to its buffer.
+       * @param[in] theConnection to receive from
+       * @return true if more bytes were received, false otherwise
+       */
+      bool Receive(typeConnection& theConnection);
+
+      /**
+       * Exchange will pipeline the requests of theFilenames provided on
+       * theConnection and store each response into the cache, reconnecting
+       * once if the server closed the connection while it was idle.
+       * @param[in] theConnection to use
+       * @param[in] theFilenames of the asset files to fetch
+       * @param[in] theFirst of theFilenames to fetch
+       * @param[out] theFetched is set for each file whose cached copy is up to date
+       * @return the index of the first of theFilenames not received
+       */
+      size_t Exchange(typeConnection& theConnection,
+        const std::vector<std::string>& theFilenames, size_t theFirst,
+        std::vector<bool>& theFetched);
+
+      /**
+       * Finish will count each of theFilenames provided that wasn't fetched
+       * as offline, if a cached copy exists and the server never answered,
+       * or failed otherwise.
+       * @param[in] theFilenames of the asset files fetched
+       * @param[in] theReceived is the index of the first file not answered
+       * @param[in,out] theFetched is set for each file offline too
+       * @return the number of cached copies that can be used
+       */
+      Uint32 Finish(const std::vector<std::string>& theFilenames,
+        size_t theReceived, std::vector<bool>& theFetched);
+
+      /**
+       * StoreResponse will update the cached copy of theFilename provided
+       * from theResponse provided.
+       * @param[in] theFilename of the asset file
+       * @param[in] theResponse received for theFilename
+       * @return true if the cached copy is now up to date, false otherwise
+       */
+      bool StoreResponse(const std::string& theFilename, const typeResponse& theResponse);
+
+      /**
+       * ReadCacheInfo will read the ETag file saved with the cached copy of
+       * theFilename provided and check it was saved for theFilename.
+       * @param[in] theFilename of the asset file
+       * @param[out] theETag saved with the cached copy
+       * @return true if a cached copy of theFilename exists, false otherwise
+       */
+      bool ReadCacheInfo(const std::string& theFilename, std::string& theETag) const;
+
+      /**
+       * ReadETag will return the ETag saved with the cached copy of
+       * theFilename provided.
+       * @param[in] theFilename of the asset file
+       * @return the ETag or an empty string if there is no cached copy
+       */
+      std::string ReadETag(const std::string& theFilename) const;
+
+      /**
+       * IsCached will return true if a complete cached copy of theFilename
+       * provided exists.
+       * @param[in] theFilename of the asset file
+       * @return true if a cached copy exists, false otherwise
+       */
+      bool IsCached(const std::string& theFilename) const;
+
+      /**
+       * NetworkSource copy constructor is private because we do not allow
+       * copies of our class
+       */
+      NetworkSource(const NetworkSource&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      NetworkSource& operator=(const NetworkSource&); // Intentionally undefined
+  }; // class NetworkSource
+} // namespace GQE
+
+#endif // CORE_NETWORK_SOURCE_HPP_INCLUDED
+
+/**
+ * @class GQE::NetworkSource
+ * @ingroup Core
+ * The NetworkSource class lets thin clients load assets from a content
+ * server (see the serve-assets tool command) using AssetLoadFromNetwork.
+ * Each file is fetched over a small pool of keep-alive HTTP/1.1 connections
+ * (sf::Http opens a new connection for every request so sf::TcpSocket is
+ * used instead) into a cache directory along with its ETag, so unchanged
+ * files are only validated and never downloaded again, and the cached copy
+ * is used when the content server can't be reached. Each AssetLoader worker
+ * thread fetches on its own connection, and a worker that finds several
+ * network assets queued uses Prefetch to pipeline their requests on every
+ * connection at once.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,206 @@
+/**
+ * Provides the PerfCounters class in the GQE namespace which is responsible
+ * for reading the CPU hardware counters (cycles, instructions, cache and
+ * branch misses) of the calling thread where the platform provides them.
+ *
+ * @file src/GQE/Core/utils/PerfCounters.cpp
+ * @author Ryan Lindeman
+ * @date 20130807 - Initial Release
+ * @date 20130826 - Scale each value when the kernel multiplexes the counters
+ */
+
+#include <cstring>
+#include <TVSource/Utils/PerfCounters.hpp>
+#if defined(GQE_LINUX)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace GQE
+{
+#if defined(GQE_LINUX)
+  /**
+   * OpenCounter will open a single user space counter of the calling thread.
+   * @param[in] theType of counter (e.g. PERF_TYPE_HARDWARE)
+   * @param[in] theConfig of the counter (e.g. PERF_COUNT_HW_CPU_CYCLES)
+   * @param[in] theGroup descriptor of the group leader or -1 for a new group
+   * @return the counter descriptor or -1 if it couldn't be opened
+   */
+  static int OpenCounter(const Uint32 theType, const Uint64 theConfig, const int theGroup)
+  {
+    struct perf_event_attr anAttr;
+    memset(&anAttr, 0, sizeof(anAttr));
+    anAttr.size = sizeof(anAttr);
+    anAttr.type = theType;
+    anAttr.config = theConfig;
+    anAttr.read_format = PERF_FORMAT_GROUP |
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    anAttr.exclude_kernel = 1;
+    anAttr.exclude_hv = 1;
+
+    // The group leader starts disabled until every counter has been added
+    anAttr.disabled = (-1 == theGroup) ? 1 : 0;
+
+    // Count the calling thread on any CPU
+    return (int)syscall(__NR_perf_event_open, &anAttr, 0, -1, theGroup, 0);
+  }
+#endif
+
+  PerfCounters::PerfCounters() :
+    mOpened(0)
+  {
+    for(Uint32 iloop = 0; iloop < PerfCount; iloop++)
+    {
+      mDescriptors[iloop] = -1;
+      mIndexes[iloop] = -1;
+    }
+  }
+
+  PerfCounters::~PerfCounters()
+  {
+    // Make sure every counter is closed
+    Close();
+  }
+
+  bool PerfCounters::Open(void)
+  {
+    // Close any counters previously opened first
+    Close();
+
+#if defined(GQE_LINUX)
+    // The type and config of each PerfCounter value
+    const Uint32 anTypes[PerfCount] =
+    {
+      PERF_TYPE_HARDWARE,
+      PERF_TYPE_HARDWARE,
+      PERF_TYPE_HW_CACHE,
+      PERF_TYPE_HARDWARE,
+      PERF_TYPE_HARDWARE
+    };
+    const Uint64 anConfigs[PerfCount] =
+    {
+      PERF_COUNT_HW_CPU_CYCLES,
+      PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+      PERF_COUNT_HW_CACHE_MISSES,
+      PERF_COUNT_HW_BRANCH_MISSES
+    };
+
+    // The cycle counter leads the group, skip any other counter not provided
+    for(Uint32 iloop = 0; iloop < PerfCount; iloop++)
+    {
+      mDescriptors[iloop] = OpenCounter(anTypes[iloop], anConfigs[iloop],
+        mDescriptors[PerfCycles]);
+      if(-1 != mDescriptors[iloop])
+      {
+        mIndexes[iloop] = mOpened++;
+      }
+      else if(PerfCycles == iloop)
+      {
+        // Without the group leader no other counter can be opened
+        break;
+      }
+    }
+
+    // Reset and start every counter in our group at the same time
+    if(-1 != mDescriptors[PerfCycles])
+    {
+      ioctl(mDescriptors[PerfCycles], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(mDescriptors[PerfCycles], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+
+    // Return true if the group leader was opened
+    return IsAvailable();
+  }
+
+  void PerfCounters::Close(void)
+  {
+    for(Uint32 iloop = 0; iloop < PerfCount; iloop++)
+    {
+#if defined(GQE_LINUX)
+      if(-1 != mDescriptors[iloop])
+      {
+        close(mDescriptors[iloop]);
+      }
+#endif
+      mDescriptors[iloop] = -1;
+      mIndexes[iloop] = -1;
+    }
+    mOpened = 0;
+  }
+
+  bool PerfCounters::IsAvailable(void) const
+  {
+    return -1 != mDescriptors[PerfCycles];
+  }
+
+  bool PerfCounters::IsCounterAvailable(const PerfCounter theCounter) const
+  {
+    return theCounter < PerfCount && -1 != mDescriptors[theCounter];
+  }
+
+  bool PerfCounters::Read(typePerfSample& theSample) const
+  {
+    // Assume theSample could not be read
+    bool anResult = false;
+
+#if defined(GQE_LINUX)
+    if(IsAvailable())
+    {
+      // Group read format is nr, time enabled, time running and each value
+      Uint64 anValues[3 + PerfCount];
+      ssize_t anSize = read(mDescriptors[PerfCycles], anValues, sizeof(anValues));
+
+      // A group that never ran (e.g. no PMU available) has nothing to report
+      if(anSize >= (ssize_t)(3 * sizeof(Uint64)) && anValues[2] > 0 &&
+        anValues[0] == (Uint64)mOpened)
+      {
+        // The kernel multiplexes the group when the CPU has too few counters,
+        // so scale each value by the time enabled over the time running
+        const bool anScaled = anValues[2] < anValues[1];
+        const double anScale = anScaled ?
+          (double)anValues[1] / (double)anValues[2] : 1.0;
+        for(Uint32 iloop = 0; iloop < PerfCount; iloop++)
+        {
+          theSample.counters[iloop] = (-1 == mIndexes[iloop]) ? 0 :
+            anValues[3 + mIndexes[iloop]];
+          if(anScaled)
+          {
+            theSample.counters[iloop] =
+              (Uint64)((double)theSample.counters[iloop] * anScale);
+          }
+        }
+        anResult = true;
+      }
+    }
+#endif
+
+    // Return anResult determined above
+    return anResult;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,124 @@
+/**
+ * Provides the PerfCounters class in the GQE namespace which is responsible
+ * for reading the CPU hardware counters (cycles, instructions, cache and
+ * branch misses) of the calling thread where the platform provides them.
+ *
+ * @file include/GQE/Core/utils/PerfCounters.hpp
+ * @author Ryan Lindeman
+ * @date 20130807 - Initial Release
+ * @date 20130826 - Scale each value when the kernel multiplexes the counters
+ */
+#ifndef   CORE_PERF_COUNTERS_HPP_INCLUDED
+#define   CORE_PERF_COUNTERS_HPP_INCLUDED
+
+#include <TVSource/Core/Core_types.hpp>
+
+namespace GQE
+{
+  /// Provides the hardware counters of the thread that opened them
+  class GQE_API PerfCounters
+  {
+    public:
+      /**
+       * PerfCounters constructor
+       */
+      PerfCounters();
+
+      /**
+       * PerfCounters deconstructor
+       */
+      virtual ~PerfCounters();
+
+      /**
+       * Open will try to open and start every hardware counter for the
+       * calling thread. Counters the CPU or kernel doesn't provide are
+       * skipped and will always read as 0.
+       * @return true if at least the cycle counter is available
+       */
+      bool Open(void);
+
+      /**
+       * Close will stop and close every hardware counter previously opened.
+       */
+      void Close(void);
+
+      /**
+       * IsAvailable will return true if the hardware counters were opened.
+       * @return true if the counters can be read, false otherwise
+       */
+      bool IsAvailable(void) const;
+
+      /**
+       * IsCounterAvailable will return true if theCounter provided was opened.
+       * @param[in] theCounter to check
+       * @return true if theCounter can be read, false otherwise
+       */
+      bool IsCounterAvailable(const PerfCounter theCounter) const;
+
+      /**
+       * Read will read the current value of every hardware counter using a
+       * single system call. Only the thread that called Open should call Read.
+       * If the kernel only counted for part of the time (because more counters
+       * were opened than the CPU provides) each value is scaled up to an
+       * estimate of the entire time.
+       * @param[out] theSample to store each counter value in
+       * @return true if theSample was read, false otherwise
+       */
+      bool Read(typePerfSample& theSample) const;
+
+    private:
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// The file descriptor of each counter opened (-1 if not opened)
+      int  mDescriptors[PerfCount];
+      /// The position of each counter in the group read (-1 if not opened)
+      int  mIndexes[PerfCount];
+      /// The number of counters opened in our group
+      int  mOpened;
+
+      /**
+       * PerfCounters copy constructor is private because we do not allow
+       * copies of our class
+       */
+      PerfCounters(const PerfCounters&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      PerfCounters& operator=(const PerfCounters&); // Intentionally undefined
+  }; // class PerfCounters
+} // namespace GQE
+
+#endif // CORE_PERF_COUNTERS_HPP_INCLUDED
+
+/**
+ * @class GQE::PerfCounters
+ * @ingroup Core
+ * The PerfCounters class is used by the StatManager class to sample the CPU
+ * hardware counters around each ISystem update and game loop phase. On Linux
+ * the counters are opened as a single perf_event_open group for the calling
+ * thread (user space only) so every counter is read together with one read()
+ * call. On other platforms, or when the kernel refuses to open the counters
+ * (e.g. /proc/sys/kernel/perf_event_paranoid is too strict or the CPU is
+ * virtualized without a PMU), Open returns false and Read never succeeds.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
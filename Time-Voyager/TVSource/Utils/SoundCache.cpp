@@ -0,0 +1,95 @@
+/**
+ * Provides the SoundCache class in the GQE namespace which is responsible
+ * for keeping a directory of sounds already decoded into PCM samples so
+ * they can be mapped and loaded without decoding the sound file again.
+ *
+ * @file src/GQE/Core/utils/SoundCache.cpp
+ * @author Ryan Lindeman
+ * @date 20130821 - Initial Release
+ */
+
+#include <TVSource/Utils/SoundCache.hpp>
+
+namespace GQE
+{
+  const char* const SoundCache::CACHE_MAGIC = "GQEPCM01";
+  const char* const SoundCache::CACHE_EXTENSION = ".pcm";
+
+  SoundCache::SoundCache() :
+    DecodeCache(CACHE_MAGIC, CACHE_EXTENSION)
+  {
+  }
+
+  SoundCache::~SoundCache()
+  {
+  }
+
+  bool SoundCache::Find(const std::string& theFilename, const char* theSource,
+    size_t theSourceSize, MappedFile& theFile, const Int16*& theSamples,
+    Uint64& theSampleCount, Uint32& theChannelCount, Uint32& theSampleRate) const
+  {
+    const typeCacheHeader* anHeader = NULL;
+    bool anResult = FindData(theFilename, theSource, theSourceSize, theFile, anHeader);
+
+    // Make sure the cached sound holds whole frames of samples
+    if(anResult)
+    {
+      anResult = anHeader->format[0] > 0 && anHeader->format[1] > 0 &&
+        anHeader->size > 0 &&
+        0 == anHeader->size % (sizeof(Int16) * anHeader->format[0]);
+    }
+
+    if(anResult)
+    {
+      theSamples = (const Int16*)(theFile.GetData() + anHeader->offset);
+      theSampleCount = anHeader->size / sizeof(Int16);
+      theChannelCount = anHeader->format[0];
+      theSampleRate = anHeader->format[1];
+    }
+    else
+    {
+      theFile.Close();
+    }
+
+    // Return anResult of true if an up to date cached sound was found
+    return anResult;
+  }
+
+  bool SoundCache::Store(const std::string& theFilename, const char* theSource,
+    size_t theSourceSize, const Int16* theSamples, Uint64 theSampleCount,
+    Uint32 theChannelCount, Uint32 theSampleRate) const
+  {
+    bool anResult = false;
+
+    if(theSampleCount > 0 && theChannelCount > 0 && theSampleRate > 0)
+    {
+      const Uint32 anFormat[CACHE_FORMAT_LENGTH] = {theChannelCount, theSampleRate, 0, 0};
+      anResult = StoreData(theFilename, theSource, theSourceSize, anFormat,
+        theSamples, theSampleCount * sizeof(Int16));
+    }
+
+    // Return anResult of true if successful, false otherwise
+    return anResult;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,118 @@
+/**
+ * Provides the SoundCache class in the GQE namespace which is responsible
+ * for keeping a directory of sounds already decoded into PCM samples so
+ * they can be mapped and loaded without decoding the sound file again.
+ *
+ * @file include/GQE/Core/utils/SoundCache.hpp
+ * @author Ryan Lindeman
+ * @date 20130821 - Initial Release
+ */
+#ifndef   CORE_SOUND_CACHE_HPP_INCLUDED
+#define   CORE_SOUND_CACHE_HPP_INCLUDED
+
+#include <string>
+#include <TVSource/Core/Core_types.hpp>
+#include <TVSource/Utils/DecodeCache.hpp>
+
+namespace GQE
+{
+  /// Provides a directory of sounds decoded into 16 bit PCM samples
+  class GQE_API SoundCache : public DecodeCache
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Text found at the start of every cached sound
+      static const char* const CACHE_MAGIC;
+      /// Extension of each cached sound filename
+      static const char* const CACHE_EXTENSION;
+
+      /**
+       * SoundCache constructor
+       */
+      SoundCache();
+
+      /**
+       * SoundCache deconstructor
+       */
+      virtual ~SoundCache();
+
+      /**
+       * Find will map the cached sound of theFilename provided into theFile
+       * provided if it was decoded from exactly theSource provided, so stale
+       * cached sounds are never used once the sound file changes.
+       * @param[in] theFilename of the sound file (see AssetPack::NormalizeFilename)
+       * @param[in] theSource contents of the sound file
+       * @param[in] theSourceSize of the sound file in bytes
+       * @param[out] theFile to map the cached sound into
+       * @param[out] theSamples interleaved PCM samples found within theFile
+       * @param[out] theSampleCount of theSamples
+       * @param[out] theChannelCount of the cached sound
+       * @param[out] theSampleRate of the cached sound in samples per second
+       * @return true if an up to date cached sound was found
+       */
+      bool Find(const std::string& theFilename, const char* theSource,
+        size_t theSourceSize, MappedFile& theFile, const Int16*& theSamples,
+        Uint64& theSampleCount, Uint32& theChannelCount, Uint32& theSampleRate) const;
+
+      /**
+       * Store will write theSamples provided as the cached sound of
+       * theFilename provided, replacing any stale cached sound.
+       * @param[in] theFilename of the sound file (see AssetPack::NormalizeFilename)
+       * @param[in] theSource contents of the sound file
+       * @param[in] theSourceSize of the sound file in bytes
+       * @param[in] theSamples interleaved PCM samples decoded from theSource
+       * @param[in] theSampleCount of theSamples
+       * @param[in] theChannelCount of the sound
+       * @param[in] theSampleRate of the sound in samples per second
+       * @return true if the cached sound was written successfully
+       */
+      bool Store(const std::string& theFilename, const char* theSource,
+        size_t theSourceSize, const Int16* theSamples, Uint64 theSampleCount,
+        Uint32 theChannelCount, Uint32 theSampleRate) const;
+
+    private:
+      /**
+       * SoundCache copy constructor is private because we do not allow
+       * copies of our class
+       */
+      SoundCache(const SoundCache&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      SoundCache& operator=(const SoundCache&); // Intentionally undefined
+  }; // class SoundCache
+} // namespace GQE
+
+#endif // CORE_SOUND_CACHE_HPP_INCLUDED
+
+/**
+ * @class GQE::SoundCache
+ * @ingroup Core
+ * The SoundCache class keeps one file for each sound decoded by the
+ * SoundHandler in a cache directory (see DecodeCache). Each cached sound
+ * holds its channel count and sample rate followed by its interleaved 16 bit
+ * PCM samples so they can be loaded straight from the mapping with
+ * sf::SoundBuffer::loadFromSamples.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,180 @@
+/**
+ * Provides the StatHistogram class in the GQE namespace which is responsible
+ * for recording time samples into logarithmic buckets without locking so
+ * percentiles can be computed without storing every sample.
+ *
+ * @file src/GQE/Core/utils/StatHistogram.cpp
+ * @author Ryan Lindeman
+ * @date 20130805 - Initial Release
+ */
+
+#include <cmath>
+#include <TVSource/Utils/AtomicUtil.hpp>
+#include <TVSource/Utils/StatHistogram.hpp>
+
+namespace GQE
+{
+  StatHistogram::StatHistogram() :
+    mCount(0),
+    mMaximum(0)
+  {
+    // Start with every bucket empty
+    Reset();
+  }
+
+  StatHistogram::~StatHistogram()
+  {
+  }
+
+  void StatHistogram::Record(const Uint32 theSample)
+  {
+    // Count theSample in its bucket first so readers never see more samples
+    // counted in mCount than are available in the buckets
+    AtomicIncrement(mBuckets[GetBucket(theSample)]);
+    AtomicIncrement(mCount);
+    AtomicMaximum(mMaximum, theSample);
+  }
+
+  void StatHistogram::Reset(void)
+  {
+    for(Uint32 iloop = 0; iloop < BUCKET_COUNT; iloop++)
+    {
+      mBuckets[iloop] = 0;
+    }
+    mCount = 0;
+    mMaximum = 0;
+  }
+
+  void StatHistogram::Merge(const StatHistogram& theOther)
+  {
+    for(Uint32 iloop = 0; iloop < BUCKET_COUNT; iloop++)
+    {
+      // Skip empty buckets to avoid needless atomic operations
+      if(theOther.mBuckets[iloop] > 0)
+      {
+        AtomicAdd(mBuckets[iloop], theOther.mBuckets[iloop]);
+      }
+    }
+    AtomicAdd(mCount, theOther.mCount);
+    AtomicMaximum(mMaximum, theOther.mMaximum);
+  }
+
+  Uint32 StatHistogram::GetCount(void) const
+  {
+    return mCount;
+  }
+
+  Uint32 StatHistogram::GetCountAbove(const Uint32 theThreshold) const
+  {
+    Uint32 anResult = 0;
+
+    // Count every sample in the buckets above the bucket of theThreshold
+    for(Uint32 iloop = GetBucket(theThreshold) + 1; iloop < BUCKET_COUNT; iloop++)
+    {
+      anResult += mBuckets[iloop];
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  Uint32 StatHistogram::GetMaximum(void) const
+  {
+    return mMaximum;
+  }
+
+  Uint32 StatHistogram::GetPercentile(const float thePercentile) const
+  {
+    // Default to 0 if no samples are available
+    Uint32 anResult = 0;
+
+    if(mCount > 0)
+    {
+      // Use the nearest rank method to find the sample rank (1 based)
+      Uint32 anRank = (Uint32)ceil((thePercentile / 100.0f) * (float)mCount);
+      if(anRank < 1)
+      {
+        anRank = 1;
+      }
+
+      // Find the bucket holding the sample at anRank
+      Uint32 anTotal = 0;
+      for(Uint32 iloop = 0; iloop < BUCKET_COUNT; iloop++)
+      {
+        anTotal += mBuckets[iloop];
+        if(anTotal >= anRank)
+        {
+          anResult = GetBucketMaximum(iloop);
+          break;
+        }
+      }
+
+      // Never report more than the largest sample actually recorded
+      if(anResult == 0 || anResult > mMaximum)
+      {
+        anResult = mMaximum;
+      }
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  Uint32 StatHistogram::GetBucket(const Uint32 theSample)
+  {
+    // Find the most significant bit of theSample
+    Uint32 anBit = 0;
+    Uint32 anValue = theSample;
+    while(anValue > 1)
+    {
+      anValue >>= 1;
+      anBit++;
+    }
+
+    // Samples below 2 * SUB_BUCKET_COUNT are counted exactly, larger samples
+    // drop their least significant bits to keep SUB_BUCKET_BITS + 1 bits
+    Uint32 anShift = 0;
+    if(anBit > SUB_BUCKET_BITS)
+    {
+      anShift = anBit - SUB_BUCKET_BITS;
+    }
+
+    // Return the bucket index for theSample
+    return anShift * SUB_BUCKET_COUNT + (theSample >> anShift);
+  }
+
+  Uint32 StatHistogram::GetBucketMaximum(const Uint32 theBucket)
+  {
+    // Reverse the shift applied by GetBucket above
+    Uint32 anShift = 0;
+    if(theBucket >= 2 * SUB_BUCKET_COUNT)
+    {
+      anShift = theBucket / SUB_BUCKET_COUNT - 1;
+    }
+    Uint64 anTop = theBucket - anShift * SUB_BUCKET_COUNT;
+
+    // Return the highest sample that maps to theBucket
+    return (Uint32)(((anTop + 1) << anShift) - 1);
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,156 @@
+/**
+ * Provides the StatHistogram class in the GQE namespace which is responsible
+ * for recording time samples into logarithmic buckets without locking so
+ * percentiles can be computed without storing every sample.
+ *
+ * @file include/GQE/Core/utils/StatHistogram.hpp
+ * @author Ryan Lindeman
+ * @date 20130805 - Initial Release
+ */
+#ifndef   CORE_STAT_HISTOGRAM_HPP_INCLUDED
+#define   CORE_STAT_HISTOGRAM_HPP_INCLUDED
+
+#include <TVSource/Core/Core_types.hpp>
+
+namespace GQE
+{
+  /// Provides a lock-free HDR style histogram of Uint32 samples
+  class GQE_API StatHistogram
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Number of bits used for the linear sub buckets of each power of two
+      static const Uint32 SUB_BUCKET_BITS = 5;
+      /// Number of linear sub buckets for each power of two (about 3% precision)
+      static const Uint32 SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+      /// Total number of buckets needed to cover every Uint32 sample
+      static const Uint32 BUCKET_COUNT = (32 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+      /**
+       * StatHistogram constructor
+       */
+      StatHistogram();
+
+      /**
+       * StatHistogram deconstructor
+       */
+      virtual ~StatHistogram();
+
+      /**
+       * Record will add theSample provided to this histogram. Record can be
+       * called from any thread at the same time without locking.
+       * @param[in] theSample to record (e.g. microseconds)
+       */
+      void Record(const Uint32 theSample);
+
+      /**
+       * Reset will remove every sample recorded so far.
+       */
+      void Reset(void);
+
+      /**
+       * Merge will add every sample recorded by theOther histogram provided
+       * to this histogram.
+       * @param[in] theOther histogram to merge into this histogram
+       */
+      void Merge(const StatHistogram& theOther);
+
+      /**
+       * GetCount will return the number of samples recorded.
+       * @return the number of samples recorded
+       */
+      Uint32 GetCount(void) const;
+
+      /**
+       * GetCountAbove will return the number of samples recorded that are
+       * larger than theThreshold provided (within the bucket precision).
+       * @param[in] theThreshold to compare each sample against
+       * @return the number of samples larger than theThreshold
+       */
+      Uint32 GetCountAbove(const Uint32 theThreshold) const;
+
+      /**
+       * GetMaximum will return the largest sample recorded.
+       * @return the largest sample recorded or 0 if none were recorded
+       */
+      Uint32 GetMaximum(void) const;
+
+      /**
+       * GetPercentile will return the sample found at thePercentile provided
+       * using the nearest rank method.
+       * @param[in] thePercentile to find in the range of [0,100]
+       * @return the highest value of the bucket holding thePercentile sample
+       */
+      Uint32 GetPercentile(const float thePercentile) const;
+
+      /**
+       * GetBucket will return the bucket index to use for theSample provided.
+       * @param[in] theSample to find the bucket for
+       * @return the bucket index in the range of [0,BUCKET_COUNT)
+       */
+      static Uint32 GetBucket(const Uint32 theSample);
+
+      /**
+       * GetBucketMaximum will return the highest sample value that is
+       * recorded into theBucket provided.
+       * @param[in] theBucket index to get the highest value of
+       * @return the highest sample value of theBucket
+       */
+      static Uint32 GetBucketMaximum(const Uint32 theBucket);
+
+    private:
+      // Variables
+      ///////////////////////////////////////////////////////////////////////////
+      /// The number of samples recorded in each bucket
+      volatile Uint32 mBuckets[BUCKET_COUNT];
+      /// The total number of samples recorded
+      volatile Uint32 mCount;
+      /// The largest sample recorded
+      volatile Uint32 mMaximum;
+
+      /**
+       * StatHistogram copy constructor is private because we do not allow
+       * copies of our class
+       */
+      StatHistogram(const StatHistogram&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      StatHistogram& operator=(const StatHistogram&); // Intentionally undefined
+  }; // class StatHistogram
+} // namespace GQE
+
+#endif // CORE_STAT_HISTOGRAM_HPP_INCLUDED
+
+/**
+ * @class GQE::StatHistogram
+ * @ingroup Core
+ * The StatHistogram class is used by the StatManager class to record the time
+ * spent in each game loop phase. Samples below 64 are counted exactly, larger
+ * samples are counted in one of 32 linear sub buckets for each power of two
+ * which keeps every percentile within about 3% of the actual sample while
+ * using a fixed 3.5 KB for any number of samples. Recording only uses atomic
+ * increments so several threads can record into the same histogram.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
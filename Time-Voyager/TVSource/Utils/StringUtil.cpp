@@ -8,272 +8,655 @@
  * @date 20110906 - Moved Util.cpp from Entities to here
  * @date 20120720 - Added several new Convert and Parse functions
  * @date 20120904 - Fix SFML v1.6 issues
+ * @date 20130810 - Added ParseSeverity
+ * @date 20130814 - Added allocation free buffer Convert and Parse overloads
  */
 
-#include <sstream>
 #include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <TVSource/utils/StringUtil.hpp>
 
 namespace GQE
 {
-  std::string ConvertBool(const bool theBoolean)
+  /// Exact powers of 10 used by the floating point parsing fast path
+  static const double POWERS_OF_10[] =
+  {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+
+  /// Largest mantissa that can be converted to a double exactly (2^53)
+  static const Uint64 MAX_EXACT_MANTISSA = 9007199254740992ULL;
+
+  /**
+   * WriteInteger will write the decimal digits of theMagnitude provided
+   * (prefixed with '-' if theNegative is true) into theText provided.
+   * @param[in] theMagnitude to write
+   * @param[in] theNegative flag to prefix theMagnitude with '-'
+   * @param[out] theText to write to (must hold at least 21 characters)
+   * @return the number of characters written
+   */
+  static size_t WriteInteger(Uint64 theMagnitude, const bool theNegative, char* theText)
   {
-    // Use StringStream class to convert theBoolean to a string
-    std::stringstream anResult;
+    // Write the digits in reverse order first
+    char anDigits[20];
+    size_t anCount = 0;
+    do
+    {
+      anDigits[anCount++] = (char)('0' + theMagnitude % 10);
+      theMagnitude /= 10;
+    } while(theMagnitude > 0);
 
-    // Add theBoolean to the stringstream
-    if(theBoolean)
+    size_t anResult = 0;
+    if(theNegative)
     {
-      anResult << "true";
+      theText[anResult++] = '-';
     }
-    else
+    while(anCount > 0)
     {
-      anResult << "false";
+      theText[anResult++] = anDigits[--anCount];
     }
 
-    // Return the string result created by stringstream
-    return anResult.str();
+    // Return the number of characters written above
+    return anResult;
   }
 
-  std::string ConvertColor(const sf::Color theColor)
+  /**
+   * WriteSigned will write theNumber provided into theText provided.
+   * @param[in] theNumber to write
+   * @param[out] theText to write to (must hold at least 21 characters)
+   * @return the number of characters written
+   */
+  static size_t WriteSigned(const Int64 theNumber, char* theText)
   {
-    // Use StringStream class to convert theColor to a string
-    std::stringstream anResult;
+    // Negate using unsigned math so the smallest value doesn't overflow
+    return WriteInteger(theNumber < 0 ? 0 - (Uint64)theNumber : (Uint64)theNumber,
+      theNumber < 0, theText);
+  }
 
-    // Add theColor to the stringstream
-    anResult << theColor.r << ", ";
-    anResult << theColor.g << ", ";
-    anResult << theColor.b << ", ";
-    anResult << theColor.a;
+  /**
+   * WriteReal will write theNumber provided into theText provided using the
+   * same format as a stream with the default precision ("%g").
+   * @param[in] theNumber to write
+   * @param[out] theText to write to (must hold at least 32 characters)
+   * @return the number of characters written
+   */
+  static size_t WriteReal(const double theNumber, char* theText)
+  {
+#if defined(_MSC_VER)
+    int anResult = sprintf_s(theText, 32, "%g", theNumber);
+#else
+    int anResult = sprintf(theText, "%g", theNumber);
+#endif
 
-    // Return the string result created by stringstream
-    return anResult.str();
+    // Return the number of characters written above
+    return anResult > 0 ? (size_t)anResult : 0;
   }
 
-  std::string ConvertDouble(const double theDouble)
+  /**
+   * WriteSeparator will write the ", " separator used between the values of
+   * a vector, rect or color into theText provided.
+   * @param[out] theText to write to (must hold at least 2 characters)
+   * @return the number of characters written
+   */
+  static size_t WriteSeparator(char* theText)
   {
-    // Use StringStream class to convert theDouble to a string
-    std::stringstream anResult;
+    theText[0] = ',';
+    theText[1] = ' ';
+    return 2;
+  }
 
-    // Add theDouble to the stringstream
-    anResult << theDouble;
+  /**
+   * CopyResult will copy theLength characters of theText provided into
+   * theBuffer provided followed by a null terminator.
+   * @param[in] theText to copy
+   * @param[in] theLength of theText in characters
+   * @param[out] theBuffer to copy theText into
+   * @param[in] theSize of theBuffer in characters
+   * @return theLength or 0 if theBuffer is too small
+   */
+  static size_t CopyResult(const char* theText, const size_t theLength,
+      char* theBuffer, const size_t theSize)
+  {
+    size_t anResult = 0;
 
-    // Return the string result created by stringstream
-    return anResult.str();
+    if(theLength < theSize)
+    {
+      memcpy(theBuffer, theText, theLength);
+      theBuffer[theLength] = '\0';
+      anResult = theLength;
+    }
+    else if(theSize > 0)
+    {
+      theBuffer[0] = '\0';
+    }
+
+    // Return anResult determined above
+    return anResult;
   }
 
-  std::string ConvertFloat(const float theFloat)
+  /**
+   * ReadInteger will read an optional sign followed by decimal digits from
+   * theValue provided the same way a stream does (leading white space is
+   * skipped and parsing stops at the first character that isn't a digit).
+   * @param[in] theValue characters to parse
+   * @param[in] theLength of theValue in characters
+   * @param[in] theSigned flag to allow a '-' sign
+   * @param[in] theLimit is the largest positive magnitude allowed (negative
+   *   magnitudes may be 1 larger)
+   * @param[out] theNegative is set to true if a '-' sign was read
+   * @param[out] theMagnitude is set to the magnitude read
+   * @return true if at least 1 digit was read and theLimit was respected
+   */
+  static bool ReadInteger(const char* theValue, const size_t theLength,
+      const bool theSigned, const Uint64 theLimit, bool& theNegative,
+      Uint64& theMagnitude)
   {
-    // Use StringStream class to convert theFloat to a string
-    std::stringstream anResult;
+    size_t anOffset = 0;
+    theNegative = false;
+    theMagnitude = 0;
 
-    // Add theFloat to the stringstream
-    anResult << theFloat;
+    // Skip preceeding white space
+    while(anOffset < theLength && isspace((unsigned char)theValue[anOffset]))
+    {
+      anOffset++;
+    }
+
+    // Read the optional sign
+    if(anOffset < theLength && (theValue[anOffset] == '-' || theValue[anOffset] == '+'))
+    {
+      theNegative = (theValue[anOffset] == '-');
+      anOffset++;
+    }
+
+    // Negative values are one larger for two's complement integers
+    const Uint64 anLimit = theNegative ? theLimit + 1 : theLimit;
+    bool anResult = theSigned || !theNegative;
+
+    // Read each digit while making sure we stay within anLimit
+    size_t anStart = anOffset;
+    while(anResult && anOffset < theLength &&
+        theValue[anOffset] >= '0' && theValue[anOffset] <= '9')
+    {
+      Uint64 anDigit = (Uint64)(theValue[anOffset] - '0');
+      if(theMagnitude > (anLimit - anDigit) / 10)
+      {
+        anResult = false;
+      }
+      else
+      {
+        theMagnitude = theMagnitude * 10 + anDigit;
+      }
+      anOffset++;
+    }
 
-    // Return the string result created by stringstream
-    return anResult.str();
+    // Return true if at least 1 digit was read without overflow
+    return anResult && anOffset > anStart;
   }
 
-  std::string ConvertInt8(const Int8 theNumber)
+  /**
+   * ReadReal will read a floating point number from theValue provided the
+   * same way a stream does. Numbers with up to 17 significant digits and
+   * small exponents are converted exactly using a single multiply or divide,
+   * all others are converted using strtod.
+   * @param[in] theValue characters to parse
+   * @param[in] theLength of theValue in characters
+   * @param[out] theNumber is set to the number read
+   * @return true if a number was read
+   */
+  static bool ReadReal(const char* theValue, const size_t theLength, double& theNumber)
   {
-    // Use StringStream class to convert theNumber to a string
-    std::stringstream anResult;
+    size_t anOffset = 0;
 
-    // Add theNumber to the stringstream
-    anResult << theNumber;
+    // Skip preceeding white space
+    while(anOffset < theLength && isspace((unsigned char)theValue[anOffset]))
+    {
+      anOffset++;
+    }
+    size_t anStart = anOffset;
 
-    // Return the string result created by stringstream
-    return anResult.str();
+    // Read the optional sign
+    bool anNegative = false;
+    if(anOffset < theLength && (theValue[anOffset] == '-' || theValue[anOffset] == '+'))
+    {
+      anNegative = (theValue[anOffset] == '-');
+      anOffset++;
+    }
+
+    // Read the integer and fraction digits into anMantissa
+    Uint64 anMantissa = 0;
+    Int32 anExponent = 0;
+    bool anDigits = false;
+    bool anExact = true;
+    bool anFraction = false;
+    while(anOffset < theLength)
+    {
+      char anChar = theValue[anOffset];
+      if(anChar >= '0' && anChar <= '9')
+      {
+        anDigits = true;
+        if(anMantissa < 100000000000000000ULL)
+        {
+          anMantissa = anMantissa * 10 + (Uint64)(anChar - '0');
+          if(anFraction)
+          {
+            anExponent--;
+          }
+        }
+        else
+        {
+          // Too many significant digits for the fast path
+          anExact = false;
+          if(!anFraction)
+          {
+            anExponent++;
+          }
+        }
+      }
+      else if(anChar == '.' && !anFraction)
+      {
+        anFraction = true;
+      }
+      else
+      {
+        break;
+      }
+      anOffset++;
+    }
+
+    // Read the optional exponent (only if at least 1 exponent digit follows)
+    if(anDigits && anOffset < theLength &&
+        (theValue[anOffset] == 'e' || theValue[anOffset] == 'E'))
+    {
+      bool anNegativeExponent = false;
+      Uint64 anValue = 0;
+      if(ReadInteger(theValue + anOffset + 1, theLength - anOffset - 1,
+          true, 100000, anNegativeExponent, anValue) &&
+          !isspace((unsigned char)theValue[anOffset + 1]))
+      {
+        anExponent += anNegativeExponent ? -(Int32)anValue : (Int32)anValue;
+
+        // Skip over the exponent characters read above
+        anOffset++;
+        if(theValue[anOffset] == '-' || theValue[anOffset] == '+')
+        {
+          anOffset++;
+        }
+        while(anOffset < theLength && theValue[anOffset] >= '0' && theValue[anOffset] <= '9')
+        {
+          anOffset++;
+        }
+      }
+    }
+
+    if(anDigits)
+    {
+      if(anExact && anMantissa <= MAX_EXACT_MANTISSA &&
+          anExponent >= -22 && anExponent <= 22)
+      {
+        // Both values are exact so the result is correctly rounded
+        theNumber = (double)(Int64)anMantissa;
+        if(anExponent < 0)
+        {
+          theNumber /= POWERS_OF_10[-anExponent];
+        }
+        else
+        {
+          theNumber *= POWERS_OF_10[anExponent];
+        }
+        if(anNegative)
+        {
+          theNumber = -theNumber;
+        }
+      }
+      else
+      {
+        // Use strtod on a null terminated copy of the characters read above
+        char anText[CONVERT_BUFFER_SIZE];
+        size_t anLength = anOffset - anStart;
+        if(anLength < CONVERT_BUFFER_SIZE)
+        {
+          memcpy(anText, theValue + anStart, anLength);
+          anText[anLength] = '\0';
+          theNumber = strtod(anText, NULL);
+        }
+        else
+        {
+          theNumber = strtod(std::string(theValue + anStart, anLength).c_str(), NULL);
+        }
+      }
+    }
+
+    // Return true if at least 1 digit was read
+    return anDigits;
   }
 
-  std::string ConvertInt16(const Int16 theNumber)
+  /**
+   * FindComma will return the offset of the first ',' found in theValue
+   * provided starting at theOffset.
+   * @param[in] theValue characters to search
+   * @param[in] theLength of theValue in characters
+   * @param[in] theOffset to start searching at
+   * @return the offset of the ',' found or theLength if not found
+   */
+  static size_t FindComma(const char* theValue, const size_t theLength, const size_t theOffset)
   {
-    // Use StringStream class to convert theNumber to a string
-    std::stringstream anResult;
+    size_t anResult = theLength;
+    if(theOffset < theLength)
+    {
+      const char* anComma = (const char*)memchr(theValue + theOffset, ',', theLength - theOffset);
+      if(NULL != anComma)
+      {
+        anResult = (size_t)(anComma - theValue);
+      }
+    }
 
-    // Add theNumber to the stringstream
-    anResult << theNumber;
+    // Return the offset found above or theLength if not found
+    return anResult;
+  }
 
-    // Return the string result created by stringstream
-    return anResult.str();
+  /**
+   * IsEqual will compare theLength characters of theValue provided with
+   * theText provided ignoring the case of theValue.
+   * @param[in] theValue characters to compare
+   * @param[in] theLength of theValue in characters
+   * @param[in] theText in lower case to compare with
+   * @return true if theValue matches theText
+   */
+  static bool IsEqual(const char* theValue, const size_t theLength, const char* theText)
+  {
+    size_t anOffset = 0;
+    while(anOffset < theLength && theText[anOffset] != '\0' &&
+        tolower((unsigned char)theValue[anOffset]) == theText[anOffset])
+    {
+      anOffset++;
+    }
+
+    // Return true if every character of both strings matched
+    return anOffset == theLength && theText[anOffset] == '\0';
   }
 
-  std::string ConvertInt32(const Int32 theNumber)
+  std::string ConvertBool(const bool theBoolean)
   {
-    // Use StringStream class to convert theNumber to a string
-    std::stringstream anResult;
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertBool(theBoolean, anBuffer, sizeof(anBuffer)));
+  }
 
-    // Add theNumber to the stringstream
-    anResult << theNumber;
+  size_t ConvertBool(const bool theBoolean, char* theBuffer, const size_t theSize)
+  {
+    return theBoolean ? CopyResult("true", 4, theBuffer, theSize) :
+      CopyResult("false", 5, theBuffer, theSize);
+  }
 
-    // Return the string result created by stringstream
-    return anResult.str();
+  std::string ConvertColor(const sf::Color theColor)
+  {
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertColor(theColor, anBuffer, sizeof(anBuffer)));
   }
 
-  std::string ConvertInt64(const Int64 theNumber)
+  size_t ConvertColor(const sf::Color theColor, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    size_t anLength = WriteInteger(theColor.r, false, anText);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteInteger(theColor.g, false, anText + anLength);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteInteger(theColor.b, false, anText + anLength);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteInteger(theColor.a, false, anText + anLength);
+    return CopyResult(anText, anLength, theBuffer, theSize);
+  }
+
+  std::string ConvertDouble(const double theDouble)
+  {
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertDouble(theDouble, anBuffer, sizeof(anBuffer)));
+  }
+
+  size_t ConvertDouble(const double theDouble, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    return CopyResult(anText, WriteReal(theDouble, anText), theBuffer, theSize);
+  }
+
+  std::string ConvertFloat(const float theFloat)
+  {
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertFloat(theFloat, anBuffer, sizeof(anBuffer)));
+  }
+
+  size_t ConvertFloat(const float theFloat, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    return CopyResult(anText, WriteReal(theFloat, anText), theBuffer, theSize);
+  }
+
+  std::string ConvertInt8(const Int8 theNumber)
+  {
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertInt8(theNumber, anBuffer, sizeof(anBuffer)));
+  }
+
+  size_t ConvertInt8(const Int8 theNumber, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    return CopyResult(anText, WriteSigned(theNumber, anText), theBuffer, theSize);
+  }
+
+  std::string ConvertInt16(const Int16 theNumber)
+  {
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertInt16(theNumber, anBuffer, sizeof(anBuffer)));
+  }
+
+  size_t ConvertInt16(const Int16 theNumber, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    return CopyResult(anText, WriteSigned(theNumber, anText), theBuffer, theSize);
+  }
+
+  std::string ConvertInt32(const Int32 theNumber)
   {
-    // Use StringStream class to convert theNumber to a string
-    std::stringstream anResult;
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertInt32(theNumber, anBuffer, sizeof(anBuffer)));
+  }
 
-    // Add theNumber to the stringstream
-    anResult << theNumber;
+  size_t ConvertInt32(const Int32 theNumber, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    return CopyResult(anText, WriteSigned(theNumber, anText), theBuffer, theSize);
+  }
+
+  std::string ConvertInt64(const Int64 theNumber)
+  {
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertInt64(theNumber, anBuffer, sizeof(anBuffer)));
+  }
 
-    // Return the string result created by stringstream
-    return anResult.str();
+  size_t ConvertInt64(const Int64 theNumber, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    return CopyResult(anText, WriteSigned(theNumber, anText), theBuffer, theSize);
   }
 
   std::string ConvertIntRect(const sf::IntRect theRect)
   {
-    // Use StringStream class to convert theRect to a string
-    std::stringstream anResult;
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertIntRect(theRect, anBuffer, sizeof(anBuffer)));
+  }
 
-    // Add theRect to the stringstream
+  size_t ConvertIntRect(const sf::IntRect theRect, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
 #if (SFML_VERSION_MAJOR < 2)
-    anResult << theRect.Top << ", ";
-    anResult << theRect.Left << ", ";
-    anResult << theRect.GetWidth() << ", ";
-    anResult << theRect.GetHeight();
+    size_t anLength = WriteSigned(theRect.Top, anText);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteSigned(theRect.Left, anText + anLength);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteSigned(theRect.GetWidth(), anText + anLength);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteSigned(theRect.GetHeight(), anText + anLength);
 #else
-    anResult << theRect.top << ", ";
-    anResult << theRect.left << ", ";
-    anResult << theRect.width << ", ";
-    anResult << theRect.height;
+    size_t anLength = WriteSigned(theRect.top, anText);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteSigned(theRect.left, anText + anLength);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteSigned(theRect.width, anText + anLength);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteSigned(theRect.height, anText + anLength);
 #endif
-
-    // Return the string result created by stringstream
-    return anResult.str();
+    return CopyResult(anText, anLength, theBuffer, theSize);
   }
 
   std::string ConvertUint8(const Uint8 theNumber)
   {
-    // Use StringStream class to convert theNumber to a string
-    std::stringstream anResult;
-
-    // Add theNumber to the stringstream
-    anResult << theNumber;
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertUint8(theNumber, anBuffer, sizeof(anBuffer)));
+  }
 
-    // Return the string result created by stringstream
-    return anResult.str();
+  size_t ConvertUint8(const Uint8 theNumber, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    return CopyResult(anText, WriteInteger(theNumber, false, anText), theBuffer, theSize);
   }
 
   std::string ConvertUint16(const Uint16 theNumber)
   {
-    // Use StringStream class to convert theNumber to a string
-    std::stringstream anResult;
-
-    // Add theNumber to the stringstream
-    anResult << theNumber;
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertUint16(theNumber, anBuffer, sizeof(anBuffer)));
+  }
 
-    // Return the string result created by stringstream
-    return anResult.str();
+  size_t ConvertUint16(const Uint16 theNumber, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    return CopyResult(anText, WriteInteger(theNumber, false, anText), theBuffer, theSize);
   }
 
   std::string ConvertUint32(const Uint32 theNumber)
   {
-    // Use StringStream class to convert theNumber to a string
-    std::stringstream anResult;
-
-    // Add theNumber to the stringstream
-    anResult << theNumber;
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertUint32(theNumber, anBuffer, sizeof(anBuffer)));
+  }
 
-    // Return the string result created by stringstream
-    return anResult.str();
+  size_t ConvertUint32(const Uint32 theNumber, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    return CopyResult(anText, WriteInteger(theNumber, false, anText), theBuffer, theSize);
   }
 
   std::string ConvertUint64(const Uint64 theNumber)
   {
-    // Use StringStream class to convert theNumber to a string
-    std::stringstream anResult;
-
-    // Add theNumber to the stringstream
-    anResult << theNumber;
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertUint64(theNumber, anBuffer, sizeof(anBuffer)));
+  }
 
-    // Return the string result created by stringstream
-    return anResult.str();
+  size_t ConvertUint64(const Uint64 theNumber, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    return CopyResult(anText, WriteInteger(theNumber, false, anText), theBuffer, theSize);
   }
 
   std::string ConvertVector2f(const sf::Vector2f theVector)
   {
-    // Use StringStream class to convert theVector to a string
-    std::stringstream anResult;
-
-    // Add theVector to the stringstream
-    anResult << theVector.x << ", ";
-    anResult << theVector.y;
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertVector2f(theVector, anBuffer, sizeof(anBuffer)));
+  }
 
-    // Return the string result created by stringstream
-    return anResult.str();
+  size_t ConvertVector2f(const sf::Vector2f theVector, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    size_t anLength = WriteReal(theVector.x, anText);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteReal(theVector.y, anText + anLength);
+    return CopyResult(anText, anLength, theBuffer, theSize);
   }
 
   std::string ConvertVector2i(const sf::Vector2i theVector)
   {
-    // Use StringStream class to convert theVector to a string
-    std::stringstream anResult;
-
-    // Add theVector to the stringstream
-    anResult << theVector.x << ", ";
-    anResult << theVector.y;
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertVector2i(theVector, anBuffer, sizeof(anBuffer)));
+  }
 
-    // Return the string result created by stringstream
-    return anResult.str();
+  size_t ConvertVector2i(const sf::Vector2i theVector, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    size_t anLength = WriteSigned(theVector.x, anText);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteSigned(theVector.y, anText + anLength);
+    return CopyResult(anText, anLength, theBuffer, theSize);
   }
 
   std::string ConvertVector2u(const sf::Vector2u theVector)
   {
-    // Use StringStream class to convert theVector to a string
-    std::stringstream anResult;
-
-    // Add theVector to the stringstream
-    anResult << theVector.x << ", ";
-    anResult << theVector.y;
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertVector2u(theVector, anBuffer, sizeof(anBuffer)));
+  }
 
-    // Return the string result created by stringstream
-    return anResult.str();
+  size_t ConvertVector2u(const sf::Vector2u theVector, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    size_t anLength = WriteInteger(theVector.x, false, anText);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteInteger(theVector.y, false, anText + anLength);
+    return CopyResult(anText, anLength, theBuffer, theSize);
   }
 
   std::string ConvertVector3f(const sf::Vector3f theVector)
   {
-    // Use StringStream class to convert theVector to a string
-    std::stringstream anResult;
-
-    // Add theVector to the stringstream
-    anResult << theVector.x << ", ";
-    anResult << theVector.y << ", ";
-    anResult << theVector.z;
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertVector3f(theVector, anBuffer, sizeof(anBuffer)));
+  }
 
-    // Return the string result created by stringstream
-    return anResult.str();
+  size_t ConvertVector3f(const sf::Vector3f theVector, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    size_t anLength = WriteReal(theVector.x, anText);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteReal(theVector.y, anText + anLength);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteReal(theVector.z, anText + anLength);
+    return CopyResult(anText, anLength, theBuffer, theSize);
   }
 
   std::string ConvertVector3i(const sf::Vector3i theVector)
   {
-    // Use StringStream class to convert theVector to a string
-    std::stringstream anResult;
-
-    // Add theVector to the stringstream
-    anResult << theVector.x << ", ";
-    anResult << theVector.y << ", ";
-    anResult << theVector.z;
+    char anBuffer[CONVERT_BUFFER_SIZE];
+    return std::string(anBuffer, ConvertVector3i(theVector, anBuffer, sizeof(anBuffer)));
+  }
 
-    // Return the string result created by stringstream
-    return anResult.str();
+  size_t ConvertVector3i(const sf::Vector3i theVector, char* theBuffer, const size_t theSize)
+  {
+    char anText[CONVERT_BUFFER_SIZE];
+    size_t anLength = WriteSigned(theVector.x, anText);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteSigned(theVector.y, anText + anLength);
+    anLength += WriteSeparator(anText + anLength);
+    anLength += WriteSigned(theVector.z, anText + anLength);
+    return CopyResult(anText, anLength, theBuffer, theSize);
   }
 
   bool ParseBool(std::string theValue, const bool theDefault)
   {
-    bool anResult = theDefault;
+    return ParseBool(theValue.data(), theValue.length(), theDefault);
+  }
 
-    // First convert theValue provided into lower case
-    std::transform(theValue.begin(), theValue.end(), theValue.begin(), tolower);
+  bool ParseBool(const char* theValue, const size_t theLength, const bool theDefault)
+  {
+    bool anResult = theDefault;
 
     // Look for true/1/on results
-    if(theValue == "true" || theValue == "1" || theValue == "on")
+    if(IsEqual(theValue, theLength, "true") || IsEqual(theValue, theLength, "1") ||
+        IsEqual(theValue, theLength, "on"))
     {
       anResult = true;
     }
 
     // Look for false results
-    if(theValue == "false" || theValue == "0" || theValue == "off")
+    if(IsEqual(theValue, theLength, "false") || IsEqual(theValue, theLength, "0") ||
+        IsEqual(theValue, theLength, "off"))
     {
       anResult = false;
     }
@@ -283,36 +666,29 @@ namespace GQE
   }
 
   sf::Color ParseColor(const std::string theValue, const sf::Color theDefault)
+  {
+    return ParseColor(theValue.data(), theValue.length(), theDefault);
+  }
+
+  sf::Color ParseColor(const char* theValue, const size_t theLength,
+      const sf::Color theDefault)
   {
     sf::Color anResult = theDefault;
 
-    // Try to find the first comma
-    size_t anComma1Offset = theValue.find_first_of(',');
-    if(anComma1Offset != std::string::npos)
+    // Try to find each of the 3 commas
+    size_t anComma1Offset = FindComma(theValue, theLength, 0);
+    size_t anComma2Offset = FindComma(theValue, theLength, anComma1Offset+1);
+    size_t anComma3Offset = FindComma(theValue, theLength, anComma2Offset+1);
+    if(anComma3Offset < theLength)
     {
-      sf::Uint8 anRed = ParseUint8(theValue.substr(0,anComma1Offset), theDefault.r);
-      // Try to find the next comma
-      size_t anComma2Offset = theValue.find_first_of(',',anComma1Offset+1);
-      if(anComma2Offset != std::string::npos)
-      {
-        sf::Uint8 anGreen = ParseUint8(
-          theValue.substr(anComma1Offset+1,anComma2Offset), theDefault.g);
-        // Try to find the next comma
-        size_t anComma3Offset = theValue.find_first_of(',',anComma2Offset+1);
-        if(anComma3Offset != std::string::npos)
-        {
-          sf::Uint8 anBlue = ParseUint8(
-            theValue.substr(anComma2Offset+1,anComma3Offset), theDefault.b);
-          sf::Uint8 anAlpha = ParseUint8(
-            theValue.substr(anComma3Offset+1), theDefault.a);
-
-          // Now that all 4 values have been parsed, return the color found
-          anResult.r = anRed;
-          anResult.g = anGreen;
-          anResult.b = anBlue;
-          anResult.a = anAlpha;
-        }
-      }
+      // Now that all 4 values have been found, return the color parsed
+      anResult.r = ParseUint8(theValue, anComma1Offset, theDefault.r);
+      anResult.g = ParseUint8(theValue + anComma1Offset + 1,
+        anComma2Offset - anComma1Offset - 1, theDefault.g);
+      anResult.b = ParseUint8(theValue + anComma2Offset + 1,
+        anComma3Offset - anComma2Offset - 1, theDefault.b);
+      anResult.a = ParseUint8(theValue + anComma3Offset + 1,
+        theLength - anComma3Offset - 1, theDefault.a);
     }
 
     // Return the result found or theDefault assigned above
@@ -320,126 +696,202 @@ namespace GQE
   }
 
   double ParseDouble(const std::string theValue, const double theDefault)
+  {
+    return ParseDouble(theValue.data(), theValue.length(), theDefault);
+  }
+
+  double ParseDouble(const char* theValue, const size_t theLength,
+      const double theDefault)
   {
     double anResult = theDefault;
-    std::istringstream iss(theValue);
 
-    // Convert the string to a double floating point number
-    iss >> anResult;
+    // Convert the characters to a double floating point number
+    double anNumber = 0.0;
+    if(ReadReal(theValue, theLength, anNumber))
+    {
+      anResult = anNumber;
+    }
 
     // Return the result found or theDefault assigned above
     return anResult;
   }
 
   float ParseFloat(const std::string theValue, const float theDefault)
+  {
+    return ParseFloat(theValue.data(), theValue.length(), theDefault);
+  }
+
+  float ParseFloat(const char* theValue, const size_t theLength,
+      const float theDefault)
   {
     float anResult = theDefault;
-    std::istringstream iss(theValue);
 
-    // Convert the string to a floating point number
-    iss >> anResult;
+    // Convert the characters to a floating point number
+    double anNumber = 0.0;
+    if(ReadReal(theValue, theLength, anNumber))
+    {
+      anResult = (float)anNumber;
+    }
 
     // Return the result found or theDefault assigned above
     return anResult;
   }
 
   Int8 ParseInt8(const std::string theValue, const Int8 theDefault)
+  {
+    return ParseInt8(theValue.data(), theValue.length(), theDefault);
+  }
+
+  Int8 ParseInt8(const char* theValue, const size_t theLength,
+      const Int8 theDefault)
   {
     Int8 anResult = theDefault;
-    std::istringstream iss(theValue);
 
-    // Convert the string to a signed 8 bit integer
-    iss >> anResult;
+    // Convert the characters to a signed 8 bit integer
+    bool anNegative = false;
+    Uint64 anMagnitude = 0;
+    if(ReadInteger(theValue, theLength, true, 0x7F, anNegative, anMagnitude))
+    {
+      anResult = (Int8)(anNegative ? -(Int64)anMagnitude : (Int64)anMagnitude);
+    }
 
     // Return the result found or theDefault assigned above
     return anResult;
   }
 
   Int16 ParseInt16(const std::string theValue, const Int16 theDefault)
+  {
+    return ParseInt16(theValue.data(), theValue.length(), theDefault);
+  }
+
+  Int16 ParseInt16(const char* theValue, const size_t theLength,
+      const Int16 theDefault)
   {
     Int16 anResult = theDefault;
-    std::istringstream iss(theValue);
 
-    // Convert the string to a signed 16 bit integer
-    iss >> anResult;
+    // Convert the characters to a signed 16 bit integer
+    bool anNegative = false;
+    Uint64 anMagnitude = 0;
+    if(ReadInteger(theValue, theLength, true, 0x7FFF, anNegative, anMagnitude))
+    {
+      anResult = (Int16)(anNegative ? -(Int64)anMagnitude : (Int64)anMagnitude);
+    }
 
     // Return the result found or theDefault assigned above
     return anResult;
   }
 
   Int32 ParseInt32(const std::string theValue, const Int32 theDefault)
+  {
+    return ParseInt32(theValue.data(), theValue.length(), theDefault);
+  }
+
+  Int32 ParseInt32(const char* theValue, const size_t theLength,
+      const Int32 theDefault)
   {
     Int32 anResult = theDefault;
-    std::istringstream iss(theValue);
 
-    // Convert the string to a signed 32 bit integer
-    iss >> anResult;
+    // Convert the characters to a signed 32 bit integer
+    bool anNegative = false;
+    Uint64 anMagnitude = 0;
+    if(ReadInteger(theValue, theLength, true, 0x7FFFFFFF, anNegative, anMagnitude))
+    {
+      anResult = (Int32)(anNegative ? -(Int64)anMagnitude : (Int64)anMagnitude);
+    }
 
     // Return the result found or theDefault assigned above
     return anResult;
   }
 
   Int64 ParseInt64(const std::string theValue, const Int64 theDefault)
+  {
+    return ParseInt64(theValue.data(), theValue.length(), theDefault);
+  }
+
+  Int64 ParseInt64(const char* theValue, const size_t theLength,
+      const Int64 theDefault)
   {
     Int64 anResult = theDefault;
-    std::istringstream iss(theValue);
 
-    // Convert the string to a signed 64 bit integer
-    iss >> anResult;
+    // Convert the characters to a signed 64 bit integer
+    bool anNegative = false;
+    Uint64 anMagnitude = 0;
+    if(ReadInteger(theValue, theLength, true, 0x7FFFFFFFFFFFFFFFULL, anNegative, anMagnitude))
+    {
+      // Negate using unsigned math so the smallest value doesn't overflow
+      anResult = (Int64)(anNegative ? 0 - anMagnitude : anMagnitude);
+    }
 
     // Return the result found or theDefault assigned above
     return anResult;
   }
 
   sf::IntRect ParseIntRect(const std::string theValue, const sf::IntRect theDefault)
+  {
+    return ParseIntRect(theValue.data(), theValue.length(), theDefault);
+  }
+
+  sf::IntRect ParseIntRect(const char* theValue, const size_t theLength,
+      const sf::IntRect theDefault)
   {
     sf::IntRect anResult = theDefault;
 
-    // Try to find the first comma
-    size_t anComma1Offset = theValue.find_first_of(',');
-    if(anComma1Offset != std::string::npos)
+    // Try to find each of the 3 commas
+    size_t anComma1Offset = FindComma(theValue, theLength, 0);
+    size_t anComma2Offset = FindComma(theValue, theLength, anComma1Offset+1);
+    size_t anComma3Offset = FindComma(theValue, theLength, anComma2Offset+1);
+    if(anComma3Offset < theLength)
     {
+      const char* anTop = theValue + anComma1Offset + 1;
+      const char* anWidth = theValue + anComma2Offset + 1;
+      const char* anHeight = theValue + anComma3Offset + 1;
 #if (SFML_VERSION_MAJOR < 2)
-      sf::Int32 anLeft = ParseInt32(theValue.substr(0,anComma1Offset), theDefault.Left);
-#else
-      sf::Int32 anLeft = ParseInt32(theValue.substr(0,anComma1Offset), theDefault.left);
-#endif
-      // Try to find the next comma
-      size_t anComma2Offset = theValue.find_first_of(',',anComma1Offset+1);
-      if(anComma2Offset != std::string::npos)
-      {
-#if (SFML_VERSION_MAJOR < 2)
-        sf::Int32 anTop = ParseInt32(theValue.substr(anComma1Offset+1,anComma2Offset), theDefault.Top);
+      sf::Int32 anLeftValue = ParseInt32(theValue, anComma1Offset, theDefault.Left);
+      sf::Int32 anTopValue = ParseInt32(anTop, anComma2Offset - anComma1Offset - 1, theDefault.Top);
+      sf::Int32 anWidthValue = ParseInt32(anWidth, anComma3Offset - anComma2Offset - 1, theDefault.GetWidth());
+      sf::Int32 anHeightValue = ParseInt32(anHeight, theLength - anComma3Offset - 1, theDefault.GetHeight());
+
+      // Now that all 4 values have been parsed, return the rect found
+      anResult.Left = anLeftValue;
+      anResult.Top = anTopValue;
+      anResult.Right = anLeftValue+anWidthValue;
+      anResult.Bottom = anTopValue+anHeightValue;
 #else
-        sf::Int32 anTop = ParseInt32(theValue.substr(anComma1Offset+1,anComma2Offset), theDefault.top);
+      // Now that all 4 values have been found, return the rect parsed
+      anResult.left = ParseInt32(theValue, anComma1Offset, theDefault.left);
+      anResult.top = ParseInt32(anTop, anComma2Offset - anComma1Offset - 1, theDefault.top);
+      anResult.width = ParseInt32(anWidth, anComma3Offset - anComma2Offset - 1, theDefault.width);
+      anResult.height = ParseInt32(anHeight, theLength - anComma3Offset - 1, theDefault.height);
 #endif
-        // Try to find the next comma
-        size_t anComma3Offset = theValue.find_first_of(',',anComma2Offset+1);
-        if(anComma3Offset != std::string::npos)
-        {
-#if (SFML_VERSION_MAJOR < 2)
-          // Get the width and height values
-          sf::Int32 anWidth = ParseInt32(theValue.substr(anComma2Offset+1,anComma3Offset), theDefault.GetWidth());
-          sf::Int32 anHeight = ParseInt32(theValue.substr(anComma3Offset+1), theDefault.GetHeight());
-
-          // Now that all 4 values have been parsed, return the color found
-          anResult.Left = anLeft;
-          anResult.Top = anTop;
-          anResult.Right = anLeft+anWidth;
-          anResult.Bottom = anTop+anHeight;
-#else
-          // Get the width and height values
-          sf::Int32 anWidth = ParseInt32(theValue.substr(anComma2Offset+1,anComma3Offset), theDefault.width);
-          sf::Int32 anHeight = ParseInt32(theValue.substr(anComma3Offset+1), theDefault.height);
-
-          // Now that all 4 values have been parsed, return the color found
-          anResult.left = anLeft;
-          anResult.top = anTop;
-          anResult.width = anWidth;
-          anResult.height = anHeight;
-#endif
-        }
-      }
+    }
+
+    // Return the result found or theDefault assigned above
+    return anResult;
+  }
+
+  SeverityType ParseSeverity(std::string theValue, const SeverityType theDefault)
+  {
+    SeverityType anResult = theDefault;
+
+    // First convert theValue provided into lower case
+    std::transform(theValue.begin(), theValue.end(), theValue.begin(), tolower);
+
+    // Look for each severity name or value
+    if(theValue == "info" || theValue == "0")
+    {
+      anResult = SeverityInfo;
+    }
+    else if(theValue == "warning" || theValue == "warn" || theValue == "1")
+    {
+      anResult = SeverityWarning;
+    }
+    else if(theValue == "error" || theValue == "2")
+    {
+      anResult = SeverityError;
+    }
+    else if(theValue == "fatal" || theValue == "3")
+    {
+      anResult = SeverityFatal;
     }
 
     // Return the result found or theDefault assigned above
@@ -447,67 +899,111 @@ namespace GQE
   }
 
   Uint8 ParseUint8(const std::string theValue, const Uint8 theDefault)
+  {
+    return ParseUint8(theValue.data(), theValue.length(), theDefault);
+  }
+
+  Uint8 ParseUint8(const char* theValue, const size_t theLength,
+      const Uint8 theDefault)
   {
     Uint8 anResult = theDefault;
-    std::istringstream iss(theValue);
 
-    // Convert the string to an unsigned 8 bit integer
-    iss >> anResult;
+    // Convert the characters to an unsigned 8 bit integer
+    bool anNegative = false;
+    Uint64 anMagnitude = 0;
+    if(ReadInteger(theValue, theLength, false, 0xFF, anNegative, anMagnitude))
+    {
+      anResult = (Uint8)anMagnitude;
+    }
 
     // Return the result found or theDefault assigned above
     return anResult;
   }
 
   Uint16 ParseUint16(const std::string theValue, const Uint16 theDefault)
+  {
+    return ParseUint16(theValue.data(), theValue.length(), theDefault);
+  }
+
+  Uint16 ParseUint16(const char* theValue, const size_t theLength,
+      const Uint16 theDefault)
   {
     Uint16 anResult = theDefault;
-    std::istringstream iss(theValue);
 
-    // Convert the string to an unsigned 16 bit integer
-    iss >> anResult;
+    // Convert the characters to an unsigned 16 bit integer
+    bool anNegative = false;
+    Uint64 anMagnitude = 0;
+    if(ReadInteger(theValue, theLength, false, 0xFFFF, anNegative, anMagnitude))
+    {
+      anResult = (Uint16)anMagnitude;
+    }
 
     // Return the result found or theDefault assigned above
     return anResult;
   }
 
   Uint32 ParseUint32(const std::string theValue, const Uint32 theDefault)
+  {
+    return ParseUint32(theValue.data(), theValue.length(), theDefault);
+  }
+
+  Uint32 ParseUint32(const char* theValue, const size_t theLength,
+      const Uint32 theDefault)
   {
     Uint32 anResult = theDefault;
-    std::istringstream iss(theValue);
 
-    // Convert the string to an unsigned 32 bit integer
-    iss >> anResult;
+    // Convert the characters to an unsigned 32 bit integer
+    bool anNegative = false;
+    Uint64 anMagnitude = 0;
+    if(ReadInteger(theValue, theLength, false, 0xFFFFFFFF, anNegative, anMagnitude))
+    {
+      anResult = (Uint32)anMagnitude;
+    }
 
     // Return the result found or theDefault assigned above
     return anResult;
   }
 
   Uint64 ParseUint64(const std::string theValue, const Uint64 theDefault)
+  {
+    return ParseUint64(theValue.data(), theValue.length(), theDefault);
+  }
+
+  Uint64 ParseUint64(const char* theValue, const size_t theLength,
+      const Uint64 theDefault)
   {
     Uint64 anResult = theDefault;
-    std::istringstream iss(theValue);
 
-    // Convert the string to an unsigned 64 bit integer
-    iss >> anResult;
+    // Convert the characters to an unsigned 64 bit integer
+    bool anNegative = false;
+    Uint64 anMagnitude = 0;
+    if(ReadInteger(theValue, theLength, false, 0xFFFFFFFFFFFFFFFFULL, anNegative, anMagnitude))
+    {
+      anResult = anMagnitude;
+    }
 
     // Return the result found or theDefault assigned above
     return anResult;
   }
 
   sf::Vector2f ParseVector2f(const std::string theValue, const sf::Vector2f theDefault)
+  {
+    return ParseVector2f(theValue.data(), theValue.length(), theDefault);
+  }
+
+  sf::Vector2f ParseVector2f(const char* theValue, const size_t theLength,
+      const sf::Vector2f theDefault)
   {
     sf::Vector2f anResult = theDefault;
 
     // Try to find the first comma
-    size_t anCommaOffset = theValue.find_first_of(',');
-    if(anCommaOffset != std::string::npos)
+    size_t anCommaOffset = FindComma(theValue, theLength, 0);
+    if(anCommaOffset < theLength)
     {
-      float anX = ParseFloat(theValue.substr(0,anCommaOffset), theDefault.x);
-      float anY = ParseFloat(theValue.substr(anCommaOffset+1), theDefault.y);
-
-      // Now that both values have been parsed, return the vector found
-      anResult.x = anX;
-      anResult.y = anY;
+      // Now that both values have been found, return the vector parsed
+      anResult.x = ParseFloat(theValue, anCommaOffset, theDefault.x);
+      anResult.y = ParseFloat(theValue + anCommaOffset + 1,
+        theLength - anCommaOffset - 1, theDefault.y);
     }
 
     // Return the result found or theDefault assigned above
@@ -515,19 +1011,23 @@ namespace GQE
   }
 
   sf::Vector2i ParseVector2i(const std::string theValue, const sf::Vector2i theDefault)
+  {
+    return ParseVector2i(theValue.data(), theValue.length(), theDefault);
+  }
+
+  sf::Vector2i ParseVector2i(const char* theValue, const size_t theLength,
+      const sf::Vector2i theDefault)
   {
     sf::Vector2i anResult = theDefault;
 
     // Try to find the first comma
-    size_t anCommaOffset = theValue.find_first_of(',');
-    if(anCommaOffset != std::string::npos)
+    size_t anCommaOffset = FindComma(theValue, theLength, 0);
+    if(anCommaOffset < theLength)
     {
-      Int32 anX = ParseInt32(theValue.substr(0,anCommaOffset), theDefault.x);
-      Int32 anY = ParseInt32(theValue.substr(anCommaOffset+1), theDefault.y);
-
-      // Now that both values have been parsed, return the vector found
-      anResult.x = anX;
-      anResult.y = anY;
+      // Now that both values have been found, return the vector parsed
+      anResult.x = ParseInt32(theValue, anCommaOffset, theDefault.x);
+      anResult.y = ParseInt32(theValue + anCommaOffset + 1,
+        theLength - anCommaOffset - 1, theDefault.y);
     }
 
     // Return the result found or theDefault assigned above
@@ -535,19 +1035,23 @@ namespace GQE
   }
 
   sf::Vector2u ParseVector2u(const std::string theValue, const sf::Vector2u theDefault)
+  {
+    return ParseVector2u(theValue.data(), theValue.length(), theDefault);
+  }
+
+  sf::Vector2u ParseVector2u(const char* theValue, const size_t theLength,
+      const sf::Vector2u theDefault)
   {
     sf::Vector2u anResult = theDefault;
 
     // Try to find the first comma
-    size_t anCommaOffset = theValue.find_first_of(',');
-    if(anCommaOffset != std::string::npos)
+    size_t anCommaOffset = FindComma(theValue, theLength, 0);
+    if(anCommaOffset < theLength)
     {
-      Uint32 anX = ParseUint32(theValue.substr(0, anCommaOffset), theDefault.x);
-      Uint32 anY = ParseUint32(theValue.substr(anCommaOffset+1), theDefault.y);
-
-      // Now that both values have been parsed, return the vector found
-      anResult.x = anX;
-      anResult.y = anY;
+      // Now that both values have been found, return the vector parsed
+      anResult.x = ParseUint32(theValue, anCommaOffset, theDefault.x);
+      anResult.y = ParseUint32(theValue + anCommaOffset + 1,
+        theLength - anCommaOffset - 1, theDefault.y);
     }
 
     // Return the result found or theDefault assigned above
@@ -555,27 +1059,26 @@ namespace GQE
   }
 
   sf::Vector3f ParseVector3f(const std::string theValue, const sf::Vector3f theDefault)
+  {
+    return ParseVector3f(theValue.data(), theValue.length(), theDefault);
+  }
+
+  sf::Vector3f ParseVector3f(const char* theValue, const size_t theLength,
+      const sf::Vector3f theDefault)
   {
     sf::Vector3f anResult = theDefault;
 
-    // Try to find the first comma
-    size_t anComma1Offset = theValue.find_first_of(',', 0);
-    if(anComma1Offset != std::string::npos)
+    // Try to find both commas
+    size_t anComma1Offset = FindComma(theValue, theLength, 0);
+    size_t anComma2Offset = FindComma(theValue, theLength, anComma1Offset+1);
+    if(anComma2Offset < theLength)
     {
-      float anX = ParseFloat(theValue.substr(0, anComma1Offset), theDefault.x);
-
-      // Try to find the next comma
-      size_t anComma2Offset = theValue.find_first_of(',',anComma1Offset+1);
-      if(anComma2Offset != std::string::npos)
-      {
-        float anY = ParseFloat(theValue.substr(anComma1Offset+1, anComma2Offset), theDefault.y);
-        float anZ = ParseFloat(theValue.substr(anComma2Offset+1), theDefault.z);
-        
-        // Now that all 3 values have been parsed, return the Vector3f found
-        anResult.x = anX;
-        anResult.y = anY;
-        anResult.z = anZ;
-      }
+      // Now that all 3 values have been found, return the Vector3f parsed
+      anResult.x = ParseFloat(theValue, anComma1Offset, theDefault.x);
+      anResult.y = ParseFloat(theValue + anComma1Offset + 1,
+        anComma2Offset - anComma1Offset - 1, theDefault.y);
+      anResult.z = ParseFloat(theValue + anComma2Offset + 1,
+        theLength - anComma2Offset - 1, theDefault.z);
     }
 
     // Return the result found or theDefault assigned above
@@ -583,27 +1086,26 @@ namespace GQE
   }
 
   sf::Vector3i ParseVector3i(const std::string theValue, const sf::Vector3i theDefault)
+  {
+    return ParseVector3i(theValue.data(), theValue.length(), theDefault);
+  }
+
+  sf::Vector3i ParseVector3i(const char* theValue, const size_t theLength,
+      const sf::Vector3i theDefault)
   {
     sf::Vector3i anResult = theDefault;
 
-    // Try to find the first comma
-    size_t anComma1Offset = theValue.find_first_of(',', 0);
-    if(anComma1Offset != std::string::npos)
+    // Try to find both commas
+    size_t anComma1Offset = FindComma(theValue, theLength, 0);
+    size_t anComma2Offset = FindComma(theValue, theLength, anComma1Offset+1);
+    if(anComma2Offset < theLength)
     {
-      Int32 anX = ParseInt32(theValue.substr(0, anComma1Offset), theDefault.x);
-
-      // Try to find the next comma
-      size_t anComma2Offset = theValue.find_first_of(',',anComma1Offset+1);
-      if(anComma2Offset != std::string::npos)
-      {
-        Int32 anY = ParseInt32(theValue.substr(anComma1Offset+1, anComma2Offset), theDefault.y);
-        Int32 anZ = ParseInt32(theValue.substr(anComma2Offset+1), theDefault.z);
-        
-        // Now that all 3 values have been parsed, return the Vector3f found
-        anResult.x = anX;
-        anResult.y = anY;
-        anResult.z = anZ;
-      }
+      // Now that all 3 values have been found, return the Vector3i parsed
+      anResult.x = ParseInt32(theValue, anComma1Offset, theDefault.x);
+      anResult.y = ParseInt32(theValue + anComma1Offset + 1,
+        anComma2Offset - anComma1Offset - 1, theDefault.y);
+      anResult.z = ParseInt32(theValue + anComma2Offset + 1,
+        theLength - anComma2Offset - 1, theDefault.z);
     }
 
     // Return the result found or theDefault assigned above
@@ -8,6 +8,8 @@
  * @date 20110906 - Moved Util.hpp from Entities to here
  * @date 20120720 - Added several new Convert and Parse functions
  * @date 20120904 - Fix SFML v1.6 issues with Vector2u
+ * @date 20130810 - Added ParseSeverity
+ * @date 20130814 - Added allocation free buffer Convert and Parse overloads
  */
 #ifndef   CORE_STRING_UTIL_HPP_INCLUDED
 #define   CORE_STRING_UTIL_HPP_INCLUDED
@@ -26,6 +28,9 @@ namespace sf
 
 namespace GQE
 {
+  /// Size of a buffer large enough for the result of any buffer Convert method
+  const size_t CONVERT_BUFFER_SIZE = 64;
+
   ///////////////////////////////////////////////////////////////////////////
   // String Manipulation Methods
   ///////////////////////////////////////////////////////////////////////////
@@ -36,6 +41,17 @@ namespace GQE
    */
   std::string GQE_API ConvertBool(const bool theBoolean);
 
+  /**
+   * ConvertBool will convert the boolean value provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theBoolean to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertBool(const bool theBoolean, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertColor will convert theColor value provided into a string.
    * @param[in] theVector to convert to a string.
@@ -43,6 +59,17 @@ namespace GQE
    */
   std::string GQE_API ConvertColor(const sf::Color theVector);
 
+  /**
+   * ConvertColor will convert theColor value provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theVector to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertColor(const sf::Color theVector, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertDouble will convert the double value provided into a string.
    * @param[in] theFloat to convert to a string.
@@ -50,6 +77,17 @@ namespace GQE
    */
   std::string GQE_API ConvertDouble(const double theFloat);
 
+  /**
+   * ConvertDouble will convert the double value provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theFloat to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertDouble(const double theFloat, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertFloat will convert the float value provided into a string.
    * @param[in] theFloat to convert to a string.
@@ -57,6 +95,17 @@ namespace GQE
    */
   std::string GQE_API ConvertFloat(const float theFloat);
 
+  /**
+   * ConvertFloat will convert the float value provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theFloat to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertFloat(const float theFloat, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertInt8 will convert the 8 bit signed integer provided into a
    * string.
@@ -65,6 +114,17 @@ namespace GQE
    */
   std::string GQE_API ConvertInt8(const Int8 theNumber);
 
+  /**
+   * ConvertInt8 will convert the 8 bit signed integer provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theNumber to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertInt8(const Int8 theNumber, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertInt16 will convert the 16 bit signed integer provided into a
    * string.
@@ -73,6 +133,17 @@ namespace GQE
    */
   std::string GQE_API ConvertInt16(const Int16 theNumber);
 
+  /**
+   * ConvertInt16 will convert the 16 bit signed integer provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theNumber to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertInt16(const Int16 theNumber, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertInt32 will convert the 32 bit signed integer provided into a
    * string.
@@ -81,6 +152,17 @@ namespace GQE
    */
   std::string GQE_API ConvertInt32(const Int32 theNumber);
 
+  /**
+   * ConvertInt32 will convert the 32 bit signed integer provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theNumber to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertInt32(const Int32 theNumber, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertInt64 will convert the 64 bit signed integer provided into a
    * string.
@@ -89,6 +171,17 @@ namespace GQE
    */
   std::string GQE_API ConvertInt64(const Int64 theNumber);
 
+  /**
+   * ConvertInt64 will convert the 64 bit signed integer provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theNumber to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertInt64(const Int64 theNumber, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertIntRect will convert the sf::IntRect value provided into a string.
    * @param[in] theRect to convert to a string.
@@ -96,6 +189,17 @@ namespace GQE
    */
   std::string GQE_API ConvertIntRect(const sf::IntRect theRect);
 
+  /**
+   * ConvertIntRect will convert the sf::IntRect value provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theRect to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertIntRect(const sf::IntRect theRect, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertUint8 will convert the 8 bit unsigned integer provided into a
    * string.
@@ -104,6 +208,17 @@ namespace GQE
    */
   std::string GQE_API ConvertUint8(const Uint8 theNumber);
 
+  /**
+   * ConvertUint8 will convert the 8 bit unsigned integer provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theNumber to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertUint8(const Uint8 theNumber, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertUint16 will convert the 16 bit unsigned integer provided into a
    * string.
@@ -112,6 +227,17 @@ namespace GQE
    */
   std::string GQE_API ConvertUint16(const Uint16 theNumber);
 
+  /**
+   * ConvertUint16 will convert the 16 bit unsigned integer provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theNumber to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertUint16(const Uint16 theNumber, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertUint32 will convert the 32 bit unsigned integer provided into a
    * string.
@@ -120,6 +246,17 @@ namespace GQE
    */
   std::string GQE_API ConvertUint32(const Uint32 theNumber);
 
+  /**
+   * ConvertUint32 will convert the 32 bit unsigned integer provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theNumber to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertUint32(const Uint32 theNumber, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertUint64 will convert the 64 bit unsigned integer provided into a
    * string.
@@ -128,6 +265,17 @@ namespace GQE
    */
   std::string GQE_API ConvertUint64(const Uint64 theNumber);
 
+  /**
+   * ConvertUint64 will convert the 64 bit unsigned integer provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theNumber to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertUint64(const Uint64 theNumber, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertVector2f will convert theVector value provided into a string.
    * @param[in] theVector to convert to a string.
@@ -135,6 +283,17 @@ namespace GQE
    */
   std::string GQE_API ConvertVector2f(const sf::Vector2f theVector);
 
+  /**
+   * ConvertVector2f will convert theVector value provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theVector to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertVector2f(const sf::Vector2f theVector, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertVector2i will convert theVector value provided into a string.
    * @param[in] theVector to convert to a string.
@@ -142,6 +301,17 @@ namespace GQE
    */
   std::string GQE_API ConvertVector2i(const sf::Vector2i theVector);
 
+  /**
+   * ConvertVector2i will convert theVector value provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theVector to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertVector2i(const sf::Vector2i theVector, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertVector2u will convert theVector value provided into a string.
    * @param[in] theVector to convert to a string.
@@ -149,6 +319,17 @@ namespace GQE
    */
   std::string GQE_API ConvertVector2u(const sf::Vector2u theVector);
 
+  /**
+   * ConvertVector2u will convert theVector value provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theVector to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertVector2u(const sf::Vector2u theVector, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertVector3f will convert theVector value provided into a string.
    * @param[in] theVector to convert to a string.
@@ -156,6 +337,17 @@ namespace GQE
    */
   std::string GQE_API ConvertVector3f(const sf::Vector3f theVector);
 
+  /**
+   * ConvertVector3f will convert theVector value provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theVector to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertVector3f(const sf::Vector3f theVector, char* theBuffer, const size_t theSize);
+
   /**
    * ConvertVector3i will convert theVector value provided into a string.
    * @param[in] theVector to convert to a string.
@@ -163,6 +355,17 @@ namespace GQE
    */
   std::string GQE_API ConvertVector3i(const sf::Vector3i theVector);
 
+  /**
+   * ConvertVector3i will convert theVector value provided into theBuffer
+   * provided without allocating any memory.
+   * @param[in] theVector to convert
+   * @param[out] theBuffer to write the null terminated result to
+   * @param[in] theSize of theBuffer in characters
+   * @return the number of characters written (not counting the null
+   *   terminator) or 0 if theBuffer is too small
+   */
+  size_t GQE_API ConvertVector3i(const sf::Vector3i theVector, char* theBuffer, const size_t theSize);
+
   ///////////////////////////////////////////////////////////////////////////
   // String Parse Methods
   ///////////////////////////////////////////////////////////////////////////
@@ -176,6 +379,17 @@ namespace GQE
    */
   bool GQE_API ParseBool(std::string theValue, const bool theDefault);
 
+  /**
+   * ParseBool will parse theLength characters of theValue provided to
+   * obtain the boolean value (true, false, 1, 0, on or off) without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  bool GQE_API ParseBool(const char* theValue, const size_t theLength,
+      const bool theDefault);
+
   /**
    * ParseColor will parse theValue string to obtain the R,G,B,A color values
    * to produce an sf::Color object for the GetColor method above.
@@ -185,6 +399,17 @@ namespace GQE
    */
   sf::Color GQE_API ParseColor(const std::string theValue, const sf::Color theDefault);
 
+  /**
+   * ParseColor will parse theLength characters of theValue provided to
+   * obtain the R,G,B,A color values without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  sf::Color GQE_API ParseColor(const char* theValue, const size_t theLength,
+      const sf::Color theDefault);
+
   /**
    * ParseDouble will parse theValue string to obtain the double value to
    * return or return theDefault instead.
@@ -194,6 +419,17 @@ namespace GQE
    */
   double GQE_API ParseDouble(const std::string theValue, const double theDefault);
 
+  /**
+   * ParseDouble will parse theLength characters of theValue provided to
+   * obtain the double value without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  double GQE_API ParseDouble(const char* theValue, const size_t theLength,
+      const double theDefault);
+
   /**
    * ParseFloat will parse theValue string to obtain the float value to
    * return or return theDefault instead.
@@ -203,6 +439,17 @@ namespace GQE
    */
   float GQE_API ParseFloat(const std::string theValue, const float theDefault);
 
+  /**
+   * ParseFloat will parse theLength characters of theValue provided to
+   * obtain the float value without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  float GQE_API ParseFloat(const char* theValue, const size_t theLength,
+      const float theDefault);
+
   /**
    * ParseInt8 will parse theValue string to obtain a signed 8 bit value.
    * If the parser fails, then it will return theDefault instead.
@@ -212,6 +459,17 @@ namespace GQE
    */
   Int8 GQE_API ParseInt8(const std::string theValue, const Int8 theDefault);
 
+  /**
+   * ParseInt8 will parse theLength characters of theValue provided to
+   * obtain a signed 8 bit value without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  Int8 GQE_API ParseInt8(const char* theValue, const size_t theLength,
+      const Int8 theDefault);
+
   /**
    * ParseInt16 will parse theValue string to obtain a signed 16 bit value.
    * If the parser fails, then it will return theDefault instead.
@@ -221,6 +479,17 @@ namespace GQE
    */
   Int16 GQE_API ParseInt16(const std::string theValue, const Int16 theDefault);
 
+  /**
+   * ParseInt16 will parse theLength characters of theValue provided to
+   * obtain a signed 16 bit value without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  Int16 GQE_API ParseInt16(const char* theValue, const size_t theLength,
+      const Int16 theDefault);
+
   /**
    * ParseInt32 will parse theValue string to obtain a signed 32 bit value.
    * If the parser fails, then it will return theDefault instead.
@@ -230,6 +499,17 @@ namespace GQE
    */
   Int32 GQE_API ParseInt32(const std::string theValue, const Int32 theDefault);
 
+  /**
+   * ParseInt32 will parse theLength characters of theValue provided to
+   * obtain a signed 32 bit value without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  Int32 GQE_API ParseInt32(const char* theValue, const size_t theLength,
+      const Int32 theDefault);
+
   /**
    * ParseInt64 will parse theValue string to obtain a signed 64 bit value.
    * If the parser fails, then it will return theDefault instead.
@@ -239,6 +519,17 @@ namespace GQE
    */
   Int64 GQE_API ParseInt64(const std::string theValue, const Int64 theDefault);
 
+  /**
+   * ParseInt64 will parse theLength characters of theValue provided to
+   * obtain a signed 64 bit value without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  Int64 GQE_API ParseInt64(const char* theValue, const size_t theLength,
+      const Int64 theDefault);
+
   /**
    * ParseIntRect will parse theValue string to obtain a sf::IntRect value.
    * If the parser fails, then it will return theDefault instead.
@@ -248,6 +539,27 @@ namespace GQE
    */
   sf::IntRect GQE_API ParseIntRect(const std::string theValue, const sf::IntRect theDefault);
 
+  /**
+   * ParseIntRect will parse theLength characters of theValue provided to
+   * obtain a sf::IntRect value without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  sf::IntRect GQE_API ParseIntRect(const char* theValue, const size_t theLength,
+      const sf::IntRect theDefault);
+
+  /**
+   * ParseSeverity will parse theValue string (info, warning, error, fatal or
+   * the matching 0 to 3 value) to obtain a SeverityType value. If the parser
+   * fails, then it will return theDefault instead.
+   * @param[in] theValue to parse for the SeverityType value
+   * @param[in] theDefault SeverityType value to use if the parser fails
+   * @return the SeverityType value obtained
+   */
+  SeverityType GQE_API ParseSeverity(std::string theValue, const SeverityType theDefault);
+
   /**
    * ParseUint8 will parse theValue string to obtain a signed 8 bit value.
    * If the parser fails, then it will return theDefault instead.
@@ -257,6 +569,17 @@ namespace GQE
    */
   Uint8 GQE_API ParseUint8(const std::string theValue, const Uint8 theDefault);
 
+  /**
+   * ParseUint8 will parse theLength characters of theValue provided to
+   * obtain an unsigned 8 bit value without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  Uint8 GQE_API ParseUint8(const char* theValue, const size_t theLength,
+      const Uint8 theDefault);
+
   /**
    * ParseUint16 will parse theValue string to obtain an unsigned 16 bit
    * value.  If the parser fails, then it will return theDefault instead.
@@ -266,6 +589,17 @@ namespace GQE
    */
   Uint16 GQE_API ParseUint16(const std::string theValue, const Uint16 theDefault);
 
+  /**
+   * ParseUint16 will parse theLength characters of theValue provided to
+   * obtain an unsigned 16 bit value without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  Uint16 GQE_API ParseUint16(const char* theValue, const size_t theLength,
+      const Uint16 theDefault);
+
   /**
    * ParseUint32 will parse theValue string to obtain an unsigned 32 bit
    * value.  If the parser fails, then it will return theDefault instead.
@@ -275,6 +609,17 @@ namespace GQE
    */
   Uint32 GQE_API ParseUint32(const std::string theValue, const Uint32 theDefault);
 
+  /**
+   * ParseUint32 will parse theLength characters of theValue provided to
+   * obtain an unsigned 32 bit value without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  Uint32 GQE_API ParseUint32(const char* theValue, const size_t theLength,
+      const Uint32 theDefault);
+
   /**
    * ParseUint64 will parse theValue string to obtain an unsigned 64 bit
    * value.  If the parser fails, then it will return theDefault instead.
@@ -284,6 +629,17 @@ namespace GQE
    */
   Uint64 GQE_API ParseUint64(const std::string theValue, const Uint64 theDefault);
 
+  /**
+   * ParseUint64 will parse theLength characters of theValue provided to
+   * obtain an unsigned 64 bit value without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  Uint64 GQE_API ParseUint64(const char* theValue, const size_t theLength,
+      const Uint64 theDefault);
+
   /**
    * ParseVector2f will parse theValue string to obtain the X,Y vector values
    * to produce an sf::Vector2f object.
@@ -293,6 +649,17 @@ namespace GQE
    */
   sf::Vector2f GQE_API ParseVector2f(const std::string theValue, const sf::Vector2f theDefault);
 
+  /**
+   * ParseVector2f will parse theLength characters of theValue provided to
+   * obtain the X,Y vector values without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  sf::Vector2f GQE_API ParseVector2f(const char* theValue, const size_t theLength,
+      const sf::Vector2f theDefault);
+
   /**
    * ParseVector2i will parse theValue string to obtain the X,Y vector values
    * to produce an sf::Vector2i object.
@@ -302,6 +669,17 @@ namespace GQE
    */
   sf::Vector2i GQE_API ParseVector2i(const std::string theValue, const sf::Vector2i theDefault);
 
+  /**
+   * ParseVector2i will parse theLength characters of theValue provided to
+   * obtain the X,Y vector values without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  sf::Vector2i GQE_API ParseVector2i(const char* theValue, const size_t theLength,
+      const sf::Vector2i theDefault);
+
   /**
    * ParseVector2u will parse theValue string to obtain the X,Y vector values
    * to produce an sf::Vector2u object.
@@ -311,6 +689,17 @@ namespace GQE
    */
   sf::Vector2u GQE_API ParseVector2u(const std::string theValue, const sf::Vector2u theDefault);
 
+  /**
+   * ParseVector2u will parse theLength characters of theValue provided to
+   * obtain the X,Y vector values without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  sf::Vector2u GQE_API ParseVector2u(const char* theValue, const size_t theLength,
+      const sf::Vector2u theDefault);
+
   /**
    * ParseVector3f will parse theValue string to obtain the X,Y,Z vector values
    * to produce an sf::Vector3f object.
@@ -320,6 +709,17 @@ namespace GQE
    */
   sf::Vector3f GQE_API ParseVector3f(const std::string theValue, const sf::Vector3f theDefault);
 
+  /**
+   * ParseVector3f will parse theLength characters of theValue provided to
+   * obtain the X,Y,Z vector values without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  sf::Vector3f GQE_API ParseVector3f(const char* theValue, const size_t theLength,
+      const sf::Vector3f theDefault);
+
   /**
    * ParseVector3i will parse theValue string to obtain the X,Y,Z vector values
    * to produce an sf::Vector3i object.
@@ -329,6 +729,17 @@ namespace GQE
    */
   sf::Vector3i GQE_API ParseVector3i(const std::string theValue, const sf::Vector3i theDefault);
 
+  /**
+   * ParseVector3i will parse theLength characters of theValue provided to
+   * obtain the X,Y,Z vector values without allocating any memory.
+   * @param[in] theValue characters to parse (need not be null terminated)
+   * @param[in] theLength of theValue in characters
+   * @param[in] theDefault to return if theValue is not valid
+   * @return the value parsed or theDefault if theValue is not valid
+   */
+  sf::Vector3i GQE_API ParseVector3i(const char* theValue, const size_t theLength,
+      const sf::Vector3i theDefault);
+
 } // namespace GQE
 
 #endif // CORE_STRING_UTIL_HPP_INCLUDED
@@ -338,6 +749,16 @@ namespace GQE
  * be used by any class in the GQE namespace.  The ConfigReader class in
  * particular makes frequent use of these methods.
  *
+ * Each Convert and Parse method also has an overload that works directly on
+ * a character buffer instead of a std::string. These overloads never create
+ * a stringstream or temporary strings: integers are parsed and formatted by
+ * hand, floating point numbers use a decimal fast path (falling back to
+ * strtod for long mantissas or large exponents) and are formatted with the
+ * same "%g" style as a stream. The std::string signatures are wrappers
+ * around these overloads. Unlike the previous stream implementation the 8
+ * bit integer methods (and so ParseColor and ConvertColor) treat values as
+ * numbers instead of single characters.
+ *
  * Copyright (c) 2010-2011 Ryan Lindeman
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -0,0 +1,94 @@
+/**
+ * Provides the TextureCache class in the GQE namespace which is responsible
+ * for keeping a directory of images already decoded into RGBA pixels so
+ * they can be mapped and uploaded without decoding the image file again.
+ *
+ * @file src/GQE/Core/utils/TextureCache.cpp
+ * @author Ryan Lindeman
+ * @date 20130820 - Initial Release
+ * @date 20130821 - Moved the cached file handling into DecodeCache
+ */
+
+#include <TVSource/Utils/TextureCache.hpp>
+
+namespace GQE
+{
+  const char* const TextureCache::CACHE_MAGIC = "GQERGBA1";
+  const char* const TextureCache::CACHE_EXTENSION = ".rgba";
+
+  TextureCache::TextureCache() :
+    DecodeCache(CACHE_MAGIC, CACHE_EXTENSION)
+  {
+  }
+
+  TextureCache::~TextureCache()
+  {
+  }
+
+  bool TextureCache::Find(const std::string& theFilename, const char* theSource,
+    size_t theSourceSize, MappedFile& theFile, const Uint8*& thePixels,
+    Uint32& theWidth, Uint32& theHeight) const
+  {
+    const typeCacheHeader* anHeader = NULL;
+    bool anResult = FindData(theFilename, theSource, theSourceSize, theFile, anHeader);
+
+    // Make sure the cached image holds every pixel of its dimensions
+    if(anResult)
+    {
+      anResult = anHeader->format[0] > 0 && anHeader->format[1] > 0 &&
+        (Uint64)anHeader->format[0] * anHeader->format[1] * 4 == anHeader->size;
+    }
+
+    if(anResult)
+    {
+      thePixels = (const Uint8*)theFile.GetData() + anHeader->offset;
+      theWidth = anHeader->format[0];
+      theHeight = anHeader->format[1];
+    }
+    else
+    {
+      theFile.Close();
+    }
+
+    // Return anResult of true if an up to date cached image was found
+    return anResult;
+  }
+
+  bool TextureCache::Store(const std::string& theFilename, const char* theSource,
+    size_t theSourceSize, Uint32 theWidth, Uint32 theHeight,
+    const Uint8* thePixels) const
+  {
+    bool anResult = false;
+
+    if(theWidth > 0 && theHeight > 0)
+    {
+      const Uint32 anFormat[CACHE_FORMAT_LENGTH] = {theWidth, theHeight, 0, 0};
+      anResult = StoreData(theFilename, theSource, theSourceSize, anFormat,
+        thePixels, (Uint64)theWidth * theHeight * 4);
+    }
+
+    // Return anResult of true if successful, false otherwise
+    return anResult;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,119 @@
+/**
+ * Provides the TextureCache class in the GQE namespace which is responsible
+ * for keeping a directory of images already decoded into RGBA pixels so
+ * they can be mapped and uploaded without decoding the image file again.
+ *
+ * @file include/GQE/Core/utils/TextureCache.hpp
+ * @author Ryan Lindeman
+ * @date 20130820 - Initial Release
+ * @date 20130821 - Moved the cached file handling into DecodeCache
+ */
+#ifndef   CORE_TEXTURE_CACHE_HPP_INCLUDED
+#define   CORE_TEXTURE_CACHE_HPP_INCLUDED
+
+#include <string>
+#include <TVSource/Core/Core_types.hpp>
+#include <TVSource/Utils/DecodeCache.hpp>
+
+namespace GQE
+{
+  /// Provides a directory of images decoded into RGBA pixels
+  class GQE_API TextureCache : public DecodeCache
+  {
+    public:
+      // Constants
+      ///////////////////////////////////////////////////////////////////////////
+      /// Text found at the start of every cached image
+      static const char* const CACHE_MAGIC;
+      /// Extension of each cached image filename
+      static const char* const CACHE_EXTENSION;
+
+      /**
+       * TextureCache constructor
+       */
+      TextureCache();
+
+      /**
+       * TextureCache deconstructor
+       */
+      virtual ~TextureCache();
+
+      /**
+       * Find will map the cached image of theFilename provided into theFile
+       * provided if it was decoded from exactly theSource provided, so stale
+       * cached images are never used once the image file changes.
+       * @param[in] theFilename of the image file (see AssetPack::NormalizeFilename)
+       * @param[in] theSource contents of the image file
+       * @param[in] theSourceSize of the image file in bytes
+       * @param[out] theFile to map the cached image into
+       * @param[out] thePixels RGBA pixels found within theFile
+       * @param[out] theWidth of the cached image in pixels
+       * @param[out] theHeight of the cached image in pixels
+       * @return true if an up to date cached image was found
+       */
+      bool Find(const std::string& theFilename, const char* theSource,
+        size_t theSourceSize, MappedFile& theFile, const Uint8*& thePixels,
+        Uint32& theWidth, Uint32& theHeight) const;
+
+      /**
+       * Store will write thePixels provided as the cached image of
+       * theFilename provided, replacing any stale cached image.
+       * @param[in] theFilename of the image file (see AssetPack::NormalizeFilename)
+       * @param[in] theSource contents of the image file
+       * @param[in] theSourceSize of the image file in bytes
+       * @param[in] theWidth of the image in pixels
+       * @param[in] theHeight of the image in pixels
+       * @param[in] thePixels RGBA pixels decoded from theSource
+       * @return true if the cached image was written successfully
+       */
+      bool Store(const std::string& theFilename, const char* theSource,
+        size_t theSourceSize, Uint32 theWidth, Uint32 theHeight,
+        const Uint8* thePixels) const;
+
+    private:
+      /**
+       * TextureCache copy constructor is private because we do not allow
+       * copies of our class
+       */
+      TextureCache(const TextureCache&); // Intentionally undefined
+
+      /**
+       * Our assignment operator is private because we do not allow copies
+       * of our class
+       */
+      TextureCache& operator=(const TextureCache&); // Intentionally undefined
+  }; // class TextureCache
+} // namespace GQE
+
+#endif // CORE_TEXTURE_CACHE_HPP_INCLUDED
+
+/**
+ * @class GQE::TextureCache
+ * @ingroup Core
+ * The TextureCache class keeps one file for each image decoded by the
+ * ImageHandler in a cache directory (see DecodeCache). Each cached image
+ * holds its dimensions followed by its RGBA pixels so they can be uploaded
+ * straight from the mapping. Cached images are
+ * written the first time an image is decoded or ahead of time by the
+ * bake-textures command of the Time-Voyager-Tools application, and are
+ * rewritten whenever the image file changes.
+ *
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
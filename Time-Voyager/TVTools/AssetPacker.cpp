@@ -0,0 +1,150 @@
+/**
+ * Provides the pack-assets command of the Time-Voyager-Tools console
+ * application which stores asset files into a single asset pack.
+ *
+ * @file src/GQE/Tools/AssetPacker.cpp
+ * @author Ryan Lindeman
+ * @date 20130816 - Initial Release
+ * @date 20130820 - Share AddFiles with the bake-textures command
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <TVTools/ToolCommands.hpp>
+#include <TVSource/Utils/AssetPack.hpp>
+#if defined(GQE_WINDOWS)
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+
+namespace GQE
+{
+  bool AddFiles(const std::string& theFilename, std::vector<std::string>& theFiles)
+  {
+    bool anResult = false;
+
+    struct stat anStat;
+    if(0 == stat(theFilename.c_str(), &anStat))
+    {
+      anResult = true;
+      if(0 == (anStat.st_mode & S_IFDIR))
+      {
+        theFiles.push_back(theFilename);
+      }
+      else
+      {
+        // Visit each entry of the directory except . and ..
+#if defined(GQE_WINDOWS)
+        WIN32_FIND_DATAA anEntry;
+        HANDLE anFind = FindFirstFileA((theFilename + "\\*").c_str(), &anEntry);
+        if(INVALID_HANDLE_VALUE != anFind)
+        {
+          do
+          {
+            std::string anName = anEntry.cFileName;
+            if(anName != "." && anName != "..")
+            {
+              anResult &= AddFiles(theFilename + "/" + anName, theFiles);
+            }
+          } while(FindNextFileA(anFind, &anEntry));
+          FindClose(anFind);
+        }
+#else
+        DIR* anDirectory = opendir(theFilename.c_str());
+        if(NULL != anDirectory)
+        {
+          struct dirent* anEntry = NULL;
+          while(NULL != (anEntry = readdir(anDirectory)))
+          {
+            std::string anName = anEntry->d_name;
+            if(anName != "." && anName != "..")
+            {
+              anResult &= AddFiles(theFilename + "/" + anName, theFiles);
+            }
+          }
+          closedir(anDirectory);
+        }
+#endif
+      }
+    }
+
+    // Return anResult of true if theFilename was found, false otherwise
+    return anResult;
+  }
+
+  int PackAssets(int argc, char* argv[])
+  {
+    // Default anExitCode to a specific value
+    int anExitCode = StatusNoError;
+
+    if(argc < 2)
+    {
+      std::cerr << "usage: Time-Voyager-Tools pack-assets <output> <input> [input...]" << std::endl;
+      anExitCode = StatusError;
+    }
+    else
+    {
+      // Collect every file of each input file or directory
+      std::vector<std::string> anFiles;
+      for(int iloop = 1; iloop < argc; iloop++)
+      {
+        if(!AddFiles(argv[iloop], anFiles))
+        {
+          std::cerr << "PackAssets() unable to find " << argv[iloop] << std::endl;
+          anExitCode = StatusError;
+        }
+      }
+
+      // Never store the asset pack inside itself
+      std::string anOutput = AssetPack::NormalizeFilename(argv[0]);
+      for(size_t iloop = 0; iloop < anFiles.size(); iloop++)
+      {
+        if(AssetPack::NormalizeFilename(anFiles[iloop]) == anOutput)
+        {
+          anFiles.erase(anFiles.begin() + iloop--);
+        }
+      }
+
+      if(StatusNoError == anExitCode)
+      {
+        if(AssetPack::Build(argv[0], anFiles))
+        {
+          std::cout << anFiles.size() << " files -> " << argv[0] << std::endl;
+        }
+        else
+        {
+          std::cerr << "PackAssets() unable to create " << argv[0] << std::endl;
+          anExitCode = StatusError;
+        }
+      }
+    }
+
+    // Return anExitCode determined above
+    return anExitCode;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
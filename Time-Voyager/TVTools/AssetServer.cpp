@@ -0,0 +1,295 @@
+/**
+ * Provides the serve-assets command of the Time-Voyager-Tools console
+ * application which serves asset files to the NetworkSource class over
+ * keep-alive HTTP connections.
+ *
+ * @file src/GQE/Tools/AssetServer.cpp
+ * @author Ryan Lindeman
+ * @date 20130824 - Initial Release
+ * @date 20130826 - Refuse connections from other computers
+ */
+
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <TVTools/ToolCommands.hpp>
+#include <TVSource/Utils/DecodeCache.hpp>
+#include <TVSource/Utils/NetworkSource.hpp>
+
+namespace GQE
+{
+  /// Provides the state of each connection accepted by ServeAssets
+  struct typeAssetClient
+  {
+    sf::TcpSocket* socket; ///< The socket connected to the client
+    std::string buffer;    ///< Bytes received but not yet parsed
+  };
+
+  /**
+   * DecodePath will return thePath of a request with each %XX escape
+   * decoded, or an empty string if thePath would leave the asset root.
+   * @param[in] thePath of the request without the leading /
+   * @return the relative filename requested
+   */
+  static std::string DecodePath(const std::string& thePath)
+  {
+    std::string anResult;
+
+    for(size_t iloop = 0; iloop < thePath.length(); iloop++)
+    {
+      if('%' == thePath[iloop] && iloop + 2 < thePath.length() &&
+        isxdigit((unsigned char)thePath[iloop + 1]) &&
+        isxdigit((unsigned char)thePath[iloop + 2]))
+      {
+        anResult += (char)strtol(thePath.substr(iloop + 1, 2).c_str(), NULL, 16);
+        iloop += 2;
+      }
+      else
+      {
+        anResult += thePath[iloop];
+      }
+    }
+
+    // Never serve a file outside of the asset root
+    if(std::string::npos != anResult.find("..") || std::string::npos != anResult.find(':') ||
+      (!anResult.empty() && ('/' == anResult[0] || '\\' == anResult[0])))
+    {
+      anResult.clear();
+    }
+
+    // Return anResult determined above
+    return anResult;
+  }
+
+  /**
+   * AnswerRequest will append the response to theRequest provided to
+   * theResponse using the files found in theRoot directory.
+   * @param[in] theRoot directory the asset files are served from
+   * @param[in] theRequest line and headers received from the client
+   * @param[out] theResponse to append the response to
+   * @return true if the connection should be kept alive, false otherwise
+   */
+  static bool AnswerRequest(const std::string& theRoot, const std::string& theRequest,
+    std::string& theResponse)
+  {
+    std::istringstream anLines(theRequest);
+    std::string anMethod;
+    std::string anPath;
+    std::string anVersion;
+    std::string anLine;
+    anLines >> anMethod >> anPath >> anVersion;
+    std::getline(anLines, anLine);
+
+    // HTTP/1.1 connections are kept alive unless the client asks otherwise
+    bool anResult = ("HTTP/1.1" == anVersion);
+    std::string anIfNoneMatch;
+    std::string anName;
+    std::string anValue;
+    while(std::getline(anLines, anLine))
+    {
+      if(NetworkSource::ParseHeader(anLine, anName, anValue))
+      {
+        if("if-none-match" == anName)
+        {
+          anIfNoneMatch = anValue;
+        }
+        else if("connection" == anName)
+        {
+          anResult = (std::string::npos == anValue.find("close"));
+        }
+      }
+    }
+
+    // Read the file requested
+    std::string anFilename;
+    std::string anBody;
+    bool anFound = false;
+    if("GET" == anMethod && 1 < anPath.length() && '/' == anPath[0])
+    {
+      anFilename = DecodePath(anPath.substr(1));
+      if(!anFilename.empty())
+      {
+        std::ifstream anFile((theRoot + "/" + anFilename).c_str(),
+          std::ios::in | std::ios::binary);
+        if(anFile.is_open())
+        {
+          std::ostringstream anContents;
+          anContents << anFile.rdbuf();
+          anBody = anContents.str();
+          anFound = !anFile.bad();
+        }
+      }
+    }
+
+    Uint32 anStatus = 404;
+    std::string anETag;
+    if(anFound)
+    {
+      // The ETag changes whenever the contents of the file change
+      std::ostringstream anHash;
+      anHash << "\"" << std::hex << std::setfill('0') << std::setw(8)
+        << DecodeCache::HashSource(anBody.data(), anBody.length()) << "\"";
+      anETag = anHash.str();
+
+      // The client already has this version? then skip sending it again
+      anStatus = (anIfNoneMatch == anETag) ? 304 : 200;
+    }
+    if(200 != anStatus)
+    {
+      anBody.clear();
+    }
+
+    std::ostringstream anHeaders;
+    anHeaders << "HTTP/1.1 " << anStatus << (200 == anStatus ? " OK" :
+      (304 == anStatus ? " Not Modified" : " Not Found")) << "\r\n";
+    if(!anETag.empty())
+    {
+      anHeaders << "ETag: " << anETag << "\r\n";
+    }
+    anHeaders << "Content-Length: " << anBody.length() << "\r\n";
+    anHeaders << "Connection: " << (anResult ? "keep-alive" : "close") << "\r\n\r\n";
+    theResponse += anHeaders.str();
+    theResponse += anBody;
+
+    std::cout << anStatus << " " << anPath << " (" << anBody.length() << " bytes)"
+      << std::endl;
+
+    // Return anResult of true if the connection should be kept alive
+    return anResult;
+  }
+
+  int ServeAssets(int argc, char* argv[])
+  {
+    // Default anExitCode to a specific value
+    int anExitCode = StatusNoError;
+
+    unsigned short anPort = NetworkSource::DEFAULT_PORT;
+    if(argc > 1)
+    {
+      anPort = (unsigned short)atoi(argv[1]);
+    }
+
+    sf::TcpListener anListener;
+    if(argc < 1 || argc > 2)
+    {
+      std::cerr << "usage: Time-Voyager-Tools serve-assets <root> [port]" << std::endl;
+      anExitCode = StatusError;
+    }
+    else if(sf::Socket::Done != anListener.listen(anPort))
+    {
+      std::cerr << "ServeAssets() unable to listen on port " << anPort << std::endl;
+      anExitCode = StatusError;
+    }
+    else
+    {
+      // SFML can only listen on every interface, so each connection from
+      // another computer is refused as it is accepted below
+      std::cout << "Serving " << argv[0] << " on port " << anPort
+        << " to this computer only" << std::endl;
+    }
+
+    // Wait on the listener and every client at once so a single thread can
+    // answer many keep-alive connections
+    sf::SocketSelector anSelector;
+    std::vector<typeAssetClient> anClients;
+    anSelector.add(anListener);
+    while(StatusNoError == anExitCode)
+    {
+      if(anSelector.wait())
+      {
+        // Accept each new connection
+        if(anSelector.isReady(anListener))
+        {
+          typeAssetClient anClient;
+          anClient.socket = new(std::nothrow) sf::TcpSocket;
+          if(NULL != anClient.socket &&
+            sf::Socket::Done == anListener.accept(*anClient.socket) &&
+            127 == (anClient.socket->getRemoteAddress().toInteger() >> 24))
+          {
+            anSelector.add(*anClient.socket);
+            anClients.push_back(anClient);
+          }
+          else
+          {
+            if(NULL != anClient.socket &&
+              sf::IpAddress::None != anClient.socket->getRemoteAddress())
+            {
+              std::cerr << "ServeAssets() refused connection from "
+                << anClient.socket->getRemoteAddress() << std::endl;
+            }
+            delete anClient.socket;
+          }
+        }
+
+        // Answer every complete request received from each client
+        for(size_t iloop = 0; iloop < anClients.size(); iloop++)
+        {
+          typeAssetClient& anClient = anClients[iloop];
+          bool anKeepAlive = true;
+          if(anSelector.isReady(*anClient.socket))
+          {
+            char anBuffer[NetworkSource::RECEIVE_SIZE];
+            size_t anReceived = 0;
+            anKeepAlive = (sf::Socket::Done == anClient.socket->receive(anBuffer,
+              sizeof(anBuffer), anReceived));
+            anClient.buffer.append(anBuffer, anReceived);
+
+            // Pipelined requests are answered in order with a single send
+            std::string anResponse;
+            size_t anEnd = anClient.buffer.find("\r\n\r\n");
+            while(anKeepAlive && std::string::npos != anEnd)
+            {
+              anKeepAlive = AnswerRequest(argv[0], anClient.buffer.substr(0, anEnd),
+                anResponse);
+              anClient.buffer.erase(0, anEnd + 4);
+              anEnd = anClient.buffer.find("\r\n\r\n");
+            }
+            if(!anResponse.empty())
+            {
+              anClient.socket->send(anResponse.data(), anResponse.length());
+            }
+          }
+
+          // Close the connection once the client is done with it
+          if(!anKeepAlive)
+          {
+            anSelector.remove(*anClient.socket);
+            anClient.socket->disconnect();
+            delete anClient.socket;
+            anClients.erase(anClients.begin() + iloop--);
+          }
+        }
+      }
+    }
+
+    // Return anExitCode determined above
+    return anExitCode;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
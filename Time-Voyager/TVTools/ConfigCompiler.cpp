@@ -0,0 +1,73 @@
+/**
+ * Provides the compile-config command of the Time-Voyager-Tools console
+ * application which turns configuration files into compiled configuration
+ * files.
+ *
+ * @file src/GQE/Tools/ConfigCompiler.cpp
+ * @author Ryan Lindeman
+ * @date 20130813 - Initial Release
+ */
+
+#include <iostream>
+#include <TVTools/ToolCommands.hpp>
+#include <TVSource/Managers/ConfigReader.hpp>
+
+namespace GQE
+{
+  int CompileConfig(int argc, char* argv[])
+  {
+    // Default anExitCode to a specific value
+    int anExitCode = StatusNoError;
+
+    if(argc < 1)
+    {
+      std::cerr << "usage: Time-Voyager-Tools compile-config <input> [input...]" << std::endl;
+      anExitCode = StatusError;
+    }
+
+    // Compile each configuration file next to itself
+    for(int iloop = 0; iloop < argc; iloop++)
+    {
+      ConfigReader anReader;
+      std::string anCompiled = ConfigReader::GetCompiledFilename(argv[iloop]);
+      if(!anReader.LoadFromFile(argv[iloop]))
+      {
+        std::cerr << "CompileConfig() unable to open " << argv[iloop] << std::endl;
+        anExitCode = StatusError;
+      }
+      else if(!anReader.SaveToCompiled(anCompiled))
+      {
+        std::cerr << "CompileConfig() unable to create " << anCompiled << std::endl;
+        anExitCode = StatusError;
+      }
+      else
+      {
+        std::cout << argv[iloop] << " -> " << anCompiled << std::endl;
+      }
+    }
+
+    // Return anExitCode determined above
+    return anExitCode;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
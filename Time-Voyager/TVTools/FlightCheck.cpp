@@ -0,0 +1,109 @@
+/**
+ * Provides the check-flight-dump command of the Time-Voyager-Tools console
+ * application which makes sure text log messages are kept by the
+ * FlightRecorder and written to its dump.
+ *
+ * @file src/GQE/Tools/FlightCheck.cpp
+ * @author Ryan Lindeman
+ * @date 20130826 - Initial Release
+ */
+
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <TVTools/ToolCommands.hpp>
+#include <TVSource/Loggers/AsyncLogger.hpp>
+#include <TVSource/Loggers/Log_macros.hpp>
+#include <TVSource/Managers/FlightRecorder.hpp>
+
+namespace GQE
+{
+  int CheckFlightDump(int argc, char* argv[])
+  {
+    // Default anExitCode to a specific value
+    int anExitCode = StatusNoError;
+
+    if(argc > 1)
+    {
+      std::cerr << "usage: Time-Voyager-Tools check-flight-dump [dumpfile]" << std::endl;
+      anExitCode = StatusError;
+    }
+    else
+    {
+      std::string anDumpFile = (argc == 1) ? argv[0] : FlightRecorder::DEFAULT_DUMP;
+      std::string anLogFile = anDumpFile + ".log";
+
+      // Make sure an old dump can't be mistaken for the one written below
+      std::remove(anDumpFile.c_str());
+
+      // Find a unique line to look for in the dump
+      std::ostringstream anMarker;
+      anMarker << "CheckFlightDump " << std::time(NULL);
+
+      {
+        // Log through the same logger and flight recorder used by IApp
+        AsyncLogger anLogger(anLogFile.c_str(), true);
+        FlightRecorder anRecorder;
+        anRecorder.SetDumpFile(anDumpFile);
+        anRecorder.SetZones(false);
+        anRecorder.DoInit();
+
+        ILOG() << anMarker.str() << std::endl;
+        anRecorder.HandleHotkey();
+
+        anRecorder.DeInit();
+      }
+
+      // Look for the line logged above in the dump
+      bool anFound = false;
+      std::ifstream anDump(anDumpFile.c_str());
+      std::string anLine;
+      while(!anFound && std::getline(anDump, anLine))
+      {
+        anFound = (anLine.find(anMarker.str()) != std::string::npos);
+      }
+
+      if(!anDump.is_open())
+      {
+        std::cerr << "CheckFlightDump() unable to open " << anDumpFile << std::endl;
+        anExitCode = StatusError;
+      }
+      else if(!anFound)
+      {
+        std::cerr << "CheckFlightDump() ILOG line missing from " << anDumpFile << std::endl;
+        anExitCode = StatusError;
+      }
+      else
+      {
+        std::cout << "ILOG line found in " << anDumpFile << std::endl;
+      }
+    }
+
+    // Return anExitCode determined above
+    return anExitCode;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,82 @@
+/**
+ * Provides the decode-log command of the Time-Voyager-Tools console
+ * application which turns a binary log back into text.
+ *
+ * @file src/GQE/Tools/LogDecoder.cpp
+ * @author Ryan Lindeman
+ * @date 20130810 - Initial Release
+ */
+
+#include <fstream>
+#include <iostream>
+#include <TVTools/ToolCommands.hpp>
+#include <TVSource/Loggers/BinaryLogger.hpp>
+
+namespace GQE
+{
+  int DecodeLog(int argc, char* argv[])
+  {
+    // Default anExitCode to a specific value
+    int anExitCode = StatusNoError;
+
+    if(argc < 1 || argc > 2)
+    {
+      std::cerr << "usage: Time-Voyager-Tools decode-log <input> [output]" << std::endl;
+      anExitCode = StatusError;
+    }
+    else
+    {
+      std::ifstream anInput(argv[0], std::ios::in | std::ios::binary);
+      if(!anInput.is_open())
+      {
+        std::cerr << "DecodeLog() unable to open " << argv[0] << std::endl;
+        anExitCode = StatusError;
+      }
+      else if(argc == 2)
+      {
+        // Write the text log to the output file provided
+        std::ofstream anOutput(argv[1]);
+        if(!anOutput.is_open())
+        {
+          std::cerr << "DecodeLog() unable to create " << argv[1] << std::endl;
+          anExitCode = StatusError;
+        }
+        else if(!BinaryLogger::Decode(anInput, anOutput))
+        {
+          std::cerr << "DecodeLog() " << argv[0] << " is not a valid binary log" << std::endl;
+          anExitCode = StatusError;
+        }
+      }
+      else if(!BinaryLogger::Decode(anInput, std::cout))
+      {
+        // Write the text log to the console
+        std::cerr << "DecodeLog() " << argv[0] << " is not a valid binary log" << std::endl;
+        anExitCode = StatusError;
+      }
+    }
+
+    // Return anExitCode determined above
+    return anExitCode;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
@@ -0,0 +1,164 @@
+/**
+ * Provides the bake-textures command of the Time-Voyager-Tools console
+ * application which decodes image files into the texture cache ahead of
+ * time.
+ *
+ * @file src/GQE/Tools/TextureBaker.cpp
+ * @author Ryan Lindeman
+ * @date 20130820 - Initial Release
+ */
+
+#include <cctype>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include <TVTools/ToolCommands.hpp>
+#include <TVSource/Utils/MappedFile.hpp>
+#include <TVSource/Utils/TextureCache.hpp>
+
+namespace GQE
+{
+  /**
+   * IsImageFile will return true if theFilename provided has the extension
+   * of an image format decoded by SFML.
+   * @param[in] theFilename to check
+   * @return true if theFilename is an image file, false otherwise
+   */
+  static bool IsImageFile(const std::string& theFilename)
+  {
+    static const char* const gExtensions[] =
+    {
+      ".bmp", ".gif", ".hdr", ".jpeg", ".jpg", ".pic", ".png", ".psd", ".tga"
+    };
+
+    // Compare the extension of theFilename in lower case
+    std::string anExtension;
+    size_t anDot = theFilename.find_last_of('.');
+    if(std::string::npos != anDot)
+    {
+      anExtension = theFilename.substr(anDot);
+      for(size_t iloop = 0; iloop < anExtension.length(); iloop++)
+      {
+        anExtension[iloop] = (char)tolower((unsigned char)anExtension[iloop]);
+      }
+    }
+
+    bool anResult = false;
+    const size_t anCount = sizeof(gExtensions) / sizeof(gExtensions[0]);
+    for(size_t iloop = 0; !anResult && iloop < anCount; iloop++)
+    {
+      anResult = (anExtension == gExtensions[iloop]);
+    }
+
+    // Return anResult of true if theFilename is an image file
+    return anResult;
+  }
+
+  int BakeTextures(int argc, char* argv[])
+  {
+    // Default anExitCode to a specific value
+    int anExitCode = StatusNoError;
+
+    if(argc < 2)
+    {
+      std::cerr << "usage: Time-Voyager-Tools bake-textures <cachedir> <input> [input...]" << std::endl;
+      anExitCode = StatusError;
+    }
+    else
+    {
+      // Collect every file of each input file or directory
+      std::vector<std::string> anFiles;
+      for(int iloop = 1; iloop < argc; iloop++)
+      {
+        if(!AddFiles(argv[iloop], anFiles))
+        {
+          std::cerr << "BakeTextures() unable to find " << argv[iloop] << std::endl;
+          anExitCode = StatusError;
+        }
+      }
+
+      TextureCache anCache;
+      anCache.SetDirectory(argv[0]);
+      if(!anCache.IsEnabled())
+      {
+        std::cerr << "BakeTextures() unable to create " << argv[0] << std::endl;
+        anExitCode = StatusError;
+      }
+
+      // Decode each image file that isn't cached or changed since it was
+      size_t anBaked = 0;
+      for(size_t iloop = 0; StatusNoError == anExitCode && iloop < anFiles.size(); iloop++)
+      {
+        MappedFile anSource;
+        MappedFile anCached;
+        const Uint8* anPixels = NULL;
+        Uint32 anWidth = 0;
+        Uint32 anHeight = 0;
+        sf::Image anImage;
+
+        if(!IsImageFile(anFiles[iloop]))
+        {
+          // Skip every other kind of file found in the directories
+        }
+        else if(!anSource.Open(anFiles[iloop]))
+        {
+          std::cerr << "BakeTextures() unable to read " << anFiles[iloop] << std::endl;
+          anExitCode = StatusError;
+        }
+        else if(anCache.Find(anFiles[iloop], anSource.GetData(), anSource.GetSize(),
+          anCached, anPixels, anWidth, anHeight))
+        {
+          // Already up to date
+        }
+        else if(!anImage.loadFromMemory(anSource.GetData(), anSource.GetSize()))
+        {
+          std::cerr << "BakeTextures() unable to decode " << anFiles[iloop] << std::endl;
+          anExitCode = StatusError;
+        }
+        else if(anCache.Store(anFiles[iloop], anSource.GetData(), anSource.GetSize(),
+          anImage.getSize().x, anImage.getSize().y, anImage.getPixelsPtr()))
+        {
+          std::cout << anFiles[iloop] << " -> "
+            << anCache.GetCacheFilename(anFiles[iloop]) << std::endl;
+          anBaked++;
+        }
+        else
+        {
+          std::cerr << "BakeTextures() unable to write "
+            << anCache.GetCacheFilename(anFiles[iloop]) << std::endl;
+          anExitCode = StatusError;
+        }
+      }
+
+      if(StatusNoError == anExitCode)
+      {
+        std::cout << anBaked << " textures -> " << argv[0] << std::endl;
+      }
+    }
+
+    // Return anExitCode determined above
+    return anExitCode;
+  }
+} // namespace GQE
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
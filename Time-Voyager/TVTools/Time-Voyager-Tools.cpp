@@ -0,0 +1,57 @@
+// Time-Voyager-Tools.cpp : Defines the entry point for the tools console application.
+//
+
+#include <cstring>
+#include <iostream>
+#include <TVTools/ToolCommands.hpp>
+#include <TVSource/Core/Core_Types.hpp>
+
+/// Provides each command of the tools console application
+struct typeToolCommand
+{
+  const char* name;                        ///< Name of the command
+  int (*function)(int argc, char* argv[]); ///< Function that runs the command
+  const char* usage;                       ///< Arguments of the command
+};
+
+/// The commands of the tools console application
+static const typeToolCommand gCommands[] =
+{
+  { "bake-textures", GQE::BakeTextures, "<cachedir> <input> [input...]" },
+  { "check-flight-dump", GQE::CheckFlightDump, "[dumpfile]" },
+  { "compile-config", GQE::CompileConfig, "<input> [input...]" },
+  { "decode-log", GQE::DecodeLog, "<input> [output]" },
+  { "pack-assets", GQE::PackAssets, "<output> <input> [input...]" },
+  { "serve-assets", GQE::ServeAssets, "<root> [port]" }
+};
+
+int main(int argc, char* argv[])
+{
+  // Default anExitCode to a specific value
+  int anExitCode = GQE::StatusError;
+
+  // Find the command requested and pass it the arguments that follow
+  bool anFound = false;
+  const int anCount = sizeof(gCommands) / sizeof(gCommands[0]);
+  for(int iloop = 0; argc > 1 && iloop < anCount && !anFound; iloop++)
+  {
+    if(strcmp(argv[1], gCommands[iloop].name) == 0)
+    {
+      anExitCode = gCommands[iloop].function(argc - 2, &argv[2]);
+      anFound = true;
+    }
+  }
+
+  if(!anFound)
+  {
+    std::cerr << "usage: Time-Voyager-Tools <command> [arguments]" << std::endl;
+    for(int iloop = 0; iloop < anCount; iloop++)
+    {
+      std::cerr << "  " << gCommands[iloop].name << " "
+        << gCommands[iloop].usage << std::endl;
+    }
+  }
+
+  // return our exit code
+  return anExitCode;
+}
@@ -0,0 +1,117 @@
+/**
+ * Provides the functions that implement each command of the
+ * Time-Voyager-Tools console application.
+ *
+ * @file include/GQE/Tools/ToolCommands.hpp
+ * @author Ryan Lindeman
+ * @date 20130810 - Initial Release
+ * @date 20130813 - Added CompileConfig
+ * @date 20130816 - Added PackAssets
+ * @date 20130820 - Added BakeTextures and AddFiles
+ * @date 20130824 - Added ServeAssets
+ * @date 20130826 - Added CheckFlightDump
+ */
+#ifndef   TOOLS_TOOL_COMMANDS_HPP_INCLUDED
+#define   TOOLS_TOOL_COMMANDS_HPP_INCLUDED
+
+#include <string>
+#include <vector>
+
+namespace GQE
+{
+  /**
+   * AddFiles will add theFilename provided to theFiles or, if theFilename
+   * is a directory, every file found in it and its subdirectories.
+   * @param[in] theFilename of the file or directory to add
+   * @param[out] theFiles to add each file found to
+   * @return true if theFilename was found, false otherwise
+   */
+  bool AddFiles(const std::string& theFilename, std::vector<std::string>& theFiles);
+
+  /**
+   * BakeTextures will decode each image file provided, and every image file
+   * found in each directory provided, into the texture cache directory used
+   * by the ImageHandler so the application never decodes them itself.
+   * usage: bake-textures <cachedir> <input> [input...]
+   * @param[in] argc number of arguments following the command name
+   * @param[in] argv arguments following the command name
+   * @return the exit code of the command (StatusNoError on success)
+   */
+  int BakeTextures(int argc, char* argv[]);
+
+  /**
+   * CheckFlightDump will log a text message through an AsyncLogger while a
+   * FlightRecorder is recording, write the dump as if its hotkey was pressed
+   * and make sure the message was written to the dump.
+   * usage: check-flight-dump [dumpfile]
+   * @param[in] argc number of arguments following the command name
+   * @param[in] argv arguments following the command name
+   * @return the exit code of the command (StatusNoError on success)
+   */
+  int CheckFlightDump(int argc, char* argv[]);
+
+  /**
+   * CompileConfig will compile each configuration file provided into a
+   * compiled configuration file next to it that is loaded by ConfigHandler.
+   * usage: compile-config <input> [input...]
+   * @param[in] argc number of arguments following the command name
+   * @param[in] argv arguments following the command name
+   * @return the exit code of the command (StatusNoError on success)
+   */
+  int CompileConfig(int argc, char* argv[]);
+
+  /**
+   * DecodeLog will decode the binary log written by the BinaryLogger class
+   * back into the text format of the FileLogger class.
+   * usage: decode-log <input> [output]
+   * @param[in] argc number of arguments following the command name
+   * @param[in] argv arguments following the command name
+   * @return the exit code of the command (StatusNoError on success)
+   */
+  int DecodeLog(int argc, char* argv[]);
+
+  /**
+   * PackAssets will store each file provided, and every file found in each
+   * directory provided, into a new asset pack loaded by the AssetManager.
+   * usage: pack-assets <output> <input> [input...]
+   * @param[in] argc number of arguments following the command name
+   * @param[in] argv arguments following the command name
+   * @return the exit code of the command (StatusNoError on success)
+   */
+  int PackAssets(int argc, char* argv[]);
+
+  /**
+   * ServeAssets will serve each file found in the root directory provided
+   * to the NetworkSource class over keep-alive HTTP connections until the
+   * command is stopped. The port is open on every interface but connections
+   * from other computers are refused.
+   * usage: serve-assets <root> [port]
+   * @param[in] argc number of arguments following the command name
+   * @param[in] argv arguments following the command name
+   * @return the exit code of the command (StatusNoError on success)
+   */
+  int ServeAssets(int argc, char* argv[]);
+} // namespace GQE
+
+#endif // TOOLS_TOOL_COMMANDS_HPP_INCLUDED
+
+/**
+ * Copyright (c) 2010-2013 Ryan Lindeman
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */